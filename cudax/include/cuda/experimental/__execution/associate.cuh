@@ -0,0 +1,212 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_ASSOCIATE
+#define __CUDAX_EXECUTION_ASSOCIATE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/__utility/exchange.h>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/get_completion_signatures.cuh>
+#include <cuda/experimental/__execution/lazy.cuh>
+#include <cuda/experimental/__execution/rcvr_ref.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+struct _CCCL_TYPE_VISIBILITY_DEFAULT associate_t
+{
+  _CUDAX_SEMI_PRIVATE :
+  template <class _Token, class _Sndr, class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+
+    // Takes over the association of the sender in __sndr, which is null if the sender
+    // could not be associated with the scope.
+    _CCCL_API explicit __opstate_t(_Token __token, __lazy<_Sndr>* __sndr, _Rcvr __rcvr)
+        : __token_{static_cast<_Token&&>(__token)}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {
+      if (__sndr != nullptr)
+      {
+        __opstate_.__construct_from(execution::connect, static_cast<_Sndr&&>(*__sndr->__get()), __rcvr_ref{__rcvr_});
+        __sndr->__destroy();
+        __associated_ = true;
+      }
+    }
+
+    _CCCL_IMMOVABLE(__opstate_t);
+
+    // The association ends with the operation, so a join of the scope also waits for the
+    // child operation to be destroyed.
+    _CCCL_API ~__opstate_t()
+    {
+      if (__associated_)
+      {
+        __opstate_.__destroy();
+        __token_.disassociate();
+      }
+    }
+
+    _CCCL_API void start() noexcept
+    {
+      if (__associated_)
+      {
+        execution::start(*__opstate_.__get());
+      }
+      else
+      {
+        execution::set_stopped(static_cast<_Rcvr&&>(__rcvr_));
+      }
+    }
+
+    _Token __token_;
+    _Rcvr __rcvr_;
+    bool __associated_ = false;
+    __lazy<connect_result_t<_Sndr, __rcvr_ref<_Rcvr>>> __opstate_;
+  };
+
+public:
+  template <class _Token, class _Sndr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t;
+
+  template <class _Token>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __closure_t;
+
+  /// @brief Associates a sender with an async scope through one of the scope's tokens.
+  /// The association is made here, and ends when the operation state of the returned
+  /// sender is destroyed, or with the sender if it is never connected. If the
+  /// association fails, for instance because the scope is closed, the sender is
+  /// destroyed and the returned sender completes with `set_stopped()`. Neither the
+  /// sender nor its operation state allocates.
+  template <class _Sndr, class _Token>
+  [[nodiscard]] _CCCL_API auto operator()(_Sndr __sndr, _Token __token) const
+  {
+    using __wrapped_t _CCCL_NODEBUG_ALIAS = decay_t<decltype(__token.wrap(static_cast<_Sndr&&>(__sndr)))>;
+    return __sndr_t<_Token, __wrapped_t>{__token, __token.wrap(static_cast<_Sndr&&>(__sndr))};
+  }
+
+  /// @brief Returns a closure that can be used with the pipe operator to associate a
+  /// sender with an async scope.
+  template <class _Token>
+  [[nodiscard]] _CCCL_API constexpr auto operator()(_Token __token) const noexcept -> __closure_t<_Token>
+  {
+    return __closure_t<_Token>{static_cast<_Token&&>(__token)};
+  }
+};
+
+template <class _Token, class _Sndr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT associate_t::__sndr_t
+{
+  using sender_concept = sender_t;
+
+  _CCCL_API explicit __sndr_t(_Token __token, _Sndr&& __sndr)
+      : __token_{static_cast<_Token&&>(__token)}
+  {
+    if (__token_.try_associate())
+    {
+      __sndr_.__construct(static_cast<_Sndr&&>(__sndr));
+      __associated_ = true;
+    }
+  }
+
+  _CCCL_API __sndr_t(__sndr_t&& __other) noexcept(__nothrow_movable<_Sndr>)
+      : __token_{__other.__token_}
+      , __associated_{__other.__associated_}
+  {
+    if (__associated_)
+    {
+      __sndr_.__construct(static_cast<_Sndr&&>(*__other.__sndr_.__get()));
+      __other.__sndr_.__destroy();
+      __other.__associated_ = false;
+    }
+  }
+
+  _CCCL_API ~__sndr_t()
+  {
+    if (__associated_)
+    {
+      __sndr_.__destroy();
+      __token_.disassociate();
+    }
+  }
+
+  template <class _Self, class... _Env>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures()
+  {
+    _CUDAX_LET_COMPLETIONS(auto(__child_completions) = get_child_completion_signatures<_Self, _Sndr, _Env...>())
+    {
+      return __child_completions + completion_signatures<set_stopped_t()>{};
+    }
+
+    _CCCL_UNREACHABLE();
+  }
+
+  /// @brief Moves the sender and its association into the operation state.
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) && -> __opstate_t<_Token, _Sndr, _Rcvr>
+  {
+    __lazy<_Sndr>* __sndr = ::cuda::std::exchange(__associated_, false) ? &__sndr_ : nullptr;
+    return __opstate_t<_Token, _Sndr, _Rcvr>{__token_, __sndr, static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  [[nodiscard]] _CCCL_API constexpr auto get_env() const noexcept -> env<>
+  {
+    return {};
+  }
+
+private:
+  _Token __token_;
+  bool __associated_ = false;
+  __lazy<_Sndr> __sndr_;
+};
+
+template <class _Token>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT associate_t::__closure_t
+{
+  template <class _Sndr>
+  [[nodiscard]] _CCCL_API auto operator()(_Sndr __sndr) const
+  {
+    return associate_t{}(static_cast<_Sndr&&>(__sndr), __token_);
+  }
+
+  template <class _Sndr>
+  [[nodiscard]] _CCCL_API friend auto operator|(_Sndr __sndr, const __closure_t& __self)
+  {
+    return associate_t{}(static_cast<_Sndr&&>(__sndr), __self.__token_);
+  }
+
+  _Token __token_;
+};
+
+_CCCL_GLOBAL_CONSTANT associate_t associate{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_ASSOCIATE
@@ -21,6 +21,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__chrono/duration.h>
 #include <cuda/std/atomic>
 
 #include <cuda/experimental/__execution/intrusive_queue.cuh>
@@ -60,12 +61,25 @@ public:
     return true;
   }
 
+  [[nodiscard]] _CCCL_API auto empty() const noexcept -> bool
+  {
+    return __head_.load(::cuda::std::memory_order_relaxed) == nullptr;
+  }
+
   _CCCL_API void wait_for_item() noexcept
   {
     // Wait until the queue has an item in it:
     __head_.wait(nullptr);
   }
 
+  // Waits until the queue has an item in it or __rel_time has elapsed. Returns false on
+  // timeout. On Linux hosts, this sleeps until push notifies the queue or the deadline
+  // passes.
+  _CCCL_API auto wait_for_item_for(::cuda::std::chrono::nanoseconds __rel_time) noexcept -> bool
+  {
+    return __head_.__wait_for(nullptr, __rel_time);
+  }
+
   [[nodiscard]]
   _CCCL_API auto pop_all() noexcept -> __intrusive_queue<_NextPtr>
   {
@@ -0,0 +1,511 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_COUNTING_SCOPE
+#define __CUDAX_EXECUTION_COUNTING_SCOPE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__exception/terminate.h>
+#include <cuda/std/__functional/reference_wrapper.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/get_completion_signatures.cuh>
+#include <cuda/experimental/__execution/lazy.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+/// @brief An async scope that counts the senders associated with it, so that they can be
+/// joined. A sender is associated with the scope through one of its tokens, either by
+/// `associate`, which wraps the sender without allocating, or by `spawn` and
+/// `spawn_future`, which start it eagerly. `join()` returns a sender that completes
+/// once the last association ends; the scope must not be destroyed before that sender
+/// completes, unless nothing was ever associated with it.
+///
+/// The count, the closed state and the join state share one atomic word, and the
+/// operations of pending `join` senders form an intrusive list, so neither associating
+/// nor joining allocates.
+///
+/// Unlike P3149, the scope may be given a limit on the number of its associations.
+/// Associations beyond the limit fail, exactly as they do once the scope is closed,
+/// which gives producers backpressure: `associate` senders complete with
+/// `set_stopped`, `spawn` drops the sender and `spawn_future` senders complete with
+/// `set_stopped`.
+class _CCCL_TYPE_VISIBILITY_DEFAULT simple_counting_scope : __immovable
+{
+  static constexpr size_t __closed  = 1; // close() was called
+  static constexpr size_t __joining = 2; // a join sender was started
+  static constexpr size_t __used    = 4; // a sender was ever associated
+  static constexpr size_t __one     = 8; // one association
+
+  [[nodiscard]] _CCCL_API static constexpr auto __count(size_t __state) noexcept -> size_t
+  {
+    return __state / __one;
+  }
+
+  // The operation state of a started join sender.
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __join_opstate_base_t : __immovable
+  {
+    using __complete_fn_t _CCCL_NODEBUG_ALIAS = void(__join_opstate_base_t*) noexcept;
+
+    _CCCL_API explicit __join_opstate_base_t(simple_counting_scope* __scope, __complete_fn_t* __complete_fn) noexcept
+        : __scope_{__scope}
+        , __complete_fn_{__complete_fn}
+    {}
+
+    simple_counting_scope* __scope_;
+    __complete_fn_t* __complete_fn_;
+    __join_opstate_base_t* __next_ = nullptr;
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __join_opstate_t : __join_opstate_base_t
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_API explicit __join_opstate_t(simple_counting_scope* __scope, _Rcvr __rcvr) noexcept
+        : __join_opstate_base_t{__scope, &__complete}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_API void start() noexcept
+    {
+      __scope_->__start_join(this);
+    }
+
+    _CCCL_API static void __complete(__join_opstate_base_t* __base) noexcept
+    {
+      execution::set_value(static_cast<_Rcvr&&>(static_cast<__join_opstate_t*>(__base)->__rcvr_));
+    }
+
+    _Rcvr __rcvr_;
+  };
+
+  // Completes the pending join senders. Called once, by whoever brings the scope to the
+  // joined state.
+  _CCCL_API void __finish_join() noexcept
+  {
+    // A completed join sender may destroy the scope, so no member of the scope may be
+    // used after the list is taken.
+    auto* __op = static_cast<__join_opstate_base_t*>(__joins_.exchange(this, ::cuda::std::memory_order_acq_rel));
+    while (__op != nullptr)
+    {
+      // take the next operation before completing this one, which may destroy it
+      auto* __next = __op->__next_;
+      __op->__complete_fn_(__op);
+      __op = __next;
+    }
+  }
+
+  _CCCL_API void __start_join(__join_opstate_base_t* __op) noexcept
+  {
+    const size_t __old = __state_.fetch_or(__joining, ::cuda::std::memory_order_acq_rel);
+    if (__count(__old) == 0 && !(__old & __joining))
+    {
+      // This join takes the scope to the joined state.
+      __finish_join();
+      __op->__complete_fn_(__op);
+      return;
+    }
+
+    // Wait for the last association to end, unless that happened in the meantime.
+    void* __head = __joins_.load(::cuda::std::memory_order_acquire);
+    do
+    {
+      if (__head == this)
+      {
+        __op->__complete_fn_(__op);
+        return;
+      }
+      __op->__next_ = static_cast<__join_opstate_base_t*>(__head);
+    } while (!__joins_.compare_exchange_weak(
+      __head, __op, ::cuda::std::memory_order_acq_rel, ::cuda::std::memory_order_acquire));
+  }
+
+public:
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __join_sndr_t;
+
+  /// @brief A handle to the scope that associates senders with it.
+  class _CCCL_TYPE_VISIBILITY_DEFAULT token
+  {
+  public:
+    /// @brief Returns the sender unchanged: a simple_counting_scope does not stop the
+    /// senders associated with it.
+    template <class _Sndr>
+    [[nodiscard]] _CCCL_API constexpr auto wrap(_Sndr&& __sndr) const noexcept -> _Sndr&&
+    {
+      return static_cast<_Sndr&&>(__sndr);
+    }
+
+    /// @brief Associates one more sender with the scope. Returns false if the scope is
+    /// closed, joined or at its limit of associations.
+    [[nodiscard]] _CCCL_API auto try_associate() const noexcept -> bool
+    {
+      return __scope_->__try_associate();
+    }
+
+    /// @brief Ends an association made by a successful call to try_associate().
+    _CCCL_API void disassociate() const noexcept
+    {
+      __scope_->__disassociate();
+    }
+
+  private:
+    friend class simple_counting_scope;
+
+    _CCCL_API explicit token(simple_counting_scope* __scope) noexcept
+        : __scope_{__scope}
+    {}
+
+    simple_counting_scope* __scope_;
+  };
+
+  /// @brief The largest number of senders that can be associated with a scope at once.
+  static constexpr size_t max_associations = (::cuda::std::numeric_limits<size_t>::max)() / __one;
+
+  _CCCL_HIDE_FROM_ABI simple_counting_scope() noexcept = default;
+
+  /// @brief Constructs a scope that allows at most `__max_associations` senders to be
+  /// associated with it at once.
+  _CCCL_API explicit simple_counting_scope(size_t __max_associations) noexcept
+      : __max_associations_{__max_associations < max_associations ? __max_associations : max_associations}
+  {}
+
+  /// @brief Terminates the program if senders are still associated with the scope, or if
+  /// senders were associated with it and it was not joined.
+  _CCCL_API ~simple_counting_scope()
+  {
+    const size_t __state = __state_.load(::cuda::std::memory_order_acquire);
+    if (__count(__state) != 0 || ((__state & __used) && !(__state & __joining)))
+    {
+      ::cuda::std::terminate();
+    }
+  }
+
+  [[nodiscard]] _CCCL_API auto get_token() noexcept -> token
+  {
+    return token{this};
+  }
+
+  /// @brief Makes all further associations fail. The senders already associated with the
+  /// scope are not affected.
+  _CCCL_API void close() noexcept
+  {
+    __state_.fetch_or(__closed, ::cuda::std::memory_order_acq_rel);
+  }
+
+  /// @brief Returns a sender that completes with `set_value()` once no sender is
+  /// associated with the scope, after which all associations fail. The sender completes
+  /// inline, either when it is started or on the thread that ends the last association.
+  [[nodiscard]] _CCCL_API auto join() noexcept -> __join_sndr_t;
+
+private:
+  [[nodiscard]] _CCCL_API auto __try_associate() noexcept -> bool
+  {
+    size_t __state = __state_.load(::cuda::std::memory_order_relaxed);
+    do
+    {
+      const bool __joined = (__state & __joining) && __count(__state) == 0;
+      if ((__state & __closed) || __joined || __count(__state) >= __max_associations_)
+      {
+        return false;
+      }
+    } while (!__state_.compare_exchange_weak(
+      __state, (__state + __one) | __used, ::cuda::std::memory_order_acquire, ::cuda::std::memory_order_relaxed));
+    return true;
+  }
+
+  _CCCL_API void __disassociate() noexcept
+  {
+    const size_t __old = __state_.fetch_sub(__one, ::cuda::std::memory_order_acq_rel);
+    _CCCL_ASSERT(__count(__old) != 0, "simple_counting_scope: disassociate without an association");
+    if (__count(__old) == 1 && (__old & __joining))
+    {
+      __finish_join();
+    }
+  }
+
+  size_t __max_associations_ = max_associations;
+  ::cuda::std::atomic<size_t> __state_{0};
+  // the pending join operations, or this scope once it is joined
+  ::cuda::std::atomic<void*> __joins_{nullptr};
+};
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT simple_counting_scope::__join_sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class _Self, class... _Env>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+  {
+    return completion_signatures<set_value_t()>{};
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept -> __join_opstate_t<_Rcvr>
+  {
+    return __join_opstate_t<_Rcvr>{__scope_, static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  simple_counting_scope* __scope_;
+};
+
+[[nodiscard]] _CCCL_API inline auto simple_counting_scope::join() noexcept -> __join_sndr_t
+{
+  return __join_sndr_t{this};
+}
+
+/// @brief A simple_counting_scope that can also request the senders associated with it
+/// to stop. Its tokens wrap senders so that their receivers' stop tokens are stopped when
+/// either the scope or the receiver of the wrapped sender requests a stop.
+class _CCCL_TYPE_VISIBILITY_DEFAULT counting_scope : __immovable
+{
+  // The sender returned by token::wrap.
+  template <class _Sndr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __stop_when_sndr_t;
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __stop_when_state_t
+  {
+    using __stop_token_t _CCCL_NODEBUG_ALIAS = stop_token_of_t<env_of_t<_Rcvr>>;
+    using __env_t _CCCL_NODEBUG_ALIAS =
+      env<prop<get_stop_token_t, inplace_stop_token>, __fwd_env_t<env_of_t<_Rcvr>>>;
+
+    _CCCL_API explicit __stop_when_state_t(inplace_stop_token __scope_token, _Rcvr __rcvr) noexcept
+        : __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+        , __scope_token_{static_cast<inplace_stop_token&&>(__scope_token)}
+    {}
+
+    [[nodiscard]] _CCCL_API auto __get_token() const noexcept -> inplace_stop_token
+    {
+      // If the receiver cannot be stopped, the child only needs the scope's token.
+      if constexpr (unstoppable_token<__stop_token_t>)
+      {
+        return __scope_token_;
+      }
+      else
+      {
+        return __stop_source_.get_token();
+      }
+    }
+
+    _CCCL_API void __start() noexcept
+    {
+      if constexpr (!unstoppable_token<__stop_token_t>)
+      {
+        __on_rcvr_stop_.__construct(get_stop_token(execution::get_env(__rcvr_)), __on_stop_request{__stop_source_});
+        __on_scope_stop_.__construct(__scope_token_, __on_stop_request{__stop_source_});
+      }
+    }
+
+    _CCCL_API void __complete() noexcept
+    {
+      if constexpr (!unstoppable_token<__stop_token_t>)
+      {
+        __on_rcvr_stop_.__destroy();
+        __on_scope_stop_.__destroy();
+      }
+    }
+
+    _Rcvr __rcvr_;
+    inplace_stop_token __scope_token_;
+    inplace_stop_source __stop_source_{};
+    __lazy<stop_callback_for_t<__stop_token_t, __on_stop_request>> __on_rcvr_stop_{};
+    __lazy<inplace_stop_callback<__on_stop_request>> __on_scope_stop_{};
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __stop_when_rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _As>
+    _CCCL_API void set_value(_As&&... __as) noexcept
+    {
+      __state_->__complete();
+      execution::set_value(static_cast<_Rcvr&&>(__state_->__rcvr_), static_cast<_As&&>(__as)...);
+    }
+
+    template <class _Error>
+    _CCCL_API void set_error(_Error&& __err) noexcept
+    {
+      __state_->__complete();
+      execution::set_error(static_cast<_Rcvr&&>(__state_->__rcvr_), static_cast<_Error&&>(__err));
+    }
+
+    _CCCL_API void set_stopped() noexcept
+    {
+      __state_->__complete();
+      execution::set_stopped(static_cast<_Rcvr&&>(__state_->__rcvr_));
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> typename __stop_when_state_t<_Rcvr>::__env_t
+    {
+      return {prop{get_stop_token, __state_->__get_token()}, __fwd_env(execution::get_env(__state_->__rcvr_))};
+    }
+
+    __stop_when_state_t<_Rcvr>* __state_;
+  };
+
+  template <class _Sndr, class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __stop_when_opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_API explicit __stop_when_opstate_t(_Sndr&& __sndr, inplace_stop_token __scope_token, _Rcvr __rcvr)
+        : __state_{static_cast<inplace_stop_token&&>(__scope_token), static_cast<_Rcvr&&>(__rcvr)}
+        , __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __stop_when_rcvr_t<_Rcvr>{&__state_}))
+    {}
+
+    _CCCL_IMMOVABLE(__stop_when_opstate_t);
+
+    _CCCL_API void start() noexcept
+    {
+      __state_.__start();
+      execution::start(__opstate_);
+    }
+
+    __stop_when_state_t<_Rcvr> __state_;
+    connect_result_t<_Sndr, __stop_when_rcvr_t<_Rcvr>> __opstate_;
+  };
+
+public:
+  /// @brief A handle to the scope that associates senders with it and wraps them so
+  /// that they are stopped by counting_scope::request_stop().
+  class _CCCL_TYPE_VISIBILITY_DEFAULT token
+  {
+  public:
+    template <class _Sndr>
+    [[nodiscard]] _CCCL_API auto wrap(_Sndr&& __sndr) const -> __stop_when_sndr_t<decay_t<_Sndr>>
+    {
+      return {static_cast<_Sndr&&>(__sndr), __scope_->__stop_source_.get_token()};
+    }
+
+    /// @brief Associates one more sender with the scope. Returns false if the scope is
+    /// closed, joined or at its limit of associations.
+    [[nodiscard]] _CCCL_API auto try_associate() const noexcept -> bool
+    {
+      return __scope_->__scope_.get_token().try_associate();
+    }
+
+    /// @brief Ends an association made by a successful call to try_associate().
+    _CCCL_API void disassociate() const noexcept
+    {
+      __scope_->__scope_.get_token().disassociate();
+    }
+
+  private:
+    friend class counting_scope;
+
+    _CCCL_API explicit token(counting_scope* __scope) noexcept
+        : __scope_{__scope}
+    {}
+
+    counting_scope* __scope_;
+  };
+
+  static constexpr size_t max_associations = simple_counting_scope::max_associations;
+
+  _CCCL_HIDE_FROM_ABI counting_scope() noexcept = default;
+
+  /// @brief Constructs a scope that allows at most `__max_associations` senders to be
+  /// associated with it at once.
+  _CCCL_API explicit counting_scope(size_t __max_associations) noexcept
+      : __scope_{__max_associations}
+  {}
+
+  [[nodiscard]] _CCCL_API auto get_token() noexcept -> token
+  {
+    return token{this};
+  }
+
+  /// @brief Makes all further associations fail.
+  _CCCL_API void close() noexcept
+  {
+    __scope_.close();
+  }
+
+  /// @brief Requests the senders associated with the scope through token::wrap to stop.
+  _CCCL_API void request_stop() noexcept
+  {
+    __stop_source_.request_stop();
+  }
+
+  /// @brief Returns a sender that completes with `set_value()` once no sender is
+  /// associated with the scope. See simple_counting_scope::join().
+  [[nodiscard]] _CCCL_API auto join() noexcept -> simple_counting_scope::__join_sndr_t
+  {
+    return __scope_.join();
+  }
+
+private:
+  simple_counting_scope __scope_{};
+  inplace_stop_source __stop_source_{};
+};
+
+template <class _Sndr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT counting_scope::__stop_when_sndr_t
+{
+  using sender_concept = sender_t;
+
+  template <class _Env>
+  using __child_env_t _CCCL_NODEBUG_ALIAS = env<prop<get_stop_token_t, inplace_stop_token>, __fwd_env_t<_Env>>;
+
+  template <class _Self, class... _Env>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures()
+  {
+    return execution::get_completion_signatures<::cuda::std::__copy_cvref_t<_Self, _Sndr>, __child_env_t<_Env>...>();
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) && -> __stop_when_opstate_t<_Sndr, _Rcvr>
+  {
+    return __stop_when_opstate_t<_Sndr, _Rcvr>{
+      static_cast<_Sndr&&>(__sndr_), static_cast<inplace_stop_token&&>(__token_), static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const& -> __stop_when_opstate_t<const _Sndr&, _Rcvr>
+  {
+    return __stop_when_opstate_t<const _Sndr&, _Rcvr>{__sndr_, __token_, static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __fwd_env_t<env_of_t<_Sndr>>
+  {
+    return __fwd_env(execution::get_env(__sndr_));
+  }
+
+  _Sndr __sndr_;
+  inplace_stop_token __token_;
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_COUNTING_SCOPE
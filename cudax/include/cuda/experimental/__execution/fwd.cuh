@@ -160,6 +160,9 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT set_stopped_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT start_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT connect_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT schedule_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT now_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT schedule_after_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT schedule_at_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT transform_sender_t;
 
 template <class _Sch>
@@ -206,10 +209,17 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT schedule_from_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT bulk_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT bulk_chunked_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT bulk_unchunked_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT associate_t;
 
 // sender consumer algorithms:
 struct _CCCL_TYPE_VISIBILITY_DEFAULT sync_wait_t;
 struct _CCCL_TYPE_VISIBILITY_DEFAULT start_detached_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT spawn_t;
+struct _CCCL_TYPE_VISIBILITY_DEFAULT spawn_future_t;
+
+// async scopes:
+class _CCCL_TYPE_VISIBILITY_DEFAULT simple_counting_scope;
+class _CCCL_TYPE_VISIBILITY_DEFAULT counting_scope;
 
 // queries:
 struct _CCCL_TYPE_VISIBILITY_DEFAULT get_allocator_t;
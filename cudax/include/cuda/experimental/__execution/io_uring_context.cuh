@@ -0,0 +1,1080 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_IO_URING_CONTEXT
+#define __CUDAX_EXECUTION_IO_URING_CONTEXT
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
+
+#  include <cuda/__utility/immovable.h>
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__utility/exchange.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+#  include <cuda/std/span>
+
+#  include <cuda/experimental/__detail/utility.cuh>
+#  include <cuda/experimental/__execution/atomic_intrusive_queue.cuh>
+#  include <cuda/experimental/__execution/completion_signatures.cuh>
+#  include <cuda/experimental/__execution/env.cuh>
+#  include <cuda/experimental/__execution/fwd.cuh>
+#  include <cuda/experimental/__execution/intrusive_queue.cuh>
+#  include <cuda/experimental/__execution/lazy.cuh>
+#  include <cuda/experimental/__execution/queries.cuh>
+#  include <cuda/experimental/__execution/stop_token.cuh>
+#  include <cuda/experimental/__execution/utility.cuh>
+
+#  include <cerrno>
+#  include <cstddef>
+#  include <system_error>
+#  include <vector>
+
+#  include <linux/io_uring.h>
+#  include <sys/eventfd.h>
+#  include <sys/mman.h>
+#  include <sys/socket.h>
+#  include <sys/syscall.h>
+#  include <sys/types.h>
+#  include <sys/uio.h>
+#  include <unistd.h>
+
+#  include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+// The submission and completion queues of an io_uring instance, mapped into this process.
+// See io_uring(7). The kernel consumes the submission queue only when it is entered, so the
+// number of entries between its head and our tail is the number of pending submissions.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __io_uring : __immovable
+{
+public:
+  _CCCL_HOST_API explicit __io_uring(unsigned __entries)
+  {
+    ::io_uring_params __params{};
+    __fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, __entries, &__params));
+    if (__fd_ < 0)
+    {
+      throw ::std::system_error(errno, ::std::system_category(), "io_uring_setup");
+    }
+
+    __sq_ring_size_ = __params.sq_off.array + __params.sq_entries * sizeof(unsigned);
+    __cq_ring_size_ = __params.cq_off.cqes + __params.cq_entries * sizeof(::io_uring_cqe);
+    __sqes_size_    = __params.sq_entries * sizeof(::io_uring_sqe);
+    __single_mmap_  = (__params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (__single_mmap_)
+    {
+      __sq_ring_size_ = __cq_ring_size_ = (::cuda::std::max) (__sq_ring_size_, __cq_ring_size_);
+    }
+
+    __sq_ring_ = __map(__sq_ring_size_, IORING_OFF_SQ_RING);
+    __cq_ring_ = __single_mmap_ ? __sq_ring_ : __map(__cq_ring_size_, IORING_OFF_CQ_RING);
+    __sqes_    = static_cast<::io_uring_sqe*>(__map(__sqes_size_, IORING_OFF_SQES));
+
+    auto* __sq       = static_cast<char*>(__sq_ring_);
+    auto* __cq       = static_cast<char*>(__cq_ring_);
+    __sq_head_       = reinterpret_cast<unsigned*>(__sq + __params.sq_off.head);
+    __sq_tail_       = reinterpret_cast<unsigned*>(__sq + __params.sq_off.tail);
+    __sq_mask_       = *reinterpret_cast<unsigned*>(__sq + __params.sq_off.ring_mask);
+    __sq_entries_    = __params.sq_entries;
+    __cq_head_       = reinterpret_cast<unsigned*>(__cq + __params.cq_off.head);
+    __cq_tail_       = reinterpret_cast<unsigned*>(__cq + __params.cq_off.tail);
+    __cq_mask_       = *reinterpret_cast<unsigned*>(__cq + __params.cq_off.ring_mask);
+    __cqes_          = reinterpret_cast<::io_uring_cqe*>(__cq + __params.cq_off.cqes);
+    __sq_local_tail_ = *__sq_tail_;
+
+    // Entry i of the submission queue always refers to SQE i.
+    auto* __array = reinterpret_cast<unsigned*>(__sq + __params.sq_off.array);
+    for (unsigned __i = 0; __i < __sq_entries_; ++__i)
+    {
+      __array[__i] = __i;
+    }
+  }
+
+  _CCCL_HOST_API ~__io_uring()
+  {
+    __release();
+  }
+
+  // Returns a zeroed SQE to fill in, or null if the submission queue is full.
+  [[nodiscard]] _CCCL_HOST_API auto __get_sqe() noexcept -> ::io_uring_sqe*
+  {
+    const unsigned __head = ::cuda::std::atomic_ref<unsigned>{*__sq_head_}.load(::cuda::std::memory_order_acquire);
+    if (__sq_local_tail_ - __head == __sq_entries_)
+    {
+      return nullptr;
+    }
+    ::io_uring_sqe* __sqe = &__sqes_[__sq_local_tail_ & __sq_mask_];
+    ++__sq_local_tail_;
+    *__sqe = ::io_uring_sqe{};
+    return __sqe;
+  }
+
+  // Submits all the SQEs filled in since the last call in one system call, and waits for
+  // __wait_nr completions if it is not 0. Returns 0 or a negative error number.
+  _CCCL_HOST_API auto __submit(unsigned __wait_nr) noexcept -> int
+  {
+    const unsigned __head =
+      ::cuda::std::atomic_ref<unsigned>{*__sq_head_}.load(::cuda::std::memory_order_acquire);
+    const unsigned __to_submit = __sq_local_tail_ - __head;
+    if (__to_submit == 0 && __wait_nr == 0)
+    {
+      return 0;
+    }
+
+    ::cuda::std::atomic_ref<unsigned>{*__sq_tail_}.store(__sq_local_tail_, ::cuda::std::memory_order_release);
+    const unsigned __flags = __wait_nr != 0 ? IORING_ENTER_GETEVENTS : 0u;
+    if (::syscall(__NR_io_uring_enter, __fd_, __to_submit, __wait_nr, __flags, nullptr, 0) < 0)
+    {
+      return -errno;
+    }
+    return 0;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __cq_empty() const noexcept -> bool
+  {
+    return *__cq_head_ == ::cuda::std::atomic_ref<unsigned>{*__cq_tail_}.load(::cuda::std::memory_order_acquire);
+  }
+
+  // Calls __fn(user_data, res) for every completion in the completion queue, and then
+  // releases their entries to the kernel all at once.
+  template <class _Fn>
+  _CCCL_HOST_API void __reap(_Fn&& __fn) noexcept
+  {
+    unsigned __head       = *__cq_head_;
+    const unsigned __tail = ::cuda::std::atomic_ref<unsigned>{*__cq_tail_}.load(::cuda::std::memory_order_acquire);
+    for (; __head != __tail; ++__head)
+    {
+      const ::io_uring_cqe& __cqe = __cqes_[__head & __cq_mask_];
+      __fn(__cqe.user_data, __cqe.res);
+    }
+    ::cuda::std::atomic_ref<unsigned>{*__cq_head_}.store(__head, ::cuda::std::memory_order_release);
+  }
+
+  // Returns 0 or a negative error number.
+  _CCCL_HOST_API auto __register_buffers(const ::iovec* __buffers, unsigned __count) noexcept -> int
+  {
+    if (::syscall(__NR_io_uring_register, __fd_, IORING_REGISTER_BUFFERS, __buffers, __count) < 0)
+    {
+      return -errno;
+    }
+    return 0;
+  }
+
+  _CCCL_HOST_API void __unregister_buffers() noexcept
+  {
+    (void) ::syscall(__NR_io_uring_register, __fd_, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+  }
+
+private:
+  _CCCL_HOST_API auto __map(::cuda::std::size_t __size, ::off_t __offset) -> void*
+  {
+    void* __ptr = ::mmap(nullptr, __size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, __fd_, __offset);
+    if (__ptr == MAP_FAILED)
+    {
+      const int __err = errno;
+      __release();
+      throw ::std::system_error(__err, ::std::system_category(), "io_uring mmap");
+    }
+    return __ptr;
+  }
+
+  _CCCL_HOST_API void __release() noexcept
+  {
+    if (__sqes_ != nullptr)
+    {
+      ::munmap(__sqes_, __sqes_size_);
+    }
+    if (__cq_ring_ != nullptr && __cq_ring_ != __sq_ring_)
+    {
+      ::munmap(__cq_ring_, __cq_ring_size_);
+    }
+    if (__sq_ring_ != nullptr)
+    {
+      ::munmap(__sq_ring_, __sq_ring_size_);
+    }
+    if (__fd_ >= 0)
+    {
+      ::close(__fd_);
+    }
+    __sqes_    = nullptr;
+    __cq_ring_ = __sq_ring_ = nullptr;
+    __fd_      = -1;
+  }
+
+  int __fd_                           = -1;
+  bool __single_mmap_                 = false;
+  void* __sq_ring_                    = nullptr;
+  void* __cq_ring_                    = nullptr;
+  ::io_uring_sqe* __sqes_             = nullptr;
+  ::cuda::std::size_t __sq_ring_size_ = 0;
+  ::cuda::std::size_t __cq_ring_size_ = 0;
+  ::cuda::std::size_t __sqes_size_    = 0;
+
+  unsigned* __sq_head_      = nullptr;
+  unsigned* __sq_tail_      = nullptr;
+  unsigned __sq_mask_       = 0;
+  unsigned __sq_entries_    = 0;
+  unsigned __sq_local_tail_ = 0;
+
+  unsigned* __cq_head_     = nullptr;
+  unsigned* __cq_tail_     = nullptr;
+  unsigned __cq_mask_      = 0;
+  ::io_uring_cqe* __cqes_  = nullptr;
+};
+
+/// @brief An execution context that performs file and socket I/O with Linux's io_uring
+/// interface, and completes the I/O operations on the thread that calls `run()`.
+///
+/// The context's scheduler provides the senders of `async_read_some`, `async_read`,
+/// `async_write` and `async_accept`. The loop submits all the operations started during
+/// one of its iterations with a single system call, which also waits for completions when
+/// there is nothing else to do, and processes all the completions that are ready in one
+/// pass. Reads and writes whose buffer lies within a buffer registered with
+/// `register_buffers` use the fixed-buffer operations of io_uring, so that the kernel does
+/// not map the buffer's pages for every operation.
+///
+/// Operations may be started on any thread. The ones started on the thread that runs the
+/// context are submitted without a round trip through its queue.
+class _CCCL_TYPE_VISIBILITY_DEFAULT io_uring_context : __immovable
+{
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __task : __immovable
+  {
+    using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__task*) noexcept;
+
+    _CCCL_HIDE_FROM_ABI __task() = default;
+    _CCCL_HOST_API explicit __task(__execute_fn_t* __execute_fn) noexcept
+        : __execute_fn_(__execute_fn)
+    {}
+
+    _CCCL_HOST_API void __execute() noexcept
+    {
+      (*__execute_fn_)(this);
+    }
+
+    __execute_fn_t* __execute_fn_ = nullptr;
+    __task* __next_               = nullptr;
+  };
+
+  template <class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __schedule_opstate_t : __task
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_HOST_API explicit __schedule_opstate_t(io_uring_context* __ctx, _Rcvr __rcvr) noexcept
+        : __task{&__execute_impl}
+        , __ctx_{__ctx}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_HOST_API void start() noexcept
+    {
+      __ctx_->__push(this);
+    }
+
+    _CCCL_HOST_API static void __execute_impl(__task* __p) noexcept
+    {
+      auto& __rcvr = static_cast<__schedule_opstate_t*>(__p)->__rcvr_;
+      if (get_stop_token(get_env(__rcvr)).stop_requested())
+      {
+        set_stopped(static_cast<_Rcvr&&>(__rcvr));
+      }
+      else
+      {
+        set_value(static_cast<_Rcvr&&>(__rcvr));
+      }
+    }
+
+    io_uring_context* __ctx_;
+    _Rcvr __rcvr_;
+  };
+
+  // An I/O operation. Its task starts the operation on the context's thread, and runs
+  // again whenever the operation waits for a free submission queue entry. A stop request
+  // pushes its __cancel_ task, which submits an IORING_OP_ASYNC_CANCEL for it. When the
+  // operation completes before that task has run, its completion is deferred to the task,
+  // so that the task never outlives the operation.
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __io_op_base : __task
+  {
+    using __prep_fn_t _CCCL_NODEBUG_ALIAS = void(__io_op_base*, ::io_uring_sqe*) noexcept;
+    // Returns true once the operation is done, and false if it has more I/O to submit.
+    using __result_fn_t _CCCL_NODEBUG_ALIAS = bool(__io_op_base*, int) noexcept;
+    using __complete_fn_t _CCCL_NODEBUG_ALIAS = void(__io_op_base*) noexcept;
+
+    struct __cancel_task_t : __task
+    {
+      _CCCL_HOST_API explicit __cancel_task_t(__io_op_base* __op) noexcept
+          : __task{&__cancel_impl}
+          , __op_{__op}
+      {}
+
+      __io_op_base* __op_;
+    };
+
+    _CCCL_HOST_API explicit __io_op_base(io_uring_context* __ctx,
+                                         __execute_fn_t* __start_fn,
+                                         __prep_fn_t* __prep_fn,
+                                         __result_fn_t* __result_fn,
+                                         __complete_fn_t* __unregister_fn,
+                                         __complete_fn_t* __complete_fn) noexcept
+        : __task{__start_fn}
+        , __ctx_{__ctx}
+        , __prep_fn_{__prep_fn}
+        , __result_fn_{__result_fn}
+        , __unregister_fn_{__unregister_fn}
+        , __complete_fn_{__complete_fn}
+        , __cancel_{this}
+    {}
+
+    // Called from the stop callback, on any thread.
+    _CCCL_HOST_API void __request_cancel() noexcept
+    {
+      if (!__cancel_requested_.exchange(true, ::cuda::std::memory_order_acq_rel))
+      {
+        __ctx_->__push(&__cancel_);
+      }
+    }
+
+    _CCCL_HOST_API static void __cancel_impl(__task* __p) noexcept
+    {
+      __io_op_base* __self = static_cast<__cancel_task_t*>(__p)->__op_;
+      if (__self->__completion_deferred_)
+      {
+        __self->__cancel_done_ = true;
+        __self->__complete_fn_(__self);
+        return;
+      }
+
+      ::io_uring_sqe* __sqe = __self->__ctx_->__get_sqe();
+      if (__sqe == nullptr)
+      {
+        __self->__ctx_->__waiting_.push_back(__p);
+        return;
+      }
+      // If the operation is not in flight, the cancellation finds nothing to cancel and
+      // the operation completes with set_stopped when it is submitted.
+      __sqe->opcode          = IORING_OP_ASYNC_CANCEL;
+      __sqe->fd              = -1;
+      __sqe->addr            = reinterpret_cast<::cuda::std::uintptr_t>(__self);
+      __sqe->user_data       = __ignore_tag;
+      __self->__cancel_done_ = true;
+    }
+
+    _CCCL_HOST_API static void __resubmit(__task* __p) noexcept
+    {
+      auto* __self = static_cast<__io_op_base*>(__p);
+      __self->__ctx_->__submit(__self);
+    }
+
+    io_uring_context* __ctx_;
+    __prep_fn_t* __prep_fn_;
+    __result_fn_t* __result_fn_;
+    __complete_fn_t* __unregister_fn_;
+    __complete_fn_t* __complete_fn_;
+    // 0, or the negative error number the operation failed with.
+    int __res_ = 0;
+    ::cuda::std::atomic<bool> __cancel_requested_{false};
+    // The remaining members are only touched from the context's thread.
+    bool __cancel_done_         = false;
+    bool __completion_deferred_ = false;
+    __cancel_task_t __cancel_;
+  };
+
+  template <class _Rcvr, class _Io>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __io_opstate_t : __io_op_base
+  {
+    using operation_state_concept = operation_state_t;
+    using __stop_token_t _CCCL_NODEBUG_ALIAS = stop_token_of_t<env_of_t<_Rcvr>>;
+
+    struct __on_stop_t
+    {
+      _CCCL_HOST_API void operator()() const noexcept
+      {
+        __self_->__request_cancel();
+      }
+
+      __io_op_base* __self_;
+    };
+
+    _CCCL_HOST_API explicit __io_opstate_t(io_uring_context* __ctx, _Io __io, _Rcvr __rcvr) noexcept
+        : __io_op_base{__ctx, &__start_impl, &__prep_impl, &__result_impl, &__unregister_impl, &__complete_impl}
+        , __io_{__io}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_HOST_API void start() noexcept
+    {
+      if (__current() == this->__ctx_)
+      {
+        __start_impl(this);
+      }
+      else
+      {
+        this->__ctx_->__push(this);
+      }
+    }
+
+    // Runs on the context's thread.
+    _CCCL_HOST_API static void __start_impl(__task* __p) noexcept
+    {
+      auto* __self = static_cast<__io_opstate_t*>(__p);
+      auto __token = get_stop_token(get_env(__self->__rcvr_));
+      if (__token.stop_requested())
+      {
+        set_stopped(static_cast<_Rcvr&&>(__self->__rcvr_));
+        return;
+      }
+
+      if constexpr (!unstoppable_token<__stop_token_t>)
+      {
+        __self->__on_stop_.__construct(__token, __on_stop_t{__self});
+      }
+      __self->__ctx_->__submit(__self);
+    }
+
+    _CCCL_HOST_API static void __prep_impl(__io_op_base* __base, ::io_uring_sqe* __sqe) noexcept
+    {
+      auto* __self = static_cast<__io_opstate_t*>(__base);
+      __self->__io_.__prep(*__self->__ctx_, __sqe);
+    }
+
+    _CCCL_HOST_API static auto __result_impl(__io_op_base* __base, int __res) noexcept -> bool
+    {
+      return static_cast<__io_opstate_t*>(__base)->__io_.__on_result(__res);
+    }
+
+    _CCCL_HOST_API static void __unregister_impl([[maybe_unused]] __io_op_base* __base) noexcept
+    {
+      if constexpr (!unstoppable_token<__stop_token_t>)
+      {
+        static_cast<__io_opstate_t*>(__base)->__on_stop_.__destroy();
+      }
+    }
+
+    _CCCL_HOST_API static void __complete_impl(__io_op_base* __base) noexcept
+    {
+      auto* __self = static_cast<__io_opstate_t*>(__base);
+      if (__self->__res_ == -ECANCELED)
+      {
+        set_stopped(static_cast<_Rcvr&&>(__self->__rcvr_));
+      }
+      else if (__self->__res_ < 0)
+      {
+        set_error(static_cast<_Rcvr&&>(__self->__rcvr_), ::std::error_code{-__self->__res_, ::std::system_category()});
+      }
+      else
+      {
+        set_value(static_cast<_Rcvr&&>(__self->__rcvr_), __self->__io_.__value());
+      }
+    }
+
+    _Io __io_;
+    _Rcvr __rcvr_;
+    __lazy<stop_callback_for_t<__stop_token_t, __on_stop_t>> __on_stop_{};
+  };
+
+  // The I/O operations. __prep fills in the SQE of the next request, and __on_result
+  // consumes its non-negative result, and returns true once the operation is done.
+  struct __read_some_t
+  {
+    using __value_t _CCCL_NODEBUG_ALIAS = ::cuda::std::size_t;
+
+    _CCCL_HOST_API void __prep(io_uring_context& __ctx, ::io_uring_sqe* __sqe) const noexcept
+    {
+      __ctx.__prep_rw(
+        __sqe, IORING_OP_READ, IORING_OP_READ_FIXED, __fd_, __buffer_.data(), __buffer_.size(), __offset_);
+    }
+
+    _CCCL_HOST_API auto __on_result(int __res) noexcept -> bool
+    {
+      __count_ = static_cast<::cuda::std::size_t>(__res);
+      return true;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __value() const noexcept -> __value_t
+    {
+      return __count_;
+    }
+
+    int __fd_;
+    ::cuda::std::span<::std::byte> __buffer_;
+    ::cuda::std::uint64_t __offset_;
+    ::cuda::std::size_t __count_ = 0;
+  };
+
+  // Reads or writes until the whole buffer is transferred, or a request transfers nothing.
+  template <class _Byte, ::cuda::std::uint8_t _Op, ::cuda::std::uint8_t _FixedOp>
+  struct __transfer_all_t
+  {
+    using __value_t _CCCL_NODEBUG_ALIAS = ::cuda::std::size_t;
+
+    _CCCL_HOST_API void __prep(io_uring_context& __ctx, ::io_uring_sqe* __sqe) const noexcept
+    {
+      const auto __offset = __offset_ == current_position ? __offset_ : __offset_ + __count_;
+      __ctx.__prep_rw(
+        __sqe, _Op, _FixedOp, __fd_, __buffer_.data() + __count_, __buffer_.size() - __count_, __offset);
+    }
+
+    _CCCL_HOST_API auto __on_result(int __res) noexcept -> bool
+    {
+      __count_ += static_cast<::cuda::std::size_t>(__res);
+      return __res == 0 || __count_ == __buffer_.size();
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __value() const noexcept -> __value_t
+    {
+      return __count_;
+    }
+
+    int __fd_;
+    ::cuda::std::span<_Byte> __buffer_;
+    ::cuda::std::uint64_t __offset_;
+    ::cuda::std::size_t __count_ = 0;
+  };
+
+  using __read_t _CCCL_NODEBUG_ALIAS  = __transfer_all_t<::std::byte, IORING_OP_READ, IORING_OP_READ_FIXED>;
+  using __write_t _CCCL_NODEBUG_ALIAS =
+    __transfer_all_t<const ::std::byte, IORING_OP_WRITE, IORING_OP_WRITE_FIXED>;
+
+  struct __accept_t
+  {
+    using __value_t _CCCL_NODEBUG_ALIAS = int;
+
+    _CCCL_HOST_API void __prep(io_uring_context&, ::io_uring_sqe* __sqe) const noexcept
+    {
+      __sqe->opcode       = IORING_OP_ACCEPT;
+      __sqe->fd           = __fd_;
+      __sqe->accept_flags = SOCK_CLOEXEC;
+    }
+
+    _CCCL_HOST_API auto __on_result(int __res) noexcept -> bool
+    {
+      __socket_ = __res;
+      return true;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __value() const noexcept -> __value_t
+    {
+      return __socket_;
+    }
+
+    int __fd_;
+    int __socket_ = -1;
+  };
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __attrs_t
+  {
+    template <class _Tag>
+    [[nodiscard]] _CCCL_HOST_API auto query(get_completion_scheduler_t<_Tag>) const noexcept;
+
+    [[nodiscard]] _CCCL_API constexpr auto query(get_completion_behavior_t) const noexcept
+    {
+      return completion_behavior::asynchronous;
+    }
+
+    io_uring_context* __ctx_;
+  };
+
+public:
+  /// @brief The offset to pass to read and write operations to use and advance the file's
+  /// current position instead of an explicit offset. Pipes and sockets need this offset.
+  static constexpr ::cuda::std::uint64_t current_position = ~::cuda::std::uint64_t{0};
+
+  /// @brief Creates an io_uring instance whose submission queue has room for `__entries`
+  /// requests, rounded up to a power of two.
+  /// @throws ::std::system_error if the kernel does not support io_uring, or denies it.
+  _CCCL_HOST_API explicit io_uring_context(unsigned __entries = 256)
+      : __ring_{__entries}
+      , __wake_fd_{::eventfd(0, EFD_CLOEXEC)}
+  {
+    if (__wake_fd_ < 0)
+    {
+      throw ::std::system_error(errno, ::std::system_category(), "eventfd");
+    }
+  }
+
+  _CCCL_HOST_API ~io_uring_context()
+  {
+    if (!__buffers_.empty())
+    {
+      __ring_.__unregister_buffers();
+    }
+    ::close(__wake_fd_);
+  }
+
+  /// @brief Runs the context on the calling thread until `finish()` has been called and
+  /// all the operations started before have completed.
+  _CCCL_HOST_API void run()
+  {
+    io_uring_context* const __prev = ::cuda::std::exchange(__current(), this);
+    while (true)
+    {
+      __execute_all();
+      __retry_waiting();
+      __ring_.__reap([this](::cuda::std::uint64_t __user_data, int __res) {
+        __on_completion(__user_data, __res);
+      });
+
+      if (__finishing_.load(::cuda::std::memory_order_acquire) && __in_flight_ == 0 && __waiting_.empty()
+          && __queue_.empty())
+      {
+        break;
+      }
+
+      // Submit the requests of this iteration. Block for a completion only if there is
+      // nothing else to do; a thread that pushes a task after the check below sees
+      // __sleeping_ and wakes the loop through __wake_fd_.
+      if (!__wakeup_armed_)
+      {
+        __arm_wakeup();
+      }
+      __sleeping_.store(true, ::cuda::std::memory_order_relaxed);
+      ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+      const bool __idle = __queue_.empty() && __waiting_.empty() && __ring_.__cq_empty()
+                       && !(__finishing_.load(::cuda::std::memory_order_relaxed) && __in_flight_ == 0);
+      (void) __ring_.__submit(__idle ? 1 : 0);
+      __sleeping_.store(false, ::cuda::std::memory_order_relaxed);
+    }
+    __current() = __prev;
+  }
+
+  /// @brief Makes `run()` return once the operations that are in flight have completed.
+  _CCCL_HOST_API void finish() noexcept
+  {
+    __finishing_.store(true, ::cuda::std::memory_order_release);
+    __wake();
+  }
+
+  /// @brief Registers buffers with the kernel, replacing the buffers registered before.
+  /// Reads and writes whose buffer lies within one of them use the fixed-buffer variants
+  /// of the operations. This must not be called while operations are in flight.
+  /// @throws ::std::system_error if the kernel rejects the buffers.
+  _CCCL_HOST_API void register_buffers(::cuda::std::span<const ::iovec> __buffers)
+  {
+    if (!__buffers_.empty())
+    {
+      __ring_.__unregister_buffers();
+      __buffers_.clear();
+    }
+    if (__buffers.empty())
+    {
+      return;
+    }
+    if (const int __err = __ring_.__register_buffers(__buffers.data(), static_cast<unsigned>(__buffers.size()));
+        __err != 0)
+    {
+      throw ::std::system_error(-__err, ::std::system_category(), "io_uring_register");
+    }
+    __buffers_.assign(__buffers.begin(), __buffers.end());
+  }
+
+  class _CCCL_TYPE_VISIBILITY_DEFAULT scheduler : __attrs_t
+  {
+  private:
+    friend io_uring_context;
+
+    _CCCL_HOST_API explicit scheduler(io_uring_context* __ctx) noexcept
+        : __attrs_t{__ctx}
+    {}
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t
+    {
+      using sender_concept = sender_t;
+
+      template <class _Rcvr>
+      [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) const noexcept -> __schedule_opstate_t<_Rcvr>
+      {
+        return __schedule_opstate_t<_Rcvr>{__ctx_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      template <class _Self>
+      [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_stopped_t()>{};
+      }
+
+      [[nodiscard]] _CCCL_HOST_API auto get_env() const noexcept -> __attrs_t
+      {
+        return __attrs_t{__ctx_};
+      }
+
+    private:
+      friend scheduler;
+      _CCCL_HOST_API explicit __sndr_t(io_uring_context* __ctx) noexcept
+          : __ctx_(__ctx)
+      {}
+
+      io_uring_context* __ctx_;
+    };
+
+    template <class _Io>
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __io_sndr_t
+    {
+      using sender_concept = sender_t;
+
+      template <class _Rcvr>
+      [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) const noexcept -> __io_opstate_t<_Rcvr, _Io>
+      {
+        return __io_opstate_t<_Rcvr, _Io>{__ctx_, __io_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      template <class _Self>
+      [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(typename _Io::__value_t),
+                                     set_error_t(::std::error_code),
+                                     set_stopped_t()>{};
+      }
+
+      [[nodiscard]] _CCCL_HOST_API auto get_env() const noexcept -> __attrs_t
+      {
+        return __attrs_t{__ctx_};
+      }
+
+    private:
+      friend scheduler;
+      _CCCL_HOST_API explicit __io_sndr_t(io_uring_context* __ctx, _Io __io) noexcept
+          : __ctx_(__ctx)
+          , __io_(__io)
+      {}
+
+      io_uring_context* __ctx_;
+      _Io __io_;
+    };
+
+    [[nodiscard]] _CCCL_HOST_API auto schedule() const noexcept -> __sndr_t
+    {
+      return __sndr_t{this->__ctx_};
+    }
+
+    /// @brief Returns a sender that reads at most `__buffer.size()` bytes from `__fd` at
+    /// `__offset`, and completes with the number of bytes read, which is 0 at the end of
+    /// the file.
+    [[nodiscard]] _CCCL_HOST_API auto async_read_some(
+      int __fd,
+      ::cuda::std::span<::std::byte> __buffer,
+      ::cuda::std::uint64_t __offset = current_position) const noexcept -> __io_sndr_t<__read_some_t>
+    {
+      return __io_sndr_t<__read_some_t>{this->__ctx_, __read_some_t{__fd, __buffer, __offset}};
+    }
+
+    /// @brief Returns a sender that reads from `__fd` at `__offset` until `__buffer` is
+    /// full or the end of the file is reached, and completes with the number of bytes read.
+    [[nodiscard]] _CCCL_HOST_API auto
+    async_read(int __fd,
+               ::cuda::std::span<::std::byte> __buffer,
+               ::cuda::std::uint64_t __offset = current_position) const noexcept -> __io_sndr_t<__read_t>
+    {
+      return __io_sndr_t<__read_t>{this->__ctx_, __read_t{__fd, __buffer, __offset}};
+    }
+
+    /// @brief Returns a sender that writes all of `__buffer` to `__fd` at `__offset`, and
+    /// completes with the number of bytes written, which is less than the size of the
+    /// buffer only if a write makes no progress.
+    [[nodiscard]] _CCCL_HOST_API auto
+    async_write(int __fd,
+                ::cuda::std::span<const ::std::byte> __buffer,
+                ::cuda::std::uint64_t __offset = current_position) const noexcept -> __io_sndr_t<__write_t>
+    {
+      return __io_sndr_t<__write_t>{this->__ctx_, __write_t{__fd, __buffer, __offset}};
+    }
+
+    /// @brief Returns a sender that accepts a connection on the listening socket `__fd`,
+    /// and completes with the file descriptor of the connected socket.
+    [[nodiscard]] _CCCL_HOST_API auto async_accept(int __fd) const noexcept -> __io_sndr_t<__accept_t>
+    {
+      return __io_sndr_t<__accept_t>{this->__ctx_, __accept_t{__fd}};
+    }
+
+    using __attrs_t::query;
+
+    [[nodiscard]] _CCCL_API constexpr auto query(get_forward_progress_guarantee_t) const noexcept
+      -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API friend bool operator==(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__ctx_ == __b.__ctx_;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API friend bool operator!=(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__ctx_ != __b.__ctx_;
+    }
+  };
+
+  [[nodiscard]] _CCCL_HOST_API auto get_scheduler() noexcept -> scheduler
+  {
+    return scheduler{this};
+  }
+
+private:
+  // The user data of the completions to ignore, and of the read of __wake_fd_. Operations
+  // are at least 8-byte aligned, so their addresses differ from both.
+  static constexpr ::cuda::std::uint64_t __ignore_tag = 0;
+  static constexpr ::cuda::std::uint64_t __wakeup_tag = 1;
+
+  // The largest number of bytes Linux transfers with one read or write.
+  static constexpr ::cuda::std::size_t __max_rw_count = 0x7ffff000;
+
+  // The context that runs on the current thread, if any.
+  [[nodiscard]] _CCCL_HOST_API static auto __current() noexcept -> io_uring_context*&
+  {
+    thread_local io_uring_context* __ctx = nullptr;
+    return __ctx;
+  }
+
+  // Pushes a task to run on the context's thread, from any thread.
+  _CCCL_HOST_API void __push(__task* __t) noexcept
+  {
+    if (__queue_.push(__t))
+    {
+      __wake();
+    }
+  }
+
+  _CCCL_HOST_API void __wake() noexcept
+  {
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    if (__sleeping_.load(::cuda::std::memory_order_relaxed))
+    {
+      (void) ::eventfd_write(__wake_fd_, 1);
+    }
+  }
+
+  // Returns a free SQE. If the submission queue is full, this submits it first.
+  [[nodiscard]] _CCCL_HOST_API auto __get_sqe() noexcept -> ::io_uring_sqe*
+  {
+    ::io_uring_sqe* __sqe = __ring_.__get_sqe();
+    if (__sqe == nullptr && __ring_.__submit(0) == 0)
+    {
+      __sqe = __ring_.__get_sqe();
+    }
+    return __sqe;
+  }
+
+  _CCCL_HOST_API void __arm_wakeup() noexcept
+  {
+    if (::io_uring_sqe* __sqe = __get_sqe())
+    {
+      __sqe->opcode    = IORING_OP_READ;
+      __sqe->fd        = __wake_fd_;
+      __sqe->addr      = reinterpret_cast<::cuda::std::uintptr_t>(&__wake_count_);
+      __sqe->len       = sizeof(__wake_count_);
+      __sqe->user_data = __wakeup_tag;
+      __wakeup_armed_  = true;
+    }
+  }
+
+  // Submits the next request of an operation, or completes it with set_stopped if a stop
+  // has been requested. If the submission queue is full, the operation waits for its turn.
+  _CCCL_HOST_API void __submit(__io_op_base* __op) noexcept
+  {
+    if (__op->__cancel_requested_.load(::cuda::std::memory_order_acquire))
+    {
+      __op->__res_ = -ECANCELED;
+      __complete(__op);
+      return;
+    }
+
+    ::io_uring_sqe* __sqe = __get_sqe();
+    if (__sqe == nullptr)
+    {
+      __op->__execute_fn_ = &__io_op_base::__resubmit;
+      __waiting_.push_back(__op);
+      return;
+    }
+    __op->__prep_fn_(__op, __sqe);
+    __sqe->user_data = reinterpret_cast<::cuda::std::uintptr_t>(__op);
+    ++__in_flight_;
+  }
+
+  _CCCL_HOST_API void __prep_rw(
+    ::io_uring_sqe* __sqe,
+    ::cuda::std::uint8_t __op,
+    ::cuda::std::uint8_t __fixed_op,
+    int __fd,
+    const void* __data,
+    ::cuda::std::size_t __size,
+    ::cuda::std::uint64_t __offset) const noexcept
+  {
+    __size            = (::cuda::std::min) (__size, __max_rw_count);
+    const int __index = __buffer_index(__data, __size);
+    __sqe->opcode     = __index < 0 ? __op : __fixed_op;
+    __sqe->fd         = __fd;
+    __sqe->off        = __offset;
+    __sqe->addr       = reinterpret_cast<::cuda::std::uintptr_t>(__data);
+    __sqe->len        = static_cast<::cuda::std::uint32_t>(__size);
+    if (__index >= 0)
+    {
+      __sqe->buf_index = static_cast<::cuda::std::uint16_t>(__index);
+    }
+  }
+
+  // The index of the registered buffer that contains [__data, __data + __size), or -1.
+  [[nodiscard]] _CCCL_HOST_API auto __buffer_index(const void* __data, ::cuda::std::size_t __size) const noexcept
+    -> int
+  {
+    const auto __first = reinterpret_cast<::cuda::std::uintptr_t>(__data);
+    for (::cuda::std::size_t __i = 0; __i < __buffers_.size(); ++__i)
+    {
+      const auto __base = reinterpret_cast<::cuda::std::uintptr_t>(__buffers_[__i].iov_base);
+      if (__first >= __base && __first + __size <= __base + __buffers_[__i].iov_len)
+      {
+        return static_cast<int>(__i);
+      }
+    }
+    return -1;
+  }
+
+  _CCCL_HOST_API void __on_completion(::cuda::std::uint64_t __user_data, int __res) noexcept
+  {
+    if (__user_data == __ignore_tag)
+    {
+      return;
+    }
+    if (__user_data == __wakeup_tag)
+    {
+      __wakeup_armed_ = false;
+      return;
+    }
+
+    auto* __op = reinterpret_cast<__io_op_base*>(static_cast<::cuda::std::uintptr_t>(__user_data));
+    --__in_flight_;
+    if (__res >= 0 && !__op->__result_fn_(__op, __res))
+    {
+      __submit(__op);
+      return;
+    }
+    __op->__res_ = (::cuda::std::min) (__res, 0);
+    __complete(__op);
+  }
+
+  _CCCL_HOST_API static void __complete(__io_op_base* __op) noexcept
+  {
+    // Once the stop callback is gone, no more cancellation can be requested.
+    __op->__unregister_fn_(__op);
+    if (__op->__cancel_requested_.load(::cuda::std::memory_order_acquire) && !__op->__cancel_done_)
+    {
+      __op->__completion_deferred_ = true;
+      return;
+    }
+    __op->__complete_fn_(__op);
+  }
+
+  _CCCL_HOST_API void __execute_all() noexcept
+  {
+    auto __queue = __queue_.pop_all();
+    for (auto __it = __queue.begin(); __it != __queue.end();)
+    {
+      // Take care to increment the iterator before executing the task, which may
+      // invalidate the current node.
+      auto __prev = __it++;
+      (*__prev)->__execute();
+    }
+    __queue.clear();
+  }
+
+  _CCCL_HOST_API void __retry_waiting() noexcept
+  {
+    auto __waiting = ::cuda::std::exchange(__waiting_, __intrusive_queue<&__task::__next_>{});
+    while (!__waiting.empty())
+    {
+      __waiting.pop_front()->__execute();
+    }
+  }
+
+  __io_uring __ring_;
+  int __wake_fd_;
+  ::cuda::std::atomic<bool> __finishing_{false};
+  ::cuda::std::atomic<bool> __sleeping_{false};
+  __atomic_intrusive_queue<&__task::__next_> __queue_{};
+  ::std::vector<::iovec> __buffers_;
+  // The remaining members are only touched from the thread that runs the context.
+  __intrusive_queue<&__task::__next_> __waiting_{};
+  ::cuda::std::size_t __in_flight_    = 0;
+  bool __wakeup_armed_                = false;
+  ::cuda::std::uint64_t __wake_count_ = 0;
+};
+
+template <class _Tag>
+_CCCL_HOST_API auto io_uring_context::__attrs_t::query(get_completion_scheduler_t<_Tag>) const noexcept
+{
+  return scheduler{__ctx_};
+}
+
+// The I/O algorithms. They call the member functions of the same name of their scheduler.
+struct async_read_some_t
+{
+  template <class _Sch, class... _Args>
+  _CCCL_HOST_API auto operator()(_Sch&& __sch, _Args&&... __args) const noexcept
+    -> decltype(static_cast<_Sch&&>(__sch).async_read_some(static_cast<_Args&&>(__args)...))
+  {
+    return static_cast<_Sch&&>(__sch).async_read_some(static_cast<_Args&&>(__args)...);
+  }
+};
+
+struct async_read_t
+{
+  template <class _Sch, class... _Args>
+  _CCCL_HOST_API auto operator()(_Sch&& __sch, _Args&&... __args) const noexcept
+    -> decltype(static_cast<_Sch&&>(__sch).async_read(static_cast<_Args&&>(__args)...))
+  {
+    return static_cast<_Sch&&>(__sch).async_read(static_cast<_Args&&>(__args)...);
+  }
+};
+
+struct async_write_t
+{
+  template <class _Sch, class... _Args>
+  _CCCL_HOST_API auto operator()(_Sch&& __sch, _Args&&... __args) const noexcept
+    -> decltype(static_cast<_Sch&&>(__sch).async_write(static_cast<_Args&&>(__args)...))
+  {
+    return static_cast<_Sch&&>(__sch).async_write(static_cast<_Args&&>(__args)...);
+  }
+};
+
+struct async_accept_t
+{
+  template <class _Sch, class... _Args>
+  _CCCL_HOST_API auto operator()(_Sch&& __sch, _Args&&... __args) const noexcept
+    -> decltype(static_cast<_Sch&&>(__sch).async_accept(static_cast<_Args&&>(__args)...))
+  {
+    return static_cast<_Sch&&>(__sch).async_accept(static_cast<_Args&&>(__args)...);
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT async_read_some_t async_read_some{};
+_CCCL_GLOBAL_CONSTANT async_read_t async_read{};
+_CCCL_GLOBAL_CONSTANT async_write_t async_write{};
+_CCCL_GLOBAL_CONSTANT async_accept_t async_accept{};
+} // namespace cuda::experimental::execution
+
+#  include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
+
+#endif // __CUDAX_EXECUTION_IO_URING_CONTEXT
@@ -21,6 +21,10 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/__type_traits/is_reference.h>
+
 #include <cuda/experimental/__execution/cpos.cuh>
 #include <cuda/experimental/__execution/env.cuh>
 
@@ -38,6 +42,14 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_with_env_t;
 template <class _Env, class _Rcvr>
 struct _CCCL_TYPE_VISIBILITY_DEFAULT __env_with_rcvr_t
 {
+  // The inner receiver's environment may be a temporary, in which case a reference that
+  // one of its queries returns would dangle, so the result is returned by value instead.
+  template <class _Query, class... _Args>
+  using __fwd_query_result_t _CCCL_NODEBUG_ALIAS =
+    ::cuda::std::conditional_t<::cuda::std::is_reference_v<env_of_t<_Rcvr>>,
+                               __query_result_t<env_of_t<_Rcvr>, _Query, _Args...>,
+                               ::cuda::std::decay_t<__query_result_t<env_of_t<_Rcvr>, _Query, _Args...>>>;
+
   // Prefer to query _Env
   _CCCL_EXEC_CHECK_DISABLE
   _CCCL_TEMPLATE(class _Query, class... _Args)
@@ -56,7 +68,7 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT __env_with_rcvr_t
                    _CCCL_AND __forwarding_query<_Query> _CCCL_AND __queryable_with<env_of_t<_Rcvr>, _Query, _Args...>)
   [[nodiscard]] _CCCL_API constexpr auto query(_Query, _Args&&... __args) const
     noexcept(__nothrow_queryable_with<env_of_t<_Rcvr>, _Query, _Args...>)
-      -> __query_result_t<env_of_t<_Rcvr>, _Query, _Args...>
+      -> __fwd_query_result_t<_Query, _Args...>
   {
     // If _Env has a value for the `get_scheduler` query, then we should not be
     // forwarding a get_domain query to the parent receiver's environment.
@@ -29,9 +29,14 @@
 #include <cuda/experimental/__execution/env.cuh>
 #include <cuda/experimental/__execution/exception.cuh>
 #include <cuda/experimental/__execution/fwd.cuh>
+#include <cuda/experimental/__execution/lazy.cuh>
 #include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/timer_wheel.cuh>
 #include <cuda/experimental/__execution/utility.cuh>
 
+#include <chrono>
+
 #include <cuda/experimental/__execution/prologue.cuh>
 
 namespace cuda::experimental::execution
@@ -39,20 +44,27 @@ namespace cuda::experimental::execution
 class _CCCL_TYPE_VISIBILITY_DEFAULT __run_loop_base : __immovable
 {
 public:
+  // The clock of the timers of the loop, and the length of a tick of its timer wheel.
+  using __clock_t _CCCL_NODEBUG_ALIAS = ::std::chrono::steady_clock;
+  using __tick_t _CCCL_NODEBUG_ALIAS  = ::std::chrono::microseconds;
+
   _CCCL_HIDE_FROM_ABI __run_loop_base() = default;
 
   _CCCL_API void run() noexcept
   {
-    // execute work items until the __finishing_ flag is set:
+    // execute work items and expired timers until the __finishing_ flag is set:
     while (!__finishing_.load(::cuda::std::memory_order_acquire))
     {
-      __queue_.wait_for_item();
+      NV_IF_TARGET(NV_IS_HOST, (__wait_for_item_or_timer();), (__queue_.wait_for_item();))
       __execute_all();
+      NV_IF_TARGET(NV_IS_HOST, ((void) __expire_timers();))
     }
     // drain the queue, taking care to execute any tasks that get added while
-    // executing the remaining tasks:
-    while (__execute_all())
-      ;
+    // executing the remaining tasks. The timers that have not expired by then
+    // complete with set_stopped:
+    NV_IF_TARGET(NV_IS_HOST,
+                 (while (__execute_all() || __expire_timers() || __stop_timers());),
+                 (while (__execute_all());))
   }
 
   _CCCL_API void finish() noexcept
@@ -116,6 +128,210 @@ public:
     }
   };
 
+  // A timer of the loop. Its task is pushed to the queue twice: once to insert the timer
+  // into the wheel from the loop's thread, and once more if a stop is requested, to take
+  // it out of the wheel again.
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_base
+      : __task
+      , __timer_node
+  {
+    using __complete_fn_t _CCCL_NODEBUG_ALIAS = void(__timer_base*, bool __stopped) noexcept;
+
+    _CCCL_API explicit __timer_base(
+      __run_loop_base* __loop, __execute_fn_t* __start_fn, __complete_fn_t* __complete_fn) noexcept
+        : __task{__start_fn}
+        , __loop_{__loop}
+        , __complete_fn_{__complete_fn}
+    {}
+
+    // The timer completes once, either when the loop takes it out of the wheel or when a
+    // stop is requested, whichever claims it first.
+    [[nodiscard]] _CCCL_API auto __try_claim() noexcept -> bool
+    {
+      return !__claimed_.exchange(true, ::cuda::std::memory_order_acq_rel);
+    }
+
+    // Called from the stop callback, on any thread.
+    _CCCL_API void __cancel() noexcept
+    {
+      if (__try_claim())
+      {
+        // The task is not in the queue anymore, since it has inserted the timer.
+        __execute_fn_ = &__cancel_impl;
+        __loop_->__queue_.push(this);
+      }
+    }
+
+    _CCCL_API static void __cancel_impl(__task* __p) noexcept
+    {
+      auto* __self = static_cast<__timer_base*>(__p);
+      if (__self->__list_ != nullptr)
+      {
+        __self->__loop_->__timers_.__erase(__self);
+      }
+      __self->__complete_fn_(__self, true);
+    }
+
+    __run_loop_base* __loop_;
+    __complete_fn_t* __complete_fn_;
+    ::cuda::std::atomic<bool> __claimed_{false};
+  };
+
+  template <class _Rcvr, bool _Relative>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_opstate_t : __timer_base
+  {
+    using operation_state_concept = operation_state_t;
+    using __stop_token_t _CCCL_NODEBUG_ALIAS = stop_token_of_t<env_of_t<_Rcvr>>;
+
+    struct __on_stop_t
+    {
+      _CCCL_API void operator()() const noexcept
+      {
+        __self_->__cancel();
+      }
+
+      __timer_base* __self_;
+    };
+
+    // __time is the delay of the timer if _Relative is true, else its deadline.
+    _CCCL_API explicit __timer_opstate_t(__run_loop_base* __loop, __clock_t::duration __time, _Rcvr __rcvr)
+        : __timer_base{__loop, &__start_impl, &__complete_impl}
+        , __time_{__time}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_HOST_API void start() noexcept
+    {
+      const auto __deadline = _Relative ? __clock_t::now() + __time_ : __clock_t::time_point{__time_};
+      this->__deadline_     = __run_loop_base::__tick_of(__deadline);
+      this->__loop_->__queue_.push(this);
+    }
+
+    // Runs on the loop's thread.
+    _CCCL_HOST_API static void __start_impl(__task* __p) noexcept
+    {
+      auto* __self = static_cast<__timer_opstate_t*>(__p);
+      auto __token = get_stop_token(get_env(__self->__rcvr_));
+      if (__token.stop_requested())
+      {
+        set_stopped(static_cast<_Rcvr&&>(__self->__rcvr_));
+        return;
+      }
+
+      // A timer that is already due completes right away, like a plain schedule().
+      if (__self->__deadline_ <= __run_loop_base::__now_tick())
+      {
+        set_value(static_cast<_Rcvr&&>(__self->__rcvr_));
+        return;
+      }
+
+      __self->__loop_->__insert_timer(__self);
+      if constexpr (!unstoppable_token<__stop_token_t>)
+      {
+        __self->__on_stop_.__construct(__token, __on_stop_t{__self});
+      }
+    }
+
+    _CCCL_API static void __complete_impl(__timer_base* __base, bool __stopped) noexcept
+    {
+      auto* __self = static_cast<__timer_opstate_t*>(__base);
+      if constexpr (!unstoppable_token<__stop_token_t>)
+      {
+        __self->__on_stop_.__destroy();
+      }
+
+      if (__stopped)
+      {
+        set_stopped(static_cast<_Rcvr&&>(__self->__rcvr_));
+      }
+      else
+      {
+        set_value(static_cast<_Rcvr&&>(__self->__rcvr_));
+      }
+    }
+
+    __clock_t::duration __time_;
+    _Rcvr __rcvr_;
+    __lazy<stop_callback_for_t<__stop_token_t, __on_stop_t>> __on_stop_{};
+  };
+
+  // Timers never expire early, so their deadlines are rounded up to the next tick.
+  [[nodiscard]] _CCCL_HOST_API static auto __tick_of(__clock_t::time_point __time) noexcept -> ::cuda::std::uint64_t
+  {
+    const auto __ticks = ::std::chrono::ceil<__tick_t>(__time.time_since_epoch()).count();
+    return __ticks < 0 ? 0 : static_cast<::cuda::std::uint64_t>(__ticks);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static auto __now_tick() noexcept -> ::cuda::std::uint64_t
+  {
+    const auto __ticks = ::std::chrono::floor<__tick_t>(__clock_t::now().time_since_epoch()).count();
+    return __ticks < 0 ? 0 : static_cast<::cuda::std::uint64_t>(__ticks);
+  }
+
+  _CCCL_HOST_API void __insert_timer(__timer_base* __timer) noexcept
+  {
+    if (__timers_.__empty())
+    {
+      __timers_.__reset(__now_tick());
+    }
+    __timers_.__insert(__timer);
+  }
+
+  _CCCL_HOST_API void __wait_for_item_or_timer() noexcept
+  {
+    if (__timers_.__empty())
+    {
+      __queue_.wait_for_item();
+      return;
+    }
+
+    // The next tick of the wheel may only move timers down its levels, in which case
+    // this waits again afterwards.
+    const auto __next = __timers_.__next_tick();
+    const auto __now  = __now_tick();
+    if (__next > __now)
+    {
+      const auto __wait = ::std::chrono::nanoseconds{__tick_t{static_cast<__tick_t::rep>(__next - __now)}};
+      (void) __queue_.wait_for_item_for(::cuda::std::chrono::nanoseconds{__wait.count()});
+    }
+  }
+
+  // Completes a list of timers taken out of the wheel, unless a stop request has already
+  // claimed them.
+  _CCCL_API static void __complete_timers(__timer_node* __list, bool __stopped) noexcept
+  {
+    while (__list != nullptr)
+    {
+      auto* __timer = static_cast<__timer_base*>(__list);
+      // Take care to read the next timer before completing this one, which may destroy it.
+      __list = __list->__next_;
+      if (__timer->__try_claim())
+      {
+        __timer->__complete_fn_(__timer, __stopped);
+      }
+    }
+  }
+
+  // Returns true if any timers expired.
+  _CCCL_HOST_API auto __expire_timers() noexcept -> bool
+  {
+    if (__timers_.__empty())
+    {
+      return false;
+    }
+    __timer_node* __expired = __timers_.__advance(__now_tick());
+    __complete_timers(__expired, false);
+    return __expired != nullptr;
+  }
+
+  // Returns true if there were any timers to stop.
+  _CCCL_HOST_API auto __stop_timers() noexcept -> bool
+  {
+    __timer_node* __timers = __timers_.__clear();
+    __complete_timers(__timers, true);
+    return __timers != nullptr;
+  }
+
   // Returns true if any tasks were executed.
   _CCCL_API bool __execute_all() noexcept
   {
@@ -146,6 +362,8 @@ public:
   ::cuda::std::atomic<bool> __finishing_{false};
   __atomic_intrusive_queue<&__task::__next_> __queue_{};
   __task __noop_task{&__noop_};
+  // Only touched from the thread that runs the loop.
+  __timer_wheel __timers_{};
 };
 
 template <class _Env>
@@ -215,11 +433,70 @@ public:
       basic_run_loop* __loop_;
     };
 
+    template <bool _Relative>
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_sndr_t
+    {
+      using sender_concept = sender_t;
+
+      template <class _Rcvr>
+      [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept -> __timer_opstate_t<_Rcvr, _Relative>
+      {
+        return __timer_opstate_t<_Rcvr, _Relative>{__loop_, __time_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      template <class _Self>
+      [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_stopped_t()>{};
+      }
+
+      _CCCL_API constexpr auto get_env() const noexcept -> __attrs_t
+      {
+        return __attrs_t{__loop_};
+      }
+
+    private:
+      friend scheduler;
+      _CCCL_API explicit __timer_sndr_t(basic_run_loop* __loop, __clock_t::duration __time) noexcept
+          : __loop_(__loop)
+          , __time_(__time)
+      {}
+
+      basic_run_loop* __loop_;
+      __clock_t::duration __time_;
+    };
+
     [[nodiscard]] _CCCL_API constexpr auto schedule() const noexcept -> __sndr_t
     {
       return __sndr_t{this->__loop_};
     }
 
+    /// @brief Returns the current time of the loop's clock, `std::chrono::steady_clock`.
+    [[nodiscard]] _CCCL_HOST_API auto now() const noexcept -> __clock_t::time_point
+    {
+      return __clock_t::now();
+    }
+
+    /// @brief Returns a sender that completes on the loop once `__delay` has elapsed
+    /// since the start of its operation, or with `set_stopped()` if a stop is requested
+    /// first or the loop finishes first. The delay is rounded up to the clock's duration.
+    template <class _Rep, class _Period>
+    [[nodiscard]] _CCCL_HOST_API auto schedule_after(::std::chrono::duration<_Rep, _Period> __delay) const noexcept
+      -> __timer_sndr_t<true>
+    {
+      return __timer_sndr_t<true>{this->__loop_, ::std::chrono::ceil<__clock_t::duration>(__delay)};
+    }
+
+    /// @brief Returns a sender that completes on the loop once `__deadline` is reached,
+    /// or with `set_stopped()` if a stop is requested first or the loop finishes first.
+    template <class _Duration>
+    [[nodiscard]] _CCCL_HOST_API auto schedule_at(::std::chrono::time_point<__clock_t, _Duration> __deadline) const
+      noexcept -> __timer_sndr_t<false>
+    {
+      return __timer_sndr_t<false>{
+        this->__loop_, ::std::chrono::ceil<__clock_t::duration>(__deadline.time_since_epoch())};
+    }
+
     using __attrs_t::query;
 
     [[nodiscard]] _CCCL_API constexpr auto query(get_forward_progress_guarantee_t) const noexcept
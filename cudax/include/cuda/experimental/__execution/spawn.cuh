@@ -0,0 +1,210 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_SPAWN
+#define __CUDAX_EXECUTION_SPAWN
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__memory/allocator_traits.h>
+#include <cuda/std/__type_traits/decay.h>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/get_completion_signatures.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+namespace __detail
+{
+// The allocator of an operation started by spawn or spawn_future: the one of the
+// environment passed to it if it has one, else the one of the sender's attributes, else
+// std::allocator.
+template <class _Env, class _Sndr>
+[[nodiscard]] _CCCL_API auto __spawn_allocator(const _Env& __env, const _Sndr& __sndr) noexcept
+{
+  if constexpr (__queryable_with<_Env, get_allocator_t>)
+  {
+    return get_allocator(__env);
+  }
+  else
+  {
+    return get_allocator(execution::get_env(__sndr));
+  }
+}
+
+template <class _Ty, class _Alloc>
+using __spawn_alloc_traits_t _CCCL_NODEBUG_ALIAS =
+  ::cuda::std::allocator_traits<typename ::cuda::std::allocator_traits<_Alloc>::template rebind_alloc<_Ty>>;
+
+// Allocates and constructs a _Ty, which keeps a copy of the allocator as its __alloc_
+// member so that __spawn_delete can free it.
+template <class _Ty, class _Alloc, class... _Args>
+[[nodiscard]] _CCCL_API auto __spawn_new(const _Alloc& __alloc, _Args&&... __args) -> _Ty*
+{
+  using __traits_t = __spawn_alloc_traits_t<_Ty, _Alloc>;
+  typename __traits_t::allocator_type __alloc_copy{__alloc};
+
+  _Ty* __ptr = __traits_t::allocate(__alloc_copy, 1);
+  _CCCL_TRY
+  {
+    __traits_t::construct(__alloc_copy, __ptr, __alloc, static_cast<_Args&&>(__args)...);
+  }
+  _CCCL_CATCH_ALL
+  {
+    __traits_t::deallocate(__alloc_copy, __ptr, 1);
+    _CCCL_RETHROW;
+  }
+  return __ptr;
+}
+
+template <class _Ty>
+_CCCL_API void __spawn_delete(_Ty* __ptr) noexcept
+{
+  using __traits_t = __spawn_alloc_traits_t<_Ty, decltype(__ptr->__alloc_)>;
+  typename __traits_t::allocator_type __alloc_copy{__ptr->__alloc_};
+
+  __traits_t::destroy(__alloc_copy, __ptr);
+  __traits_t::deallocate(__alloc_copy, __ptr, 1);
+}
+} // namespace __detail
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT spawn_t
+{
+  _CUDAX_SEMI_PRIVATE :
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_base_t : __immovable
+  {
+    using __complete_fn_t _CCCL_NODEBUG_ALIAS = void(__opstate_base_t*) noexcept;
+
+    _CCCL_API explicit __opstate_base_t(__complete_fn_t* __complete_fn) noexcept
+        : __complete_fn_{__complete_fn}
+    {}
+
+    __complete_fn_t* __complete_fn_;
+  };
+
+  template <class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _As>
+    _CCCL_API void set_value(_As&&...) noexcept
+    {
+      __opstate_->__complete_fn_(__opstate_);
+    }
+
+    _CCCL_API void set_stopped() noexcept
+    {
+      __opstate_->__complete_fn_(__opstate_);
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __env_ref_t<const _Env&>
+    {
+      return __env_ref(*__env_);
+    }
+
+    __opstate_base_t* __opstate_;
+    const _Env* __env_;
+  };
+
+  template <class _Alloc, class _Token, class _Sndr, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __opstate_base_t
+  {
+    using operation_state_concept = operation_state_t;
+
+    _CCCL_API explicit __opstate_t(const _Alloc& __alloc, _Token __token, _Sndr&& __sndr, _Env __env)
+        : __opstate_base_t{&__complete}
+        , __alloc_{__alloc}
+        , __token_{static_cast<_Token&&>(__token)}
+        , __env_{static_cast<_Env&&>(__env)}
+        , __opstate_(execution::connect(static_cast<_Sndr&&>(__sndr), __rcvr_t<_Env>{this, &__env_}))
+    {}
+
+    _CCCL_API void start() noexcept
+    {
+      execution::start(__opstate_);
+    }
+
+    // Frees the operation before ending its association, so that joining the scope also
+    // waits for the memory of its operations to be released.
+    _CCCL_API static void __complete(__opstate_base_t* __base) noexcept
+    {
+      auto* __self   = static_cast<__opstate_t*>(__base);
+      _Token __token = __self->__token_;
+      __detail::__spawn_delete(__self);
+      __token.disassociate();
+    }
+
+    _Alloc __alloc_;
+    _Token __token_;
+    _Env __env_;
+    connect_result_t<_Sndr, __rcvr_t<_Env>> __opstate_;
+  };
+
+public:
+  /// @brief Eagerly starts a sender associated with an async scope, without waiting for
+  /// it to complete. The sender's operation state is allocated with the allocator of
+  /// `__env` if it has one, else with the one of the sender's attributes, else with
+  /// `std::allocator`; it is the only allocation. Nothing is allocated if the association
+  /// fails. The sender must not complete with an error.
+  template <class _Sndr, class _Token, class _Env = env<>>
+  _CCCL_API void operator()(_Sndr __sndr, _Token __token, _Env __env = {}) const
+  {
+    using __wrapped_t _CCCL_NODEBUG_ALIAS = decay_t<decltype(__token.wrap(static_cast<_Sndr&&>(__sndr)))>;
+    static_assert(get_completion_signatures<__wrapped_t, __env_ref_t<const _Env&>>().count(set_error) == 0,
+                  "spawn requires a sender that does not complete with an error.");
+
+    __wrapped_t __wrapped = __token.wrap(static_cast<_Sndr&&>(__sndr));
+    auto __alloc          = __detail::__spawn_allocator(__env, __wrapped);
+
+    using __opstate_t _CCCL_NODEBUG_ALIAS = spawn_t::__opstate_t<decltype(__alloc), _Token, __wrapped_t, _Env>;
+
+    if (!__token.try_associate())
+    {
+      return;
+    }
+
+    _CCCL_TRY
+    {
+      auto* __opstate = __detail::__spawn_new<__opstate_t>(
+        __alloc, __token, static_cast<__wrapped_t&&>(__wrapped), static_cast<_Env&&>(__env));
+      execution::start(*__opstate);
+    }
+    _CCCL_CATCH_ALL
+    {
+      __token.disassociate();
+      _CCCL_RETHROW;
+    }
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT spawn_t spawn{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_SPAWN
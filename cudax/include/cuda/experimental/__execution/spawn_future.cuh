@@ -0,0 +1,405 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_SPAWN_FUTURE
+#define __CUDAX_EXECUTION_SPAWN_FUTURE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__type_traits/decay.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/__utility/pod_tuple.h>
+#include <cuda/std/atomic>
+
+#include <cuda/experimental/__detail/utility.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/exception.cuh>
+#include <cuda/experimental/__execution/get_completion_signatures.cuh>
+#include <cuda/experimental/__execution/lazy.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/spawn.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/transform_completion_signatures.cuh>
+#include <cuda/experimental/__execution/utility.cuh>
+#include <cuda/experimental/__execution/variant.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+struct _CCCL_TYPE_VISIBILITY_DEFAULT spawn_future_t
+{
+  _CUDAX_SEMI_PRIVATE :
+  template <class _Env>
+  using __child_env_t _CCCL_NODEBUG_ALIAS = env<prop<get_stop_token_t, inplace_stop_token>, __env_ref_t<const _Env&>>;
+
+  // The results of the spawned sender are decay-copied into the shared state, which can
+  // throw, and the future completes with set_stopped() if the association fails.
+  template <class _Sndr, class _Env>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto __get_completions()
+  {
+    _CUDAX_LET_COMPLETIONS(auto(__child_completions) =
+                             execution::get_completion_signatures<_Sndr, __child_env_t<_Env>>())
+    {
+      using __parts_t _CCCL_NODEBUG_ALIAS = __partitioned_completions_of_t<decltype(__child_completions)>;
+      constexpr bool __nothrow            = __parts_t::__nothrow_decay_copyable::__all::value;
+      return transform_completion_signatures(
+        __child_completions,
+        __decay_transform<set_value_t>{},
+        __decay_transform<set_error_t>{},
+        {},
+        completion_signatures<set_stopped_t()>{} + __eptr_completion_if<!__nothrow>());
+    }
+
+    _CCCL_UNREACHABLE();
+  }
+
+  template <class _Sndr, class _Env>
+  using __completions_t _CCCL_NODEBUG_ALIAS = decltype(spawn_future_t::__get_completions<_Sndr, _Env>());
+
+  enum __status_t : int
+  {
+    __pending,
+    __waiting,
+    __done,
+    __abandoned
+  };
+
+  // The state shared by the spawned operation and the future. Whichever of the two
+  // finishes last frees it.
+  template <class _Completions>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_base_t : __immovable
+  {
+    using __results_t _CCCL_NODEBUG_ALIAS =
+      typename _Completions::template __transform_q<::cuda::std::__decayed_tuple, __variant>;
+    using __fn_t _CCCL_NODEBUG_ALIAS          = void(__state_base_t*) noexcept;
+    using __consumer_fn_t _CCCL_NODEBUG_ALIAS = void(void*) noexcept;
+
+    _CCCL_API explicit __state_base_t(__fn_t* __complete_fn, __fn_t* __destroy_fn) noexcept
+        : __complete_fn_{__complete_fn}
+        , __destroy_fn_{__destroy_fn}
+    {}
+
+    // Called once the results are stored.
+    _CCCL_API void __publish() noexcept
+    {
+      switch (__status_.exchange(__done, ::cuda::std::memory_order_acq_rel))
+      {
+        case __waiting:
+          __consumer_fn_(__consumer_);
+          break;
+        case __abandoned:
+          __destroy_fn_(this);
+          break;
+        default:
+          break;
+      }
+    }
+
+    // Called when the future is dropped before its results are consumed.
+    _CCCL_API void __abandon() noexcept
+    {
+      __stop_source_.request_stop();
+      if (__status_.exchange(__abandoned, ::cuda::std::memory_order_acq_rel) == __done)
+      {
+        __destroy_fn_(this);
+      }
+    }
+
+    // Returns false if the results are already stored, in which case the consumer is not
+    // called.
+    [[nodiscard]] _CCCL_API auto __try_wait(__consumer_fn_t* __consumer_fn, void* __consumer) noexcept -> bool
+    {
+      __consumer_fn_ = __consumer_fn;
+      __consumer_    = __consumer;
+      int __expected = __pending;
+      return __status_.compare_exchange_strong(
+        __expected, __waiting, ::cuda::std::memory_order_acq_rel, ::cuda::std::memory_order_acquire);
+    }
+
+    __fn_t* __complete_fn_;
+    __fn_t* __destroy_fn_;
+    __consumer_fn_t* __consumer_fn_ = nullptr;
+    void* __consumer_               = nullptr;
+    ::cuda::std::atomic<int> __status_{__pending};
+    inplace_stop_source __stop_source_{};
+    __results_t __results_{};
+  };
+
+  // This receiver is connected to the spawned sender. It stashes the sender's results
+  // into the shared state.
+  template <class _Completions, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class _Tag, class... _As>
+    _CCCL_API void __set_result(_Tag, _As&&... __as) noexcept
+    {
+      using __tupl_t _CCCL_NODEBUG_ALIAS = ::cuda::std::__tuple<_Tag, decay_t<_As>...>;
+      _CCCL_TRY
+      {
+        __state_->__results_.template __emplace<__tupl_t>(_Tag{}, static_cast<_As&&>(__as)...);
+      }
+      _CCCL_CATCH_ALL
+      {
+        // Avoid ODR-using this completion operation if this code path is not taken.
+        if constexpr (!__nothrow_decay_copyable<_As...>)
+        {
+          using __error_tupl_t _CCCL_NODEBUG_ALIAS = ::cuda::std::__tuple<set_error_t, exception_ptr>;
+          __state_->__results_.template __emplace<__error_tupl_t>(set_error_t{}, execution::current_exception());
+        }
+      }
+      __state_->__complete_fn_(__state_);
+    }
+
+    template <class... _As>
+    _CCCL_API void set_value(_As&&... __as) noexcept
+    {
+      __set_result(set_value_t{}, static_cast<_As&&>(__as)...);
+    }
+
+    template <class _Error>
+    _CCCL_API void set_error(_Error&& __error) noexcept
+    {
+      __set_result(set_error_t{}, static_cast<_Error&&>(__error));
+    }
+
+    _CCCL_API void set_stopped() noexcept
+    {
+      __set_result(set_stopped_t{});
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __child_env_t<_Env>
+    {
+      return {prop{get_stop_token, __state_->__stop_source_.get_token()}, __env_ref(*__env_)};
+    }
+
+    __state_base_t<_Completions>* __state_;
+    const _Env* __env_;
+  };
+
+  template <class _Completions, class _Alloc, class _Token, class _Sndr, class _Env>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __state_t : __state_base_t<_Completions>
+  {
+    using __base_t _CCCL_NODEBUG_ALIAS = __state_base_t<_Completions>;
+    using __rcvr_t _CCCL_NODEBUG_ALIAS = spawn_future_t::__rcvr_t<_Completions, _Env>;
+
+    _CCCL_API explicit __state_t(const _Alloc& __alloc, _Token __token, _Sndr&& __sndr, _Env __env)
+        : __base_t{&__complete, &__destroy}
+        , __alloc_{__alloc}
+        , __token_{static_cast<_Token&&>(__token)}
+        , __env_{static_cast<_Env&&>(__env)}
+    {
+      __opstate_.__construct_from(execution::connect, static_cast<_Sndr&&>(__sndr), __rcvr_t{this, &__env_});
+    }
+
+    // Starts the spawned operation, or completes the future with set_stopped() if the
+    // association fails.
+    _CCCL_API void __start() noexcept
+    {
+      if (__token_.try_associate())
+      {
+        execution::start(*__opstate_.__get());
+      }
+      else
+      {
+        __opstate_.__destroy();
+        this->__results_.template __emplace<::cuda::std::__tuple<set_stopped_t>>(set_stopped_t{});
+        this->__status_.store(__done, ::cuda::std::memory_order_relaxed);
+      }
+    }
+
+    // The association ends with the spawned operation, before the results are handed to
+    // the future.
+    _CCCL_API static void __complete(__base_t* __base) noexcept
+    {
+      auto* __self = static_cast<__state_t*>(__base);
+      __self->__opstate_.__destroy();
+      __self->__token_.disassociate();
+      __self->__publish();
+    }
+
+    _CCCL_API static void __destroy(__base_t* __base) noexcept
+    {
+      __detail::__spawn_delete(static_cast<__state_t*>(__base));
+    }
+
+    _Alloc __alloc_;
+    _Token __token_;
+    _Env __env_;
+    __lazy<connect_result_t<_Sndr, __rcvr_t>> __opstate_;
+  };
+
+  struct __send_result_fn
+  {
+    template <class _Rcvr, class _Tag, class... _As>
+    _CCCL_API void operator()(_Rcvr& __rcvr, _Tag, _As&... __args) const noexcept
+    {
+      // moves from lvalues here is intentional:
+      _Tag{}(static_cast<_Rcvr&&>(__rcvr), static_cast<_As&&>(__args)...);
+    }
+  };
+
+  struct __send_result_visitor
+  {
+    template <class _Rcvr, class _Tuple>
+    _CCCL_API void operator()(_Rcvr& __rcvr, _Tuple& __tuple) const noexcept
+    {
+      ::cuda::std::__apply(__send_result_fn{}, __tuple, __rcvr);
+    }
+  };
+
+  template <class _Completions, class _Rcvr>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t
+  {
+    using operation_state_concept = operation_state_t;
+    using __stop_token_t _CCCL_NODEBUG_ALIAS = stop_token_of_t<env_of_t<_Rcvr>>;
+
+    _CCCL_API explicit __opstate_t(__state_base_t<_Completions>* __state, _Rcvr __rcvr) noexcept
+        : __state_{__state}
+        , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+    {}
+
+    _CCCL_IMMOVABLE(__opstate_t);
+
+    _CCCL_API ~__opstate_t()
+    {
+      if (__started_)
+      {
+        __state_->__destroy_fn_(__state_);
+      }
+      else
+      {
+        __state_->__abandon();
+      }
+    }
+
+    _CCCL_API void start() noexcept
+    {
+      __started_ = true;
+      if constexpr (!unstoppable_token<__stop_token_t>)
+      {
+        __on_stop_.__construct(
+          get_stop_token(execution::get_env(__rcvr_)), __on_stop_request{__state_->__stop_source_});
+      }
+
+      if (!__state_->__try_wait(&__complete, this))
+      {
+        __complete(this);
+      }
+    }
+
+    _CCCL_API static void __complete(void* __ptr) noexcept
+    {
+      auto* __self = static_cast<__opstate_t*>(__ptr);
+      if constexpr (!unstoppable_token<__stop_token_t>)
+      {
+        __self->__on_stop_.__destroy();
+      }
+      __visit(__send_result_visitor{}, __self->__state_->__results_, __self->__rcvr_);
+    }
+
+    __state_base_t<_Completions>* __state_;
+    _Rcvr __rcvr_;
+    bool __started_ = false;
+    __lazy<stop_callback_for_t<__stop_token_t, __on_stop_request>> __on_stop_{};
+  };
+
+public:
+  template <class _Completions>
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t;
+
+  /// @brief Eagerly starts a sender associated with an async scope, and returns a
+  /// sender of its results. The spawned operation, its results and the state the two
+  /// share take one allocation, made with the allocator of `__env` if it has one, else
+  /// with the one of the sender's attributes, else with `std::allocator`. Dropping the
+  /// returned sender, or destroying its operation state before starting it, requests
+  /// the spawned operation to stop; the state is freed when the later of the two is
+  /// done. If the association fails, the returned sender completes with `set_stopped()`.
+  template <class _Sndr, class _Token, class _Env = env<>>
+  [[nodiscard]] _CCCL_API auto operator()(_Sndr __sndr, _Token __token, _Env __env = {}) const
+  {
+    using __wrapped_t _CCCL_NODEBUG_ALIAS = decay_t<decltype(__token.wrap(static_cast<_Sndr&&>(__sndr)))>;
+    using __completions_t _CCCL_NODEBUG_ALIAS = spawn_future_t::__completions_t<__wrapped_t, _Env>;
+
+    __wrapped_t __wrapped = __token.wrap(static_cast<_Sndr&&>(__sndr));
+    auto __alloc          = __detail::__spawn_allocator(__env, __wrapped);
+
+    using __state_t _CCCL_NODEBUG_ALIAS =
+      spawn_future_t::__state_t<__completions_t, decltype(__alloc), _Token, __wrapped_t, _Env>;
+
+    auto* __state = __detail::__spawn_new<__state_t>(
+      __alloc, __token, static_cast<__wrapped_t&&>(__wrapped), static_cast<_Env&&>(__env));
+    __state->__start();
+    return __sndr_t<__completions_t>{__state};
+  }
+};
+
+template <class _Completions>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT spawn_future_t::__sndr_t
+{
+  using sender_concept = sender_t;
+
+  _CCCL_API explicit __sndr_t(__state_base_t<_Completions>* __state) noexcept
+      : __state_{__state}
+  {}
+
+  _CCCL_API __sndr_t(__sndr_t&& __other) noexcept
+      : __state_{::cuda::std::exchange(__other.__state_, nullptr)}
+  {}
+
+  _CCCL_API ~__sndr_t()
+  {
+    if (__state_ != nullptr)
+    {
+      __state_->__abandon();
+    }
+  }
+
+  template <class _Self, class... _Env>
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+  {
+    return _Completions{};
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) && noexcept -> __opstate_t<_Completions, _Rcvr>
+  {
+    return __opstate_t<_Completions, _Rcvr>{::cuda::std::exchange(__state_, nullptr), static_cast<_Rcvr&&>(__rcvr)};
+  }
+
+  [[nodiscard]] _CCCL_API constexpr auto get_env() const noexcept -> env<>
+  {
+    return {};
+  }
+
+private:
+  __state_base_t<_Completions>* __state_;
+};
+
+_CCCL_GLOBAL_CONSTANT spawn_future_t spawn_future{};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_SPAWN_FUTURE
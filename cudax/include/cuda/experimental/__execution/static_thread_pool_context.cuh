@@ -0,0 +1,537 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_STATIC_THREAD_POOL_CONTEXT
+#define __CUDAX_EXECUTION_STATIC_THREAD_POOL_CONTEXT
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__exception/exception_macros.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__utility/pod_tuple.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+
+#include <cuda/experimental/__execution/bulk.cuh>
+#include <cuda/experimental/__execution/completion_signatures.cuh>
+#include <cuda/experimental/__execution/cpos.cuh>
+#include <cuda/experimental/__execution/domain.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/exception.cuh>
+#include <cuda/experimental/__execution/fwd.cuh>
+#include <cuda/experimental/__execution/policy.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/run_loop.cuh>
+#include <cuda/experimental/__execution/transform_completion_signatures.cuh>
+#include <cuda/experimental/__execution/variant.cuh>
+
+#include <memory>
+#include <thread>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+class static_thread_pool_context;
+
+namespace __thread_pool
+{
+struct __domain_t;
+
+template <class _Sndr>
+struct __bulk_sndr_t;
+
+template <class _Policy, class _CvSndr, class _Shape, class _Fn, class _Rcvr>
+struct __bulk_opstate_t;
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __attrs_t
+{
+  [[nodiscard]] _CCCL_API constexpr auto query(get_completion_scheduler_t<set_value_t>) const noexcept;
+  [[nodiscard]] _CCCL_API constexpr auto query(get_completion_scheduler_t<set_stopped_t>) const noexcept;
+
+  [[nodiscard]] _CCCL_API constexpr auto query(get_completion_domain_t<set_value_t>) const noexcept;
+  [[nodiscard]] _CCCL_API constexpr auto query(get_completion_domain_t<set_stopped_t>) const noexcept;
+
+  [[nodiscard]] _CCCL_API constexpr auto query(get_completion_behavior_t) const noexcept
+  {
+    return completion_behavior::asynchronous;
+  }
+
+  static_thread_pool_context* __pool_;
+};
+} // namespace __thread_pool
+
+//! @brief An execution context with a fixed number of worker threads, each of which runs
+//! a @c run_loop.
+//!
+//! `schedule()` hands the continuation to the workers in turn. `bulk` and `bulk_chunked`
+//! operations with a parallel policy are split into one contiguous chunk of the iteration
+//! space per worker, so that all the workers run the operation at once. The worker that
+//! completes the predecessor runs its own chunk inline. The last chunk to finish completes
+//! the operation, with the error of the first chunk that failed, if any.
+class _CCCL_TYPE_VISIBILITY_DEFAULT static_thread_pool_context : __immovable
+{
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __worker_t
+  {
+    run_loop __loop_;
+    ::std::thread __thrd_;
+  };
+
+public:
+  class _CCCL_TYPE_VISIBILITY_DEFAULT scheduler : __thread_pool::__attrs_t
+  {
+  private:
+    friend static_thread_pool_context;
+    friend __thread_pool::__attrs_t;
+    friend __thread_pool::__domain_t;
+
+    _CCCL_API constexpr explicit scheduler(static_thread_pool_context* __pool) noexcept
+        : __thread_pool::__attrs_t{__pool}
+    {}
+
+  public:
+    using scheduler_concept = scheduler_t;
+
+    struct _CCCL_TYPE_VISIBILITY_DEFAULT __sndr_t
+    {
+      using sender_concept = sender_t;
+
+      // Picks the worker that will run the operation when it is connected.
+      template <class _Rcvr>
+      [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) const noexcept -> __run_loop_base::__opstate_t<_Rcvr>
+      {
+        return __run_loop_base::__opstate_t<_Rcvr>{&__pool_->__next_loop().__queue_, static_cast<_Rcvr&&>(__rcvr)};
+      }
+
+      template <class _Self>
+      [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures() noexcept
+      {
+        return completion_signatures<set_value_t(), set_stopped_t()>{};
+      }
+
+      [[nodiscard]] _CCCL_API constexpr auto get_env() const noexcept -> __thread_pool::__attrs_t
+      {
+        return __thread_pool::__attrs_t{__pool_};
+      }
+
+    private:
+      friend scheduler;
+
+      _CCCL_API constexpr explicit __sndr_t(static_thread_pool_context* __pool) noexcept
+          : __pool_{__pool}
+      {}
+
+      static_thread_pool_context* __pool_;
+    };
+
+    [[nodiscard]] _CCCL_API constexpr auto schedule() const noexcept -> __sndr_t
+    {
+      return __sndr_t{__pool_};
+    }
+
+    using __thread_pool::__attrs_t::query;
+
+    [[nodiscard]] _CCCL_API constexpr auto query(get_forward_progress_guarantee_t) const noexcept
+      -> forward_progress_guarantee
+    {
+      return forward_progress_guarantee::parallel;
+    }
+
+    [[nodiscard]] _CCCL_API friend constexpr bool operator==(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__pool_ == __b.__pool_;
+    }
+
+    [[nodiscard]] _CCCL_API friend constexpr bool operator!=(const scheduler& __a, const scheduler& __b) noexcept
+    {
+      return __a.__pool_ != __b.__pool_;
+    }
+  };
+
+  //! @brief Starts @p __num_threads workers, one per hardware thread if 0.
+  _CCCL_HOST_API explicit static_thread_pool_context(size_t __num_threads = 0)
+      : __size_{__num_threads != 0 ? __num_threads : (::cuda::std::max) (::std::thread::hardware_concurrency(), 1u)}
+      , __workers_{new __worker_t[__size_]}
+  {
+    for (size_t __i = 0; __i < __size_; ++__i)
+    {
+      __workers_[__i].__thrd_ = ::std::thread{[this, __i] {
+        __current_worker() = {this, __i};
+        __workers_[__i].__loop_.run();
+      }};
+    }
+  }
+
+  _CCCL_HOST_API ~static_thread_pool_context() noexcept
+  {
+    join();
+  }
+
+  //! @brief Runs the work scheduled so far and stops the workers, one after the other.
+  //! Work that is still running must not schedule more work on the context, since a
+  //! worker that has stopped does not run it.
+  _CCCL_HOST_API void join() noexcept
+  {
+    for (size_t __i = 0; __i < __size_; ++__i)
+    {
+      if (__workers_[__i].__thrd_.joinable())
+      {
+        __workers_[__i].__loop_.finish();
+        __workers_[__i].__thrd_.join();
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_API constexpr auto get_scheduler() noexcept -> scheduler
+  {
+    return scheduler{this};
+  }
+
+  //! @brief Returns the number of workers.
+  [[nodiscard]] _CCCL_API constexpr auto size() const noexcept -> size_t
+  {
+    return __size_;
+  }
+
+private:
+  template <class, class, class, class, class>
+  friend struct __thread_pool::__bulk_opstate_t;
+
+  struct __worker_id_t
+  {
+    const static_thread_pool_context* __pool_;
+    size_t __index_;
+  };
+
+  [[nodiscard]] _CCCL_HOST_API static auto __current_worker() noexcept -> __worker_id_t&
+  {
+    thread_local __worker_id_t __id{nullptr, 0};
+    return __id;
+  }
+
+  // Returns the index of the worker that runs on the calling thread, or size() if the
+  // calling thread is not one of the workers of this pool.
+  [[nodiscard]] _CCCL_HOST_API auto __current_index() const noexcept -> size_t
+  {
+    const __worker_id_t& __id = __current_worker();
+    return __id.__pool_ == this ? __id.__index_ : __size_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __next_loop() noexcept -> run_loop&
+  {
+    return __workers_[__next_.fetch_add(1, ::cuda::std::memory_order_relaxed) % __size_].__loop_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __loop(size_t __index) noexcept -> run_loop&
+  {
+    return __workers_[__index].__loop_;
+  }
+
+  size_t __size_;
+  ::std::unique_ptr<__worker_t[]> __workers_;
+  ::cuda::std::atomic<size_t> __next_{0};
+};
+
+namespace __thread_pool
+{
+//! Runs a bulk_chunked operation on the workers of a static_thread_pool_context. The
+//! receiver that is connected to the predecessor stores its values in the operation state
+//! and gives every worker one chunk of the iteration space. The chunks count down a single
+//! atomic counter as they finish, and the one that takes it to zero completes the
+//! operation.
+template <class _Policy, class _CvSndr, class _Shape, class _Fn, class _Rcvr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __bulk_opstate_t
+{
+  using operation_state_concept = operation_state_t;
+
+  _CCCL_HOST_API explicit __bulk_opstate_t(
+    _CvSndr&& __sndr, _Shape __shape, _Fn __fn, _Rcvr __rcvr, static_thread_pool_context* __pool)
+      : __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
+      , __fn_{static_cast<_Fn&&>(__fn)}
+      , __shape_{__shape}
+      , __pool_{__pool}
+      , __num_chunks_{__is_parallel ? (::cuda::std::min) (__pool->size(), static_cast<size_t>(__shape)) : size_t{1}}
+      , __remaining_{__num_chunks_}
+      , __chunks_{__num_chunks_ > 1 ? new __chunk_t[__num_chunks_] : nullptr}
+      , __opstate_{execution::connect(static_cast<_CvSndr&&>(__sndr), __rcvr_t{this})}
+  {}
+
+  _CCCL_IMMOVABLE(__bulk_opstate_t);
+
+  _CCCL_HOST_API void start() noexcept
+  {
+    execution::start(__opstate_);
+  }
+
+private:
+  static constexpr bool __is_parallel =
+    ::cuda::std::is_same_v<_Policy, ::cuda::std::execution::parallel_policy>
+    || ::cuda::std::is_same_v<_Policy, ::cuda::std::execution::parallel_unsequenced_policy>;
+
+  using __values_t =
+    value_types_of_t<_CvSndr, __fwd_env_t<env_of_t<_Rcvr>>, ::cuda::std::__decayed_tuple, __nullable_variant>;
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __rcvr_t
+  {
+    using receiver_concept = receiver_t;
+
+    template <class... _As>
+    _CCCL_HOST_API void set_value(_As&&... __as) noexcept
+    {
+      _CCCL_TRY
+      {
+        __self_->__values_.template __emplace<::cuda::std::__decayed_tuple<_As...>>(static_cast<_As&&>(__as)...);
+      }
+      _CCCL_CATCH_ALL
+      {
+        execution::set_error(static_cast<_Rcvr&&>(__self_->__rcvr_), execution::current_exception());
+        return;
+      }
+      __self_->__start_chunks();
+    }
+
+    template <class _Error>
+    _CCCL_HOST_API void set_error(_Error&& __err) noexcept
+    {
+      execution::set_error(static_cast<_Rcvr&&>(__self_->__rcvr_), static_cast<_Error&&>(__err));
+    }
+
+    _CCCL_HOST_API void set_stopped() noexcept
+    {
+      execution::set_stopped(static_cast<_Rcvr&&>(__self_->__rcvr_));
+    }
+
+    [[nodiscard]] _CCCL_API auto get_env() const noexcept -> __fwd_env_t<env_of_t<_Rcvr>>
+    {
+      return __fwd_env(execution::get_env(__self_->__rcvr_));
+    }
+
+    __bulk_opstate_t* __self_;
+  };
+
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __chunk_t : __run_loop_base::__task
+  {
+    _CCCL_HOST_API __chunk_t() noexcept
+        : __run_loop_base::__task{&__execute_impl}
+    {}
+
+    _CCCL_HOST_API static void __execute_impl(__run_loop_base::__task* __task) noexcept
+    {
+      auto* __self = static_cast<__chunk_t*>(__task);
+      __self->__op_->__run_chunk(__self->__index_);
+    }
+
+    __bulk_opstate_t* __op_ = nullptr;
+    size_t __index_         = 0;
+  };
+
+  _CCCL_HOST_API void __start_chunks() noexcept
+  {
+    const size_t __num_chunks = __num_chunks_;
+    if (__num_chunks == 0)
+    {
+      __complete();
+      return;
+    }
+    if (__num_chunks == 1)
+    {
+      __run_chunk(0);
+      return;
+    }
+
+    // The worker that runs this does not hand its own chunk to its own loop, but runs it
+    // after it has handed out the others. Nothing may touch *this once the last chunk has
+    // been handed out unless the calling thread still has a chunk to run.
+    const size_t __own_chunk           = __pool_->__current_index();
+    static_thread_pool_context* __pool = __pool_;
+    __chunk_t* __chunks                = __chunks_.get();
+    for (size_t __i = 0; __i < __num_chunks; ++__i)
+    {
+      if (__i != __own_chunk)
+      {
+        __chunks[__i].__op_    = this;
+        __chunks[__i].__index_ = __i;
+        __pool->__loop(__i).__queue_.push(&__chunks[__i]);
+      }
+    }
+    if (__own_chunk < __num_chunks)
+    {
+      __run_chunk(__own_chunk);
+    }
+  }
+
+  _CCCL_HOST_API void __run_chunk(size_t __index) noexcept
+  {
+    // Once a chunk has failed, the others have nothing to contribute to the result.
+    if (!__failed_.load(::cuda::std::memory_order_relaxed))
+    {
+      // Split the shape into __num_chunks_ ranges whose lengths differ by at most one.
+      const size_t __shape = static_cast<size_t>(__shape_);
+      const size_t __size  = __shape / __num_chunks_;
+      const size_t __rem   = __shape % __num_chunks_;
+      const size_t __begin = __index * __size + (::cuda::std::min) (__index, __rem);
+      const size_t __end   = __begin + __size + (__index < __rem ? 1 : 0);
+
+      _CCCL_TRY
+      {
+        __visit(
+          [&](auto& __tupl) {
+            if constexpr (!__same_as<decltype(__tupl), ::cuda::std::monostate&>)
+            {
+              ::cuda::std::__apply(
+                [&](auto&... __as) {
+                  __fn_(_Shape(__begin), _Shape(__end), __as...);
+                },
+                __tupl);
+            }
+          },
+          __values_);
+      }
+      _CCCL_CATCH_ALL
+      {
+        if (!__failed_.exchange(true, ::cuda::std::memory_order_relaxed))
+        {
+          __error_ = execution::current_exception();
+        }
+      }
+    }
+
+    if (__remaining_.fetch_sub(1, ::cuda::std::memory_order_acq_rel) == 1)
+    {
+      __complete();
+    }
+  }
+
+  _CCCL_HOST_API void __complete() noexcept
+  {
+    if (__failed_.load(::cuda::std::memory_order_relaxed))
+    {
+      execution::set_error(static_cast<_Rcvr&&>(__rcvr_), static_cast<exception_ptr&&>(__error_));
+      return;
+    }
+    __visit(
+      [this](auto& __tupl) {
+        if constexpr (!__same_as<decltype(__tupl), ::cuda::std::monostate&>)
+        {
+          ::cuda::std::__apply(execution::set_value, _CCCL_MOVE(__tupl), _CCCL_MOVE(__rcvr_));
+        }
+      },
+      __values_);
+  }
+
+  using __child_opstate_t = connect_result_t<_CvSndr, __rcvr_t>;
+
+  _Rcvr __rcvr_;
+  _Fn __fn_;
+  _Shape __shape_;
+  static_thread_pool_context* __pool_;
+  size_t __num_chunks_;
+  __values_t __values_{};
+  ::cuda::std::atomic<size_t> __remaining_;
+  ::cuda::std::atomic<bool> __failed_{false};
+  exception_ptr __error_{};
+  ::std::unique_ptr<__chunk_t[]> __chunks_;
+  __child_opstate_t __opstate_;
+};
+
+//! The sender that a bulk_chunked sender whose predecessor completes on a
+//! static_thread_pool_context is transformed into.
+template <class _Sndr>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __bulk_sndr_t
+{
+  using sender_concept = sender_t;
+
+  _CCCL_API explicit __bulk_sndr_t(_Sndr __sndr, static_thread_pool_context* __pool)
+      : __sndr_(static_cast<_Sndr&&>(__sndr))
+      , __pool_{__pool}
+  {}
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_HOST_API auto connect(_Rcvr __rcvr) &&
+  {
+    auto& [__tag, __data, __child] = __sndr_;
+    auto& [__pol, __shape, __fn]   = __data;
+    return __bulk_opstate_t<decltype(__pol), decltype(__child), decltype(__shape), decltype(__fn), _Rcvr>{
+      _CCCL_MOVE(__child), __shape, _CCCL_MOVE(__fn), static_cast<_Rcvr&&>(__rcvr), __pool_};
+  }
+
+  _CCCL_TEMPLATE(class _Self, class _Env)
+  _CCCL_REQUIRES(__same_as<_Self, __bulk_sndr_t>) // accept only rvalues.
+  [[nodiscard]] _CCCL_API static _CCCL_CONSTEVAL auto get_completion_signatures()
+  {
+    // Call get_completion_signatures on the wrapped bulk_chunked sender directly to avoid
+    // another trip through transform_sender. The predecessor's values are stored in the
+    // operation state, which can throw.
+    auto __completions = decay_t<_Sndr>::template get_completion_signatures<_Sndr, _Env>();
+    return transform_completion_signatures(
+      __completions, __decay_transform<set_value_t>(), {}, {}, __eptr_completion());
+  }
+
+  [[nodiscard]] _CCCL_API auto get_env() const noexcept -> env_of_t<_Sndr>
+  {
+    return execution::get_env(__sndr_);
+  }
+
+private:
+  _Sndr __sndr_;
+  static_thread_pool_context* __pool_;
+};
+
+//! The domain of the senders that complete on a static_thread_pool_context. It splits
+//! bulk_chunked operations (and the bulk operations that lower to them) over the workers.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __domain_t : default_domain
+{
+  _CCCL_TEMPLATE(class _Sndr, class _Env, class _BulkTag = tag_of_t<_Sndr>)
+  _CCCL_REQUIRES(__same_as<_BulkTag, bulk_chunked_t>)
+  [[nodiscard]] _CCCL_API static constexpr auto transform_sender(set_value_t, _Sndr&& __sndr, const _Env& __env)
+  {
+    auto __sch = get_completion_scheduler<set_value_t>(get_env(__sndr), __env);
+    static_assert(__same_as<decltype(__sch), static_thread_pool_context::scheduler>,
+                  "the predecessor of the bulk operation must complete on a static_thread_pool_context");
+    return __bulk_sndr_t<_Sndr>{static_cast<_Sndr&&>(__sndr), __sch.__pool_};
+  }
+};
+
+_CCCL_API constexpr auto __attrs_t::query(get_completion_scheduler_t<set_value_t>) const noexcept
+{
+  return static_thread_pool_context::scheduler{__pool_};
+}
+
+_CCCL_API constexpr auto __attrs_t::query(get_completion_scheduler_t<set_stopped_t>) const noexcept
+{
+  return query(get_completion_scheduler<set_value_t>);
+}
+
+_CCCL_API constexpr auto __attrs_t::query(get_completion_domain_t<set_value_t>) const noexcept
+{
+  return __domain_t{};
+}
+
+_CCCL_API constexpr auto __attrs_t::query(get_completion_domain_t<set_stopped_t>) const noexcept
+{
+  return __domain_t{};
+}
+} // namespace __thread_pool
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_STATIC_THREAD_POOL_CONTEXT
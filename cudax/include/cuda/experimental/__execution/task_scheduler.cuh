@@ -27,6 +27,8 @@
 #include <cuda/std/__memory/allocator.h>
 #include <cuda/std/__tuple_dir/ignore.h>
 #include <cuda/std/__utility/pod_tuple.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
 
 #include <cuda/experimental/__detail/type_traits.cuh>
 #include <cuda/experimental/__execution/bulk.cuh>
@@ -74,6 +76,14 @@ struct __task_scheduler_backend : parallel_scheduler_backend
 
 using __backend_ptr_t = __shared_ptr<__task_scheduler_backend>;
 
+// The sizes of the buffers that the type-erased operation states lend to the backend.
+// __backend_for constructs the operation state of the underlying scheduler's sender in
+// such a buffer when it fits, and only allocates it with the backend's allocator when it
+// does not. The bulk buffer is larger because the bulk senders carry a function and a
+// shape in addition to the schedule sender.
+inline constexpr size_t __task_storage_size      = 12 * sizeof(void*);
+inline constexpr size_t __task_bulk_storage_size = 24 * sizeof(void*);
+
 template <class _Sch>
 _CCCL_CONCEPT __non_task_scheduler = _CCCL_REQUIRES_EXPR((_Sch))( //
   requires(__not_same_as<task_scheduler, _Sch>), //
@@ -190,6 +200,12 @@ private:
   template <class>
   friend struct __detail::__task_bulk_sender;
   friend struct __detail::__task_sender;
+  friend class work_stealing_context;
+
+  // Used by the execution contexts that implement a backend directly.
+  _CCCL_API explicit task_scheduler(__detail::__backend_ptr_t __backend) noexcept
+      : __backend_(_CCCL_MOVE(__backend))
+  {}
 
   __detail::__backend_ptr_t __backend_;
 };
@@ -224,7 +240,7 @@ public:
 private:
   __detail::__receiver_proxy<_Rcvr> __rcvr_proxy_;
   __backend_ptr_t __backend_;
-  ::cuda::std::byte __storage_[8 * sizeof(void*)];
+  alignas(::cuda::std::max_align_t) ::cuda::std::byte __storage_[__task_storage_size];
 };
 
 //! @brief A type-erased sender returned by task_scheduler::schedule().
@@ -242,9 +258,17 @@ struct __task_sender
   {}
 
   template <class _Rcvr>
-  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const noexcept -> __task_opstate_t<_Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) && noexcept -> __task_opstate_t<_Rcvr>
+  {
+    // Take the backend from the sender instead of copying it, to save a reference count
+    // increment and decrement per operation.
+    return __task_opstate_t<_Rcvr>(_CCCL_MOVE(__attrs_.__sch_.__backend_), _CCCL_MOVE(__rcvr));
+  }
+
+  template <class _Rcvr>
+  [[nodiscard]] _CCCL_API auto connect(_Rcvr __rcvr) const& noexcept -> __task_opstate_t<_Rcvr>
   {
-    return __task_opstate_t<_Rcvr>(get_completion_scheduler<set_value_t>(__attrs_).__backend_, _CCCL_MOVE(__rcvr));
+    return __task_opstate_t<_Rcvr>(__attrs_.__sch_.__backend_, _CCCL_MOVE(__rcvr));
   }
 
   template <class _Self>
@@ -444,7 +468,7 @@ private:
   size_t __shape_;
   _Values __values_{};
   __backend_ptr_t __backend_;
-  ::cuda::std::byte __storage_[8 * sizeof(void*)];
+  alignas(::cuda::std::max_align_t) ::cuda::std::byte __storage_[__task_bulk_storage_size];
 };
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -541,6 +565,14 @@ struct __bulk_unchunked_fn
   bulk_item_receiver_proxy& __rcvr_;
 };
 
+// Whether an object of type _Ty can be constructed in __storage.
+template <class _Ty>
+[[nodiscard]] _CCCL_API auto __fits_in(::cuda::std::span<::cuda::std::byte> __storage) noexcept -> bool
+{
+  return __storage.size() >= sizeof(_Ty)
+      && reinterpret_cast<::cuda::std::uintptr_t>(__storage.data()) % alignof(_Ty) == 0;
+}
+
 template <class _Ty, class _Alloc, class... _Args>
 _CCCL_API auto __emplace_into(::cuda::std::span<::cuda::std::byte> __storage, _Alloc& __alloc, _Args&&... __args)
   -> _Ty&
@@ -548,7 +580,7 @@ _CCCL_API auto __emplace_into(::cuda::std::span<::cuda::std::byte> __storage, _A
   using __traits_t = ::cuda::std::allocator_traits<__rebind_alloc_t<_Alloc, _Ty>>;
   __rebind_alloc_t<_Alloc, _Ty> __alloc_copy{__alloc};
 
-  const bool __in_situ = __storage.size() >= sizeof(_Ty);
+  const bool __in_situ = __detail::__fits_in<_Ty>(__storage);
   auto* __ty_ptr       = __in_situ ? reinterpret_cast<_Ty*>(__storage.data()) : __traits_t::allocate(__alloc_copy, 1);
   __traits_t::construct(__alloc_copy, __ty_ptr, static_cast<_Args&&>(__args)...);
   return *::cuda::std::launder(__ty_ptr);
@@ -606,7 +638,7 @@ private:
 }
 
 template <class _Sch, class _Alloc>
-class _CCCL_DECLSPEC_EMPTY_BASES task_scheduler::__backend_for
+class _CCCL_DECLSPEC_EMPTY_BASES task_scheduler::__backend_for final
     : public __detail::__task_scheduler_backend
     , _Alloc
 {
@@ -619,10 +651,12 @@ class _CCCL_DECLSPEC_EMPTY_BASES task_scheduler::__backend_for
   {
     _CCCL_TRY
     {
-      using __opstate_t    = connect_result_t<_Sndr, __detail::__proxy_receiver<_RcvrProxy>>;
-      const bool __in_situ = __storage.size() >= sizeof(__opstate_t);
+      // The deleter that __opstate_t passes to its receiver must agree with
+      // __emplace_into about where the operation state lives.
+      using __opstate_t    = __detail::__opstate_t<_Alloc, _Sndr>;
+      const bool __in_situ = __detail::__fits_in<__opstate_t>(__storage);
       _Alloc& __alloc      = *this;
-      auto& __opstate      = __detail::__emplace_into<__detail::__opstate_t<_Alloc, _Sndr>>(
+      auto& __opstate      = __detail::__emplace_into<__opstate_t>(
         __storage, __alloc, __alloc, static_cast<_Sndr&&>(__sndr), __rcvr_proxy, __in_situ);
       execution::start(__opstate);
     }
@@ -655,7 +689,7 @@ public:
 
   _CCCL_API void schedule_bulk_unchunked(size_t __size,
                                          bulk_item_receiver_proxy& __rcvr_proxy,
-                                         ::cuda::std::span<::cuda::std::byte> __storage) noexcept override
+                                         ::cuda::std::span<::cuda::std::byte> __storage) noexcept final override
   {
     auto __sndr =
       execution::bulk_unchunked(execution::schedule(__sch_), par, __size, __detail::__bulk_unchunked_fn{__rcvr_proxy});
@@ -0,0 +1,98 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_TIMED_SCHEDULER
+#define __CUDAX_EXECUTION_TIMED_SCHEDULER
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__type_traits/decay.h>
+
+#include <cuda/experimental/__detail/type_traits.cuh>
+#include <cuda/experimental/__execution/concepts.cuh>
+#include <cuda/experimental/__execution/fwd.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+// Timed schedulers are schedulers that also have a clock. They provide senders that
+// complete on the scheduler's execution resource once a point in time of that clock is
+// reached, which makes timeouts and periodic work possible without a thread that
+// sleeps on the side.
+
+struct now_t
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Sch>
+  _CCCL_TRIVIAL_API constexpr auto operator()(const _Sch& __sch) const noexcept -> decltype(__sch.now())
+  {
+    static_assert(noexcept(__sch.now()));
+    return __sch.now();
+  }
+};
+
+struct schedule_after_t
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Sch, class _Duration>
+  _CCCL_TRIVIAL_API constexpr auto operator()(_Sch&& __sch, const _Duration& __duration) const noexcept
+    -> decltype(static_cast<_Sch&&>(__sch).schedule_after(__duration))
+  {
+    static_assert(noexcept(static_cast<_Sch&&>(__sch).schedule_after(__duration)));
+    return static_cast<_Sch&&>(__sch).schedule_after(__duration);
+  }
+};
+
+struct schedule_at_t
+{
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Sch, class _TimePoint>
+  _CCCL_TRIVIAL_API constexpr auto operator()(_Sch&& __sch, const _TimePoint& __time_point) const noexcept
+    -> decltype(static_cast<_Sch&&>(__sch).schedule_at(__time_point))
+  {
+    static_assert(noexcept(static_cast<_Sch&&>(__sch).schedule_at(__time_point)));
+    return static_cast<_Sch&&>(__sch).schedule_at(__time_point);
+  }
+};
+
+_CCCL_GLOBAL_CONSTANT now_t now{};
+_CCCL_GLOBAL_CONSTANT schedule_after_t schedule_after{};
+_CCCL_GLOBAL_CONSTANT schedule_at_t schedule_at{};
+
+template <class _Sch>
+using time_point_of_t _CCCL_NODEBUG_ALIAS = decay_t<__call_result_t<now_t, const _Sch&>>;
+
+template <class _Sch>
+using duration_of_t _CCCL_NODEBUG_ALIAS = typename time_point_of_t<_Sch>::duration;
+
+template <class _Sch>
+_CCCL_CONCEPT timed_scheduler = //
+  _CCCL_REQUIRES_EXPR((_Sch), __declfn_t<_Sch> __sch) //
+  ( //
+    requires(scheduler<_Sch>), //
+    execution::now(__sch()), //
+    execution::schedule_after(__sch(), duration_of_t<_Sch>{}), //
+    execution::schedule_at(__sch(), time_point_of_t<_Sch>{}) //
+  );
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_TIMED_SCHEDULER
@@ -0,0 +1,263 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_TIMER_WHEEL
+#define __CUDAX_EXECUTION_TIMER_WHEEL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/experimental/__detail/utility.cuh>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+// A timer of a __timer_wheel. It is owned by the operation that inserts it.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __timer_node : __immovable
+{
+  // The tick at which the timer expires.
+  ::cuda::std::uint64_t __deadline_ = 0;
+  __timer_node* __next_             = nullptr;
+  __timer_node* __prev_             = nullptr;
+  // The head of the list that holds the timer, or null if the timer is not in a wheel.
+  __timer_node** __list_ = nullptr;
+};
+
+// A hierarchical timer wheel. Time is counted in ticks, and level L of the wheel has 64
+// slots of 64^L ticks each. A timer goes to the level of the highest group of 6 bits in
+// which its deadline differs from the current tick, in the slot that this group of its
+// deadline selects. When the current tick reaches a slot of a level above 0, the timers
+// of the slot are moved down to lower levels; when it reaches a slot of level 0, its
+// timers expire. Timers further away than the top level reaches go to an overflow list,
+// which is sorted out again at every turn of the top level.
+//
+// Inserting and erasing a timer takes constant time. Slots are doubly-linked lists, and
+// every level keeps a mask of its non-empty slots, so that finding the next slot to
+// process takes one count of trailing zeros per level no matter how far away it is.
+//
+// The wheel is not thread-safe.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __timer_wheel : __immovable
+{
+public:
+  static constexpr int __bits_per_level = 6;
+  static constexpr int __level_size     = 1 << __bits_per_level;
+  static constexpr int __levels         = 6;
+
+  _CCCL_HIDE_FROM_ABI __timer_wheel() = default;
+
+  [[nodiscard]] _CCCL_API auto __empty() const noexcept -> bool
+  {
+    return __size_ == 0;
+  }
+
+  [[nodiscard]] _CCCL_API auto __size() const noexcept -> ::cuda::std::size_t
+  {
+    return __size_;
+  }
+
+  // The tick up to which the wheel has been advanced.
+  [[nodiscard]] _CCCL_API auto __now() const noexcept -> ::cuda::std::uint64_t
+  {
+    return __now_;
+  }
+
+  // Moves the current tick of an empty wheel, forwards or backwards.
+  _CCCL_API void __reset(::cuda::std::uint64_t __now) noexcept
+  {
+    _CCCL_ASSERT(__empty(), "only an empty timer wheel can be reset");
+    __now_ = __now;
+  }
+
+  // Inserts a timer. A timer that is already due expires at the next call to __advance.
+  _CCCL_API void __insert(__timer_node* __timer) noexcept
+  {
+    _CCCL_ASSERT(__timer->__list_ == nullptr, "the timer is already in a timer wheel");
+    __place(__timer);
+  }
+
+  // Removes a timer that is in the wheel.
+  _CCCL_API void __erase(__timer_node* __timer) noexcept
+  {
+    _CCCL_ASSERT(__timer->__list_ != nullptr, "the timer is not in a timer wheel");
+    __timer_node** __list = __timer->__list_;
+    if (__timer->__prev_ != nullptr)
+    {
+      __timer->__prev_->__next_ = __timer->__next_;
+    }
+    else
+    {
+      *__list = __timer->__next_;
+    }
+    if (__timer->__next_ != nullptr)
+    {
+      __timer->__next_->__prev_ = __timer->__prev_;
+    }
+    if (*__list == nullptr && __list != &__overflow_)
+    {
+      const auto __index = static_cast<int>(__list - &__slots_[0][0]);
+      __masks_[__index / __level_size] &= ~(::cuda::std::uint64_t{1} << (__index % __level_size));
+    }
+    __timer->__list_ = nullptr;
+    --__size_;
+  }
+
+  // The next tick at which __advance has work to do, or the largest tick if the wheel is
+  // empty. No timer expires before that tick.
+  [[nodiscard]] _CCCL_API auto __next_tick() const noexcept -> ::cuda::std::uint64_t
+  {
+    int __level = 0;
+    int __slot  = 0;
+    return __next_event(__level, __slot);
+  }
+
+  // Advances the current tick to __now, and returns the timers that expire on the way as
+  // a list linked by their __next_ pointers.
+  [[nodiscard]] _CCCL_API auto __advance(::cuda::std::uint64_t __now) noexcept -> __timer_node*
+  {
+    __timer_node* __head  = nullptr;
+    __timer_node** __tail = &__head;
+    while (__size_ != 0)
+    {
+      int __level        = 0;
+      int __slot         = 0;
+      const auto __event = __next_event(__level, __slot);
+      if (__event > __now)
+      {
+        break;
+      }
+
+      __now_                = __event;
+      __timer_node** __list = __level < __levels ? &__slots_[__level][__slot] : &__overflow_;
+      __timer_node* __timer = ::cuda::std::exchange(*__list, nullptr);
+      if (__level < __levels)
+      {
+        __masks_[__level] &= ~(::cuda::std::uint64_t{1} << __slot);
+      }
+
+      while (__timer != nullptr)
+      {
+        __timer_node* __next = __timer->__next_;
+        __timer->__list_     = nullptr;
+        --__size_;
+        if (__timer->__deadline_ <= __now_)
+        {
+          __timer->__next_ = nullptr;
+          *__tail          = __timer;
+          __tail           = &__timer->__next_;
+        }
+        else
+        {
+          __place(__timer);
+        }
+        __timer = __next;
+      }
+    }
+    __now_ = (::cuda::std::max) (__now_, __now);
+    return __head;
+  }
+
+  // Removes all the timers, and returns them as a list linked by their __next_ pointers.
+  [[nodiscard]] _CCCL_API auto __clear() noexcept -> __timer_node*
+  {
+    __timer_node* __head = nullptr;
+    while (__size_ != 0)
+    {
+      int __level = 0;
+      int __slot  = 0;
+      (void) __next_event(__level, __slot);
+      __timer_node* __timer = __level < __levels ? __slots_[__level][__slot] : __overflow_;
+      __erase(__timer);
+      __timer->__next_ = __head;
+      __head           = __timer;
+    }
+    return __head;
+  }
+
+private:
+  static constexpr int __top_bits = __bits_per_level * __levels;
+
+  _CCCL_API void __place(__timer_node* __timer) noexcept
+  {
+    // The timer goes at least one tick ahead, so that it differs from the current tick.
+    const auto __tick  = (::cuda::std::max) (__timer->__deadline_, __now_ + 1);
+    const auto __level = (::cuda::std::bit_width(__tick ^ __now_) - 1) / __bits_per_level;
+
+    __timer_node** __list = &__overflow_;
+    if (__level < __levels)
+    {
+      const auto __slot = static_cast<int>((__tick >> (__level * __bits_per_level)) % __level_size);
+      __list            = &__slots_[__level][__slot];
+      __masks_[__level] |= ::cuda::std::uint64_t{1} << __slot;
+    }
+
+    __timer->__prev_ = nullptr;
+    __timer->__next_ = *__list;
+    if (*__list != nullptr)
+    {
+      (*__list)->__prev_ = __timer;
+    }
+    *__list          = __timer;
+    __timer->__list_ = __list;
+    ++__size_;
+  }
+
+  // The tick at which the first non-empty slot is reached. Every timer of a level is in
+  // a slot after the current one, so the first non-empty level has the first event.
+  [[nodiscard]] _CCCL_API auto __next_event(int& __level, int& __slot) const noexcept -> ::cuda::std::uint64_t
+  {
+    for (__level = 0; __level < __levels; ++__level)
+    {
+      const int __shift    = __level * __bits_per_level;
+      const auto __current = static_cast<int>((__now_ >> __shift) % __level_size);
+      // the slots after the current one; shifting 2 by 63 wraps around to 0
+      const auto __mask = __masks_[__level] & ~((::cuda::std::uint64_t{2} << __current) - 1);
+      if (__mask != 0)
+      {
+        __slot = ::cuda::std::countr_zero(__mask);
+        return ((__now_ >> (__shift + __bits_per_level)) << (__shift + __bits_per_level))
+             | (static_cast<::cuda::std::uint64_t>(__slot) << __shift);
+      }
+    }
+
+    if (__overflow_ != nullptr)
+    {
+      // the start of the next turn of the top level
+      return ((__now_ >> __top_bits) + 1) << __top_bits;
+    }
+    return (::cuda::std::numeric_limits<::cuda::std::uint64_t>::max)();
+  }
+
+  ::cuda::std::uint64_t __now_ = 0;
+  ::cuda::std::size_t __size_  = 0;
+  ::cuda::std::uint64_t __masks_[__levels]{};
+  __timer_node* __slots_[__levels][__level_size]{};
+  __timer_node* __overflow_ = nullptr;
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_TIMER_WHEEL
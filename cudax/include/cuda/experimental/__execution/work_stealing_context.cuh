@@ -0,0 +1,333 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_WORK_STEALING_CONTEXT
+#define __CUDAX_EXECUTION_WORK_STEALING_CONTEXT
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__exception/terminate.h>
+#include <cuda/std/__new/launder.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__execution/parallel_scheduler_backend.cuh>
+#include <cuda/experimental/__execution/task_scheduler.cuh>
+#include <cuda/experimental/__execution/work_stealing_pool.cuh>
+#include <cuda/experimental/__utility/shared_ptr.cuh>
+
+#include <new>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+namespace __detail
+{
+// Constructs a _Task in __storage if it fits there, and on the heap otherwise.
+template <class _Task, class... _Args>
+_CCCL_HOST_API auto __make_ws_task(::cuda::std::span<::cuda::std::byte> __storage, _Args&&... __args) -> _Task*
+{
+  const bool __in_situ = __storage.size() >= sizeof(_Task)
+                      && reinterpret_cast<::cuda::std::uintptr_t>(__storage.data()) % alignof(_Task) == 0;
+  if (__in_situ)
+  {
+    return ::cuda::std::launder(::new (__storage.data()) _Task(static_cast<_Args&&>(__args)..., true));
+  }
+  return ::new _Task(static_cast<_Args&&>(__args)..., false);
+}
+
+template <class _Task>
+_CCCL_HOST_API void __destroy_ws_task(_Task* __task) noexcept
+{
+  if (__task->__in_situ_)
+  {
+    __task->~_Task();
+  }
+  else
+  {
+    delete __task;
+  }
+}
+
+// The task submitted to the pool by schedule().
+struct __ws_schedule_task : __ws_task
+{
+  _CCCL_HOST_API explicit __ws_schedule_task(receiver_proxy& __proxy, bool __in_situ) noexcept
+      : __ws_task(&__execute_impl)
+      , __proxy_(__proxy)
+      , __in_situ_(__in_situ)
+  {}
+
+  _CCCL_HOST_API static void __execute_impl(__ws_task* __task) noexcept
+  {
+    auto* __self            = static_cast<__ws_schedule_task*>(__task);
+    receiver_proxy& __proxy = __self->__proxy_;
+    __destroy_ws_task(__self);
+
+    if (__proxy.get_env().query(get_stop_token_t{}).stop_requested())
+    {
+      __proxy.set_stopped();
+    }
+    else
+    {
+      __proxy.set_value();
+    }
+  }
+
+  receiver_proxy& __proxy_;
+  bool __in_situ_;
+};
+
+// The task submitted to the pool by schedule_bulk_[un]chunked(). When a worker runs it, it forks
+// it to as many other workers as are useful; every copy then claims chunks of the iteration space
+// until there are none left. The last copy to finish completes the operation, so no copy is still
+// in a deque when the storage of the task goes away.
+template <bool _Chunked>
+struct __ws_bulk_task : __ws_task
+{
+  _CCCL_HOST_API explicit __ws_bulk_task(bulk_item_receiver_proxy& __proxy,
+                                          size_t __shape,
+                                          size_t __num_chunks,
+                                          size_t __num_copies,
+                                          bool __in_situ) noexcept
+      : __ws_task(&__start)
+      , __proxy_(__proxy)
+      , __shape_(__shape)
+      , __num_chunks_(__num_chunks)
+      , __refs_(__num_copies)
+      , __in_situ_(__in_situ)
+  {}
+
+  _CCCL_HOST_API static void __start(__ws_task* __task) noexcept
+  {
+    auto* __self = static_cast<__ws_bulk_task*>(__task);
+
+    if (__self->__proxy_.get_env().query(get_stop_token_t{}).stop_requested())
+    {
+      bulk_item_receiver_proxy& __proxy = __self->__proxy_;
+      __destroy_ws_task(__self);
+      __proxy.set_stopped();
+      return;
+    }
+
+    const size_t __num_copies = __self->__refs_.load(::cuda::std::memory_order_relaxed);
+    __self->__execute_fn_     = &__help;
+    if (__num_copies > 1)
+    {
+      __work_stealing_pool::__fork(__self, __num_copies - 1);
+    }
+    __help(__self);
+  }
+
+  _CCCL_HOST_API static void __help(__ws_task* __task) noexcept
+  {
+    auto* __self                      = static_cast<__ws_bulk_task*>(__task);
+    bulk_item_receiver_proxy& __proxy = __self->__proxy_;
+
+    // chunk __c is [__c * __q + min(__c, __r), (__c + 1) * __q + min(__c + 1, __r))
+    const size_t __q = __self->__shape_ / (::cuda::std::max)(__self->__num_chunks_, size_t{1});
+    const size_t __r = __self->__shape_ % (::cuda::std::max)(__self->__num_chunks_, size_t{1});
+
+    for (size_t __c = __self->__next_chunk_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+         __c < __self->__num_chunks_;
+         __c = __self->__next_chunk_.fetch_add(1, ::cuda::std::memory_order_relaxed))
+    {
+      const size_t __begin = __c * __q + (::cuda::std::min)(__c, __r);
+      const size_t __end   = __begin + __q + (__c < __r);
+
+      if constexpr (_Chunked)
+      {
+        __proxy.execute(__begin, __end);
+      }
+      else
+      {
+        for (size_t __i = __begin; __i < __end; ++__i)
+        {
+          __proxy.execute(__i, __i + 1);
+        }
+      }
+    }
+
+    if (__self->__refs_.fetch_sub(1, ::cuda::std::memory_order_acq_rel) == 1)
+    {
+      __destroy_ws_task(__self);
+      __proxy.set_value();
+    }
+  }
+
+  bulk_item_receiver_proxy& __proxy_;
+  size_t __shape_;
+  size_t __num_chunks_;
+  ::cuda::std::atomic<size_t> __next_chunk_{0};
+  ::cuda::std::atomic<size_t> __refs_;
+  bool __in_situ_;
+};
+
+// A task_scheduler backend that runs work on a __work_stealing_pool.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __work_stealing_backend final : public __task_scheduler_backend
+{
+public:
+  // Every worker gets this many chunks of a bulk operation on average, so that the workers that
+  // finish early can take over some of the work of the others.
+  static constexpr size_t __chunks_per_worker = 4;
+
+  _CCCL_HOST_API explicit __work_stealing_backend(size_t __num_threads, bool __pin_workers)
+      : __pool_(__num_threads, __pin_workers)
+  {}
+
+  _CCCL_API void schedule(receiver_proxy& __proxy, ::cuda::std::span<::cuda::std::byte> __storage) noexcept override
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__schedule(__proxy, __storage);), (::cuda::std::terminate();))
+  }
+
+  _CCCL_API void schedule_bulk_chunked(size_t __shape,
+                                       bulk_item_receiver_proxy& __proxy,
+                                       ::cuda::std::span<::cuda::std::byte> __storage) noexcept override
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__schedule_bulk<true>(__shape, __proxy, __storage);), (::cuda::std::terminate();))
+  }
+
+  _CCCL_API void schedule_bulk_unchunked(size_t __shape,
+                                         bulk_item_receiver_proxy& __proxy,
+                                         ::cuda::std::span<::cuda::std::byte> __storage) noexcept override
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__schedule_bulk<false>(__shape, __proxy, __storage);), (::cuda::std::terminate();))
+  }
+
+  [[nodiscard]]
+  _CCCL_API auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee override
+  {
+    return forward_progress_guarantee::parallel;
+  }
+
+  // task_scheduler only compares the backend against schedulers of other types, and this backend has no underlying
+  // scheduler type that one of them could be. Two task_schedulers of the same pool compare equal through their shared
+  // backend instead.
+  [[nodiscard]] _CCCL_API bool __equal_to(const void*, ::cuda::std::__type_info_ref) override
+  {
+    return false;
+  }
+
+  _CCCL_HOST_API void join() noexcept
+  {
+    __pool_.join();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto size() const noexcept -> size_t
+  {
+    return __pool_.size();
+  }
+
+private:
+  _CCCL_HOST_API void __schedule(receiver_proxy& __proxy, ::cuda::std::span<::cuda::std::byte> __storage) noexcept
+  {
+    _CCCL_TRY
+    {
+      auto* __task = __make_ws_task<__ws_schedule_task>(__storage, __proxy);
+      if (!__pool_.__submit(__task))
+      {
+        __destroy_ws_task(__task);
+        __proxy.set_stopped();
+      }
+    }
+    _CCCL_CATCH_ALL
+    {
+      __proxy.set_error(execution::current_exception());
+    }
+  }
+
+  template <bool _Chunked>
+  _CCCL_HOST_API void __schedule_bulk(
+    size_t __shape, bulk_item_receiver_proxy& __proxy, ::cuda::std::span<::cuda::std::byte> __storage) noexcept
+  {
+    const size_t __num_chunks = (::cuda::std::min)(__shape, __pool_.size() * __chunks_per_worker);
+    const size_t __num_copies = (::cuda::std::max)((::cuda::std::min)(__num_chunks, __pool_.size()), size_t{1});
+    _CCCL_TRY
+    {
+      auto* __task =
+        __make_ws_task<__ws_bulk_task<_Chunked>>(__storage, __proxy, __shape, __num_chunks, __num_copies);
+      if (!__pool_.__submit(__task))
+      {
+        __destroy_ws_task(__task);
+        __proxy.set_stopped();
+      }
+    }
+    _CCCL_CATCH_ALL
+    {
+      __proxy.set_error(execution::current_exception());
+    }
+  }
+
+  __work_stealing_pool __pool_;
+};
+} // namespace __detail
+
+//! @brief An execution context that runs work on a pool of threads with one work-stealing deque
+//! each.
+//!
+//! The scheduler of a `work_stealing_context` is a @c task_scheduler. `schedule()` runs the
+//! continuation on one of the workers. `bulk_chunked` and `bulk_unchunked` operations are split
+//! into a few chunks per worker, which idle workers steal from each other until all have run, so
+//! the iterations are spread over all the workers without any external library.
+//!
+//! On Linux, the workers can optionally be pinned to the CPUs the process may run on. Workers are
+//! then assigned one NUMA node after the other and steal from the workers on their own node first.
+class _CCCL_TYPE_VISIBILITY_DEFAULT work_stealing_context
+{
+public:
+  //! @brief Starts @p __num_threads workers, one per CPU the process may run on if 0.
+  //! @param __pin_workers If true, binds every worker to a single CPU.
+  _CCCL_HOST_API explicit work_stealing_context(size_t __num_threads = 0, bool __pin_workers = false)
+      : __backend_(experimental::__make_shared<__detail::__work_stealing_backend>(__num_threads, __pin_workers))
+  {}
+
+  _CCCL_HOST_API ~work_stealing_context() noexcept
+  {
+    join();
+  }
+
+  //! @brief Runs the work scheduled so far and stops the workers. Work scheduled from other threads
+  //! afterwards completes with @c set_stopped.
+  _CCCL_HOST_API void join() noexcept
+  {
+    __backend_->join();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto get_scheduler() const -> task_scheduler
+  {
+    return task_scheduler{__detail::__backend_ptr_t{__backend_}};
+  }
+
+  //! @brief Returns the number of workers.
+  [[nodiscard]] _CCCL_HOST_API auto size() const noexcept -> size_t
+  {
+    return __backend_->size();
+  }
+
+private:
+  __shared_ptr<__detail::__work_stealing_backend> __backend_;
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_WORK_STEALING_CONTEXT
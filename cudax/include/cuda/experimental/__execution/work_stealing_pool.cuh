@@ -0,0 +1,550 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_WORK_STEALING_POOL
+#define __CUDAX_EXECUTION_WORK_STEALING_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+
+#include <cuda/experimental/__execution/atomic_intrusive_queue.cuh>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif // __linux__
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+// A unit of work executed by a __work_stealing_pool.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __ws_task : __immovable
+{
+  using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__ws_task*) noexcept;
+
+  _CCCL_HIDE_FROM_ABI __ws_task() = default;
+  _CCCL_HOST_API explicit __ws_task(__execute_fn_t* __execute_fn) noexcept
+      : __execute_fn_(__execute_fn)
+  {}
+
+  _CCCL_HOST_API void __execute() noexcept
+  {
+    (*__execute_fn_)(this);
+  }
+
+  __execute_fn_t* __execute_fn_ = nullptr;
+  __ws_task* __next_            = nullptr;
+};
+
+// The work-stealing deque of Chase and Lev, with the memory orderings of Lê et al., "Correct and
+// Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013). Only the owning thread may push and
+// pop, at the bottom; any other thread may steal, from the top. The same task may be pushed more
+// than once.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __work_stealing_deque : __immovable
+{
+  struct __ring
+  {
+    _CCCL_HOST_API explicit __ring(::cuda::std::ptrdiff_t __capacity)
+        : __mask_(__capacity - 1)
+        , __slots_(new ::cuda::std::atomic<__ws_task*>[static_cast<size_t>(__capacity)])
+    {}
+
+    [[nodiscard]] _CCCL_HOST_API auto __capacity() const noexcept -> ::cuda::std::ptrdiff_t
+    {
+      return __mask_ + 1;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __get(::cuda::std::ptrdiff_t __i) const noexcept -> __ws_task*
+    {
+      return __slots_[__i & __mask_].load(::cuda::std::memory_order_relaxed);
+    }
+
+    _CCCL_HOST_API void __put(::cuda::std::ptrdiff_t __i, __ws_task* __task) noexcept
+    {
+      __slots_[__i & __mask_].store(__task, ::cuda::std::memory_order_relaxed);
+    }
+
+    ::cuda::std::ptrdiff_t __mask_;
+    ::std::unique_ptr<::cuda::std::atomic<__ws_task*>[]> __slots_;
+  };
+
+public:
+  static constexpr ::cuda::std::ptrdiff_t __initial_capacity = 256;
+
+  _CCCL_HOST_API __work_stealing_deque()
+  {
+    __rings_.push_back(::std::make_unique<__ring>(__initial_capacity));
+    __ring_.store(__rings_.back().get(), ::cuda::std::memory_order_relaxed);
+  }
+
+  // Owner only.
+  _CCCL_HOST_API void push(__ws_task* __task)
+  {
+    const auto __b = __bottom_.load(::cuda::std::memory_order_relaxed);
+    const auto __t = __top_.load(::cuda::std::memory_order_acquire);
+    __ring* __r    = __ring_.load(::cuda::std::memory_order_relaxed);
+
+    if (__b - __t > __r->__capacity() - 1)
+    {
+      __r = __grow(__r, __t, __b);
+    }
+
+    __r->__put(__b, __task);
+    __bottom_.store(__b + 1, ::cuda::std::memory_order_release);
+  }
+
+  // Owner only. Returns the most recently pushed task, or nullptr if the deque is empty.
+  [[nodiscard]] _CCCL_HOST_API auto pop() noexcept -> __ws_task*
+  {
+    const auto __b = __bottom_.load(::cuda::std::memory_order_relaxed) - 1;
+    __ring* __r    = __ring_.load(::cuda::std::memory_order_relaxed);
+    __bottom_.store(__b, ::cuda::std::memory_order_relaxed);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    auto __t = __top_.load(::cuda::std::memory_order_relaxed);
+
+    __ws_task* __task = nullptr;
+    if (__t <= __b)
+    {
+      __task = __r->__get(__b);
+      if (__t == __b)
+      {
+        // last element, race against the thieves for it:
+        if (!__top_.compare_exchange_strong(
+              __t, __t + 1, ::cuda::std::memory_order_seq_cst, ::cuda::std::memory_order_relaxed))
+        {
+          __task = nullptr;
+        }
+        __bottom_.store(__b + 1, ::cuda::std::memory_order_relaxed);
+      }
+    }
+    else
+    {
+      __bottom_.store(__b + 1, ::cuda::std::memory_order_relaxed);
+    }
+    return __task;
+  }
+
+  // Any thread. Returns the least recently pushed task, or nullptr if the deque is empty or
+  // another thread won the race for the task. __lost is set in the latter case.
+  [[nodiscard]] _CCCL_HOST_API auto steal(bool& __lost) noexcept -> __ws_task*
+  {
+    auto __t = __top_.load(::cuda::std::memory_order_acquire);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    const auto __b = __bottom_.load(::cuda::std::memory_order_acquire);
+
+    if (__t < __b)
+    {
+      __ws_task* __task = __ring_.load(::cuda::std::memory_order_acquire)->__get(__t);
+      if (__top_.compare_exchange_strong(
+            __t, __t + 1, ::cuda::std::memory_order_seq_cst, ::cuda::std::memory_order_relaxed))
+      {
+        return __task;
+      }
+      __lost = true;
+    }
+    return nullptr;
+  }
+
+private:
+  // Replaces the ring by one twice as large. The old ring is kept alive because concurrent thieves
+  // may still be reading from it.
+  _CCCL_HOST_API auto __grow(__ring* __old, ::cuda::std::ptrdiff_t __t, ::cuda::std::ptrdiff_t __b) -> __ring*
+  {
+    __rings_.push_back(::std::make_unique<__ring>(2 * __old->__capacity()));
+    __ring* __new = __rings_.back().get();
+    for (auto __i = __t; __i < __b; ++__i)
+    {
+      __new->__put(__i, __old->__get(__i));
+    }
+    __ring_.store(__new, ::cuda::std::memory_order_release);
+    return __new;
+  }
+
+  alignas(64)::cuda::std::atomic<::cuda::std::ptrdiff_t> __top_{0};
+  alignas(64)::cuda::std::atomic<::cuda::std::ptrdiff_t> __bottom_{0};
+  ::cuda::std::atomic<__ring*> __ring_{nullptr};
+  ::std::vector<::std::unique_ptr<__ring>> __rings_;
+};
+
+namespace __detail
+{
+// The CPUs this process may run on, grouped by NUMA node. On Linux, the nodes are read from sysfs
+// and the CPUs from the affinity mask of the process; elsewhere, all workers share a single node
+// and are never pinned.
+struct __cpu_topology
+{
+  struct __cpu
+  {
+    int __id_;
+    int __node_;
+  };
+
+  _CCCL_HOST_API __cpu_topology()
+  {
+#if defined(__linux__)
+    ::cpu_set_t __allowed;
+    CPU_ZERO(&__allowed);
+    if (::sched_getaffinity(0, sizeof(__allowed), &__allowed) != 0)
+    {
+      return;
+    }
+
+    for (int __id = 0; __id < CPU_SETSIZE; ++__id)
+    {
+      if (CPU_ISSET(__id, &__allowed))
+      {
+        __cpus_.push_back({__id, 0});
+      }
+    }
+
+    for (int __node = 0;; ++__node)
+    {
+      char __path[64];
+      ::std::snprintf(__path, sizeof(__path), "/sys/devices/system/node/node%d/cpulist", __node);
+      ::std::FILE* __file = ::std::fopen(__path, "r");
+      if (__file == nullptr)
+      {
+        break;
+      }
+
+      // the list has the form "0-3,8,10-11"
+      int __first = 0;
+      while (::std::fscanf(__file, "%d", &__first) == 1)
+      {
+        int __last = __first;
+        int __sep  = ::std::fgetc(__file);
+        if (__sep == '-')
+        {
+          if (::std::fscanf(__file, "%d", &__last) != 1)
+          {
+            break;
+          }
+          __sep = ::std::fgetc(__file);
+        }
+        __assign_node(__first, __last, __node);
+        if (__sep != ',')
+        {
+          break;
+        }
+      }
+      ::std::fclose(__file);
+    }
+
+    ::std::stable_sort(__cpus_.begin(), __cpus_.end(), [](const __cpu& __lhs, const __cpu& __rhs) {
+      return __lhs.__node_ < __rhs.__node_;
+    });
+#endif // __linux__
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __size() const noexcept -> size_t
+  {
+    return __cpus_.size();
+  }
+
+  // The CPU worker __i runs on. Workers are spread over the nodes in order, so that consecutive
+  // workers share a node.
+  [[nodiscard]] _CCCL_HOST_API auto operator[](size_t __i) const noexcept -> const __cpu&
+  {
+    return __cpus_[__i % __cpus_.size()];
+  }
+
+private:
+  _CCCL_HOST_API void __assign_node(int __first, int __last, int __node) noexcept
+  {
+    for (auto& __c : __cpus_)
+    {
+      if (__first <= __c.__id_ && __c.__id_ <= __last)
+      {
+        __c.__node_ = __node;
+      }
+    }
+  }
+
+  ::std::vector<__cpu> __cpus_;
+};
+} // namespace __detail
+
+// A fixed-size pool of threads with one work-stealing deque each. Tasks submitted from a worker go
+// to the bottom of the worker's deque; tasks submitted from other threads go to the inbox of one of
+// the workers, chosen round-robin. Idle workers first drain their inbox and then steal from the
+// other workers, those on the same NUMA node first. Workers that find no work go to sleep on an
+// epoch counter that is bumped whenever work is pushed while some worker is asleep.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __work_stealing_pool : __immovable
+{
+  struct __worker : __immovable
+  {
+    __work_stealing_pool* __pool_ = nullptr;
+    __work_stealing_deque __deque_;
+    __atomic_intrusive_queue<&__ws_task::__next_> __inbox_;
+    ::std::vector<__worker*> __victims_;
+    int __cpu_  = -1;
+    int __node_ = 0;
+    ::std::thread __thread_;
+  };
+
+public:
+  // Starts num_threads workers (one per hardware thread if 0). If pin_workers is true, every worker
+  // is bound to one of the CPUs the process may run on, filling one NUMA node after the other.
+  _CCCL_HOST_API explicit __work_stealing_pool(size_t __num_threads = 0, bool __pin_workers = false)
+  {
+    const __detail::__cpu_topology __topology;
+
+    if (__num_threads == 0)
+    {
+      __num_threads = __topology.__size() != 0 ? __topology.__size() : ::std::thread::hardware_concurrency();
+      __num_threads = ::cuda::std::max<size_t>(__num_threads, 1);
+    }
+
+    __workers_.reserve(__num_threads);
+    for (size_t __i = 0; __i < __num_threads; ++__i)
+    {
+      auto& __w   = *__workers_.emplace_back(::std::make_unique<__worker>());
+      __w.__pool_ = this;
+      if (__topology.__size() != 0)
+      {
+        __w.__cpu_  = __topology[__i].__id_;
+        __w.__node_ = __topology[__i].__node_;
+      }
+    }
+
+    // every worker steals from the workers after it in turn, those on its own node first:
+    for (size_t __i = 0; __i < __num_threads; ++__i)
+    {
+      auto& __w = *__workers_[__i];
+      for (size_t __j = 1; __j < __num_threads; ++__j)
+      {
+        __w.__victims_.push_back(__workers_[(__i + __j) % __num_threads].get());
+      }
+      ::std::stable_partition(__w.__victims_.begin(), __w.__victims_.end(), [&__w](const __worker* __v) {
+        return __v->__node_ == __w.__node_;
+      });
+    }
+
+    for (auto& __w : __workers_)
+    {
+      __w->__thread_ = ::std::thread{[this, __self = __w.get()] {
+        __run(*__self);
+      }};
+#if defined(__linux__)
+      if (__pin_workers && __w->__cpu_ >= 0)
+      {
+        ::cpu_set_t __cpus;
+        CPU_ZERO(&__cpus);
+        CPU_SET(__w->__cpu_, &__cpus);
+        ::pthread_setaffinity_np(__w->__thread_.native_handle(), sizeof(__cpus), &__cpus);
+      }
+#else // ^^^ __linux__ ^^^ / vvv !__linux__ vvv
+      (void) __pin_workers;
+#endif // ^^^ !__linux__ ^^^
+    }
+  }
+
+  _CCCL_HOST_API ~__work_stealing_pool()
+  {
+    join();
+  }
+
+  // Runs all the work submitted so far and then stops the workers. Work submitted from outside the
+  // pool afterwards is rejected by __submit.
+  _CCCL_HOST_API void join() noexcept
+  {
+    if ((__submitters_.fetch_or(1, ::cuda::std::memory_order_acq_rel) & 1) == 0)
+    {
+      // wait for the submissions that are under way, so that the workers still run them
+      while (__submitters_.load(::cuda::std::memory_order_acquire) != 1)
+      {
+        ::std::this_thread::yield();
+      }
+
+      __stop_.store(true, ::cuda::std::memory_order_release);
+      __epoch_.fetch_add(1, ::cuda::std::memory_order_release);
+      __epoch_.notify_all();
+      for (auto& __w : __workers_)
+      {
+        __w->__thread_.join();
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto size() const noexcept -> size_t
+  {
+    return __workers_.size();
+  }
+
+  // Hands __task to the workers. Returns false without taking __task if join() has been called and
+  // the caller is not one of the workers, which run the work they submit themselves until they stop.
+  [[nodiscard]] _CCCL_HOST_API auto __submit(__ws_task* __task) -> bool
+  {
+    if (__worker* __w = __current_worker(); __w != nullptr && __w->__pool_ == this)
+    {
+      __w->__deque_.push(__task);
+      __wake(false);
+      return true;
+    }
+
+    // the lowest bit is set by join(), the other bits count the submissions that are under way
+    if (__submitters_.fetch_add(2, ::cuda::std::memory_order_acquire) & 1)
+    {
+      __submitters_.fetch_sub(2, ::cuda::std::memory_order_relaxed);
+      return false;
+    }
+
+    const size_t __i = __next_inbox_.fetch_add(1, ::cuda::std::memory_order_relaxed) % __workers_.size();
+    __workers_[__i]->__inbox_.push(__task);
+    __wake(true);
+
+    __submitters_.fetch_sub(2, ::cuda::std::memory_order_release);
+    return true;
+  }
+
+  // Pushes __task __count times to the deque of the calling thread, which must be a worker of some
+  // pool, so that up to __count idle workers of that pool each steal and run it once.
+  _CCCL_HOST_API static void __fork(__ws_task* __task, size_t __count)
+  {
+    __worker* __w = __current_worker();
+    _CCCL_ASSERT(__w != nullptr, "__fork must be called from a worker of a __work_stealing_pool");
+    for (size_t __i = 0; __i < __count; ++__i)
+    {
+      __w->__deque_.push(__task);
+    }
+    __w->__pool_->__wake(__count > 1);
+  }
+
+private:
+  [[nodiscard]] _CCCL_HOST_API static auto __current_worker() noexcept -> __worker*&
+  {
+    static thread_local __worker* __current = nullptr;
+    return __current;
+  }
+
+  _CCCL_HOST_API void __wake(bool __all) noexcept
+  {
+    // pairs with the fence in __run: either the sleeper sees the new work, or we see the sleeper
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    if (__sleepers_.load(::cuda::std::memory_order_relaxed) != 0)
+    {
+      __epoch_.fetch_add(1, ::cuda::std::memory_order_release);
+      if (__all)
+      {
+        __epoch_.notify_all();
+      }
+      else
+      {
+        __epoch_.notify_one();
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __find_task(__worker& __w) -> __ws_task*
+  {
+    if (__ws_task* __task = __w.__deque_.pop())
+    {
+      return __task;
+    }
+
+    // move the tasks submitted from outside the pool to the deque, where they can be stolen:
+    auto __inbox = __w.__inbox_.pop_all();
+    if (!__inbox.empty())
+    {
+      __ws_task* __task = __inbox.pop_front();
+      if (!__inbox.empty())
+      {
+        do
+        {
+          __w.__deque_.push(__inbox.pop_front());
+        } while (!__inbox.empty());
+        __wake(true);
+      }
+      return __task;
+    }
+
+    for (bool __lost = true; __lost;)
+    {
+      __lost = false;
+      for (__worker* __victim : __w.__victims_)
+      {
+        if (__ws_task* __task = __victim->__deque_.steal(__lost))
+        {
+          return __task;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  _CCCL_HOST_API void __run(__worker& __w) noexcept
+  {
+    __current_worker() = &__w;
+
+    while (true)
+    {
+      if (__ws_task* __task = __find_task(__w))
+      {
+        __task->__execute();
+        continue;
+      }
+
+      const auto __epoch = __epoch_.load(::cuda::std::memory_order_acquire);
+      __sleepers_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+      ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+
+      // join() sets __stop_ after the last submission, so the last look for work below sees it
+      const bool __stopping = __stop_.load(::cuda::std::memory_order_acquire);
+      if (__ws_task* __task = __find_task(__w))
+      {
+        __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+        __task->__execute();
+        continue;
+      }
+
+      if (__stopping)
+      {
+        __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+        break;
+      }
+
+      __epoch_.wait(__epoch, ::cuda::std::memory_order_acquire);
+      __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+    }
+
+    __current_worker() = nullptr;
+  }
+
+  ::std::vector<::std::unique_ptr<__worker>> __workers_;
+  alignas(64)::cuda::std::atomic<unsigned> __epoch_{0};
+  ::cuda::std::atomic<unsigned> __sleepers_{0};
+  ::cuda::std::atomic<bool> __stop_{false};
+  alignas(64)::cuda::std::atomic<size_t> __next_inbox_{0};
+  ::cuda::std::atomic<size_t> __submitters_{0};
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_WORK_STEALING_POOL
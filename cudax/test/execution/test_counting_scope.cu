@@ -0,0 +1,222 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+#include "common/utility.cuh"
+#include "testing.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+template <class T>
+struct counting_allocator
+{
+  using value_type = T;
+
+  counting_allocator(int* allocs, int* deallocs) noexcept
+      : allocs(allocs)
+      , deallocs(deallocs)
+  {}
+
+  template <class U>
+  counting_allocator(const counting_allocator<U>& other) noexcept
+      : allocs(other.allocs)
+      , deallocs(other.deallocs)
+  {}
+
+  T* allocate(std::size_t n)
+  {
+    ++*allocs;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) noexcept
+  {
+    ++*deallocs;
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  friend bool operator==(const counting_allocator& a, const counting_allocator& b) noexcept
+  {
+    return a.allocs == b.allocs;
+  }
+
+  int* allocs;
+  int* deallocs;
+};
+
+C2H_TEST("an unused simple_counting_scope can be joined", "[scope][counting_scope]")
+{
+  ex::simple_counting_scope scope;
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("associate forwards the results of the sender", "[scope][counting_scope]")
+{
+  ex::simple_counting_scope scope;
+  auto sndr = ex::just(42) | ex::associate(scope.get_token());
+  check_value_types<types<int>>(sndr);
+  check_sends_stopped<true>(sndr);
+
+  auto [val] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(val == 42);
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("associate completes with set_stopped once the scope is closed", "[scope][counting_scope]")
+{
+  ex::simple_counting_scope scope;
+  scope.close();
+  bool ran  = false;
+  auto sndr = ex::associate(ex::just() | ex::then([&] {
+                              ran = true;
+                            }),
+                            scope.get_token());
+  CHECK_FALSE(ex::sync_wait(std::move(sndr)).has_value());
+  CHECK_FALSE(ran);
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("a scope limits the number of its associations", "[scope][counting_scope]")
+{
+  ex::simple_counting_scope scope{1};
+  auto first  = ex::associate(ex::just(1), scope.get_token());
+  auto second = ex::associate(ex::just(2), scope.get_token());
+  CHECK_FALSE(ex::sync_wait(std::move(second)).has_value());
+  CHECK(ex::sync_wait(std::move(first)).has_value());
+
+  // the association of the first sender has ended
+  auto third = ex::associate(ex::just(3), scope.get_token());
+  auto [val] = ex::sync_wait(std::move(third)).value();
+  CHECK(val == 3);
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("join waits for the senders spawned on a thread_context", "[scope][counting_scope]")
+{
+  ex::thread_context ctx;
+  ex::simple_counting_scope scope;
+  std::atomic<int> count{0};
+  for (int i = 0; i < 100; ++i)
+  {
+    ex::spawn(ex::starts_on(ctx.get_scheduler(), ex::just() | ex::then([&]() noexcept {
+                                                   ++count;
+                                                 })),
+              scope.get_token());
+  }
+  CHECK(ex::sync_wait(scope.join()).has_value());
+  CHECK(count == 100);
+}
+
+C2H_TEST("spawn allocates once with the allocator of the environment", "[scope][counting_scope]")
+{
+  int allocs   = 0;
+  int deallocs = 0;
+  ex::counting_scope scope;
+  auto env = ex::prop{ex::get_allocator, counting_allocator<std::byte>{&allocs, &deallocs}};
+  ex::spawn(ex::just(), scope.get_token(), env);
+  CHECK(allocs == 1);
+  CHECK(deallocs == 1);
+
+  // nothing is allocated for a sender that cannot be associated
+  scope.close();
+  ex::spawn(ex::just(), scope.get_token(), env);
+  CHECK(allocs == 1);
+  CHECK(deallocs == 1);
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("counting_scope::request_stop stops the associated senders", "[scope][counting_scope]")
+{
+  ex::counting_scope scope;
+  scope.request_stop();
+  auto sndr = ex::read_env(ex::get_stop_token) | ex::then([](auto token) {
+                return token.stop_requested();
+              })
+            | ex::associate(scope.get_token());
+  auto [stopped] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(stopped);
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("spawn_future forwards the results of the sender", "[scope][counting_scope]")
+{
+  ex::counting_scope scope;
+  auto values = ex::spawn_future(ex::just(1, 2.0), scope.get_token());
+  check_value_types<types<int, double>>(values);
+
+  auto [i, d] = ex::sync_wait(std::move(values)).value();
+  CHECK(i == 1);
+  CHECK(d == 2.0);
+
+  auto error = ex::spawn_future(ex::just_error(42), scope.get_token()) | ex::upon_error([](int err) {
+                 return err;
+               });
+  auto [err] = ex::sync_wait(std::move(error)).value();
+  CHECK(err == 42);
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("spawn_future completes with set_stopped once the scope is closed", "[scope][counting_scope]")
+{
+  ex::simple_counting_scope scope;
+  scope.close();
+  auto future = ex::spawn_future(ex::just(1), scope.get_token());
+  CHECK_FALSE(ex::sync_wait(std::move(future)).has_value());
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("spawn_future runs the sender before the future is started", "[scope][counting_scope]")
+{
+  ex::thread_context ctx;
+  ex::simple_counting_scope scope;
+  std::atomic<bool> ran{false};
+  auto future = ex::spawn_future(ex::starts_on(ctx.get_scheduler(), ex::just() | ex::then([&] {
+                                                                      ran = true;
+                                                                      return 42;
+                                                                    })),
+                                 scope.get_token());
+  CHECK(ex::sync_wait(scope.join()).has_value());
+  CHECK(ran);
+  auto [val] = ex::sync_wait(std::move(future)).value();
+  CHECK(val == 42);
+}
+
+C2H_TEST("dropping a spawn_future sender stops the spawned sender", "[scope][counting_scope]")
+{
+  int allocs   = 0;
+  int deallocs = 0;
+  ex::run_loop loop;
+  ex::simple_counting_scope scope;
+  bool ran = false;
+  {
+    auto env    = ex::prop{ex::get_allocator, counting_allocator<std::byte>{&allocs, &deallocs}};
+    auto future = ex::spawn_future(ex::schedule(loop.get_scheduler()) | ex::then([&] {
+                                     ran = true;
+                                   }),
+                                   scope.get_token(),
+                                   env);
+    CHECK(allocs == 1);
+  }
+  CHECK(deallocs == 0);
+
+  loop.finish();
+  loop.run();
+  CHECK_FALSE(ran);
+  CHECK(deallocs == 1);
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+} // namespace
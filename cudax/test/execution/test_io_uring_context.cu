@@ -0,0 +1,294 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#if _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
+
+#  include <algorithm>
+#  include <atomic>
+#  include <cerrno>
+#  include <chrono>
+#  include <cstddef>
+#  include <cstdio>
+#  include <cuda/std/span>
+#  include <system_error>
+#  include <thread>
+#  include <vector>
+
+#  include <netinet/in.h>
+#  include <sys/socket.h>
+#  include <unistd.h>
+
+#  include "common/utility.cuh"
+#  include "testing.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+// An io_uring_context that runs on its own thread.
+struct io_thread
+{
+  explicit io_thread(unsigned entries = 256)
+      : ctx{entries}
+      , thread{[this] {
+        ctx.run();
+      }}
+  {}
+
+  ~io_thread()
+  {
+    ctx.finish();
+    thread.join();
+  }
+
+  ex::io_uring_context ctx;
+  std::thread thread;
+};
+
+// Containers and sandboxes often deny io_uring.
+bool io_uring_available()
+{
+  static const bool available = [] {
+    try
+    {
+      ex::io_uring_context ctx{8};
+      return true;
+    }
+    catch (const std::system_error&)
+    {
+      return false;
+    }
+  }();
+  return available;
+}
+
+#  define SKIP_WITHOUT_IO_URING()        \
+    if (!io_uring_available())           \
+    {                                    \
+      SKIP("io_uring is not available"); \
+    }
+
+struct temp_file
+{
+  temp_file()
+      : file{std::tmpfile()}
+      , fd{::fileno(file)}
+  {}
+
+  ~temp_file()
+  {
+    std::fclose(file);
+  }
+
+  std::FILE* file;
+  int fd;
+};
+
+std::vector<std::byte> iota_bytes(std::size_t size)
+{
+  std::vector<std::byte> bytes(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    bytes[i] = static_cast<std::byte>(i * 7 + i / 251);
+  }
+  return bytes;
+}
+
+C2H_TEST("io_uring_context's scheduler completes on the context's thread", "[context][io_uring]")
+{
+  SKIP_WITHOUT_IO_URING();
+  io_thread io;
+  auto sch = io.ctx.get_scheduler();
+  STATIC_REQUIRE(ex::scheduler<decltype(sch)>);
+
+  auto sndr = ex::schedule(sch) | ex::then([] {
+                return std::this_thread::get_id();
+              });
+  auto [id] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(id == io.thread.get_id());
+}
+
+C2H_TEST("async_write and async_read transfer whole buffers", "[context][io_uring]")
+{
+  SKIP_WITHOUT_IO_URING();
+  io_thread io;
+  auto sch = io.ctx.get_scheduler();
+  temp_file file;
+
+  const auto data = iota_bytes(3 << 20);
+  auto write      = ex::async_write(sch, file.fd, cuda::std::span{data}, 0);
+  check_value_types<types<std::size_t>>(write);
+  auto [written] = ex::sync_wait(std::move(write)).value();
+  CHECK(written == data.size());
+
+  std::vector<std::byte> buffer(data.size() + 100);
+  auto [read] = ex::sync_wait(ex::async_read(sch, file.fd, cuda::std::span{buffer}, 0)).value();
+  CHECK(read == data.size());
+  buffer.resize(read);
+  CHECK(buffer == data);
+
+  // a read at the end of the file reads nothing
+  auto [none] = ex::sync_wait(ex::async_read_some(sch, file.fd, cuda::std::span{buffer}, data.size())).value();
+  CHECK(none == 0);
+}
+
+C2H_TEST("io_uring_context reads and writes registered buffers", "[context][io_uring]")
+{
+  SKIP_WITHOUT_IO_URING();
+  io_thread io;
+  auto sch = io.ctx.get_scheduler();
+  temp_file file;
+
+  std::vector<std::byte> buffer     = iota_bytes(1 << 16);
+  const std::vector<std::byte> data = buffer;
+  ::iovec iov{buffer.data(), buffer.size()};
+  io.ctx.register_buffers({&iov, 1});
+
+  // a part of the registered buffer
+  auto [written] = ex::sync_wait(ex::async_write(sch, file.fd, cuda::std::span{buffer}.subspan(100), 0)).value();
+  CHECK(written == buffer.size() - 100);
+
+  std::fill(buffer.begin(), buffer.end(), std::byte{0});
+  auto [read] = ex::sync_wait(ex::async_read(sch, file.fd, cuda::std::span{buffer}.first(written), 0)).value();
+  CHECK(read == written);
+  CHECK(std::equal(buffer.begin(), buffer.begin() + read, data.begin() + 100));
+}
+
+C2H_TEST("async_read_some completes with what a pipe has", "[context][io_uring]")
+{
+  SKIP_WITHOUT_IO_URING();
+  io_thread io;
+  auto sch = io.ctx.get_scheduler();
+  int fds[2];
+  REQUIRE(::pipe(fds) == 0);
+
+  REQUIRE(::write(fds[1], "hello", 5) == 5);
+  std::byte buffer[64];
+  auto [count] = ex::sync_wait(ex::async_read_some(sch, fds[0], cuda::std::span{buffer})).value();
+  CHECK(count == 5);
+
+  // async_read stops at the end of the file
+  REQUIRE(::write(fds[1], "world", 5) == 5);
+  ::close(fds[1]);
+  auto [total] = ex::sync_wait(ex::async_read(sch, fds[0], cuda::std::span{buffer})).value();
+  CHECK(total == 5);
+  ::close(fds[0]);
+}
+
+C2H_TEST("io_uring_context reports errors as error codes", "[context][io_uring]")
+{
+  SKIP_WITHOUT_IO_URING();
+  io_thread io;
+  auto sch = io.ctx.get_scheduler();
+  std::byte buffer[16];
+
+  auto sndr = ex::async_read_some(sch, -1, cuda::std::span{buffer}) | ex::upon_error([](std::error_code err) {
+                return static_cast<std::size_t>(err.value());
+              });
+  auto [err] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(err == EBADF);
+}
+
+C2H_TEST("a stop request cancels an I/O operation", "[context][io_uring]")
+{
+  SKIP_WITHOUT_IO_URING();
+  io_thread io;
+  auto sch = io.ctx.get_scheduler();
+  ex::counting_scope scope;
+  int fds[2];
+  REQUIRE(::pipe(fds) == 0);
+
+  // nothing is ever written to the pipe
+  std::byte buffer[16];
+  auto future = ex::spawn_future(ex::async_read_some(sch, fds[0], cuda::std::span{buffer}), scope.get_token());
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  scope.request_stop();
+  CHECK_FALSE(ex::sync_wait(std::move(future)).has_value());
+  CHECK(ex::sync_wait(scope.join()).has_value());
+  ::close(fds[0]);
+  ::close(fds[1]);
+}
+
+C2H_TEST("async_accept completes with a connected socket", "[context][io_uring]")
+{
+  SKIP_WITHOUT_IO_URING();
+  io_thread io;
+  auto sch = io.ctx.get_scheduler();
+
+  const int listener = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  REQUIRE(listener >= 0);
+  ::sockaddr_in addr{};
+  addr.sin_family      = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  ::socklen_t len      = sizeof(addr);
+  REQUIRE(::bind(listener, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == 0);
+  REQUIRE(::listen(listener, 1) == 0);
+  REQUIRE(::getsockname(listener, reinterpret_cast<::sockaddr*>(&addr), &len) == 0);
+
+  ex::counting_scope scope;
+  auto accepted = ex::spawn_future(ex::async_accept(sch, listener), scope.get_token());
+  const int client = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  REQUIRE(::connect(client, reinterpret_cast<::sockaddr*>(&addr), sizeof(addr)) == 0);
+  auto [server] = ex::sync_wait(std::move(accepted)).value();
+  REQUIRE(server >= 0);
+
+  const auto data = iota_bytes(100000);
+  std::vector<std::byte> buffer(data.size());
+  auto [written, read] = ex::sync_wait(ex::when_all(ex::async_write(sch, client, cuda::std::span{data}),
+                                                    ex::async_read(sch, server, cuda::std::span{buffer})))
+                           .value();
+  CHECK(written == data.size());
+  CHECK(read == data.size());
+  CHECK(buffer == data);
+  CHECK(ex::sync_wait(scope.join()).has_value());
+
+  ::close(server);
+  ::close(client);
+  ::close(listener);
+}
+
+C2H_TEST("io_uring_context runs more operations than its ring has entries", "[context][io_uring]")
+{
+  SKIP_WITHOUT_IO_URING();
+  io_thread io{4};
+  auto sch = io.ctx.get_scheduler();
+  temp_file file;
+
+  constexpr std::size_t count = 1000;
+  constexpr std::size_t block = 64;
+  const auto data             = iota_bytes(count * block);
+  ex::counting_scope scope;
+  std::atomic<std::size_t> written{0};
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    // start the writes on the context's thread, so that they fill its ring at once. spawn does not accept senders
+    // that can fail; a failed write shows in the number of bytes written
+    ex::spawn(ex::schedule(sch) | ex::let_value([&, i] {
+                return ex::async_write(sch, file.fd, cuda::std::span{data}.subspan(i * block, block), i * block);
+              })
+                | ex::then([&](std::size_t n) {
+                    written += n;
+                  })
+                | ex::upon_error([](auto&&) noexcept {}),
+              scope.get_token());
+  }
+  CHECK(ex::sync_wait(scope.join()).has_value());
+  CHECK(written == data.size());
+
+  std::vector<std::byte> buffer(data.size());
+  auto [read] = ex::sync_wait(ex::async_read(sch, file.fd, cuda::std::span{buffer}, 0)).value();
+  CHECK(read == data.size());
+  CHECK(buffer == data);
+}
+} // namespace
+
+#endif // _CCCL_OS(LINUX) && __has_include(<linux/io_uring.h>)
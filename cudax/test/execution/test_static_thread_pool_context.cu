@@ -0,0 +1,216 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common/utility.cuh"
+#include "testing.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+struct chunk
+{
+  std::size_t begin;
+  std::size_t end;
+  std::thread::id thread;
+
+  friend bool operator<(const chunk& lhs, const chunk& rhs) noexcept
+  {
+    return lhs.begin < rhs.begin;
+  }
+};
+
+// Records the chunks that a bulk_chunked operation is split into.
+struct chunk_log
+{
+  void add(std::size_t begin, std::size_t end)
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    chunks.push_back({begin, end, std::this_thread::get_id()});
+  }
+
+  auto sorted() -> std::vector<chunk>
+  {
+    std::sort(chunks.begin(), chunks.end());
+    return chunks;
+  }
+
+  std::mutex mutex;
+  std::vector<chunk> chunks;
+};
+
+C2H_TEST("static_thread_pool_context's scheduler hands work to the workers in turn", "[context][thread_pool]")
+{
+  ex::static_thread_pool_context pool{4};
+  auto sch = pool.get_scheduler();
+  STATIC_CHECK(ex::scheduler<decltype(sch)>);
+  CHECK(pool.size() == 4);
+  CHECK(sch == pool.get_scheduler());
+  CHECK(ex::get_forward_progress_guarantee(sch) == ex::forward_progress_guarantee::parallel);
+
+  std::set<std::thread::id> threads;
+  for (int i = 0; i < 8; ++i)
+  {
+    auto [id] = ex::sync_wait(ex::schedule(sch) | ex::then([] {
+                                return std::this_thread::get_id();
+                              }))
+                  .value();
+    threads.insert(id);
+  }
+  CHECK(threads.size() == 4);
+  CHECK(threads.count(std::this_thread::get_id()) == 0);
+}
+
+C2H_TEST("bulk_chunked gives each worker one chunk", "[context][thread_pool][bulk]")
+{
+  ex::static_thread_pool_context pool{4};
+  chunk_log log;
+
+  auto sndr = ex::schedule(pool.get_scheduler()) | ex::then([] {
+                return 42;
+              })
+            | ex::bulk_chunked(ex::par, 1003, [&](int begin, int end, int& value) {
+                CHECK(value == 42);
+                log.add(begin, end);
+              });
+  auto [value] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(value == 42);
+
+  const auto chunks = log.sorted();
+  REQUIRE(chunks.size() == 4);
+  std::set<std::thread::id> threads;
+  std::size_t next = 0;
+  for (const auto& c : chunks)
+  {
+    CHECK(c.begin == next);
+    CHECK((c.end - c.begin == 250 || c.end - c.begin == 251));
+    next = c.end;
+    threads.insert(c.thread);
+  }
+  CHECK(next == 1003);
+  CHECK(threads.size() == 4);
+}
+
+C2H_TEST("bulk runs every index once on the workers", "[context][thread_pool][bulk]")
+{
+  ex::static_thread_pool_context pool{3};
+  std::vector<std::atomic<int>> hits(10000);
+
+  auto sndr = ex::schedule(pool.get_scheduler()) | ex::bulk(ex::par_unseq, hits.size(), [&](std::size_t i) {
+                ++hits[i];
+              });
+  CHECK(ex::sync_wait(std::move(sndr)).has_value());
+  CHECK(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int>& hit) {
+    return hit == 1;
+  }));
+}
+
+C2H_TEST("bulk_chunked with fewer indices than workers", "[context][thread_pool][bulk]")
+{
+  ex::static_thread_pool_context pool{4};
+  chunk_log log;
+  ex::sync_wait(ex::schedule(pool.get_scheduler()) | ex::bulk_chunked(ex::par, 2, [&](int begin, int end) {
+                  log.add(begin, end);
+                }));
+  CHECK(log.sorted().size() == 2);
+
+  // an empty shape completes without calling the function
+  auto [value] = ex::sync_wait(ex::schedule(pool.get_scheduler()) | ex::then([] {
+                                 return 7;
+                               })
+                               | ex::bulk_chunked(ex::par, 0, [&](int, int, int) {
+                                   log.add(0, 0);
+                                 }))
+                   .value();
+  CHECK(value == 7);
+  CHECK(log.chunks.size() == 2);
+}
+
+C2H_TEST("bulk_chunked with the sequenced policy runs in one chunk", "[context][thread_pool][bulk]")
+{
+  ex::static_thread_pool_context pool{4};
+  chunk_log log;
+  auto [id] = ex::sync_wait(ex::schedule(pool.get_scheduler())
+                            | ex::bulk_chunked(ex::seq,
+                                               100,
+                                               [&](int begin, int end) {
+                                                 log.add(begin, end);
+                                               })
+                            | ex::then([] {
+                                return std::this_thread::get_id();
+                              }))
+                .value();
+  REQUIRE(log.chunks.size() == 1);
+  CHECK(log.chunks[0].begin == 0);
+  CHECK(log.chunks[0].end == 100);
+  CHECK(log.chunks[0].thread == id);
+}
+
+C2H_TEST("bulk_chunked completes with the error of a failing chunk", "[context][thread_pool][bulk]")
+{
+  ex::static_thread_pool_context pool{4};
+  std::atomic<int> calls{0};
+  auto sndr = ex::schedule(pool.get_scheduler()) | ex::bulk_chunked(ex::par, 400, [&](int begin, int) {
+                ++calls;
+                throw begin;
+              });
+  try
+  {
+    ex::sync_wait(std::move(sndr));
+    FAIL("expected an exception");
+  }
+  catch (int begin)
+  {
+    CHECK(begin % 100 == 0);
+  }
+  CHECK(calls >= 1);
+  CHECK(calls <= 4);
+
+  // errors of the predecessor skip the bulk function
+  auto failing = ex::schedule(pool.get_scheduler()) | ex::then([] {
+                   throw 1;
+                 })
+               | ex::bulk_chunked(ex::par, 400, [&](int, int) {
+                   ++calls;
+                 });
+  const int before = calls;
+  CHECK_THROWS_AS(ex::sync_wait(std::move(failing)), int);
+  CHECK(calls == before);
+}
+
+C2H_TEST("a static_thread_pool_context runs bulk operations from many threads", "[context][thread_pool][bulk]")
+{
+  ex::static_thread_pool_context pool{4};
+  ex::counting_scope scope;
+  std::atomic<long> sum{0};
+  for (int i = 0; i < 200; ++i)
+  {
+    // spawn does not accept senders that can fail; a failed operation shows in the sum
+    ex::spawn(ex::schedule(pool.get_scheduler()) | ex::bulk(ex::par, 100, [&](int j) {
+                sum += j;
+              })
+                | ex::upon_error([](auto&&) noexcept {}),
+              scope.get_token());
+  }
+  CHECK(ex::sync_wait(scope.join()).has_value());
+  CHECK(sum == 200L * 4950);
+}
+} // namespace
@@ -10,6 +10,10 @@
 
 #include <cuda/experimental/execution.cuh>
 
+#include <array>
+#include <cstddef>
+#include <memory>
+
 #include "common/checked_receiver.cuh" // IWYU pragma: keep
 #include "common/dummy_scheduler.cuh" // IWYU pragma: keep
 #include "common/error_scheduler.cuh" // IWYU pragma: keep
@@ -91,4 +95,102 @@ C2H_TEST("bulk dispatches correctly through task_scheduler", "[scheduler][task_s
   CHECK(val == -1);
   CHECK(g_called);
 }
+
+struct allocation_counts
+{
+  int allocations   = 0;
+  int deallocations = 0;
+};
+
+template <class T>
+struct counting_allocator
+{
+  using value_type = T;
+
+  explicit counting_allocator(allocation_counts* counts) noexcept
+      : counts(counts)
+  {}
+
+  template <class U>
+  counting_allocator(const counting_allocator<U>& other) noexcept
+      : counts(other.counts)
+  {}
+
+  T* allocate(std::size_t n)
+  {
+    ++counts->allocations;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* ptr, std::size_t n) noexcept
+  {
+    ++counts->deallocations;
+    std::allocator<T>{}.deallocate(ptr, n);
+  }
+
+  friend bool operator==(const counting_allocator& lhs, const counting_allocator& rhs) noexcept
+  {
+    return lhs.counts == rhs.counts;
+  }
+
+  friend bool operator!=(const counting_allocator& lhs, const counting_allocator& rhs) noexcept
+  {
+    return lhs.counts != rhs.counts;
+  }
+
+  allocation_counts* counts;
+};
+
+// A scheduler whose operation states are too large for task_scheduler's in-place buffers.
+struct large_scheduler
+{
+  using scheduler_concept = ex::scheduler_t;
+
+  auto schedule() const noexcept
+  {
+    return ex::just() | ex::then([padding = std::array<std::byte, 512>{}] {});
+  }
+
+  friend bool operator==(large_scheduler, large_scheduler) noexcept
+  {
+    return true;
+  }
+
+  friend bool operator!=(large_scheduler, large_scheduler) noexcept
+  {
+    return false;
+  }
+};
+
+C2H_TEST("task_scheduler does not allocate operation states that fit in place", "[scheduler][task_scheduler]")
+{
+  allocation_counts counts;
+  ex::thread_context ctx;
+  ex::task_scheduler sched{ctx.get_scheduler(), counting_allocator<std::byte>{&counts}};
+  CHECK(counts.allocations == 1); // the backend
+
+  for (int i = 0; i < 100; ++i)
+  {
+    ex::sync_wait(sched.schedule());
+    ex::sync_wait(ex::schedule(sched) | ex::bulk(ex::par, 8, [](int) {}));
+    ex::sync_wait(ex::schedule(sched) | ex::bulk_unchunked(ex::par, 8, [](int) {}));
+  }
+  CHECK(counts.allocations == 1);
+  CHECK(counts.deallocations == 0);
+}
+
+C2H_TEST("task_scheduler allocates operation states that do not fit in place", "[scheduler][task_scheduler]")
+{
+  allocation_counts counts;
+  {
+    ex::task_scheduler sched{large_scheduler{}, counting_allocator<std::byte>{&counts}};
+    for (int i = 0; i < 10; ++i)
+    {
+      CHECK(ex::sync_wait(sched.schedule()).has_value());
+    }
+    CHECK(counts.allocations == 11);
+    CHECK(counts.deallocations == 10);
+  }
+  CHECK(counts.deallocations == 11);
+}
 } // namespace
@@ -0,0 +1,212 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "common/utility.cuh"
+#include "testing.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+C2H_TEST("the schedulers of run_loop and thread_context are timed schedulers", "[timed_scheduler]")
+{
+  STATIC_CHECK(ex::timed_scheduler<decltype(std::declval<ex::run_loop&>().get_scheduler())>);
+  STATIC_CHECK(ex::timed_scheduler<decltype(std::declval<ex::thread_context&>().get_scheduler())>);
+  STATIC_CHECK_FALSE(ex::timed_scheduler<ex::inline_scheduler>);
+}
+
+C2H_TEST("the timer wheel expires every timer at its deadline", "[timed_scheduler][timer_wheel]")
+{
+  struct timer : ex::__timer_node
+  {
+    bool expired = false;
+  };
+
+  std::mt19937_64 rng{42};
+  ex::__timer_wheel wheel;
+  wheel.__reset(1000);
+
+  // deadlines spread over every level of the wheel and its overflow list
+  std::vector<timer> timers(10000);
+  for (auto& t : timers)
+  {
+    const int bits = static_cast<int>(rng() % 42);
+    t.__deadline_  = 1000 + (rng() & ((std::uint64_t{1} << bits) - 1));
+    wheel.__insert(&t);
+  }
+  CHECK(wheel.__size() == timers.size());
+
+  // erase every tenth timer
+  for (std::size_t i = 0; i < timers.size(); i += 10)
+  {
+    wheel.__erase(&timers[i]);
+  }
+
+  std::uint64_t now = 1000;
+  while (!wheel.__empty())
+  {
+    const std::uint64_t next = wheel.__next_tick();
+    REQUIRE(next > now);
+    now = next + rng() % 64;
+    for (ex::__timer_node* t = wheel.__advance(now); t != nullptr; t = t->__next_)
+    {
+      REQUIRE(t->__deadline_ <= now);
+      static_cast<timer*>(t)->expired = true;
+    }
+    REQUIRE(wheel.__now() == now);
+
+    // no timer that is still in the wheel is due
+    for (std::size_t i = 0; i < timers.size(); i += 97)
+    {
+      REQUIRE((timers[i].__list_ == nullptr || timers[i].__deadline_ > now));
+    }
+  }
+
+  for (std::size_t i = 0; i < timers.size(); ++i)
+  {
+    CHECK(timers[i].expired == (i % 10 != 0));
+  }
+}
+
+C2H_TEST("schedule_after completes once the delay has elapsed", "[timed_scheduler]")
+{
+  ex::thread_context ctx;
+  auto sched = ctx.get_scheduler();
+
+  const auto start = ex::now(sched);
+  auto sndr        = ex::schedule_after(sched, 20ms) | ex::then([&] {
+                return ex::now(sched);
+              });
+  auto [end] = ex::sync_wait(std::move(sndr)).value();
+  CHECK(end - start >= 20ms);
+}
+
+C2H_TEST("timers complete in the order of their deadlines", "[timed_scheduler]")
+{
+  ex::thread_context ctx;
+  auto sched = ctx.get_scheduler();
+  std::vector<int> order;
+
+  auto timer = [&](auto delay, int id) {
+    return ex::schedule_after(sched, delay) | ex::then([&order, id] {
+             order.push_back(id);
+           });
+  };
+  const auto now = ex::now(sched);
+  ex::sync_wait(ex::when_all(
+    timer(30ms, 3), timer(10ms, 1), ex::schedule_at(sched, now + 20ms) | ex::then([&] {
+                                      order.push_back(2);
+                                    })));
+  CHECK(order == std::vector<int>{1, 2, 3});
+}
+
+C2H_TEST("schedule_at a past time completes right away", "[timed_scheduler]")
+{
+  ex::thread_context ctx;
+  auto sched = ctx.get_scheduler();
+  CHECK(ex::sync_wait(ex::schedule_at(sched, ex::now(sched) - 1h)).has_value());
+}
+
+C2H_TEST("a stop request cancels a timer", "[timed_scheduler]")
+{
+  ex::thread_context ctx;
+  auto sched = ctx.get_scheduler();
+
+  ex::inplace_stop_source source;
+  auto sndr = ex::when_all(ex::schedule_after(sched, 1h), ex::schedule_after(sched, 1ms) | ex::then([&] {
+                             source.request_stop();
+                           }))
+            | ex::write_env(ex::prop{ex::get_stop_token, source.get_token()});
+
+  const auto start = std::chrono::steady_clock::now();
+  CHECK_FALSE(ex::sync_wait(std::move(sndr)).has_value());
+  CHECK(std::chrono::steady_clock::now() - start < 1min);
+}
+
+C2H_TEST("work pushed while the loop waits for a timer wakes it up", "[timed_scheduler]")
+{
+  ex::thread_context ctx;
+  auto sched = ctx.get_scheduler();
+  ex::inplace_stop_source source;
+  ex::simple_counting_scope scope;
+
+  // the loop now sleeps until the timer's deadline, unless something is pushed to its queue
+  ex::spawn(ex::schedule_after(sched, 1h) | ex::write_env(ex::prop{ex::get_stop_token, source.get_token()})
+              | ex::upon_stopped([]() noexcept {}),
+            scope.get_token());
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < 100; ++i)
+  {
+    CHECK(ex::sync_wait(ex::schedule(sched)).has_value());
+  }
+  CHECK(std::chrono::steady_clock::now() - start < 1min);
+
+  source.request_stop();
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("the timers of a run_loop stop when it finishes", "[timed_scheduler]")
+{
+  ex::run_loop loop;
+  ex::simple_counting_scope scope;
+  auto sched = loop.get_scheduler();
+
+  auto due     = ex::spawn_future(ex::schedule_at(sched, ex::now(sched) - 1ms), scope.get_token());
+  auto pending = ex::spawn_future(ex::schedule_after(sched, 1h), scope.get_token());
+  loop.finish();
+  loop.run();
+
+  CHECK(ex::sync_wait(std::move(due)).has_value());
+  CHECK_FALSE(ex::sync_wait(std::move(pending)).has_value());
+  CHECK(ex::sync_wait(scope.join()).has_value());
+}
+
+C2H_TEST("a thread_context runs many timers", "[timed_scheduler]")
+{
+  ex::thread_context ctx;
+  auto sched = ctx.get_scheduler();
+  ex::counting_scope scope;
+  std::atomic<int> fired{0};
+  std::atomic<int> stopped{0};
+
+  std::mt19937 rng{7};
+  constexpr int count = 20000;
+  for (int i = 0; i < count; ++i)
+  {
+    const auto delay = std::chrono::microseconds(rng() % 50000);
+    ex::spawn(ex::schedule_after(sched, delay) | ex::then([&]() noexcept {
+                ++fired;
+              })
+                | ex::upon_stopped([&]() noexcept {
+                    ++stopped;
+                  }),
+              scope.get_token());
+  }
+
+  // cancel the timers that are left after 10ms
+  ex::sync_wait(ex::schedule_after(sched, 10ms));
+  scope.request_stop();
+  ex::sync_wait(scope.join());
+  CHECK(fired + stopped == count);
+  CHECK(fired > 0);
+  CHECK(stopped > 0);
+}
+} // namespace
@@ -0,0 +1,150 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "testing.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+C2H_TEST("work_stealing_context runs work on its workers", "[context][work_stealing_context]")
+{
+  ex::work_stealing_context ctx{4};
+  CHECK(ctx.size() == 4);
+
+  auto sched = ctx.get_scheduler();
+  STATIC_CHECK(ex::scheduler<decltype(sched)>);
+  CHECK(ex::get_forward_progress_guarantee(sched) == ex::forward_progress_guarantee::parallel);
+  CHECK(sched == sched);
+  CHECK(sched == ctx.get_scheduler());
+
+  ex::work_stealing_context other{1};
+  CHECK(sched != other.get_scheduler());
+
+  auto sndr = ex::starts_on(sched, ex::just(42) | ex::then([](int i) {
+                                     return ::std::pair{i, ::std::this_thread::get_id()};
+                                   }));
+  auto [result] = ex::sync_wait(::cuda::std::move(sndr)).value();
+  CHECK(result.first == 42);
+  CHECK(result.second != ::std::this_thread::get_id());
+}
+
+C2H_TEST("work_stealing_context runs bulk_chunked over the whole shape", "[context][work_stealing_context]")
+{
+  ex::work_stealing_context ctx{4};
+  constexpr int shape = 10000;
+  std::vector<std::atomic<int>> counts(shape);
+
+  auto sndr = ex::on(ctx.get_scheduler(), ex::just(1) | ex::bulk_chunked(ex::par, shape, [&](int b, int e, int v) {
+                                            for (; b != e; ++b)
+                                            {
+                                              counts[b] += v;
+                                            }
+                                          }));
+  auto [val] = ex::sync_wait(::cuda::std::move(sndr)).value();
+  CHECK(val == 1);
+  for (auto& count : counts)
+  {
+    CHECK(count == 1);
+  }
+}
+
+C2H_TEST("work_stealing_context spreads bulk_unchunked over its workers", "[context][work_stealing_context]")
+{
+  ex::work_stealing_context ctx{4};
+  constexpr int shape = 1000;
+  std::vector<std::atomic<int>> counts(shape);
+  std::mutex mtx;
+  std::set<std::thread::id> threads;
+
+  auto sndr = ex::on(ctx.get_scheduler(), ex::just() | ex::bulk_unchunked(ex::par, shape, [&](int i) {
+                                            counts[i]++;
+                                            std::this_thread::sleep_for(std::chrono::microseconds(10));
+                                            std::lock_guard lock{mtx};
+                                            threads.insert(std::this_thread::get_id());
+                                          }));
+  ex::sync_wait(::cuda::std::move(sndr));
+  for (auto& count : counts)
+  {
+    CHECK(count == 1);
+  }
+  CHECK(threads.count(std::this_thread::get_id()) == 0);
+  CHECK(threads.size() > 1);
+}
+
+C2H_TEST("work_stealing_context handles empty bulk shapes", "[context][work_stealing_context]")
+{
+  ex::work_stealing_context ctx{2};
+  bool called = false;
+
+  auto sndr = ex::on(ctx.get_scheduler(), ex::just() | ex::bulk(ex::par, 0, [&](int) {
+                                            called = true;
+                                          }));
+  ex::sync_wait(::cuda::std::move(sndr));
+  CHECK(!called);
+}
+
+C2H_TEST("work_stealing_context stops the work scheduled after join", "[context][work_stealing_context]")
+{
+  ex::work_stealing_context ctx{2};
+  auto sched = ctx.get_scheduler();
+  std::atomic<int> ran{0};
+
+  // the work scheduled before join still runs
+  ex::simple_counting_scope scope;
+  for (int i = 0; i < 100; ++i)
+  {
+    // spawn does not accept senders that can fail; a failed operation shows in the count
+    ex::spawn(ex::starts_on(sched, ex::just() | ex::then([&] {
+                                     ran += 1;
+                                   }))
+                | ex::upon_error([](auto&&) noexcept {}),
+              scope.get_token());
+  }
+  ctx.join();
+  CHECK(ran == 100);
+  CHECK(ex::sync_wait(scope.join()).has_value());
+
+  CHECK_FALSE(ex::sync_wait(ex::schedule(sched)).has_value());
+  CHECK_FALSE(ex::sync_wait(ex::on(sched, ex::just() | ex::bulk(ex::par, 64, [&](int) {
+                                            ran += 1;
+                                          })))
+                .has_value());
+  CHECK(ran == 100);
+}
+
+C2H_TEST("work_stealing_context runs many concurrent operations", "[context][work_stealing_context]")
+{
+  ex::work_stealing_context ctx;
+  auto sched = ctx.get_scheduler();
+  std::atomic<int> total{0};
+
+  for (int i = 0; i < 100; ++i)
+  {
+    ex::sync_wait(ex::when_all(ex::starts_on(sched, ex::just() | ex::then([&] {
+                                               total += 1;
+                                             })),
+                               ex::on(sched, ex::just() | ex::bulk(ex::par, 64, [&](int) {
+                                            total += 1;
+                                          }))));
+  }
+  CHECK(total == 100 * 65);
+}
+} // namespace
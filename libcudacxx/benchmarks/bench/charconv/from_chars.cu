@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/memory_pool>
+#include <cuda/std/charconv>
+#include <cuda/std/cstring>
+#include <cuda/std/execution>
+#include <cuda/stream>
+
+#include <cstdlib>
+#include <string>
+
+#include "nvbench_helper.cuh"
+
+// Every value is read from its own null terminated slot of the input
+constexpr int slot_size = 32;
+
+template <class T>
+struct from_chars_t
+{
+  const char* in;
+  T* values;
+
+  __host__ __device__ void operator()(cuda::std::size_t i) const
+  {
+    const char* first = in + i * slot_size;
+    (void) cuda::std::from_chars(first, first + cuda::std::strlen(first), values[i]);
+  }
+};
+
+// The shortest round trip representations of random values
+template <class T>
+thrust::host_vector<char> generate_strings(std::size_t elements)
+{
+  thrust::host_vector<T> values = thrust::device_vector<T>(generate(elements));
+  thrust::host_vector<char> strings(elements * slot_size);
+  for (std::size_t i = 0; i < elements; ++i)
+  {
+    char* first       = strings.data() + i * slot_size;
+    const auto result = cuda::std::to_chars(first, first + slot_size - 1, values[i]);
+    *result.ptr       = '\0';
+  }
+  return strings;
+}
+
+template <typename T>
+static void device(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  thrust::device_vector<char> in = generate_strings<T>(elements);
+  thrust::device_vector<T> out(elements, thrust::no_init);
+
+  state.add_element_count(elements);
+  state.add_global_memory_writes<T>(elements);
+
+  from_chars_t<T> op{thrust::raw_pointer_cast(in.data()), thrust::raw_pointer_cast(out.data())};
+
+  caching_allocator_t alloc{};
+
+  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch) {
+               do_not_optimize(cuda::std::for_each_n(
+                 cuda_policy(alloc, launch), cuda::counting_iterator<std::size_t>{0}, elements, op));
+             });
+}
+
+NVBENCH_BENCH_TYPES(device, NVBENCH_TYPE_AXES(nvbench::type_list<float, double>))
+  .set_name("device")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4));
+
+template <typename T>
+static void host(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto impl     = state.get_string("Impl");
+
+  thrust::host_vector<char> in = generate_strings<T>(elements);
+  thrust::host_vector<T> out(elements);
+
+  state.add_element_count(elements);
+
+  from_chars_t<T> op{in.data(), out.data()};
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (impl == "cuda::std::from_chars")
+    {
+      for (std::size_t i = 0; i < elements; ++i)
+      {
+        op(i);
+      }
+    }
+    else
+    {
+      for (std::size_t i = 0; i < elements; ++i)
+      {
+        const char* first = in.data() + i * slot_size;
+        if constexpr (sizeof(T) == sizeof(float))
+        {
+          out[i] = std::strtof(first, nullptr);
+        }
+        else
+        {
+          out[i] = std::strtod(first, nullptr);
+        }
+      }
+    }
+    do_not_optimize(out.data());
+  });
+}
+
+NVBENCH_BENCH_TYPES(host, NVBENCH_TYPE_AXES(nvbench::type_list<float, double>))
+  .set_name("host")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 20, 4))
+  .add_string_axis("Impl", {"cuda::std::from_chars", "strtod"});
@@ -0,0 +1,107 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/memory_pool>
+#include <cuda/std/charconv>
+#include <cuda/std/execution>
+#include <cuda/stream>
+
+#include <cstdio>
+#include <string>
+
+#include "nvbench_helper.cuh"
+
+// Every value is written to its own slot of the output
+constexpr int slot_size = 32;
+
+template <class T>
+struct to_chars_t
+{
+  const T* values;
+  char* out;
+
+  __host__ __device__ void operator()(cuda::std::size_t i) const
+  {
+    char* first       = out + i * slot_size;
+    const auto result = cuda::std::to_chars(first, first + slot_size - 1, values[i]);
+    *result.ptr       = '\0';
+  }
+};
+
+template <typename T>
+static void device(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+
+  thrust::device_vector<T> in = generate(elements);
+  thrust::device_vector<char> out(elements * slot_size, thrust::no_init);
+
+  state.add_element_count(elements);
+  state.add_global_memory_reads<T>(elements);
+
+  to_chars_t<T> op{thrust::raw_pointer_cast(in.data()), thrust::raw_pointer_cast(out.data())};
+
+  caching_allocator_t alloc{};
+
+  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch) {
+               do_not_optimize(cuda::std::for_each_n(
+                 cuda_policy(alloc, launch), cuda::counting_iterator<std::size_t>{0}, elements, op));
+             });
+}
+
+NVBENCH_BENCH_TYPES(device, NVBENCH_TYPE_AXES(nvbench::type_list<float, double>))
+  .set_name("device")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4));
+
+// Shortest round trip conversion on the host, compared with the 17 or 9 significant digits snprintf needs to round trip
+template <typename T>
+static void host(nvbench::state& state, nvbench::type_list<T>)
+{
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto impl     = state.get_string("Impl");
+
+  thrust::host_vector<T> in = thrust::device_vector<T>(generate(elements));
+  thrust::host_vector<char> out(elements * slot_size);
+
+  state.add_element_count(elements);
+
+  to_chars_t<T> op{in.data(), out.data()};
+  constexpr int digits = (sizeof(T) == sizeof(float)) ? 9 : 17;
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (impl == "cuda::std::to_chars")
+    {
+      for (std::size_t i = 0; i < elements; ++i)
+      {
+        op(i);
+      }
+    }
+    else
+    {
+      for (std::size_t i = 0; i < elements; ++i)
+      {
+        std::snprintf(out.data() + i * slot_size, slot_size, "%.*g", digits, static_cast<double>(in[i]));
+      }
+    }
+    do_not_optimize(out.data());
+  });
+}
+
+NVBENCH_BENCH_TYPES(host, NVBENCH_TYPE_AXES(nvbench::type_list<float, double>))
+  .set_name("host")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 20, 4))
+  .add_string_axis("Impl", {"cuda::std::to_chars", "snprintf"});
@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <thrust/host_vector.h>
+
+#include <cuda/std/random>
+#include <cuda/std/span>
+
+#include <string>
+
+#include "nvbench_helper.cuh"
+
+// Samples per second of the bulk operator() of the distributions on the host, compared with a loop of the scalar one
+template <typename Distribution>
+static void sample(nvbench::state& state, Distribution dist)
+{
+  using result_type   = typename Distribution::result_type;
+  const auto elements = static_cast<std::size_t>(state.get_int64("Elements"));
+  const auto impl     = state.get_string("Impl");
+
+  thrust::host_vector<result_type> out(elements);
+  cuda::std::philox4x32 rng{};
+
+  state.add_element_count(elements);
+  state.add_global_memory_writes<result_type>(elements);
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (impl == "bulk")
+    {
+      dist(rng, cuda::std::span<result_type>(out.data(), elements));
+    }
+    else
+    {
+      for (std::size_t i = 0; i < elements; ++i)
+      {
+        out[i] = dist(rng);
+      }
+    }
+    do_not_optimize(out.data());
+  });
+}
+
+template <typename T>
+static void uniform_int(nvbench::state& state, nvbench::type_list<T>)
+{
+  sample(state, cuda::std::uniform_int_distribution<T>(0, 999));
+}
+
+NVBENCH_BENCH_TYPES(uniform_int, NVBENCH_TYPE_AXES(nvbench::type_list<int32_t, int64_t>))
+  .set_name("uniform_int")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4))
+  .add_string_axis("Impl", {"bulk", "scalar"});
+
+template <typename T>
+static void uniform_real(nvbench::state& state, nvbench::type_list<T>)
+{
+  sample(state, cuda::std::uniform_real_distribution<T>(-1, 1));
+}
+
+NVBENCH_BENCH_TYPES(uniform_real, NVBENCH_TYPE_AXES(nvbench::type_list<float, double>))
+  .set_name("uniform_real")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4))
+  .add_string_axis("Impl", {"bulk", "scalar"});
+
+template <typename T>
+static void normal(nvbench::state& state, nvbench::type_list<T>)
+{
+  sample(state, cuda::std::normal_distribution<T>(0, 1));
+}
+
+NVBENCH_BENCH_TYPES(normal, NVBENCH_TYPE_AXES(nvbench::type_list<float, double>))
+  .set_name("normal")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4))
+  .add_string_axis("Impl", {"bulk", "scalar"});
+
+template <typename T>
+static void exponential(nvbench::state& state, nvbench::type_list<T>)
+{
+  sample(state, cuda::std::exponential_distribution<T>(1));
+}
+
+NVBENCH_BENCH_TYPES(exponential, NVBENCH_TYPE_AXES(nvbench::type_list<float, double>))
+  .set_name("exponential")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4))
+  .add_string_axis("Impl", {"bulk", "scalar"});
+
+static void bernoulli(nvbench::state& state)
+{
+  sample(state, cuda::std::bernoulli_distribution(0.25));
+}
+
+NVBENCH_BENCH(bernoulli)
+  .set_name("bernoulli")
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4))
+  .add_string_axis("Impl", {"bulk", "scalar"});
@@ -0,0 +1,126 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___BIT_BITSET_RANK_SELECT_H
+#define _CUDA___BIT_BITSET_RANK_SELECT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__fwd/bitset.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__algorithm/upper_bound.h>
+#include <cuda/std/__bit/word_algorithms.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/remove_const.h>
+#include <cuda/std/__type_traits/remove_pointer.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/bitset>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief A copy of a bitset with the number of set bits before every block of 16 of its words, which answers rank and
+//! select queries in constant time and in time logarithmic in the number of blocks respectively. The counts take a
+//! sixteenth of the size of the bitset, or an eighth when it has more than 2^32 bits.
+//! @tparam _Size The number of bits of the bitset
+template <::cuda::std::size_t _Size>
+class bitset_rank_select
+{
+private:
+  using __word_type = ::cuda::std::remove_const_t<::cuda::std::remove_pointer_t<decltype(
+    ::cuda::std::declval<const ::cuda::std::bitset<_Size>&>().__word_data())>>;
+  using __rank_type =
+    ::cuda::std::conditional_t<(_Size <= ::cuda::std::numeric_limits<::cuda::std::uint32_t>::max()),
+                               ::cuda::std::uint32_t,
+                               ::cuda::std::size_t>;
+
+  static constexpr ::cuda::std::size_t __n_words     = ::cuda::std::bitset<_Size>::__n_words;
+  static constexpr ::cuda::std::size_t __block_words = ::cuda::std::__bit_word_block;
+  static constexpr ::cuda::std::size_t __block_bits =
+    __block_words * ::cuda::std::numeric_limits<::cuda::std::__bit_word_t<__word_type>>::digits;
+  static constexpr ::cuda::std::size_t __n_blocks    = (__n_words + __block_words - 1) / __block_words;
+
+  ::cuda::std::bitset<_Size> __bits_;
+  // the number of set bits before every block, and in total
+  __rank_type __ranks_[__n_blocks + 1]{};
+
+  [[nodiscard]] _CCCL_API constexpr const __word_type* __block_data(::cuda::std::size_t __block) const noexcept
+  {
+    return __bits_.__word_data() + __block * __block_words;
+  }
+
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __block_size(::cuda::std::size_t __block) const noexcept
+  {
+    return ::cuda::std::min(__block_words, __n_words - __block * __block_words);
+  }
+
+public:
+  _CCCL_API constexpr explicit bitset_rank_select(const ::cuda::std::bitset<_Size>& __bits) noexcept
+      : __bits_(__bits)
+  {
+    for (::cuda::std::size_t __block = 0; __block < __n_blocks; ++__block)
+    {
+      __ranks_[__block + 1] = static_cast<__rank_type>(
+        __ranks_[__block] + ::cuda::std::__popcount_words(__block_data(__block), __block_size(__block)));
+    }
+  }
+
+  //! @brief The bitset the queries are about
+  [[nodiscard]] _CCCL_API constexpr const ::cuda::std::bitset<_Size>& bits() const noexcept
+  {
+    return __bits_;
+  }
+
+  //! @brief The number of set bits
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t count() const noexcept
+  {
+    return __ranks_[__n_blocks];
+  }
+
+  //! @brief The number of set bits before bit __pos, which is at most _Size
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t rank(::cuda::std::size_t __pos) const noexcept
+  {
+    _CCCL_ASSERT(__pos <= _Size, "bitset_rank_select::rank: position out of range");
+    const ::cuda::std::size_t __block = __pos / __block_bits;
+    return __ranks_[__block] + ::cuda::std::__rank_bits(__block_data(__block), __pos % __block_bits);
+  }
+
+  //! @brief The position of the set bit of index __k, counting from 0, or _Size if there are at most __k set bits
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t select(::cuda::std::size_t __k) const noexcept
+  {
+    if (__k >= count())
+    {
+      return _Size;
+    }
+
+    // the last block with at most __k set bits before it
+    const auto __block = static_cast<::cuda::std::size_t>(
+      ::cuda::std::upper_bound(__ranks_, __ranks_ + __n_blocks + 1, __k) - __ranks_ - 1);
+    return __block * __block_bits
+         + ::cuda::std::__select_bit(__block_data(__block), __block_size(__block), __k - __ranks_[__block]);
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___BIT_BITSET_RANK_SELECT_H
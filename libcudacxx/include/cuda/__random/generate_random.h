@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___RANDOM_GENERATE_RANDOM_H
+#define _CUDA___RANDOM_GENERATE_RANDOM_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__random/pcg_engine.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__random/philox_engine.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+template <class _Engine>
+inline constexpr bool __is_philox_engine_v = false;
+
+template <class _UIntType,
+          ::cuda::std::size_t _WordSize,
+          ::cuda::std::size_t _WordCount,
+          ::cuda::std::size_t _NumRounds,
+          _UIntType... _Constants>
+inline constexpr bool
+  __is_philox_engine_v<::cuda::std::philox_engine<_UIntType, _WordSize, _WordCount, _NumRounds, _Constants...>> = true;
+
+template <class _Engine>
+inline constexpr bool __is_pcg64_engine_v = false;
+
+template <::cuda::std::uint64_t _AHi, ::cuda::std::uint64_t _ALo, ::cuda::std::uint64_t _CHi, ::cuda::std::uint64_t _CLo>
+inline constexpr bool __is_pcg64_engine_v<pcg64_engine<_AHi, _ALo, _CHi, _CLo>> = true;
+
+//! @brief True for the engines that generate_random fills a range with faster than by calling operator() once per
+//! value. These engines also discard values in constant or logarithmic time, so that parallel callers can start every
+//! thread at its own position of a sequence.
+template <class _Engine>
+inline constexpr bool __has_bulk_generate_v =
+  __is_philox_engine_v<_Engine> || __is_pcg64_engine_v<_Engine>;
+
+//! @brief Fills [__first, __last) with the values that as many calls of __engine() would return, and leaves __engine
+//! in the same state as those calls.
+//!
+//! For ``cuda::std::philox_engine`` and random access iterators, the rounds of several counters are computed at once,
+//! which the compiler can vectorize on the host. ``cuda::pcg64`` interleaves several jumped-ahead copies of its LCG.
+//! Other engines are called once per value.
+//!
+//! Together with ``discard``, generate_random lets every thread fill its own part of a sequence:
+//!
+//! .. code-block:: c++
+//!
+//!    cuda::std::philox4x32 rng(seed);
+//!    rng.discard(thread_id * values_per_thread);
+//!    cuda::generate_random(out + thread_id * values_per_thread, out + (thread_id + 1) * values_per_thread, rng);
+//!
+//! @param __first The beginning of the range to fill.
+//! @param __last The end of the range to fill.
+//! @param __engine The engine that produces the values.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _ForwardIterator, class _Engine>
+_CCCL_API constexpr void generate_random(_ForwardIterator __first, _ForwardIterator __last, _Engine& __engine)
+{
+  if constexpr (__is_philox_engine_v<_Engine> && ::cuda::std::__has_random_access_traversal<_ForwardIterator>)
+  {
+    __engine.__generate(__first, __last);
+  }
+  else if constexpr (__is_pcg64_engine_v<_Engine>)
+  {
+    __engine.generate(__first, __last);
+  }
+  else
+  {
+    for (; __first != __last; ++__first)
+    {
+      *__first = __engine();
+    }
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___RANDOM_GENERATE_RANDOM_H
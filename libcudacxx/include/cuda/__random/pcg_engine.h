@@ -217,6 +217,9 @@ private:
     }
     return ::cuda::std::pair{__acc_mult, __acc_plus};
   }
+  // The number of interleaved LCG steps of generate
+  static constexpr int __lane_count = 4;
+
   __pcg64_uint128_t __x_{};
 
 public:
@@ -298,6 +301,43 @@ public:
     __x_                        = __x_ * __mult + __plus;
   }
 
+  //! @brief Fill a range with the values that as many calls of `operator()` would return.
+  //!
+  //! The engine is left in the same state as after those calls. The values are computed by `__lane_count`
+  //! interleaved copies of the LCG that each jump `__lane_count` steps at a time, so that consecutive values do not
+  //! wait on each other's multiplication.
+  //! @param __first The beginning of the range to fill.
+  //! @param __last The end of the range to fill.
+  template <class _ForwardIterator>
+  _CCCL_API constexpr void generate(_ForwardIterator __first, _ForwardIterator __last)
+  {
+    // the state of lane __l is __l + 1 steps ahead of __x_
+    __pcg64_uint128_t __lanes[__lane_count] = {};
+    __lanes[0]                              = __x_ * __multiplier + __increment;
+    for (int __l = 1; __l < __lane_count; ++__l)
+    {
+      __lanes[__l] = __lanes[__l - 1] * __multiplier + __increment;
+    }
+    const auto [__mult, __plus] = __power_mod(__lane_count);
+
+    while (__first != __last)
+    {
+      for (int __l = 0; __l < __lane_count; ++__l, ++__first)
+      {
+        if (__first == __last)
+        {
+          return;
+        }
+        *__first = __output_transform(__lanes[__l]);
+        __x_     = __lanes[__l];
+      }
+      for (int __l = 0; __l < __lane_count; ++__l)
+      {
+        __lanes[__l] = __lanes[__l] * __mult + __plus;
+      }
+    }
+  }
+
   //! @brief Equality comparison for two engines.
   //! @return True if both engines have identical internal state.
   [[nodiscard]] _CCCL_API constexpr friend bool operator==(const pcg64_engine& __x, const pcg64_engine& __y) noexcept
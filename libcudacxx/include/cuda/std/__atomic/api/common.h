@@ -81,6 +81,13 @@
   {                                                                                                         \
     __atomic_wait(&__a, __v, __m, _Sco{});                                                                  \
   }                                                                                                         \
+  /* Like wait, but returns false once __rel_time has elapsed with the value still equal to __v */          \
+  _CCCL_API inline bool __wait_for(                                                                         \
+    _Tp __v, ::cuda::std::chrono::nanoseconds __rel_time, memory_order __m = memory_order_seq_cst)          \
+    const _VOLATILE noexcept                                                                                \
+  {                                                                                                         \
+    return __atomic_wait_for(&__a, __v, __rel_time, __m, _Sco{});                                           \
+  }                                                                                                         \
   _CCCL_API inline void notify_one() _CONST _VOLATILE noexcept                                              \
   {                                                                                                         \
     __atomic_notify_one(&__a, _Sco{});                                                                      \
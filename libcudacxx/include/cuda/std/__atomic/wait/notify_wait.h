@@ -24,6 +24,8 @@
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
 #include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__atomic/wait/waiter_table.h>
+#include <cuda/std/__chrono/duration.h>
 #include <cuda/std/cstring>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -32,35 +34,90 @@ _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
 extern "C" _CCCL_DEVICE void __atomic_try_wait_unsupported_before_SM_70__();
 
+template <typename _Tp>
+_CCCL_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+{
+#if _CCCL_CUDA_COMPILATION()
+  return __lhs == __rhs;
+#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
+  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+}
+
+// The address that host waiters and notifiers of the atomic at __a meet at in the waiter table. Every atomic_ref has
+// its own storage that points to the referenced object, so atomic_refs meet at that object instead.
+template <typename _Tp>
+[[nodiscard]] _CCCL_HOST_API inline void const volatile* __atomic_wait_address(_Tp const volatile* __a) noexcept
+{
+  return __a;
+}
+
+template <typename _Tp>
+[[nodiscard]] _CCCL_HOST_API inline void const volatile*
+__atomic_wait_address(__atomic_ref_storage<_Tp> const volatile* __a) noexcept
+{
+  return __a->get();
+}
+
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API inline void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+  ::cuda::std::__atomic_waiter_table_wait(::cuda::std::__atomic_wait_address(__a), [=]() {
+    return !::cuda::std::__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val);
+  });
+#else // ^^^ _LIBCUDACXX_HAS_FUTEX ^^^ / vvv !_LIBCUDACXX_HAS_FUTEX vvv
+  ::cuda::std::__atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+#endif // ^^^ !_LIBCUDACXX_HAS_FUTEX ^^^
+}
+
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API inline bool __atomic_wait_for_host(
+  _Tp const volatile* __a,
+  __atomic_underlying_remove_cv_t<_Tp> __val,
+  ::cuda::std::chrono::nanoseconds __rel_time,
+  memory_order __order,
+  _Sco)
+{
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+  return ::cuda::std::__atomic_waiter_table_wait_for(
+    ::cuda::std::__atomic_wait_address(__a), __atomic_poll_tester<_Tp, _Sco>(__a, __val, __order), __rel_time);
+#else // ^^^ _LIBCUDACXX_HAS_FUTEX ^^^ / vvv !_LIBCUDACXX_HAS_FUTEX vvv
+  return ::cuda::std::__cccl_thread_poll_with_backoff(__atomic_poll_tester<_Tp, _Sco>(__a, __val, __order), __rel_time);
+#endif // ^^^ !_LIBCUDACXX_HAS_FUTEX ^^^
+}
+
+template <typename _Tp>
+_CCCL_HOST_API inline void __atomic_notify_host([[maybe_unused]] _Tp const volatile* __a)
+{
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+  ::cuda::std::__atomic_waiter_table_notify(::cuda::std::__atomic_wait_address(__a));
+#endif // _LIBCUDACXX_HAS_FUTEX
+}
+
 template <typename _Tp, typename _Sco>
 _CCCL_API inline void
 __atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
-                     , NV_IS_HOST, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+                     , NV_IS_HOST, __atomic_try_wait_slow_host(__a, __val, __order, _Sco{});
                      , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
+// Host waiters share the slots of the waiter table, so notify_one has to wake all of them
 template <typename _Tp, typename _Sco>
-_CCCL_API inline void __atomic_notify_one(_Tp const volatile*, _Sco)
+_CCCL_API inline void __atomic_notify_one([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_host(__a);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_API inline void __atomic_notify_all(_Tp const volatile*, _Sco)
-{
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
-}
-
-template <typename _Tp>
-_CCCL_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+_CCCL_API inline void __atomic_notify_all([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-#if _CCCL_CUDA_COMPILATION()
-  return __lhs == __rhs;
-#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
-  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
-#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_host(__a);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
@@ -88,6 +145,27 @@ _CCCL_API inline void __atomic_wait(
   }
 }
 
+// Like __atomic_wait, but gives up once __rel_time has elapsed. Returns false if the value still equals __val by then.
+// On the host, the waiter sleeps until it is notified or the deadline passes, so writers have to notify the atomic.
+template <typename _Tp, typename _Sco>
+_CCCL_API inline bool __atomic_wait_for(
+  _Tp const volatile* __a,
+  __atomic_underlying_remove_cv_t<_Tp> const __val,
+  ::cuda::std::chrono::nanoseconds __rel_time,
+  memory_order __order,
+  _Sco = {})
+{
+  const __atomic_poll_tester<_Tp, _Sco> __changed(__a, __val, __order);
+  // a zero duration means no deadline to __cccl_thread_poll_with_backoff
+  if (__rel_time <= ::cuda::std::chrono::nanoseconds::zero())
+  {
+    return __changed();
+  }
+  NV_IF_ELSE_TARGET(NV_IS_HOST,
+                    (return ::cuda::std::__atomic_wait_for_host(__a, __val, __rel_time, __order, _Sco{});),
+                    (return ::cuda::std::__cccl_thread_poll_with_backoff(__changed, __rel_time);))
+}
+
 _CCCL_END_NAMESPACE_CUDA_STD
 
 #include <cuda/std/__cccl/epilogue.h>
@@ -0,0 +1,141 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___ATOMIC_WAIT_WAITER_TABLE_H
+#define _CUDA_STD___ATOMIC_WAIT_WAITER_TABLE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__chrono/duration.h>
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Host threads blocked in an atomic wait sleep on the futex of one of a fixed number of slots, picked by hashing the
+// address of the atomic, like libstdc++ does. Notifiers only enter the kernel when some thread sleeps on the slot.
+// Since unrelated atomics may share a slot, every notification wakes all the threads sleeping on it.
+struct alignas(64) __atomic_waiter_slot
+{
+  // number of threads sleeping on the slot
+  int __waiters;
+  // futex word, bumped by every notification
+  int __version;
+};
+
+inline constexpr size_t __atomic_waiter_table_size = 16;
+
+// The table has to be shared by every shared object of a process, since a notification from one of them must reach the
+// waiters of another. A function with default visibility keeps the hidden visibility of _CCCL_HOST_API from giving
+// each of them its own copy.
+[[nodiscard]] _CCCL_PUBLIC_HOST_API inline __atomic_waiter_slot&
+__atomic_waiter_slot_for(void const volatile* __addr) noexcept
+{
+  static __atomic_waiter_slot __table[__atomic_waiter_table_size];
+
+  const auto __key = reinterpret_cast<uintptr_t>(__addr);
+  return __table[((__key >> 2) ^ (__key >> 8)) % __atomic_waiter_table_size];
+}
+
+// Sleeps until __done() returns true, which must happen after the atomic at __addr is notified. Every sleep is bounded
+// by a timeout that backs off to 1ms, so that writers that never notify, such as a device writing to managed memory,
+// are still observed.
+template <class _Fn>
+_CCCL_HOST_API void __atomic_waiter_table_wait(void const volatile* __addr, _Fn __done)
+{
+  __atomic_waiter_slot& __slot = ::cuda::std::__atomic_waiter_slot_for(__addr);
+
+  __atomic_fetch_add(&__slot.__waiters, 1, __ATOMIC_SEQ_CST);
+  // pairs with the fence in __atomic_waiter_table_notify: either the notifier sees this waiter, or __done() sees the
+  // value stored before the notification
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  constexpr ::cuda::std::chrono::nanoseconds __max_timeout = ::cuda::std::chrono::milliseconds(1);
+  ::cuda::std::chrono::nanoseconds __timeout               = ::cuda::std::chrono::microseconds(10);
+  while (true)
+  {
+    const int __version = __atomic_load_n(&__slot.__version, __ATOMIC_ACQUIRE);
+    if (__done())
+    {
+      break;
+    }
+    ::cuda::std::__cccl_futex_wait(&__slot.__version, __version, __timeout);
+    __timeout = (::cuda::std::min)(__timeout * 2, __max_timeout);
+  }
+
+  __atomic_fetch_sub(&__slot.__waiters, 1, __ATOMIC_RELAXED);
+}
+
+// Like __atomic_waiter_table_wait, but gives up once __rel_time has elapsed. Returns the last result of __done(). The
+// sleeps only end with a notification or at the deadline, so writers have to notify the atomic at __addr.
+template <class _Fn>
+[[nodiscard]] _CCCL_HOST_API bool
+__atomic_waiter_table_wait_for(void const volatile* __addr, _Fn __done, ::cuda::std::chrono::nanoseconds __rel_time)
+{
+  __atomic_waiter_slot& __slot = ::cuda::std::__atomic_waiter_slot_for(__addr);
+
+  __atomic_fetch_add(&__slot.__waiters, 1, __ATOMIC_SEQ_CST);
+  // pairs with the fence in __atomic_waiter_table_notify, see __atomic_waiter_table_wait
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  const timespec __deadline = ::cuda::std::__cccl_futex_deadline(__rel_time);
+  bool __result             = false;
+  while (true)
+  {
+    const int __version = __atomic_load_n(&__slot.__version, __ATOMIC_ACQUIRE);
+    if (__done())
+    {
+      __result = true;
+      break;
+    }
+    if (!::cuda::std::__cccl_futex_wait_until(&__slot.__version, __version, __deadline))
+    {
+      __result = __done();
+      break;
+    }
+  }
+
+  __atomic_fetch_sub(&__slot.__waiters, 1, __ATOMIC_RELAXED);
+  return __result;
+}
+
+_CCCL_HOST_API inline void __atomic_waiter_table_notify(void const volatile* __addr)
+{
+  __atomic_waiter_slot& __slot = ::cuda::std::__atomic_waiter_slot_for(__addr);
+
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&__slot.__waiters, __ATOMIC_RELAXED) != 0)
+  {
+    __atomic_fetch_add(&__slot.__version, 1, __ATOMIC_SEQ_CST);
+    ::cuda::std::__cccl_futex_wake_all(&__slot.__version);
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX_HAS_FUTEX
+
+#endif // _CUDA_STD___ATOMIC_WAIT_WAITER_TABLE_H
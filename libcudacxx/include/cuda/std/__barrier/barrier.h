@@ -156,6 +156,17 @@ private:
   {
     return __try_wait_phase(__old & __phase_bit);
   }
+  // Blocks on the barrier word until the phase changes. Only the completion of a phase notifies, so the intermediate
+  // arrivals just make the wait return early.
+  _CCCL_HOST_API void __wait_phase(uint64_t __phase) const
+  {
+    uint64_t __current = __phase_arrived_expected.load(memory_order_acquire);
+    while ((__current & __phase_bit) == __phase)
+    {
+      __phase_arrived_expected.wait(__current, memory_order_relaxed);
+      __current = __phase_arrived_expected.load(memory_order_acquire);
+    }
+  }
   [[nodiscard]] _CCCL_API bool __try_wait_parity(bool __parity) const
   {
     return __try_wait_phase(__parity ? __phase_bit : 0);
@@ -188,12 +199,17 @@ public:
   }
   _CCCL_API void wait(arrival_token&& __phase) const
   {
-    ::cuda::std::__cccl_thread_poll_with_backoff(
-      __barrier_poll_tester_phase<__barrier_base>(this, ::cuda::std::move(__phase)));
+    NV_IF_ELSE_TARGET(NV_IS_HOST,
+                      (__wait_phase(__phase & __phase_bit);),
+                      (::cuda::std::__cccl_thread_poll_with_backoff(
+                         __barrier_poll_tester_phase<__barrier_base>(this, ::cuda::std::move(__phase)));))
   }
   _CCCL_API void wait_parity(bool __parity) const
   {
-    ::cuda::std::__cccl_thread_poll_with_backoff(__barrier_poll_tester_parity<__barrier_base>(this, __parity));
+    NV_IF_ELSE_TARGET(
+      NV_IS_HOST,
+      (__wait_phase(__parity ? __phase_bit : 0);),
+      (::cuda::std::__cccl_thread_poll_with_backoff(__barrier_poll_tester_parity<__barrier_base>(this, __parity));))
   }
   _CCCL_API void arrive_and_wait()
   {
@@ -0,0 +1,220 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___BIT_WORD_ALGORITHMS_H
+#define _CUDA_STD___BIT_WORD_ALGORITHMS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/popcount.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__type_traits/is_unsigned_integer.h>
+#include <cuda/std/__utility/convert_to_integral.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/limits>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Algorithms over an array of words of bits, bit i being bit i % digits of word i / digits. The words are unsigned
+// integers or wrappers that convert to them through __convert_to_integral, like the words of bitset. All of them take
+// time linear in the number of words rather than in the number of bits.
+
+template <class _Word>
+using __bit_word_t = decltype(__convert_to_integral(::cuda::std::declval<_Word>()));
+
+// Word loops work on blocks of this many words. A byte of a word holds the count of at most 8 bits, so the counts of a
+// block add up per byte without overflowing.
+inline constexpr size_t __bit_word_block = 16;
+
+// The number of set bits of every byte of __v, in that byte
+template <class _Uint>
+[[nodiscard]] _CCCL_API constexpr _Uint __popcount_bytes(_Uint __v) noexcept
+{
+  constexpr _Uint __m1 = static_cast<_Uint>(~_Uint{0}) / 3;  // 0x55...
+  constexpr _Uint __m2 = static_cast<_Uint>(~_Uint{0}) / 5;  // 0x33...
+  constexpr _Uint __m4 = static_cast<_Uint>(~_Uint{0}) / 17; // 0x0f...
+  __v                  = static_cast<_Uint>(__v - ((__v >> 1) & __m1));
+  __v                  = static_cast<_Uint>((__v & __m2) + ((__v >> 2) & __m2));
+  return static_cast<_Uint>((__v + (__v >> 4)) & __m4);
+}
+
+// The number of set bits in the first __n words, which are at most a block, added per byte with shifts and masks only.
+// This vectorizes on every target, unlike a loop of popcount instructions, and needs no popcount instruction at all.
+template <class _Word>
+[[nodiscard]] _CCCL_API constexpr size_t __popcount_word_block(const _Word* __words, size_t __n) noexcept
+{
+  using _Uint = __bit_word_t<_Word>;
+
+  _Uint __bytes = 0;
+  for (size_t __i = 0; __i < __n; ++__i)
+  {
+    __bytes += ::cuda::std::__popcount_bytes(static_cast<_Uint>(__convert_to_integral(__words[__i])));
+  }
+
+  // add the bytes into 16 bit lanes, then the lanes into the top lane
+  constexpr _Uint __ones16 = static_cast<_Uint>(~_Uint{0}) / 0xffff; // 0x00010001...
+  constexpr _Uint __m8     = __ones16 * 0xff;                        // 0x00ff00ff...
+  const _Uint __lanes      = (__bytes & __m8) + ((__bytes >> 8) & __m8);
+  return static_cast<size_t>((__lanes * __ones16) >> (numeric_limits<_Uint>::digits - 16));
+}
+
+// The number of set bits in the first __n words
+template <class _Word>
+[[nodiscard]] _CCCL_API constexpr size_t __popcount_words(const _Word* __words, size_t __n) noexcept
+{
+  using _Uint = __bit_word_t<_Word>;
+  static_assert(__cccl_is_unsigned_integer_v<_Uint>, "the words of a bit array must be unsigned integers");
+
+  if constexpr (sizeof(_Uint) >= sizeof(uint32_t))
+  {
+    // device code has a popcount instruction that is as fast
+    NV_IF_TARGET(NV_IS_HOST, ({
+                   const size_t __blocks_end = __n - __n % __bit_word_block;
+
+                   size_t __count = 0;
+                   for (size_t __i = 0; __i < __blocks_end; __i += __bit_word_block)
+                   {
+                     __count += ::cuda::std::__popcount_word_block(__words + __i, __bit_word_block);
+                   }
+                   return __count + ::cuda::std::__popcount_word_block(__words + __blocks_end, __n - __blocks_end);
+                 }))
+  }
+
+  size_t __count = 0;
+  for (size_t __i = 0; __i < __n; ++__i)
+  {
+    __count += static_cast<size_t>(::cuda::std::popcount(static_cast<_Uint>(__convert_to_integral(__words[__i]))));
+  }
+  return __count;
+}
+
+// The number of set bits before bit __pos
+template <class _Word>
+[[nodiscard]] _CCCL_API constexpr size_t __rank_bits(const _Word* __words, size_t __pos) noexcept
+{
+  using _Uint                      = __bit_word_t<_Word>;
+  constexpr size_t __bits_per_word = numeric_limits<_Uint>::digits;
+
+  const size_t __n = __pos / __bits_per_word;
+  size_t __count   = ::cuda::std::__popcount_words(__words, __n);
+  if (__pos % __bits_per_word != 0)
+  {
+    const auto __mask =
+      static_cast<_Uint>(static_cast<_Uint>(~_Uint{0}) >> (__bits_per_word - __pos % __bits_per_word));
+    __count += static_cast<size_t>(
+      ::cuda::std::popcount(static_cast<_Uint>(static_cast<_Uint>(__convert_to_integral(__words[__n])) & __mask)));
+  }
+  return __count;
+}
+
+// The position of the first set bit at or after bit __pos of the first __n words, or __n * digits if there is none
+template <class _Word>
+[[nodiscard]] _CCCL_API constexpr size_t __find_set_bit(const _Word* __words, size_t __n, size_t __pos) noexcept
+{
+  using _Uint                      = __bit_word_t<_Word>;
+  constexpr size_t __bits_per_word = numeric_limits<_Uint>::digits;
+
+  size_t __i = __pos / __bits_per_word;
+  if (__i >= __n)
+  {
+    return __n * __bits_per_word;
+  }
+
+  // clear the bits before __pos in its word
+  const auto __mask = static_cast<_Uint>(static_cast<_Uint>(~_Uint{0}) << (__pos % __bits_per_word));
+  auto __word       = static_cast<_Uint>(static_cast<_Uint>(__convert_to_integral(__words[__i])) & __mask);
+  while (__word == 0)
+  {
+    if (++__i == __n)
+    {
+      return __n * __bits_per_word;
+    }
+    __word = static_cast<_Uint>(__convert_to_integral(__words[__i]));
+  }
+  return __i * __bits_per_word + static_cast<size_t>(::cuda::std::countr_zero(__word));
+}
+
+// The position of the set bit of index __k in __word, which must have more than __k set bits
+template <class _Uint>
+[[nodiscard]] _CCCL_API constexpr size_t __select_bit_in_word(_Uint __word, size_t __k) noexcept
+{
+  // find the byte that holds the bit from the running counts of the bytes ...
+  size_t __pos = 0;
+  if constexpr (sizeof(_Uint) > 1)
+  {
+    constexpr auto __ones8 = static_cast<_Uint>(static_cast<_Uint>(~_Uint{0}) / 0xff); // 0x0101...
+    const auto __counts    = static_cast<_Uint>(::cuda::std::__popcount_bytes(__word) * __ones8);
+    while (static_cast<size_t>((__counts >> __pos) & 0xff) <= __k)
+    {
+      __pos += 8;
+    }
+    if (__pos != 0)
+    {
+      __k -= static_cast<size_t>((__counts >> (__pos - 8)) & 0xff);
+    }
+  }
+
+  // ... then clear the lower set bits of the byte
+  auto __byte = static_cast<unsigned>((__word >> __pos) & 0xff);
+  for (; __k != 0; --__k)
+  {
+    __byte &= __byte - 1;
+  }
+  return __pos + static_cast<size_t>(::cuda::std::countr_zero(__byte));
+}
+
+// The position of the set bit of index __k of the first __n words, or __n * digits if there are at most __k set bits
+template <class _Word>
+[[nodiscard]] _CCCL_API constexpr size_t __select_bit(const _Word* __words, size_t __n, size_t __k) noexcept
+{
+  using _Uint                      = __bit_word_t<_Word>;
+  constexpr size_t __bits_per_word = numeric_limits<_Uint>::digits;
+
+  // skip whole blocks first, then the words of the block that holds the bit
+  size_t __i = 0;
+  for (; __i + __bit_word_block <= __n; __i += __bit_word_block)
+  {
+    const size_t __count = ::cuda::std::__popcount_words(__words + __i, __bit_word_block);
+    if (__k < __count)
+    {
+      break;
+    }
+    __k -= __count;
+  }
+
+  for (; __i < __n; ++__i)
+  {
+    const auto __word    = static_cast<_Uint>(__convert_to_integral(__words[__i]));
+    const size_t __count = static_cast<size_t>(::cuda::std::popcount(__word));
+    if (__k < __count)
+    {
+      return __i * __bits_per_word + ::cuda::std::__select_bit_in_word(__word, __k);
+    }
+    __k -= __count;
+  }
+  return __n * __bits_per_word;
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___BIT_WORD_ALGORITHMS_H
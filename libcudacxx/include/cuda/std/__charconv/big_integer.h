@@ -0,0 +1,194 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_BIG_INTEGER_H
+#define _CUDA_STD___CHARCONV_BIG_INTEGER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief Unsigned integer of at most _Nlimbs 32-bit limbs for the exact paths of the floating-point conversions. The
+//! limbs are stored least significant first and the most significant limb in use is never zero.
+template <int _Nlimbs>
+struct __charconv_big_integer
+{
+  uint32_t __limbs_[_Nlimbs];
+  int __size_;
+
+  _CCCL_API explicit __charconv_big_integer(uint64_t __value) noexcept
+      : __size_{0}
+  {
+    for (; __value != 0; __value >>= 32)
+    {
+      __push(static_cast<uint32_t>(__value));
+    }
+  }
+
+  [[nodiscard]] _CCCL_API bool __is_zero() const noexcept
+  {
+    return __size_ == 0;
+  }
+
+  _CCCL_API void __push(uint32_t __limb) noexcept
+  {
+    _CCCL_ASSERT(__size_ < _Nlimbs, "__charconv_big_integer: capacity exceeded");
+    __limbs_[__size_++] = __limb;
+  }
+
+  _CCCL_API void __trim() noexcept
+  {
+    while (__size_ > 0 && __limbs_[__size_ - 1] == 0)
+    {
+      --__size_;
+    }
+  }
+
+  //! @brief *this = *this * __mul + __add
+  _CCCL_API void __mul_add(uint32_t __mul, uint32_t __add = 0) noexcept
+  {
+    uint64_t __carry = __add;
+    for (int __i = 0; __i < __size_; ++__i)
+    {
+      __carry += static_cast<uint64_t>(__limbs_[__i]) * __mul;
+      __limbs_[__i] = static_cast<uint32_t>(__carry);
+      __carry >>= 32;
+    }
+    if (__carry != 0)
+    {
+      __push(static_cast<uint32_t>(__carry));
+    }
+  }
+
+  //! @brief *this = *this * 5^__n
+  _CCCL_API void __mul_pow5(int __n) noexcept
+  {
+    constexpr uint32_t __pow5_13 = 1220703125;
+    for (; __n >= 13; __n -= 13)
+    {
+      __mul_add(__pow5_13);
+    }
+    uint32_t __mul = 1;
+    for (; __n > 0; --__n)
+    {
+      __mul *= 5;
+    }
+    __mul_add(__mul);
+  }
+
+  //! @brief *this = *this * 2^__n
+  _CCCL_API void __shift_left(int __n) noexcept
+  {
+    if (__size_ == 0)
+    {
+      return;
+    }
+
+    const int __limb_shift = __n / 32;
+    const int __bit_shift  = __n % 32;
+    if (__bit_shift != 0)
+    {
+      const uint32_t __top = __limbs_[__size_ - 1] >> (32 - __bit_shift);
+      for (int __i = __size_ - 1; __i > 0; --__i)
+      {
+        __limbs_[__i] = (__limbs_[__i] << __bit_shift) | (__limbs_[__i - 1] >> (32 - __bit_shift));
+      }
+      __limbs_[0] <<= __bit_shift;
+      if (__top != 0)
+      {
+        __push(__top);
+      }
+    }
+    if (__limb_shift != 0)
+    {
+      _CCCL_ASSERT(__size_ + __limb_shift <= _Nlimbs, "__charconv_big_integer: capacity exceeded");
+      for (int __i = __size_ - 1; __i >= 0; --__i)
+      {
+        __limbs_[__i + __limb_shift] = __limbs_[__i];
+      }
+      for (int __i = 0; __i < __limb_shift; ++__i)
+      {
+        __limbs_[__i] = 0;
+      }
+      __size_ += __limb_shift;
+    }
+  }
+
+  //! @brief *this = *this / __div, returns the remainder
+  _CCCL_API uint32_t __div(uint32_t __div) noexcept
+  {
+    uint64_t __rem = 0;
+    for (int __i = __size_ - 1; __i >= 0; --__i)
+    {
+      __rem         = (__rem << 32) | __limbs_[__i];
+      __limbs_[__i] = static_cast<uint32_t>(__rem / __div);
+      __rem %= __div;
+    }
+    __trim();
+    return static_cast<uint32_t>(__rem);
+  }
+
+  //! @brief Multiplies *this, which must be less than 2^__nbits, by __mul. Keeps the low __nbits bits of the product
+  //! and returns the others.
+  _CCCL_API uint32_t __mul_split(uint32_t __mul, int __nbits) noexcept
+  {
+    __mul_add(__mul);
+
+    const int __limb = __nbits / 32;
+    const int __bit  = __nbits % 32;
+    const uint64_t __lo = (__limb < __size_) ? __limbs_[__limb] : 0;
+    const uint64_t __hi = (__limb + 1 < __size_) ? __limbs_[__limb + 1] : 0;
+    const auto __ret    = static_cast<uint32_t>(((__hi << 32) | __lo) >> __bit);
+
+    if (__limb < __size_)
+    {
+      __limbs_[__limb] &= (uint32_t{1} << __bit) - 1;
+      __size_ = __limb + 1;
+      __trim();
+    }
+    return __ret;
+  }
+
+  //! @brief Returns a negative value, zero or a positive value if __lhs is less than, equal to or greater than __rhs
+  [[nodiscard]] _CCCL_API friend int
+  __compare(const __charconv_big_integer& __lhs, const __charconv_big_integer& __rhs) noexcept
+  {
+    if (__lhs.__size_ != __rhs.__size_)
+    {
+      return __lhs.__size_ - __rhs.__size_;
+    }
+    for (int __i = __lhs.__size_ - 1; __i >= 0; --__i)
+    {
+      if (__lhs.__limbs_[__i] != __rhs.__limbs_[__i])
+      {
+        return (__lhs.__limbs_[__i] < __rhs.__limbs_[__i]) ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_BIG_INTEGER_H
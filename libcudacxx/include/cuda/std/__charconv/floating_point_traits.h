@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FLOATING_POINT_TRAITS_H
+#define _CUDA_STD___CHARCONV_FLOATING_POINT_TRAITS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief Properties of the floating-point types supported by to_chars and from_chars
+template <class _Tp>
+struct __charconv_fp_traits;
+
+template <>
+struct __charconv_fp_traits<float>
+{
+  using __uint_type = uint32_t;
+
+  static constexpr int __mantissa_bits = 23;
+  static constexpr int __exponent_bias = 127;
+  static constexpr int __infinite_power = 0xff;
+
+  //! Maximal number of significant decimal digits of the exact value
+  static constexpr int __max_exact_digits = 112;
+  //! Maximal number of decimal digits of the integral part
+  static constexpr int __max_integral_digits = 39;
+  //! Limbs of a big integer that holds the integral part or the fractional bits times 10^9
+  static constexpr int __exact_limbs = 6;
+
+  //! Digits of the input that decide the rounding of from_chars, the others only matter if they are nonzero
+  static constexpr int __max_parsed_digits = 114;
+  //! Limbs of a big integer that holds the parsed digits scaled to the halfway point between two floats
+  static constexpr int __parse_limbs = 16;
+
+  //! Eisel-Lemire: w * 10^q is zero for q below and infinite for q above these powers of ten
+  static constexpr int __smallest_power_of_ten = -64;
+  static constexpr int __largest_power_of_ten  = 38;
+  //! Eisel-Lemire: the range of q in which w * 10^q can be exactly halfway between two floats
+  static constexpr int __min_exponent_round_to_even = -17;
+  static constexpr int __max_exponent_round_to_even = 10;
+
+  //! Clinger's fast path: powers of ten that are exact floats
+  static constexpr int __max_exact_power_of_ten = 10;
+};
+
+template <>
+struct __charconv_fp_traits<double>
+{
+  using __uint_type = uint64_t;
+
+  static constexpr int __mantissa_bits = 52;
+  static constexpr int __exponent_bias = 1023;
+  static constexpr int __infinite_power = 0x7ff;
+
+  static constexpr int __max_exact_digits    = 767;
+  static constexpr int __max_integral_digits = 309;
+  static constexpr int __exact_limbs         = 35;
+
+  static constexpr int __max_parsed_digits = 769;
+  static constexpr int __parse_limbs       = 88;
+
+  static constexpr int __smallest_power_of_ten = -342;
+  static constexpr int __largest_power_of_ten  = 308;
+  static constexpr int __min_exponent_round_to_even = -4;
+  static constexpr int __max_exponent_round_to_even = 23;
+
+  static constexpr int __max_exact_power_of_ten = 22;
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FLOATING_POINT_TRAITS_H
@@ -0,0 +1,594 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+#define _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/big_integer.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/eisel_lemire_tables.h>
+#include <cuda/std/__charconv/floating_point_traits.h>
+#include <cuda/std/__charconv/from_chars.h>
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief A binary floating-point value given by its mantissa field and biased exponent field
+struct __charconv_adjusted_mantissa
+{
+  uint64_t __mantissa_;
+  int __power2_;
+
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator==(const __charconv_adjusted_mantissa& __lhs, const __charconv_adjusted_mantissa& __rhs) noexcept
+  {
+    return __lhs.__mantissa_ == __rhs.__mantissa_ && __lhs.__power2_ == __rhs.__power2_;
+  }
+
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator!=(const __charconv_adjusted_mantissa& __lhs, const __charconv_adjusted_mantissa& __rhs) noexcept
+  {
+    return !(__lhs == __rhs);
+  }
+};
+
+// Eisel-Lemire algorithm, see D. Lemire, "Number Parsing at a Gigabyte per Second", Software: Practice and Experience
+// 51 (8), 2021, and N. Mushtak, D. Lemire, "Fast Number Parsing Without Fallback", 2023.
+
+//! @brief Returns the float that is closest to __w * 10^__q, assuming that there is no tie unless __w * 10^__q is exact
+template <class _Tp>
+[[nodiscard]] _CCCL_API __charconv_adjusted_mantissa __eisel_lemire(int64_t __q, uint64_t __w) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  if (__w == 0 || __q < _Traits::__smallest_power_of_ten)
+  {
+    return {0, 0};
+  }
+  if (__q > _Traits::__largest_power_of_ten)
+  {
+    return {0, _Traits::__infinite_power};
+  }
+
+  const int __lz = ::cuda::std::countl_zero(__w);
+  __w <<= __lz;
+
+  // The product of __w and the 128-bit approximation of 5^__q. The high half suffices to round correctly unless all
+  // the bits below the mantissa, the rounding bit and the bit lost to normalization are ones.
+  const auto& __pow5 =
+    ::cuda::std::__eisel_lemire_pow5_128[__q - ::cuda::std::__eisel_lemire_smallest_power_of_five];
+  uint64_t __high       = ::cuda::mul_hi(__w, __pow5[1]);
+  uint64_t __low        = __w * __pow5[1];
+  constexpr int __bits  = _Traits::__mantissa_bits + 3;
+  constexpr auto __mask = ~uint64_t{0} >> __bits;
+  if ((__high & __mask) == __mask)
+  {
+    const uint64_t __second_high = ::cuda::mul_hi(__w, __pow5[0]);
+    __low += __second_high;
+    __high += (__second_high > __low);
+  }
+
+  const int __upperbit = static_cast<int>(__high >> 63);
+  const int __shift    = __upperbit + 64 - __bits;
+
+  __charconv_adjusted_mantissa __answer{__high >> __shift, 0};
+  // floor(log2(10^__q)) + 63, exact for __q in [-1e5, 1e5]
+  const int __power = static_cast<int>(((152170 + 65536) * __q) >> 16) + 63;
+  __answer.__power2_ = __power + __upperbit - __lz + _Traits::__exponent_bias;
+
+  if (__answer.__power2_ <= 0)
+  {
+    // Subnormal, or zero if more than 64 bits are below the smallest exponent
+    if (-__answer.__power2_ + 1 >= 64)
+    {
+      return {0, 0};
+    }
+    __answer.__mantissa_ >>= -__answer.__power2_ + 1;
+    // Ties cannot happen for subnormals
+    __answer.__mantissa_ += (__answer.__mantissa_ & 1);
+    __answer.__mantissa_ >>= 1;
+    // Rounding up may have made the value normal
+    __answer.__power2_ = (__answer.__mantissa_ < (uint64_t{1} << _Traits::__mantissa_bits)) ? 0 : 1;
+    return __answer;
+  }
+
+  // A tie is only possible where 5^__q fits into 64 bits, and if the bits below the rounding bit are zero
+  if (__low <= 1 && __q >= _Traits::__min_exponent_round_to_even && __q <= _Traits::__max_exponent_round_to_even
+      && (__answer.__mantissa_ & 3) == 1 && (__answer.__mantissa_ << __shift) == __high)
+  {
+    __answer.__mantissa_ &= ~uint64_t{1};
+  }
+
+  __answer.__mantissa_ += (__answer.__mantissa_ & 1);
+  __answer.__mantissa_ >>= 1;
+  if (__answer.__mantissa_ >= (uint64_t{2} << _Traits::__mantissa_bits))
+  {
+    __answer.__mantissa_ = uint64_t{1} << _Traits::__mantissa_bits;
+    ++__answer.__power2_;
+  }
+
+  __answer.__mantissa_ &= ~(uint64_t{1} << _Traits::__mantissa_bits);
+  if (__answer.__power2_ >= _Traits::__infinite_power)
+  {
+    return {0, _Traits::__infinite_power};
+  }
+  return __answer;
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __from_chars_is_digit(char __c) noexcept
+{
+  return static_cast<unsigned char>(__c - '0') < 10;
+}
+
+//! @brief Decides between __candidate and the next float by comparing the decimal value of the digits in
+//! [__first, __last), which may contain one point, times 10^__exp10 with the halfway point between both exactly.
+template <class _Tp>
+[[nodiscard]] _CCCL_API __charconv_adjusted_mantissa __from_chars_fp_compare_halfway(
+  const char* __first, const char* __last, int __exp10, __charconv_adjusted_mantissa __candidate) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+  using _BigInt = __charconv_big_integer<_Traits::__parse_limbs>;
+
+  // The significant digits, up to the number that can decide the rounding, and whether any of the others is nonzero
+  _BigInt __digits{0};
+  int __ndigits       = 0;
+  int __nskipped      = 0;
+  bool __truncated    = false;
+  uint32_t __group    = 0;
+  uint32_t __group_10 = 1;
+  for (; __first != __last; ++__first)
+  {
+    if (*__first == '.')
+    {
+      continue;
+    }
+    const auto __d = static_cast<uint32_t>(*__first - '0');
+    if (__ndigits == 0 && __d == 0)
+    {
+      // The exponent counts the leading zeros in the fractional part
+      continue;
+    }
+    if (__ndigits == _Traits::__max_parsed_digits)
+    {
+      __truncated |= __d != 0;
+      ++__nskipped;
+      continue;
+    }
+    ++__ndigits;
+    __group = __group * 10 + __d;
+    __group_10 *= 10;
+    if (__group_10 == 1000000000)
+    {
+      __digits.__mul_add(__group_10, __group);
+      __group    = 0;
+      __group_10 = 1;
+    }
+  }
+  __digits.__mul_add(__group_10, __group);
+  __exp10 += __nskipped;
+
+  // The value is __digits * 10^__exp10, where __exp10 was relative to all digits in the range
+  // halfway = (2 * m + 1) * 2^(e - 1) for the candidate m * 2^e
+  const bool __normal = __candidate.__power2_ != 0;
+  const uint64_t __m  = __candidate.__mantissa_ | (static_cast<uint64_t>(__normal) << _Traits::__mantissa_bits);
+  const int __e2 =
+    ((__normal) ? __candidate.__power2_ : 1) - _Traits::__exponent_bias - _Traits::__mantissa_bits - 1;
+  _BigInt __halfway{2 * __m + 1};
+
+  // Compare __digits * 5^__exp10 * 2^__exp10 with __halfway * 2^__e2
+  int __pow2 = __exp10 - __e2;
+  if (__exp10 >= 0)
+  {
+    __digits.__mul_pow5(__exp10);
+  }
+  else
+  {
+    __halfway.__mul_pow5(-__exp10);
+  }
+  if (__pow2 >= 0)
+  {
+    __digits.__shift_left(__pow2);
+  }
+  else
+  {
+    __halfway.__shift_left(-__pow2);
+  }
+
+  const int __cmp = __compare(__digits, __halfway);
+  if (__cmp < 0 || (__cmp == 0 && !__truncated && (__m & 1) == 0))
+  {
+    return __candidate;
+  }
+
+  // The next float, which may be the next binade or infinity
+  ++__candidate.__mantissa_;
+  if (__candidate.__mantissa_ == (uint64_t{1} << _Traits::__mantissa_bits))
+  {
+    __candidate.__mantissa_ = 0;
+    ++__candidate.__power2_;
+  }
+  return __candidate;
+}
+
+//! @brief Assigns the float given by the sign, mantissa field and biased exponent field to __value, or reports that the
+//! value of nonzero digits is out of range
+template <class _Tp>
+[[nodiscard]] _CCCL_API errc
+__from_chars_fp_assign(_Tp& __value, bool __negative, __charconv_adjusted_mantissa __am, bool __nonzero) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+  using _Up     = typename _Traits::__uint_type;
+
+  if (__am.__power2_ == _Traits::__infinite_power || (__nonzero && __am.__mantissa_ == 0 && __am.__power2_ == 0))
+  {
+    return errc::result_out_of_range;
+  }
+  const auto __bits = static_cast<_Up>(__am.__mantissa_)
+                    | (static_cast<_Up>(__am.__power2_) << _Traits::__mantissa_bits)
+                    | (static_cast<_Up>(__negative) << (8 * sizeof(_Up) - 1));
+  __value = ::cuda::std::bit_cast<_Tp>(__bits);
+  return errc{};
+}
+
+//! @brief Parses the exponent after the exponent character at __first, returns the end of the exponent, which is
+//! __first if there is no valid one. Large exponents saturate, they cannot make a difference anyway.
+[[nodiscard]] _CCCL_API inline const char*
+__from_chars_fp_exponent(const char* __first, const char* __last, int& __exp) noexcept
+{
+  const char* __it = __first + 1;
+  bool __negative  = false;
+  if (__it != __last && (*__it == '+' || *__it == '-'))
+  {
+    __negative = *__it == '-';
+    ++__it;
+  }
+  if (__it == __last || !::cuda::std::__from_chars_is_digit(*__it))
+  {
+    return __first;
+  }
+
+  int __value = 0;
+  for (; __it != __last && ::cuda::std::__from_chars_is_digit(*__it); ++__it)
+  {
+    if (__value < 100000)
+    {
+      __value = __value * 10 + (*__it - '0');
+    }
+  }
+  __exp = (__negative) ? -__value : __value;
+  return __it;
+}
+
+//! @brief Returns whether [__first, __last) starts with the lower case string __str, ignoring case
+[[nodiscard]] _CCCL_API constexpr bool
+__from_chars_starts_with_icase(const char* __first, const char* __last, const char* __str, int __n) noexcept
+{
+  if (__last - __first < __n)
+  {
+    return false;
+  }
+  for (int __i = 0; __i < __n; ++__i)
+  {
+    if ((__first[__i] | 0x20) != __str[__i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//! @brief Parses infinity or NaN, returns __first if there is neither
+template <class _Tp>
+[[nodiscard]] _CCCL_API const char*
+__from_chars_fp_non_finite(const char* __first, const char* __last, bool __negative, _Tp& __value) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  if (::cuda::std::__from_chars_starts_with_icase(__first, __last, "inf", 3))
+  {
+    (void) ::cuda::std::__from_chars_fp_assign(__value, __negative, {0, 0}, false);
+    __value = ::cuda::std::bit_cast<_Tp>(
+      ::cuda::std::bit_cast<typename _Traits::__uint_type>(__value)
+      | (static_cast<typename _Traits::__uint_type>(_Traits::__infinite_power) << _Traits::__mantissa_bits));
+    return __first + (::cuda::std::__from_chars_starts_with_icase(__first + 3, __last, "inity", 5) ? 8 : 3);
+  }
+  if (::cuda::std::__from_chars_starts_with_icase(__first, __last, "nan", 3))
+  {
+    (void) ::cuda::std::__from_chars_fp_assign(__value, __negative, {0, 0}, false);
+    __value = ::cuda::std::bit_cast<_Tp>(
+      ::cuda::std::bit_cast<typename _Traits::__uint_type>(__value)
+      | (static_cast<typename _Traits::__uint_type>(_Traits::__infinite_power) << _Traits::__mantissa_bits)
+      | (typename _Traits::__uint_type{1} << (_Traits::__mantissa_bits - 1)));
+
+    // An optional sequence of letters, digits and underscores in parentheses
+    const char* __it = __first + 3;
+    if (__it != __last && *__it == '(')
+    {
+      for (++__it; __it != __last; ++__it)
+      {
+        const char __c = *__it;
+        if (__c == ')')
+        {
+          return __it + 1;
+        }
+        const bool __is_alpha = static_cast<unsigned char>((__c | 0x20) - 'a') < 26;
+        if (!::cuda::std::__from_chars_is_digit(__c) && !__is_alpha && __c != '_')
+        {
+          break;
+        }
+      }
+    }
+    return __first + 3;
+  }
+  return __first;
+}
+
+//! @brief Parses a hexadecimal floating-point number without prefix, rounding to nearest with ties to even
+template <class _Tp>
+[[nodiscard]] _CCCL_API from_chars_result
+__from_chars_fp_hex(const char* __first, const char* __last, bool __negative, _Tp& __value) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  // The value is __mantissa * 2^__exp2, plus something less than 2^__exp2 if __sticky
+  uint64_t __mantissa = 0;
+  int __exp2          = 0;
+  bool __sticky       = false;
+  bool __any_digit    = false;
+  bool __after_point  = false;
+  const char* __it    = __first;
+  for (; __it != __last; ++__it)
+  {
+    if (*__it == '.' && !__after_point)
+    {
+      __after_point = true;
+      continue;
+    }
+    const auto __digit = ::cuda::std::__from_chars_char_to_value(*__it, 16);
+    if (!__digit.__valid_)
+    {
+      break;
+    }
+    __any_digit = true;
+    if ((__mantissa >> 60) == 0)
+    {
+      __mantissa = __mantissa * 16 + static_cast<uint64_t>(__digit.__value_);
+      __exp2 -= 4 * __after_point;
+    }
+    else
+    {
+      __sticky |= __digit.__value_ != 0;
+      __exp2 += 4 * !__after_point;
+    }
+  }
+  if (!__any_digit)
+  {
+    return {__first, errc::invalid_argument};
+  }
+  if (__it != __last && (*__it == 'p' || *__it == 'P'))
+  {
+    int __exp = 0;
+    __it      = ::cuda::std::__from_chars_fp_exponent(__it, __last, __exp);
+    __exp2 += __exp;
+  }
+
+  if (__mantissa == 0)
+  {
+    return {__it, ::cuda::std::__from_chars_fp_assign(__value, __negative, {0, 0}, false)};
+  }
+
+  // Normalize to 64 bits, then keep the mantissa bits of a normal or subnormal float
+  const int __lz = ::cuda::std::countl_zero(__mantissa);
+  __mantissa <<= __lz;
+  int __power2 = __exp2 - __lz + 63 + _Traits::__exponent_bias;
+  int __shift  = 63 - _Traits::__mantissa_bits;
+  if (__power2 <= 0)
+  {
+    __shift += 1 - __power2;
+    __power2 = 0;
+  }
+
+  __charconv_adjusted_mantissa __am{0, 0};
+  if (__shift <= 64)
+  {
+    const uint64_t __kept    = (__shift < 64) ? __mantissa >> __shift : 0;
+    const uint64_t __dropped = (__shift < 64) ? __mantissa & ((uint64_t{1} << __shift) - 1) : __mantissa;
+    const uint64_t __half    = uint64_t{1} << (__shift - 1);
+    __am.__mantissa_ =
+      __kept + (__dropped > __half || (__dropped == __half && (__sticky || (__kept & 1) != 0)));
+
+    // Rounding up may carry into the next binade, a subnormal becomes normal without adjustment
+    if (__power2 != 0)
+    {
+      if (__am.__mantissa_ == (uint64_t{2} << _Traits::__mantissa_bits))
+      {
+        __am.__mantissa_ >>= 1;
+        ++__power2;
+      }
+      __am.__mantissa_ &= ~(uint64_t{1} << _Traits::__mantissa_bits);
+    }
+    __am.__power2_ = (__power2 < _Traits::__infinite_power) ? __power2 : _Traits::__infinite_power;
+  }
+  return {__it, ::cuda::std::__from_chars_fp_assign(__value, __negative, __am, true)};
+}
+
+//! @brief Parses a decimal floating-point number, rounding to nearest with ties to even
+template <class _Tp>
+[[nodiscard]] _CCCL_API from_chars_result
+__from_chars_fp_decimal(
+  const char* __first, const char* __last, bool __negative, _Tp& __value, chars_format __fmt) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  // The first 19 significant digits and the decimal exponent of the last one
+  constexpr int __max_digits = 19;
+  uint64_t __w               = 0;
+  int __ndigits              = 0;
+  int64_t __exp10            = 0;
+  bool __truncated           = false;
+  bool __any_digit           = false;
+  bool __after_point         = false;
+  const char* __it           = __first;
+  for (; __it != __last; ++__it)
+  {
+    if (*__it == '.' && !__after_point)
+    {
+      __after_point = true;
+      continue;
+    }
+    if (!::cuda::std::__from_chars_is_digit(*__it))
+    {
+      break;
+    }
+    __any_digit      = true;
+    const auto __d   = static_cast<uint64_t>(*__it - '0');
+    if (__ndigits < __max_digits)
+    {
+      if (__ndigits != 0 || __d != 0)
+      {
+        __w = __w * 10 + __d;
+        ++__ndigits;
+      }
+      __exp10 -= __after_point;
+    }
+    else
+    {
+      __truncated |= __d != 0;
+      __exp10 += !__after_point;
+    }
+  }
+  if (!__any_digit)
+  {
+    return {__first, errc::invalid_argument};
+  }
+  const char* const __digits_last = __it;
+
+  const bool __allows_exponent = (__fmt & chars_format::scientific) == chars_format::scientific;
+  if (__allows_exponent && __it != __last && (*__it == 'e' || *__it == 'E'))
+  {
+    int __exp                  = 0;
+    const char* const __exp_it = __it;
+    __it                       = ::cuda::std::__from_chars_fp_exponent(__it, __last, __exp);
+    if (__it == __exp_it && __fmt == chars_format::scientific)
+    {
+      return {__first, errc::invalid_argument};
+    }
+    __exp10 += __exp;
+  }
+  else if (__fmt == chars_format::scientific)
+  {
+    return {__first, errc::invalid_argument};
+  }
+
+  if (__w == 0)
+  {
+    return {__it, ::cuda::std::__from_chars_fp_assign(__value, __negative, {0, 0}, false)};
+  }
+
+  // Clinger's fast path: both __w and the power of ten are exact, so a single rounding gives the result
+  if (!__truncated && __exp10 >= -_Traits::__max_exact_power_of_ten && __exp10 <= _Traits::__max_exact_power_of_ten
+      && __w <= (uint64_t{2} << _Traits::__mantissa_bits))
+  {
+    _Tp __pow10 = 1;
+    for (int64_t __i = (__exp10 < 0) ? -__exp10 : __exp10; __i > 0; --__i)
+    {
+      __pow10 *= 10;
+    }
+    const _Tp __abs = (__exp10 < 0) ? static_cast<_Tp>(__w) / __pow10 : static_cast<_Tp>(__w) * __pow10;
+    __value         = (__negative) ? -__abs : __abs;
+    return {__it, errc{}};
+  }
+
+  auto __am = ::cuda::std::__eisel_lemire<_Tp>(__exp10, __w);
+  if (__truncated && __am != ::cuda::std::__eisel_lemire<_Tp>(__exp10, __w + 1))
+  {
+    // The digits that did not fit into __w decide the rounding, compare all of them with the halfway point. The
+    // exponent is relative to the last digit of the first 19.
+    int __ndigits_total = 0;
+    for (const char* __p = __first; __p != __digits_last; ++__p)
+    {
+      __ndigits_total += (*__p != '.') && (__ndigits_total != 0 || *__p != '0');
+    }
+    const int64_t __exp_all = __exp10 - (__ndigits_total - __max_digits);
+    __am = ::cuda::std::__from_chars_fp_compare_halfway<_Tp>(__first, __digits_last, static_cast<int>(__exp_all), __am);
+  }
+  return {__it, ::cuda::std::__from_chars_fp_assign(__value, __negative, __am, true)};
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API from_chars_result
+__from_chars_fp(const char* __first, const char* __last, _Tp& __value, chars_format __fmt) noexcept
+{
+  const char* __it      = __first;
+  const bool __negative = __it != __last && *__it == '-';
+  __it += __negative;
+
+  const char* __non_finite_last = ::cuda::std::__from_chars_fp_non_finite(__it, __last, __negative, __value);
+  if (__non_finite_last != __it)
+  {
+    return {__non_finite_last, errc{}};
+  }
+
+  const auto __ret = (__fmt == chars_format::hex)
+                     ? ::cuda::std::__from_chars_fp_hex(__it, __last, __negative, __value)
+                     : ::cuda::std::__from_chars_fp_decimal(__it, __last, __negative, __value, __fmt);
+  if (__ret.ec == errc::invalid_argument)
+  {
+    return {__first, errc::invalid_argument};
+  }
+  return __ret;
+}
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(is_floating_point_v<_Tp>)
+[[nodiscard]] _CCCL_API from_chars_result
+from_chars(const char* __first, const char* __last, _Tp& __value, chars_format __fmt = chars_format::general) noexcept
+{
+  static_assert(sizeof(_Tp) <= sizeof(double), "cuda::std::from_chars for long double is not yet implemented");
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+  _CCCL_ASSERT(__fmt == chars_format::fixed || __fmt == chars_format::scientific || __fmt == chars_format::general
+                 || __fmt == chars_format::hex,
+               "format must be a valid chars_format value");
+
+  using _Up = conditional_t<is_same_v<_Tp, float>, float, double>;
+  _Up __tmp{};
+  const auto __ret = ::cuda::std::__from_chars_fp(__first, __last, __tmp, __fmt);
+  if (__ret.ec == errc{})
+  {
+    __value = static_cast<_Tp>(__tmp);
+  }
+  return __ret;
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
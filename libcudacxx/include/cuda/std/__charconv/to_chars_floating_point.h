@@ -0,0 +1,1059 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
+#define _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__charconv/big_integer.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/floating_point_traits.h>
+#include <cuda/std/__charconv/ryu_tables.h>
+#include <cuda/std/__charconv/to_chars.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/climits>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Shortest round-trip conversion with Ryu, see U. Adams, "Ryu: fast float-to-string conversion", PLDI 2018.
+
+[[nodiscard]] _CCCL_API constexpr int __ryu_pow5_bits(int __e) noexcept
+{
+  // ceil(log2(5^__e)), but 1 for __e == 0
+  return static_cast<int>((static_cast<uint32_t>(__e) * 1217359u) >> 19) + 1;
+}
+
+[[nodiscard]] _CCCL_API constexpr int __ryu_log10_pow2(int __e) noexcept
+{
+  // floor(log10(2^__e))
+  return static_cast<int>((static_cast<uint32_t>(__e) * 78913u) >> 18);
+}
+
+[[nodiscard]] _CCCL_API constexpr int __ryu_log10_pow5(int __e) noexcept
+{
+  // floor(log10(5^__e))
+  return static_cast<int>((static_cast<uint32_t>(__e) * 732923u) >> 20);
+}
+
+template <class _Up>
+[[nodiscard]] _CCCL_API constexpr bool __ryu_multiple_of_pow5(_Up __v, int __p) noexcept
+{
+  int __count = 0;
+  for (; __v % 5 == 0; __v /= 5)
+  {
+    ++__count;
+  }
+  return __count >= __p;
+}
+
+template <class _Up>
+[[nodiscard]] _CCCL_API constexpr bool __ryu_multiple_of_pow2(_Up __v, int __p) noexcept
+{
+  return (__v & ((_Up{1} << __p) - 1)) == 0;
+}
+
+//! @brief Returns (__m * __mul) >> __j for a 128-bit __mul stored as {low, high} and 64 < __j < 128
+[[nodiscard]] _CCCL_API constexpr uint64_t __ryu_mul_shift64(uint64_t __m, const uint64_t (&__mul)[2], int __j) noexcept
+{
+  const uint64_t __high0 = ::cuda::mul_hi(__m, __mul[0]);
+  const uint64_t __low1  = __m * __mul[1];
+  const uint64_t __sum   = __high0 + __low1;
+  const uint64_t __high1 = ::cuda::mul_hi(__m, __mul[1]) + (__sum < __high0);
+  const int __dist       = __j - 64;
+  return (__high1 << (64 - __dist)) | (__sum >> __dist);
+}
+
+//! @brief Returns (__m * __factor) >> __shift for 32 < __shift
+[[nodiscard]] _CCCL_API constexpr uint32_t __ryu_mul_shift32(uint32_t __m, uint64_t __factor, int __shift) noexcept
+{
+  const uint64_t __bits0 = static_cast<uint64_t>(__m) * static_cast<uint32_t>(__factor);
+  const uint64_t __bits1 = static_cast<uint64_t>(__m) * static_cast<uint32_t>(__factor >> 32);
+  return static_cast<uint32_t>(((__bits0 >> 32) + __bits1) >> (__shift - 32));
+}
+
+//! @brief A decimal floating-point value __mantissa_ * 10^__exponent_
+template <class _Up>
+struct __charconv_decimal_fp
+{
+  _Up __mantissa_;
+  int __exponent_;
+};
+
+//! @brief Returns the shortest decimal representation that rounds to the positive finite double given by its mantissa
+//! and biased exponent fields, or the closest one to the exact value if there are several.
+[[nodiscard]] _CCCL_API inline __charconv_decimal_fp<uint64_t>
+__ryu_d2d(uint64_t __ieee_mantissa, int __ieee_exponent) noexcept
+{
+  using _Traits = __charconv_fp_traits<double>;
+
+  // Step 1: value = __m2 * 2^__e2, with two more bits for the bounds
+  int __e2      = 0;
+  uint64_t __m2 = 0;
+  if (__ieee_exponent == 0)
+  {
+    __e2 = 1 - _Traits::__exponent_bias - _Traits::__mantissa_bits - 2;
+    __m2 = __ieee_mantissa;
+  }
+  else
+  {
+    __e2 = __ieee_exponent - _Traits::__exponent_bias - _Traits::__mantissa_bits - 2;
+    __m2 = (uint64_t{1} << _Traits::__mantissa_bits) | __ieee_mantissa;
+  }
+  const bool __accept_bounds = (__m2 & 1) == 0;
+
+  // Step 2: the interval of decimal representations that round to the value is (mm, mp), or [mm, mp] if the mantissa
+  // is even. The lower bound is closer at powers of two.
+  const uint64_t __mv       = 4 * __m2;
+  const uint32_t __mm_shift = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+
+  // Step 3: convert the interval to a decimal power base
+  uint64_t __vr                 = 0;
+  uint64_t __vp                 = 0;
+  uint64_t __vm                 = 0;
+  int __e10                     = 0;
+  bool __vm_is_trailing_zeros = false;
+  bool __vr_is_trailing_zeros = false;
+  if (__e2 >= 0)
+  {
+    const int __q = ::cuda::std::__ryu_log10_pow2(__e2) - (__e2 > 3);
+    __e10         = __q;
+    const int __k = ::cuda::std::__ryu_double_pow5_inv_bitcount + ::cuda::std::__ryu_pow5_bits(__q) - 1;
+    const int __i = -__e2 + __q + __k;
+    const auto& __mul = ::cuda::std::__ryu_double_pow5_inv_split[__q];
+    __vr              = ::cuda::std::__ryu_mul_shift64(4 * __m2, __mul, __i);
+    __vp              = ::cuda::std::__ryu_mul_shift64(4 * __m2 + 2, __mul, __i);
+    __vm              = ::cuda::std::__ryu_mul_shift64(4 * __m2 - 1 - __mm_shift, __mul, __i);
+    if (__q <= 21)
+    {
+      // Only one of mp, mv and mm can be a multiple of 5, if any
+      if (__mv % 5 == 0)
+      {
+        __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mv, __q);
+      }
+      else if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mv - 1 - __mm_shift, __q);
+      }
+      else
+      {
+        __vp -= ::cuda::std::__ryu_multiple_of_pow5(__mv + 2, __q);
+      }
+    }
+  }
+  else
+  {
+    const int __q = ::cuda::std::__ryu_log10_pow5(-__e2) - (-__e2 > 1);
+    __e10         = __q + __e2;
+    const int __i = -__e2 - __q;
+    const int __k = ::cuda::std::__ryu_pow5_bits(__i) - ::cuda::std::__ryu_double_pow5_bitcount;
+    const int __j = __q - __k;
+    const auto& __mul = ::cuda::std::__ryu_double_pow5_split[__i];
+    __vr              = ::cuda::std::__ryu_mul_shift64(4 * __m2, __mul, __j);
+    __vp              = ::cuda::std::__ryu_mul_shift64(4 * __m2 + 2, __mul, __j);
+    __vm              = ::cuda::std::__ryu_mul_shift64(4 * __m2 - 1 - __mm_shift, __mul, __j);
+    if (__q <= 1)
+    {
+      // mv = 4 * m2 has at least two trailing zero bits, mm = mv - 1 - mm_shift has one iff mm_shift is 1, and
+      // mp = mv + 2 always has one
+      __vr_is_trailing_zeros = true;
+      if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = __mm_shift == 1;
+      }
+      else
+      {
+        --__vp;
+      }
+    }
+    else if (__q < 63)
+    {
+      __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow2(__mv, __q);
+    }
+  }
+
+  // Step 4: find the shortest decimal representation in the interval
+  int __removed                 = 0;
+  uint32_t __last_removed_digit = 0;
+  uint64_t __output             = 0;
+  if (__vm_is_trailing_zeros || __vr_is_trailing_zeros)
+  {
+    // Rare general case
+    while (__vp / 10 > __vm / 10)
+    {
+      __vm_is_trailing_zeros &= __vm % 10 == 0;
+      __vr_is_trailing_zeros &= __last_removed_digit == 0;
+      __last_removed_digit = static_cast<uint32_t>(__vr % 10);
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    if (__vm_is_trailing_zeros)
+    {
+      while (__vm % 10 == 0)
+      {
+        __vr_is_trailing_zeros &= __last_removed_digit == 0;
+        __last_removed_digit = static_cast<uint32_t>(__vr % 10);
+        __vr /= 10;
+        __vp /= 10;
+        __vm /= 10;
+        ++__removed;
+      }
+    }
+    if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+    {
+      // Round to even if the exact value is ...50...0
+      __last_removed_digit = 4;
+    }
+    // Take vr + 1 if vr is outside of the interval or if it has to be rounded up
+    __output = __vr
+             + ((__vr == __vm && (!__accept_bounds || !__vm_is_trailing_zeros)) || __last_removed_digit >= 5);
+  }
+  else
+  {
+    // Common case, remove two digits at a time while possible
+    bool __round_up = false;
+    if (__vp / 100 > __vm / 100)
+    {
+      __round_up = __vr % 100 >= 50;
+      __vr /= 100;
+      __vp /= 100;
+      __vm /= 100;
+      __removed += 2;
+    }
+    while (__vp / 10 > __vm / 10)
+    {
+      __round_up = __vr % 10 >= 5;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    __output = __vr + (__vr == __vm || __round_up);
+  }
+  return {__output, __e10 + __removed};
+}
+
+//! @brief Returns the shortest decimal representation that rounds to the positive finite float given by its mantissa
+//! and biased exponent fields, or the closest one to the exact value if there are several.
+[[nodiscard]] _CCCL_API inline __charconv_decimal_fp<uint32_t>
+__ryu_f2d(uint32_t __ieee_mantissa, int __ieee_exponent) noexcept
+{
+  using _Traits = __charconv_fp_traits<float>;
+
+  // The float tables are the upper halves of the double tables
+  constexpr int __pow5_inv_bitcount = ::cuda::std::__ryu_double_pow5_inv_bitcount - 64;
+  constexpr int __pow5_bitcount     = ::cuda::std::__ryu_double_pow5_bitcount - 64;
+
+  int __e2      = 0;
+  uint32_t __m2 = 0;
+  if (__ieee_exponent == 0)
+  {
+    __e2 = 1 - _Traits::__exponent_bias - _Traits::__mantissa_bits - 2;
+    __m2 = __ieee_mantissa;
+  }
+  else
+  {
+    __e2 = __ieee_exponent - _Traits::__exponent_bias - _Traits::__mantissa_bits - 2;
+    __m2 = (uint32_t{1} << _Traits::__mantissa_bits) | __ieee_mantissa;
+  }
+  const bool __accept_bounds = (__m2 & 1) == 0;
+
+  const uint32_t __mv       = 4 * __m2;
+  const uint32_t __mp       = 4 * __m2 + 2;
+  const uint32_t __mm_shift = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+  const uint32_t __mm       = 4 * __m2 - 1 - __mm_shift;
+
+  uint32_t __vr                 = 0;
+  uint32_t __vp                 = 0;
+  uint32_t __vm                 = 0;
+  int __e10                     = 0;
+  bool __vm_is_trailing_zeros   = false;
+  bool __vr_is_trailing_zeros   = false;
+  uint32_t __last_removed_digit = 0;
+  if (__e2 >= 0)
+  {
+    const int __q = ::cuda::std::__ryu_log10_pow2(__e2);
+    __e10         = __q;
+    const int __k = __pow5_inv_bitcount + ::cuda::std::__ryu_pow5_bits(__q) - 1;
+    const int __i = -__e2 + __q + __k;
+    // The inverse table holds floor(2^x / 5^y) + 1, of which the upper half lacks the + 1
+    const uint64_t __mul = ::cuda::std::__ryu_double_pow5_inv_split[__q][1] + 1;
+    __vr                 = ::cuda::std::__ryu_mul_shift32(__mv, __mul, __i);
+    __vp                 = ::cuda::std::__ryu_mul_shift32(__mp, __mul, __i);
+    __vm                 = ::cuda::std::__ryu_mul_shift32(__mm, __mul, __i);
+    if (__q != 0 && (__vp - 1) / 10 <= __vm / 10)
+    {
+      // The loop below removes no digit, but the last removed digit is needed for rounding
+      const int __l = __pow5_inv_bitcount + ::cuda::std::__ryu_pow5_bits(__q - 1) - 1;
+      __last_removed_digit =
+        ::cuda::std::__ryu_mul_shift32(
+          __mv, ::cuda::std::__ryu_double_pow5_inv_split[__q - 1][1] + 1, -__e2 + __q - 1 + __l)
+        % 10;
+    }
+    if (__q <= 9)
+    {
+      if (__mv % 5 == 0)
+      {
+        __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mv, __q);
+      }
+      else if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mm, __q);
+      }
+      else
+      {
+        __vp -= ::cuda::std::__ryu_multiple_of_pow5(__mp, __q);
+      }
+    }
+  }
+  else
+  {
+    const int __q = ::cuda::std::__ryu_log10_pow5(-__e2);
+    __e10         = __q + __e2;
+    const int __i = -__e2 - __q;
+    const int __k = ::cuda::std::__ryu_pow5_bits(__i) - __pow5_bitcount;
+    const int __j = __q - __k;
+    const uint64_t __mul = ::cuda::std::__ryu_double_pow5_split[__i][1];
+    __vr                 = ::cuda::std::__ryu_mul_shift32(__mv, __mul, __j);
+    __vp                 = ::cuda::std::__ryu_mul_shift32(__mp, __mul, __j);
+    __vm                 = ::cuda::std::__ryu_mul_shift32(__mm, __mul, __j);
+    if (__q != 0 && (__vp - 1) / 10 <= __vm / 10)
+    {
+      const int __l = __q - 1 - (::cuda::std::__ryu_pow5_bits(__i + 1) - __pow5_bitcount);
+      __last_removed_digit =
+        ::cuda::std::__ryu_mul_shift32(__mv, ::cuda::std::__ryu_double_pow5_split[__i + 1][1], __l) % 10;
+    }
+    if (__q <= 1)
+    {
+      __vr_is_trailing_zeros = true;
+      if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = __mm_shift == 1;
+      }
+      else
+      {
+        --__vp;
+      }
+    }
+    else if (__q < 31)
+    {
+      __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow2(__mv, __q - 1);
+    }
+  }
+
+  int __removed     = 0;
+  uint32_t __output = 0;
+  if (__vm_is_trailing_zeros || __vr_is_trailing_zeros)
+  {
+    while (__vp / 10 > __vm / 10)
+    {
+      __vm_is_trailing_zeros &= __vm % 10 == 0;
+      __vr_is_trailing_zeros &= __last_removed_digit == 0;
+      __last_removed_digit = __vr % 10;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    if (__vm_is_trailing_zeros)
+    {
+      while (__vm % 10 == 0)
+      {
+        __vr_is_trailing_zeros &= __last_removed_digit == 0;
+        __last_removed_digit = __vr % 10;
+        __vr /= 10;
+        __vp /= 10;
+        __vm /= 10;
+        ++__removed;
+      }
+    }
+    if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+    {
+      __last_removed_digit = 4;
+    }
+    __output = __vr
+             + ((__vr == __vm && (!__accept_bounds || !__vm_is_trailing_zeros)) || __last_removed_digit >= 5);
+  }
+  else
+  {
+    while (__vp / 10 > __vm / 10)
+    {
+      __last_removed_digit = __vr % 10;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    __output = __vr + (__vr == __vm || __last_removed_digit >= 5);
+  }
+  return {__output, __e10 + __removed};
+}
+
+//! @brief Pairs of decimal digits of the numbers 0 to 99
+_CCCL_GLOBAL_CONSTANT char __charconv_digit_pairs[] =
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+//! @brief Writes the __n least significant decimal digits of __v to [__first, __first + __n), padded with zeros
+_CCCL_API inline void __to_chars_fp_write_digits(char* __first, uint64_t __v, int __n) noexcept
+{
+  char* __it = __first + __n;
+  while (__v >> 32 != 0)
+  {
+    const uint64_t __q = __v / 100000000;
+    auto __r           = static_cast<uint32_t>(__v - __q * 100000000);
+    __v                = __q;
+    for (int __i = 0; __i < 4; ++__i, __r /= 100)
+    {
+      __it -= 2;
+      __it[0] = ::cuda::std::__charconv_digit_pairs[2 * (__r % 100)];
+      __it[1] = ::cuda::std::__charconv_digit_pairs[2 * (__r % 100) + 1];
+    }
+    __n -= 8;
+  }
+  auto __v32 = static_cast<uint32_t>(__v);
+  for (; __n >= 2; __n -= 2, __v32 /= 100)
+  {
+    __it -= 2;
+    __it[0] = ::cuda::std::__charconv_digit_pairs[2 * (__v32 % 100)];
+    __it[1] = ::cuda::std::__charconv_digit_pairs[2 * (__v32 % 100) + 1];
+  }
+  if (__n == 1)
+  {
+    *--__it = static_cast<char>('0' + __v32 % 10);
+  }
+}
+
+[[nodiscard]] _CCCL_API inline to_chars_result
+__to_chars_fp_copy(char* __first, char* __last, const char* __str, int __n) noexcept
+{
+  if (__last - __first < __n)
+  {
+    return {__last, errc::value_too_large};
+  }
+  for (int __i = 0; __i < __n; ++__i)
+  {
+    __first[__i] = __str[__i];
+  }
+  return {__first + __n, errc{}};
+}
+
+//! @brief Copies __count digits of __digits starting at index __i to __out, digits outside of [0, __size) are zero
+[[nodiscard]] _CCCL_API inline char*
+__to_chars_fp_copy_digits(char* __out, const char* __digits, int __size, int __i, ptrdiff_t __count) noexcept
+{
+  for (; __count > 0 && __i < 0; --__count, ++__i)
+  {
+    *__out++ = '0';
+  }
+  for (; __count > 0 && __i < __size; --__count, ++__i)
+  {
+    *__out++ = __digits[__i];
+  }
+  for (; __count > 0; --__count)
+  {
+    *__out++ = '0';
+  }
+  return __out;
+}
+
+//! @brief Writes the exponent __exp after __marker with a sign and at least __min_digits digits
+[[nodiscard]] _CCCL_API inline to_chars_result
+__to_chars_fp_write_exponent(char* __first, char* __last, int __exp, char __marker, int __min_digits) noexcept
+{
+  const auto __abs_exp = static_cast<uint32_t>((__exp < 0) ? -__exp : __exp);
+  const int __width    = ::cuda::std::__to_chars_int_width(__abs_exp, 10);
+  const int __n        = (__width < __min_digits) ? __min_digits : __width;
+  if (__last - __first < __n + 2)
+  {
+    return {__last, errc::value_too_large};
+  }
+  __first[0] = __marker;
+  __first[1] = (__exp < 0) ? '-' : '+';
+  ::cuda::std::__to_chars_fp_write_digits(__first + 2, __abs_exp, __n);
+  return {__first + __n + 2, errc{}};
+}
+
+//! @brief Writes the first __ndigits digits of __digits in scientific notation, where the first digit has the decimal
+//! exponent __exp. Digits after the __size stored ones are zero.
+[[nodiscard]] _CCCL_API inline to_chars_result __to_chars_fp_write_scientific(
+  char* __first, char* __last, const char* __digits, int __size, ptrdiff_t __ndigits, int __exp) noexcept
+{
+  if (__last - __first < __ndigits + (__ndigits > 1))
+  {
+    return {__last, errc::value_too_large};
+  }
+  *__first++ = __digits[0];
+  if (__ndigits > 1)
+  {
+    *__first++ = '.';
+    __first    = ::cuda::std::__to_chars_fp_copy_digits(__first, __digits, __size, 1, __ndigits - 1);
+  }
+  return ::cuda::std::__to_chars_fp_write_exponent(__first, __last, __exp, 'e', 2);
+}
+
+//! @brief Writes __digits in fixed notation with __nfrac fractional digits, where the first digit has the decimal
+//! exponent __exp. Digits after the __size stored ones are zero.
+[[nodiscard]] _CCCL_API inline to_chars_result __to_chars_fp_write_fixed(
+  char* __first, char* __last, const char* __digits, int __size, int __exp, ptrdiff_t __nfrac) noexcept
+{
+  const int __nint = (__exp >= 0) ? __exp + 1 : 1;
+  if (__last - __first < __nint + ((__nfrac > 0) ? __nfrac + 1 : 0))
+  {
+    return {__last, errc::value_too_large};
+  }
+  __first = ::cuda::std::__to_chars_fp_copy_digits(__first, __digits, __size, __exp - __nint + 1, __nint);
+  if (__nfrac > 0)
+  {
+    *__first++ = '.';
+    __first    = ::cuda::std::__to_chars_fp_copy_digits(__first, __digits, __size, __exp + 1, __nfrac);
+  }
+  return {__first, errc{}};
+}
+
+[[nodiscard]] _CCCL_API inline to_chars_result
+__to_chars_fp_non_finite(char* __first, char* __last, bool __negative, bool __nan) noexcept
+{
+  const char* __str = (__nan) ? "-nan" : "-inf";
+  return ::cuda::std::__to_chars_fp_copy(__first, __last, __str + !__negative, 3 + __negative);
+}
+
+//! @brief Writes the exact value of the integer __m2 * 2^__e2
+template <class _Tp>
+[[nodiscard]] _CCCL_API to_chars_result
+__to_chars_fp_exact_integer(char* __first, char* __last, uint64_t __m2, int __e2) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  __charconv_big_integer<_Traits::__exact_limbs> __value{__m2};
+  __value.__shift_left(__e2);
+
+  // Groups of 9 digits, least significant first
+  uint32_t __groups[(_Traits::__max_integral_digits + 8) / 9];
+  int __ngroups = 0;
+  while (!__value.__is_zero())
+  {
+    __groups[__ngroups++] = __value.__div(1000000000);
+  }
+
+  const int __top_width = ::cuda::std::__to_chars_int_width(__groups[__ngroups - 1], 10);
+  if (__last - __first < __top_width + 9 * (__ngroups - 1))
+  {
+    return {__last, errc::value_too_large};
+  }
+  ::cuda::std::__to_chars_fp_write_digits(__first, __groups[__ngroups - 1], __top_width);
+  __first += __top_width;
+  for (int __i = __ngroups - 2; __i >= 0; --__i, __first += 9)
+  {
+    ::cuda::std::__to_chars_fp_write_digits(__first, __groups[__i], 9);
+  }
+  return {__first, errc{}};
+}
+
+//! @brief The digits of the exact value of a positive floating-point value, rounded to nearest with ties to even
+//! either to a number of fractional digits or to a number of significant digits
+template <class _Tp>
+struct __charconv_exact_decimal
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  //! Rounding never happens further than this many digits after the decimal point, since all fractional digits of
+  //! the exact value come before
+  static constexpr int __max_precision = 1100;
+
+  //! Significant digits, those after __size_ are zero
+  char __digits_[_Traits::__max_exact_digits];
+  int __size_ = 0;
+  //! Decimal exponent of the first digit
+  int __exp_ = 0;
+
+  //! Decimal exponent of the next digit to consume, and of the last one that is kept
+  int __pos_    = 0;
+  int __cutoff_ = 0;
+  bool __significant_;
+  int __precision_;
+
+  //! The first digit that is not kept, and whether any of the following ones is nonzero
+  int __round_digit_ = 0;
+  bool __sticky_     = false;
+
+  _CCCL_API __charconv_exact_decimal(uint64_t __m2, int __e2, bool __significant, int __precision) noexcept
+      : __significant_{__significant}
+      , __precision_{(__precision < __max_precision) ? __precision : __max_precision}
+  {
+    __cutoff_ = (__significant_) ? INT_MIN : -__precision_;
+
+    bool __found = false;
+    __charconv_big_integer<_Traits::__exact_limbs> __fraction{0};
+    int __fraction_bits = 0;
+    if (__e2 >= 0)
+    {
+      __charconv_big_integer<_Traits::__exact_limbs> __integral{__m2};
+      __integral.__shift_left(__e2);
+      __found = __consume_integral(__integral);
+    }
+    else
+    {
+      __fraction_bits = -__e2;
+      if (__fraction_bits < 64)
+      {
+        __charconv_big_integer<_Traits::__exact_limbs> __integral{__m2 >> __fraction_bits};
+        __fraction = __charconv_big_integer<_Traits::__exact_limbs>{__m2 & ((uint64_t{1} << __fraction_bits) - 1)};
+        __found    = __consume_integral(__integral);
+        __sticky_ |= __found && !__fraction.__is_zero();
+      }
+      else
+      {
+        __fraction = __charconv_big_integer<_Traits::__exact_limbs>{__m2};
+      }
+    }
+
+    __pos_ = -1;
+    while (!__found && !__fraction.__is_zero())
+    {
+      __found = __consume(__fraction.__mul_split(1000000000, __fraction_bits), 9);
+    }
+    __sticky_ |= __found && !__fraction.__is_zero();
+
+    if (__found && (__round_digit_ > 5 || (__round_digit_ == 5 && (__sticky_ || __last_kept_digit_is_odd()))))
+    {
+      __round_up();
+    }
+  }
+
+  //! @brief Consumes the digits of the nonzero integral part, returns whether the rounding digit was found
+  _CCCL_API bool __consume_integral(__charconv_big_integer<_Traits::__exact_limbs>& __integral) noexcept
+  {
+    if (__integral.__is_zero())
+    {
+      return false;
+    }
+
+    uint32_t __groups[(_Traits::__max_integral_digits + 8) / 9];
+    int __ngroups = 0;
+    while (!__integral.__is_zero())
+    {
+      __groups[__ngroups++] = __integral.__div(1000000000);
+    }
+
+    const int __top_width = ::cuda::std::__to_chars_int_width(__groups[__ngroups - 1], 10);
+    __pos_                = __top_width + 9 * (__ngroups - 1) - 1;
+    bool __found          = __consume(__groups[__ngroups - 1], __top_width);
+    for (int __i = __ngroups - 2; __i >= 0; --__i)
+    {
+      if (__found)
+      {
+        __sticky_ |= __groups[__i] != 0;
+      }
+      else
+      {
+        __found = __consume(__groups[__i], 9);
+      }
+    }
+    return __found;
+  }
+
+  //! @brief Consumes the __n digits of __group, returns whether the rounding digit was found
+  _CCCL_API bool __consume(uint32_t __group, int __n) noexcept
+  {
+    uint32_t __pow10 = 1;
+    for (int __i = 1; __i < __n; ++__i)
+    {
+      __pow10 *= 10;
+    }
+    for (; __n > 0; --__n, --__pos_, __pow10 /= 10)
+    {
+      const auto __digit = static_cast<int>(__group / __pow10);
+      __group %= __pow10;
+      if (__pos_ < __cutoff_)
+      {
+        __round_digit_ = __digit;
+        __sticky_      = __group != 0;
+        return true;
+      }
+      if (__size_ == 0)
+      {
+        if (__digit == 0)
+        {
+          continue;
+        }
+        __exp_ = __pos_;
+        if (__significant_)
+        {
+          __cutoff_ = __pos_ - __precision_;
+        }
+      }
+      if (__size_ < _Traits::__max_exact_digits)
+      {
+        __digits_[__size_++] = static_cast<char>('0' + __digit);
+      }
+    }
+    return false;
+  }
+
+  [[nodiscard]] _CCCL_API bool __last_kept_digit_is_odd() const noexcept
+  {
+    return __size_ != 0 && __exp_ - (__size_ - 1) == __cutoff_ && (__digits_[__size_ - 1] - '0') % 2 != 0;
+  }
+
+  _CCCL_API void __round_up() noexcept
+  {
+    if (__size_ == 0)
+    {
+      __digits_[0] = '1';
+      __size_      = 1;
+      __exp_       = __cutoff_;
+      return;
+    }
+
+    int __i = __size_ - 1;
+    for (; __i >= 0 && __digits_[__i] == '9'; --__i)
+    {
+      __digits_[__i] = '0';
+    }
+    if (__i >= 0)
+    {
+      ++__digits_[__i];
+    }
+    else
+    {
+      __digits_[0] = '1';
+      ++__exp_;
+    }
+  }
+};
+
+//! @brief Writes the hexadecimal representation of the positive floating-point value given by its mantissa and biased
+//! exponent fields with __precision hexadecimal digits after the point, or with as many as needed if it is negative
+template <class _Tp>
+[[nodiscard]] _CCCL_API to_chars_result __to_chars_fp_hex(
+  char* __first,
+  char* __last,
+  typename __charconv_fp_traits<_Tp>::__uint_type __mantissa,
+  int __exponent,
+  int __precision) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+  using _Up     = typename _Traits::__uint_type;
+
+  // The mantissa is shifted to fill whole hexadecimal digits, below the leading one
+  constexpr int __mantissa_digits = (_Traits::__mantissa_bits + 3) / 4;
+  _Up __value = (__mantissa << (4 * __mantissa_digits - _Traits::__mantissa_bits))
+              | (static_cast<_Up>(__exponent != 0) << (4 * __mantissa_digits));
+  int __exp2  = (__exponent != 0) ? __exponent - _Traits::__exponent_bias : 1 - _Traits::__exponent_bias;
+  if (__value == 0)
+  {
+    __exp2 = 0;
+  }
+
+  int __ndigits = __mantissa_digits;
+  if (__precision < 0)
+  {
+    for (; __ndigits > 0 && (__value & 0xf) == 0; --__ndigits)
+    {
+      __value >>= 4;
+    }
+  }
+  else if (__precision < __mantissa_digits)
+  {
+    const int __dropped_bits = 4 * (__mantissa_digits - __precision);
+    const _Up __dropped      = __value & ((_Up{1} << __dropped_bits) - 1);
+    const _Up __half         = _Up{1} << (__dropped_bits - 1);
+    __value >>= __dropped_bits;
+    __value += (__dropped > __half || (__dropped == __half && (__value & 1) != 0));
+    __ndigits = __precision;
+  }
+
+  const int __leading = static_cast<int>(__value >> (4 * __ndigits));
+  const ptrdiff_t __nfrac = (__precision < 0) ? __ndigits : __precision;
+  if (__last - __first < 1 + ((__nfrac > 0) ? __nfrac + 1 : 0))
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  *__first++ = static_cast<char>('0' + __leading);
+  if (__nfrac > 0)
+  {
+    *__first++ = '.';
+    for (int __i = __ndigits - 1; __i >= 0; --__i)
+    {
+      *__first++ = ::cuda::std::__to_chars_value_to_char(static_cast<int>((__value >> (4 * __i)) & 0xf), 16);
+    }
+    for (ptrdiff_t __i = __ndigits; __i < __nfrac; ++__i)
+    {
+      *__first++ = '0';
+    }
+  }
+  return ::cuda::std::__to_chars_fp_write_exponent(__first, __last, __exp2, 'p', 1);
+}
+
+//! @brief chars_format value that selects the to_chars overload without format, which uses the shorter of fixed and
+//! scientific notation
+inline constexpr chars_format __charconv_plain_format = chars_format{};
+
+template <class _Tp>
+struct __charconv_fp_fields
+{
+  typename __charconv_fp_traits<_Tp>::__uint_type __mantissa_;
+  int __exponent_;
+  bool __negative_;
+
+  _CCCL_API explicit __charconv_fp_fields(_Tp __value) noexcept
+  {
+    using _Traits = __charconv_fp_traits<_Tp>;
+    using _Up     = typename _Traits::__uint_type;
+
+    const auto __bits = ::cuda::std::bit_cast<_Up>(__value);
+    __mantissa_       = __bits & ((_Up{1} << _Traits::__mantissa_bits) - 1);
+    __exponent_       = static_cast<int>((__bits >> _Traits::__mantissa_bits) & _Traits::__infinite_power);
+    __negative_       = (__bits >> (8 * sizeof(_Up) - 1)) != 0;
+  }
+};
+
+//! @brief Writes the shortest representation of __value that reads back as __value in the format __fmt
+template <class _Tp>
+[[nodiscard]] _CCCL_API to_chars_result
+__to_chars_fp_shortest(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  const __charconv_fp_fields<_Tp> __fields{__value};
+  if (__fields.__exponent_ == _Traits::__infinite_power)
+  {
+    return ::cuda::std::__to_chars_fp_non_finite(__first, __last, __fields.__negative_, __fields.__mantissa_ != 0);
+  }
+  if (__fields.__negative_)
+  {
+    if (__first == __last)
+    {
+      return {__last, errc::value_too_large};
+    }
+    *__first++ = '-';
+  }
+
+  if (__fmt == chars_format::hex)
+  {
+    return ::cuda::std::__to_chars_fp_hex<_Tp>(__first, __last, __fields.__mantissa_, __fields.__exponent_, -1);
+  }
+  if (__fields.__mantissa_ == 0 && __fields.__exponent_ == 0)
+  {
+    return ::cuda::std::__to_chars_fp_copy(__first, __last, "0e+00", (__fmt == chars_format::scientific) ? 5 : 1);
+  }
+
+  uint64_t __mantissa = 0;
+  int __exp           = 0;
+  if constexpr (is_same_v<_Tp, float>)
+  {
+    const auto __dec = ::cuda::std::__ryu_f2d(__fields.__mantissa_, __fields.__exponent_);
+    __mantissa       = __dec.__mantissa_;
+    __exp            = __dec.__exponent_;
+  }
+  else
+  {
+    const auto __dec = ::cuda::std::__ryu_d2d(__fields.__mantissa_, __fields.__exponent_);
+    __mantissa       = __dec.__mantissa_;
+    __exp            = __dec.__exponent_;
+  }
+
+  char __digits[20];
+  const int __size = ::cuda::std::__to_chars_int_width(__mantissa, 10);
+  ::cuda::std::__to_chars_fp_write_digits(__digits, __mantissa, __size);
+  const int __sci_exp = __exp + __size - 1;
+
+  bool __scientific = __fmt == chars_format::scientific;
+  if (__fmt == chars_format::general)
+  {
+    // Like printf's %g with the default precision of 6
+    __scientific = __sci_exp < -4 || __sci_exp >= 6;
+  }
+  else if (__fmt == __charconv_plain_format)
+  {
+    // Prefer fixed notation unless it is longer
+    const int __fixed_size = (__exp >= 0) ? __size + __exp : ((__sci_exp >= 0) ? __size + 1 : 2 - __exp);
+    const int __sci_size   = __size + (__size > 1) + ((__sci_exp <= -100 || __sci_exp >= 100) ? 5 : 4);
+    __scientific           = __sci_size < __fixed_size;
+  }
+
+  if (__scientific)
+  {
+    return ::cuda::std::__to_chars_fp_write_scientific(__first, __last, __digits, __size, __size, __sci_exp);
+  }
+  if (__exp > 0 && __fields.__exponent_ - _Traits::__exponent_bias > _Traits::__mantissa_bits)
+  {
+    // Like printf, fixed notation shows the exact value of integers that are not exactly representable by the shortest
+    // digits followed by zeros
+    return ::cuda::std::__to_chars_fp_exact_integer<_Tp>(
+      __first,
+      __last,
+      (uint64_t{1} << _Traits::__mantissa_bits) | __fields.__mantissa_,
+      __fields.__exponent_ - _Traits::__exponent_bias - _Traits::__mantissa_bits);
+  }
+  return ::cuda::std::__to_chars_fp_write_fixed(
+    __first, __last, __digits, __size, __sci_exp, (__size - 1 > __sci_exp) ? __size - 1 - __sci_exp : 0);
+}
+
+//! @brief Writes __value in the format __fmt with the precision __precision, like printf
+template <class _Tp>
+[[nodiscard]] _CCCL_API to_chars_result
+__to_chars_fp_precision(char* __first, char* __last, _Tp __value, chars_format __fmt, int __precision) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  const __charconv_fp_fields<_Tp> __fields{__value};
+  if (__fields.__exponent_ == _Traits::__infinite_power)
+  {
+    return ::cuda::std::__to_chars_fp_non_finite(__first, __last, __fields.__negative_, __fields.__mantissa_ != 0);
+  }
+  if (__fields.__negative_)
+  {
+    if (__first == __last)
+    {
+      return {__last, errc::value_too_large};
+    }
+    *__first++ = '-';
+  }
+
+  if (__fmt == chars_format::hex)
+  {
+    return ::cuda::std::__to_chars_fp_hex<_Tp>(
+      __first, __last, __fields.__mantissa_, __fields.__exponent_, __precision);
+  }
+
+  // A negative precision is ignored, like in printf
+  if (__precision < 0)
+  {
+    __precision = 6;
+  }
+
+  if (__fields.__mantissa_ == 0 && __fields.__exponent_ == 0)
+  {
+    switch (__fmt)
+    {
+      case chars_format::fixed:
+        return ::cuda::std::__to_chars_fp_write_fixed(__first, __last, "0", 1, 0, __precision);
+      case chars_format::scientific:
+        return ::cuda::std::__to_chars_fp_write_scientific(
+          __first, __last, "0", 1, static_cast<ptrdiff_t>(__precision) + 1, 0);
+      default:
+        return ::cuda::std::__to_chars_fp_copy(__first, __last, "0", 1);
+    }
+  }
+
+  const uint64_t __m2 = (__fields.__exponent_ != 0)
+                        ? (uint64_t{1} << _Traits::__mantissa_bits) | __fields.__mantissa_
+                        : static_cast<uint64_t>(__fields.__mantissa_);
+  const int __e2 = ((__fields.__exponent_ != 0) ? __fields.__exponent_ : 1) - _Traits::__exponent_bias
+                 - _Traits::__mantissa_bits;
+
+  switch (__fmt)
+  {
+    case chars_format::fixed: {
+      const __charconv_exact_decimal<_Tp> __dec{__m2, __e2, false, __precision};
+      return ::cuda::std::__to_chars_fp_write_fixed(
+        __first, __last, __dec.__digits_, __dec.__size_, (__dec.__size_ != 0) ? __dec.__exp_ : -1, __precision);
+    }
+    case chars_format::scientific: {
+      const __charconv_exact_decimal<_Tp> __dec{__m2, __e2, true, __precision};
+      return ::cuda::std::__to_chars_fp_write_scientific(
+        __first, __last, __dec.__digits_, __dec.__size_, static_cast<ptrdiff_t>(__precision) + 1, __dec.__exp_);
+    }
+    default: {
+      // Like printf's %g, which drops trailing zeros
+      const int __significant_digits = (__precision == 0) ? 1 : __precision;
+      __charconv_exact_decimal<_Tp> __dec{__m2, __e2, true, __significant_digits - 1};
+      while (__dec.__size_ > 1 && __dec.__digits_[__dec.__size_ - 1] == '0')
+      {
+        --__dec.__size_;
+      }
+      if (__dec.__exp_ < -4 || __dec.__exp_ >= __significant_digits)
+      {
+        return ::cuda::std::__to_chars_fp_write_scientific(
+          __first, __last, __dec.__digits_, __dec.__size_, __dec.__size_, __dec.__exp_);
+      }
+      return ::cuda::std::__to_chars_fp_write_fixed(
+        __first,
+        __last,
+        __dec.__digits_,
+        __dec.__size_,
+        __dec.__exp_,
+        (__dec.__size_ - 1 > __dec.__exp_) ? __dec.__size_ - 1 - __dec.__exp_ : 0);
+    }
+  }
+}
+
+//! @brief The type a floating-point type is converted with, long double only if it is the same as double
+template <class _Tp>
+using __charconv_fp_t = conditional_t<is_same_v<_Tp, float>, float, double>;
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(is_floating_point_v<_Tp>)
+[[nodiscard]] _CCCL_API to_chars_result to_chars(char* __first, char* __last, _Tp __value) noexcept
+{
+  static_assert(sizeof(_Tp) <= sizeof(double), "cuda::std::to_chars for long double is not yet implemented");
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+  return ::cuda::std::__to_chars_fp_shortest(
+    __first, __last, static_cast<__charconv_fp_t<_Tp>>(__value), __charconv_plain_format);
+}
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(is_floating_point_v<_Tp>)
+[[nodiscard]] _CCCL_API to_chars_result
+to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
+{
+  static_assert(sizeof(_Tp) <= sizeof(double), "cuda::std::to_chars for long double is not yet implemented");
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+  _CCCL_ASSERT(__fmt == chars_format::fixed || __fmt == chars_format::scientific || __fmt == chars_format::general
+                 || __fmt == chars_format::hex,
+               "format must be a valid chars_format value");
+  return ::cuda::std::__to_chars_fp_shortest(__first, __last, static_cast<__charconv_fp_t<_Tp>>(__value), __fmt);
+}
+
+_CCCL_TEMPLATE(class _Tp)
+_CCCL_REQUIRES(is_floating_point_v<_Tp>)
+[[nodiscard]] _CCCL_API to_chars_result
+to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
+{
+  static_assert(sizeof(_Tp) <= sizeof(double), "cuda::std::to_chars for long double is not yet implemented");
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+  _CCCL_ASSERT(__fmt == chars_format::fixed || __fmt == chars_format::scientific || __fmt == chars_format::general
+                 || __fmt == chars_format::hex,
+               "format must be a valid chars_format value");
+  return ::cuda::std::__to_chars_fp_precision(
+    __first, __last, static_cast<__charconv_fp_t<_Tp>>(__value), __fmt, __prec);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
@@ -24,10 +24,24 @@
 #include <cuda/std/__cccl/prologue.h>
 
 #define _CCCL_HAS_BACKEND_CUDA() _CCCL_CUDA_COMPILATION() && !_CCCL_COMPILER(NVRTC)
-#define _CCCL_HAS_BACKEND_OMP()  0
-#define _CCCL_HAS_BACKEND_TBB()  0
 
-#define _CCCL_HAS_PSTL_BACKEND() (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB())
+// The OpenMP backend would otherwise take over the parallel policies of every program built with OpenMP, so users
+// need to opt in with CCCL_ENABLE_PSTL_OMP
+#if defined(_OPENMP) && defined(CCCL_ENABLE_PSTL_OMP) && !_CCCL_COMPILER(NVRTC)
+#  define _CCCL_HAS_BACKEND_OMP() 1
+#else // ^^^ CCCL_ENABLE_PSTL_OMP ^^^ / vvv !CCCL_ENABLE_PSTL_OMP vvv
+#  define _CCCL_HAS_BACKEND_OMP() 0
+#endif // !CCCL_ENABLE_PSTL_OMP
+
+// The TBB backend requires linking against TBB, so users need to opt in with CCCL_ENABLE_PSTL_TBB
+#if defined(CCCL_ENABLE_PSTL_TBB) && !_CCCL_COMPILER(NVRTC)
+#  define _CCCL_HAS_BACKEND_TBB() 1
+#else // ^^^ CCCL_ENABLE_PSTL_TBB ^^^ / vvv !CCCL_ENABLE_PSTL_TBB vvv
+#  define _CCCL_HAS_BACKEND_TBB() 0
+#endif // !CCCL_ENABLE_PSTL_TBB
+
+#define _CCCL_HAS_CPU_BACKEND()  (_CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB())
+#define _CCCL_HAS_PSTL_BACKEND() (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_CPU_BACKEND())
 
 #include <cuda/std/__cccl/epilogue.h>
 
@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_DENSE_H
+#define _CUDA_STD___LINALG_DENSE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! @brief Whether the elements of an mdspan are plain memory in layout_left or layout_right, so that the algorithms can
+//! use the blocked kernels over raw pointers instead of the generic element-wise path
+template <class _Mdspan>
+inline constexpr bool __is_dense_v = false;
+
+template <class _ElementType, class _Extents, class _Layout>
+inline constexpr bool __is_dense_v<mdspan<_ElementType, _Extents, _Layout, default_accessor<_ElementType>>> =
+  is_same_v<_Layout, layout_left> || is_same_v<_Layout, layout_right>;
+
+//! @brief A matrix in plain memory, the element (__i, __j) is at __data_[__i * __row_stride_ + __j * __col_stride_]
+template <class _Tp>
+struct __dense_matrix
+{
+  _Tp* __data_;
+  ptrdiff_t __rows_;
+  ptrdiff_t __cols_;
+  ptrdiff_t __row_stride_;
+  ptrdiff_t __col_stride_;
+
+  [[nodiscard]] _CCCL_API constexpr _Tp& operator()(ptrdiff_t __i, ptrdiff_t __j) const noexcept
+  {
+    return __data_[__i * __row_stride_ + __j * __col_stride_];
+  }
+
+  //! @brief The same elements seen as the transposed matrix
+  [[nodiscard]] _CCCL_API constexpr __dense_matrix __transposed() const noexcept
+  {
+    return {__data_, __cols_, __rows_, __col_stride_, __row_stride_};
+  }
+};
+
+template <class _Mdspan>
+[[nodiscard]] _CCCL_API constexpr __dense_matrix<typename _Mdspan::element_type> __make_dense_matrix(const _Mdspan& __m)
+{
+  return {__m.data_handle(),
+          static_cast<ptrdiff_t>(__m.extent(0)),
+          static_cast<ptrdiff_t>(__m.extent(1)),
+          static_cast<ptrdiff_t>(__m.stride(0)),
+          static_cast<ptrdiff_t>(__m.stride(1))};
+}
+} // namespace __detail
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_DENSE_H
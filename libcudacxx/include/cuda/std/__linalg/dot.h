@@ -0,0 +1,174 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_DOT_H
+#define _CUDA_STD___LINALG_DOT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/conj_if_needed.h>
+#include <cuda/std/__linalg/dense.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! @brief Returns the value itself or its complex conjugate
+template <bool _Conj, class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __conj_if(const _Tp& __t)
+{
+  if constexpr (_Conj)
+  {
+    return conj_if_needed(__t);
+  }
+  else
+  {
+    return __t;
+  }
+}
+
+//! @brief Adds the products of the elements of __v1, conjugated if requested, and __v2 to __init. Contiguous vectors
+//! are summed up in independent partial sums, which shortens the dependency chain and lets the compiler vectorize.
+template <bool _Conj, class _InVec1, class _InVec2, class _Scalar>
+[[nodiscard]] _CCCL_API constexpr _Scalar __dot(const _InVec1& __v1, const _InVec2& __v2, _Scalar __init)
+{
+  static_assert(_InVec1::rank() == 1 && _InVec2::rank() == 1, "dot: the arguments must be vectors");
+  _CCCL_ASSERT(static_cast<size_t>(__v1.extent(0)) == static_cast<size_t>(__v2.extent(0)),
+               "dot: the vectors must have the same size");
+
+  const auto __n = static_cast<ptrdiff_t>(__v1.extent(0));
+  if constexpr (__is_dense_v<_InVec1> && __is_dense_v<_InVec2>)
+  {
+    constexpr ptrdiff_t __lanes = 4;
+
+    const auto* __x = __v1.data_handle();
+    const auto* __y = __v2.data_handle();
+    _Scalar __partial[__lanes]{};
+    ptrdiff_t __i = 0;
+    for (; __i + __lanes <= __n; __i += __lanes)
+    {
+      for (ptrdiff_t __l = 0; __l < __lanes; ++__l)
+      {
+        __partial[__l] += __conj_if<_Conj>(__x[__i + __l]) * __y[__i + __l];
+      }
+    }
+    for (; __i < __n; ++__i)
+    {
+      __partial[0] += __conj_if<_Conj>(__x[__i]) * __y[__i];
+    }
+    return __init + ((__partial[0] + __partial[1]) + (__partial[2] + __partial[3]));
+  }
+  else
+  {
+    for (ptrdiff_t __i = 0; __i < __n; ++__i)
+    {
+      __init += __conj_if<_Conj>(__v1(__i)) * __v2(__i);
+    }
+    return __init;
+  }
+}
+
+template <class _InVec1, class _InVec2>
+using __dot_result_t =
+  decltype(::cuda::std::declval<typename _InVec1::value_type>() * ::cuda::std::declval<typename _InVec2::value_type>());
+
+template <class _InVec1, class _InVec2>
+using __dotc_result_t = decltype(conj_if_needed(::cuda::std::declval<typename _InVec1::value_type>())
+                                 * ::cuda::std::declval<typename _InVec2::value_type>());
+} // namespace __detail
+
+//! @brief Returns __init plus the sum of the products of the elements of __v1 and __v2
+template <class _ElementType1,
+          class _Extents1,
+          class _Layout1,
+          class _Accessor1,
+          class _ElementType2,
+          class _Extents2,
+          class _Layout2,
+          class _Accessor2,
+          class _Scalar>
+[[nodiscard]] _CCCL_API constexpr _Scalar dot(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __v1,
+                                              mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __v2,
+                                              _Scalar __init)
+{
+  return __detail::__dot<false>(__v1, __v2, __init);
+}
+
+//! @brief Returns the sum of the products of the elements of __v1 and __v2
+template <class _ElementType1,
+          class _Extents1,
+          class _Layout1,
+          class _Accessor1,
+          class _ElementType2,
+          class _Extents2,
+          class _Layout2,
+          class _Accessor2>
+[[nodiscard]] _CCCL_API constexpr auto dot(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __v1,
+                                           mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __v2)
+{
+  using _Scalar = __detail::__dot_result_t<decltype(__v1), decltype(__v2)>;
+  return __detail::__dot<false>(__v1, __v2, _Scalar{});
+}
+
+//! @brief Returns __init plus the sum of the products of the conjugated elements of __v1 and the elements of __v2
+template <class _ElementType1,
+          class _Extents1,
+          class _Layout1,
+          class _Accessor1,
+          class _ElementType2,
+          class _Extents2,
+          class _Layout2,
+          class _Accessor2,
+          class _Scalar>
+[[nodiscard]] _CCCL_API constexpr _Scalar dotc(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __v1,
+                                               mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __v2,
+                                               _Scalar __init)
+{
+  return __detail::__dot<true>(__v1, __v2, __init);
+}
+
+//! @brief Returns the sum of the products of the conjugated elements of __v1 and the elements of __v2
+template <class _ElementType1,
+          class _Extents1,
+          class _Layout1,
+          class _Accessor1,
+          class _ElementType2,
+          class _Extents2,
+          class _Layout2,
+          class _Accessor2>
+[[nodiscard]] _CCCL_API constexpr auto dotc(mdspan<_ElementType1, _Extents1, _Layout1, _Accessor1> __v1,
+                                            mdspan<_ElementType2, _Extents2, _Layout2, _Accessor2> __v2)
+{
+  using _Scalar = __detail::__dotc_result_t<decltype(__v1), decltype(__v2)>;
+  return __detail::__dot<true>(__v1, __v2, _Scalar{});
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_DOT_H
@@ -0,0 +1,245 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_PRODUCT_H
+#define _CUDA_STD___LINALG_MATRIX_PRODUCT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/dense.h>
+#include <cuda/std/__type_traits/remove_cv.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+// The blocked product computes tiles of __gemm_mr x __gemm_nr elements of C in registers. The tiles are swept over
+// blocks of __gemm_mc rows of A and __gemm_kc x __gemm_nc elements of B, which are sized to stay in the L1 and L2
+// caches while they are reused.
+inline constexpr ptrdiff_t __gemm_mr = 4;
+inline constexpr ptrdiff_t __gemm_nr = 8;
+inline constexpr ptrdiff_t __gemm_mc = 64;
+inline constexpr ptrdiff_t __gemm_kc = 256;
+inline constexpr ptrdiff_t __gemm_nc = 512;
+
+//! @brief Adds the product of the rows [__i, __i + __mr) of __a and the columns [__j, __j + __nr) of __b, over the
+//! inner dimension [__p, __p + __kc), to the tile of __c. The accumulators are updated with a rank 1 update per step of
+//! the inner dimension, whose inner loop runs along the rows of __b and __c.
+template <class _Acc, class _Ta, class _Tb, class _Tc>
+_CCCL_API constexpr void __gemm_tile(
+  const __dense_matrix<_Ta>& __a,
+  const __dense_matrix<_Tb>& __b,
+  const __dense_matrix<_Tc>& __c,
+  ptrdiff_t __i,
+  ptrdiff_t __j,
+  ptrdiff_t __p,
+  ptrdiff_t __kc,
+  ptrdiff_t __mr,
+  ptrdiff_t __nr)
+{
+  _Acc __acc[__gemm_mr][__gemm_nr]{};
+  for (ptrdiff_t __k = __p; __k < __p + __kc; ++__k)
+  {
+    for (ptrdiff_t __ii = 0; __ii < __mr; ++__ii)
+    {
+      const auto __aik = __a(__i + __ii, __k);
+      for (ptrdiff_t __jj = 0; __jj < __nr; ++__jj)
+      {
+        __acc[__ii][__jj] += __aik * __b(__k, __j + __jj);
+      }
+    }
+  }
+  for (ptrdiff_t __ii = 0; __ii < __mr; ++__ii)
+  {
+    for (ptrdiff_t __jj = 0; __jj < __nr; ++__jj)
+    {
+      __c(__i + __ii, __j + __jj) += __acc[__ii][__jj];
+    }
+  }
+}
+
+//! @brief Adds __a * __b to __c, where the rows of __c are preferably contiguous
+template <class _Acc, class _Ta, class _Tb, class _Tc>
+_CCCL_API constexpr void __dense_add_matrix_product_by_rows(
+  const __dense_matrix<_Ta>& __a, const __dense_matrix<_Tb>& __b, const __dense_matrix<_Tc>& __c)
+{
+  const ptrdiff_t __m = __c.__rows_;
+  const ptrdiff_t __n = __c.__cols_;
+  const ptrdiff_t __k = __a.__cols_;
+  for (ptrdiff_t __jc = 0; __jc < __n; __jc += __gemm_nc)
+  {
+    const ptrdiff_t __nc = (::cuda::std::min)(__gemm_nc, __n - __jc);
+    for (ptrdiff_t __pc = 0; __pc < __k; __pc += __gemm_kc)
+    {
+      const ptrdiff_t __kc = (::cuda::std::min)(__gemm_kc, __k - __pc);
+      for (ptrdiff_t __ic = 0; __ic < __m; __ic += __gemm_mc)
+      {
+        const ptrdiff_t __mc = (::cuda::std::min)(__gemm_mc, __m - __ic);
+        for (ptrdiff_t __jr = __jc; __jr < __jc + __nc; __jr += __gemm_nr)
+        {
+          const ptrdiff_t __nr = (::cuda::std::min)(__gemm_nr, __jc + __nc - __jr);
+          for (ptrdiff_t __ir = __ic; __ir < __ic + __mc; __ir += __gemm_mr)
+          {
+            const ptrdiff_t __mr = (::cuda::std::min)(__gemm_mr, __ic + __mc - __ir);
+            // Full tiles get their own copy of the kernel with constant trip counts
+            if (__mr == __gemm_mr && __nr == __gemm_nr)
+            {
+              ::cuda::std::linalg::__detail::__gemm_tile<_Acc>(
+                __a, __b, __c, __ir, __jr, __pc, __kc, __gemm_mr, __gemm_nr);
+            }
+            else
+            {
+              ::cuda::std::linalg::__detail::__gemm_tile<_Acc>(__a, __b, __c, __ir, __jr, __pc, __kc, __mr, __nr);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+//! @brief Adds __a * __b to __c
+template <class _InMat1, class _InMat2, class _OutMat>
+_CCCL_API constexpr void __add_matrix_product(const _InMat1& __a, const _InMat2& __b, const _OutMat& __c)
+{
+  static_assert(_InMat1::rank() == 2 && _InMat2::rank() == 2 && _OutMat::rank() == 2,
+                "matrix_product: the arguments must be matrices");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(1)) == static_cast<size_t>(__b.extent(0)),
+               "matrix_product: the number of columns of A must be the number of rows of B");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__c.extent(0)),
+               "matrix_product: A and C must have the same number of rows");
+  _CCCL_ASSERT(static_cast<size_t>(__b.extent(1)) == static_cast<size_t>(__c.extent(1)),
+               "matrix_product: B and C must have the same number of columns");
+
+  using _Acc = typename _OutMat::value_type;
+
+  if constexpr (__is_dense_v<_InMat1> && __is_dense_v<_InMat2> && __is_dense_v<_OutMat>)
+  {
+    const auto __am = ::cuda::std::linalg::__detail::__make_dense_matrix(__a);
+    const auto __bm = ::cuda::std::linalg::__detail::__make_dense_matrix(__b);
+    const auto __cm = ::cuda::std::linalg::__detail::__make_dense_matrix(__c);
+    if (__cm.__col_stride_ == 1)
+    {
+      ::cuda::std::linalg::__detail::__dense_add_matrix_product_by_rows<_Acc>(__am, __bm, __cm);
+    }
+    else
+    {
+      // The columns of C are contiguous, compute the transposed product C^T += B^T * A^T instead
+      ::cuda::std::linalg::__detail::__dense_add_matrix_product_by_rows<_Acc>(
+        __bm.__transposed(), __am.__transposed(), __cm.__transposed());
+    }
+  }
+  else
+  {
+    const auto __m = static_cast<ptrdiff_t>(__c.extent(0));
+    const auto __n = static_cast<ptrdiff_t>(__c.extent(1));
+    const auto __k = static_cast<ptrdiff_t>(__a.extent(1));
+    for (ptrdiff_t __i = 0; __i < __m; ++__i)
+    {
+      for (ptrdiff_t __j = 0; __j < __n; ++__j)
+      {
+        _Acc __acc{};
+        for (ptrdiff_t __p = 0; __p < __k; ++__p)
+        {
+          __acc += __a(__i, __p) * __b(__p, __j);
+        }
+        __c(__i, __j) += __acc;
+      }
+    }
+  }
+}
+} // namespace __detail
+
+//! @brief Computes C = A * B
+//!
+//! Matrices in plain memory with layout_left or layout_right are multiplied by a cache blocked kernel, all other
+//! matrices element-wise through their mdspan.
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _ElementTypeB,
+          class _ExtentsB,
+          class _LayoutB,
+          class _AccessorB,
+          class _ElementTypeC,
+          class _ExtentsC,
+          class _LayoutC,
+          class _AccessorC>
+_CCCL_API constexpr void matrix_product(mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+                                        mdspan<_ElementTypeB, _ExtentsB, _LayoutB, _AccessorB> __b,
+                                        mdspan<_ElementTypeC, _ExtentsC, _LayoutC, _AccessorC> __c)
+{
+  for (ptrdiff_t __i = 0; __i < static_cast<ptrdiff_t>(__c.extent(0)); ++__i)
+  {
+    for (ptrdiff_t __j = 0; __j < static_cast<ptrdiff_t>(__c.extent(1)); ++__j)
+    {
+      __c(__i, __j) = remove_cv_t<_ElementTypeC>{};
+    }
+  }
+  ::cuda::std::linalg::__detail::__add_matrix_product(__a, __b, __c);
+}
+
+//! @brief Computes C = E + A * B, where C may be E
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _ElementTypeB,
+          class _ExtentsB,
+          class _LayoutB,
+          class _AccessorB,
+          class _ElementTypeE,
+          class _ExtentsE,
+          class _LayoutE,
+          class _AccessorE,
+          class _ElementTypeC,
+          class _ExtentsC,
+          class _LayoutC,
+          class _AccessorC>
+_CCCL_API constexpr void matrix_product(mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+                                        mdspan<_ElementTypeB, _ExtentsB, _LayoutB, _AccessorB> __b,
+                                        mdspan<_ElementTypeE, _ExtentsE, _LayoutE, _AccessorE> __e,
+                                        mdspan<_ElementTypeC, _ExtentsC, _LayoutC, _AccessorC> __c)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__e.extent(0)) == static_cast<size_t>(__c.extent(0))
+                 && static_cast<size_t>(__e.extent(1)) == static_cast<size_t>(__c.extent(1)),
+               "matrix_product: E and C must have the same extents");
+  for (ptrdiff_t __i = 0; __i < static_cast<ptrdiff_t>(__c.extent(0)); ++__i)
+  {
+    for (ptrdiff_t __j = 0; __j < static_cast<ptrdiff_t>(__c.extent(1)); ++__j)
+    {
+      __c(__i, __j) = __e(__i, __j);
+    }
+  }
+  ::cuda::std::linalg::__detail::__add_matrix_product(__a, __b, __c);
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_PRODUCT_H
@@ -0,0 +1,215 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_RANK_1_UPDATE_H
+#define _CUDA_STD___LINALG_MATRIX_RANK_1_UPDATE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/conj_if_needed.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! @brief Calls __f(__i, __j) for the elements of the __m x __n matrix __a in the triangle _Triangle, or all elements
+//! if _Triangle is void, in the order of its layout
+template <class _Triangle, class _Mat, class _Fn>
+_CCCL_API constexpr void __for_each_matrix_index(const _Mat& __a, _Fn __f)
+{
+  const auto __m = static_cast<ptrdiff_t>(__a.extent(0));
+  const auto __n = static_cast<ptrdiff_t>(__a.extent(1));
+  if constexpr (is_same_v<typename _Mat::layout_type, layout_left>)
+  {
+    for (ptrdiff_t __j = 0; __j < __n; ++__j)
+    {
+      const ptrdiff_t __b = (is_same_v<_Triangle, lower_triangle_t>) ? __j : 0;
+      const ptrdiff_t __e = (is_same_v<_Triangle, upper_triangle_t>) ? __j + 1 : __m;
+      for (ptrdiff_t __i = __b; __i < __e; ++__i)
+      {
+        __f(__i, __j);
+      }
+    }
+  }
+  else
+  {
+    for (ptrdiff_t __i = 0; __i < __m; ++__i)
+    {
+      const ptrdiff_t __b = (is_same_v<_Triangle, upper_triangle_t>) ? __i : 0;
+      const ptrdiff_t __e = (is_same_v<_Triangle, lower_triangle_t>) ? __i + 1 : __n;
+      for (ptrdiff_t __j = __b; __j < __e; ++__j)
+      {
+        __f(__i, __j);
+      }
+    }
+  }
+}
+} // namespace __detail
+
+//! @brief Computes A = A + x * y^T
+template <class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX,
+          class _ElementTypeY,
+          class _ExtentsY,
+          class _LayoutY,
+          class _AccessorY,
+          class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA>
+_CCCL_API constexpr void matrix_rank_1_update(mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x,
+                                              mdspan<_ElementTypeY, _ExtentsY, _LayoutY, _AccessorY> __y,
+                                              mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__x.extent(0)) == static_cast<size_t>(__a.extent(0))
+                 && static_cast<size_t>(__y.extent(0)) == static_cast<size_t>(__a.extent(1)),
+               "matrix_rank_1_update: the extents of the arguments do not match");
+  ::cuda::std::linalg::__detail::__for_each_matrix_index<void>(__a, [&](ptrdiff_t __i, ptrdiff_t __j) {
+    __a(__i, __j) += __x(__i) * __y(__j);
+  });
+}
+
+//! @brief Computes A = A + x * y^H
+template <class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX,
+          class _ElementTypeY,
+          class _ExtentsY,
+          class _LayoutY,
+          class _AccessorY,
+          class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA>
+_CCCL_API constexpr void matrix_rank_1_update_c(mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x,
+                                                mdspan<_ElementTypeY, _ExtentsY, _LayoutY, _AccessorY> __y,
+                                                mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__x.extent(0)) == static_cast<size_t>(__a.extent(0))
+                 && static_cast<size_t>(__y.extent(0)) == static_cast<size_t>(__a.extent(1)),
+               "matrix_rank_1_update_c: the extents of the arguments do not match");
+  ::cuda::std::linalg::__detail::__for_each_matrix_index<void>(__a, [&](ptrdiff_t __i, ptrdiff_t __j) {
+    __a(__i, __j) += __x(__i) * conj_if_needed(__y(__j));
+  });
+}
+
+//! @brief Computes A = A + alpha * x * x^T, only accessing the selected triangle of A
+template <class _Scalar,
+          class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX,
+          class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle>
+_CCCL_API constexpr void symmetric_matrix_rank_1_update(
+  _Scalar __alpha,
+  mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x,
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle)
+{
+  static_assert(__detail::__is_triangle_v<_Triangle>, "symmetric_matrix_rank_1_update: invalid triangle");
+  _CCCL_ASSERT(static_cast<size_t>(__x.extent(0)) == static_cast<size_t>(__a.extent(0))
+                 && static_cast<size_t>(__x.extent(0)) == static_cast<size_t>(__a.extent(1)),
+               "symmetric_matrix_rank_1_update: the extents of the arguments do not match");
+  ::cuda::std::linalg::__detail::__for_each_matrix_index<_Triangle>(__a, [&](ptrdiff_t __i, ptrdiff_t __j) {
+    __a(__i, __j) += __alpha * __x(__i) * __x(__j);
+  });
+}
+
+//! @brief Computes A = A + x * x^T, only accessing the selected triangle of A
+template <class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX,
+          class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle>
+_CCCL_API constexpr void symmetric_matrix_rank_1_update(
+  mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x,
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle __t)
+{
+  ::cuda::std::linalg::symmetric_matrix_rank_1_update(typename decltype(__x)::value_type{1}, __x, __a, __t);
+}
+
+//! @brief Computes A = A + alpha * x * x^H, only accessing the selected triangle of A
+template <class _Scalar,
+          class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX,
+          class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle>
+_CCCL_API constexpr void hermitian_matrix_rank_1_update(
+  _Scalar __alpha,
+  mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x,
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle)
+{
+  static_assert(__detail::__is_triangle_v<_Triangle>, "hermitian_matrix_rank_1_update: invalid triangle");
+  _CCCL_ASSERT(static_cast<size_t>(__x.extent(0)) == static_cast<size_t>(__a.extent(0))
+                 && static_cast<size_t>(__x.extent(0)) == static_cast<size_t>(__a.extent(1)),
+               "hermitian_matrix_rank_1_update: the extents of the arguments do not match");
+  ::cuda::std::linalg::__detail::__for_each_matrix_index<_Triangle>(__a, [&](ptrdiff_t __i, ptrdiff_t __j) {
+    __a(__i, __j) += __alpha * __x(__i) * conj_if_needed(__x(__j));
+  });
+}
+
+//! @brief Computes A = A + x * x^H, only accessing the selected triangle of A
+template <class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX,
+          class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle>
+_CCCL_API constexpr void hermitian_matrix_rank_1_update(
+  mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x,
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle __t)
+{
+  ::cuda::std::linalg::hermitian_matrix_rank_1_update(typename decltype(__x)::value_type{1}, __x, __a, __t);
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_RANK_1_UPDATE_H
@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_RANK_K_UPDATE_H
+#define _CUDA_STD___LINALG_MATRIX_RANK_K_UPDATE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/conj_if_needed.h>
+#include <cuda/std/__linalg/dot.h>
+#include <cuda/std/__linalg/matrix_rank_1_update.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! @brief Adds __alpha * A * A^T, or A * A^H if _Conj, to the triangle of __c. Every element of the triangle is the dot
+//! product of two rows of __a, which are contiguous for layout_right.
+template <bool _Conj, class _Triangle, class _Scalar, class _InMat, class _InOutMat>
+_CCCL_API constexpr void __matrix_rank_k_update(const _Scalar& __alpha, const _InMat& __a, const _InOutMat& __c)
+{
+  static_assert(_InMat::rank() == 2 && _InOutMat::rank() == 2, "matrix_rank_k_update: the arguments must be matrices");
+  static_assert(__is_triangle_v<_Triangle>, "matrix_rank_k_update: invalid triangle");
+  _CCCL_ASSERT(static_cast<size_t>(__c.extent(0)) == static_cast<size_t>(__c.extent(1)),
+               "matrix_rank_k_update: C must be square");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__c.extent(0)),
+               "matrix_rank_k_update: A must have as many rows as C");
+
+  using _Acc = typename _InOutMat::value_type;
+
+  const auto __k = static_cast<ptrdiff_t>(__a.extent(1));
+  ::cuda::std::linalg::__detail::__for_each_matrix_index<_Triangle>(__c, [&](ptrdiff_t __i, ptrdiff_t __j) {
+    _Acc __acc{};
+    for (ptrdiff_t __p = 0; __p < __k; ++__p)
+    {
+      __acc += __a(__i, __p) * __conj_if<_Conj>(__a(__j, __p));
+    }
+    __c(__i, __j) += __alpha * __acc;
+  });
+}
+} // namespace __detail
+
+//! @brief Computes C = C + alpha * A * A^T, only accessing the selected triangle of C
+template <class _Scalar,
+          class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _ElementTypeC,
+          class _ExtentsC,
+          class _LayoutC,
+          class _AccessorC,
+          class _Triangle>
+_CCCL_API constexpr void symmetric_matrix_rank_k_update(
+  _Scalar __alpha,
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  mdspan<_ElementTypeC, _ExtentsC, _LayoutC, _AccessorC> __c,
+  _Triangle)
+{
+  ::cuda::std::linalg::__detail::__matrix_rank_k_update<false, _Triangle>(__alpha, __a, __c);
+}
+
+//! @brief Computes C = C + A * A^T, only accessing the selected triangle of C
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _ElementTypeC,
+          class _ExtentsC,
+          class _LayoutC,
+          class _AccessorC,
+          class _Triangle>
+_CCCL_API constexpr void symmetric_matrix_rank_k_update(
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  mdspan<_ElementTypeC, _ExtentsC, _LayoutC, _AccessorC> __c,
+  _Triangle)
+{
+  using _Scalar = typename decltype(__c)::value_type;
+  ::cuda::std::linalg::__detail::__matrix_rank_k_update<false, _Triangle>(_Scalar{1}, __a, __c);
+}
+
+//! @brief Computes C = C + alpha * A * A^H, only accessing the selected triangle of C
+template <class _Scalar,
+          class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _ElementTypeC,
+          class _ExtentsC,
+          class _LayoutC,
+          class _AccessorC,
+          class _Triangle>
+_CCCL_API constexpr void hermitian_matrix_rank_k_update(
+  _Scalar __alpha,
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  mdspan<_ElementTypeC, _ExtentsC, _LayoutC, _AccessorC> __c,
+  _Triangle)
+{
+  ::cuda::std::linalg::__detail::__matrix_rank_k_update<true, _Triangle>(__alpha, __a, __c);
+}
+
+//! @brief Computes C = C + A * A^H, only accessing the selected triangle of C
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _ElementTypeC,
+          class _ExtentsC,
+          class _LayoutC,
+          class _AccessorC,
+          class _Triangle>
+_CCCL_API constexpr void hermitian_matrix_rank_k_update(
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  mdspan<_ElementTypeC, _ExtentsC, _LayoutC, _AccessorC> __c,
+  _Triangle)
+{
+  using _Scalar = typename decltype(__c)::value_type;
+  ::cuda::std::linalg::__detail::__matrix_rank_k_update<true, _Triangle>(_Scalar{1}, __a, __c);
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_RANK_K_UPDATE_H
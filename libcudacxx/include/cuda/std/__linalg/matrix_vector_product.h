@@ -0,0 +1,189 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_MATRIX_VECTOR_PRODUCT_H
+#define _CUDA_STD___LINALG_MATRIX_VECTOR_PRODUCT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/dense.h>
+#include <cuda/std/__type_traits/remove_cv.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! @brief Adds __a * __x to __y
+template <class _InMat, class _InVec, class _OutVec>
+_CCCL_API constexpr void __add_matrix_vector_product(const _InMat& __a, const _InVec& __x, const _OutVec& __y)
+{
+  static_assert(_InMat::rank() == 2 && _InVec::rank() == 1 && _OutVec::rank() == 1,
+                "matrix_vector_product: the arguments must be a matrix and vectors");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(1)) == static_cast<size_t>(__x.extent(0)),
+               "matrix_vector_product: the number of columns of A must be the size of x");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__y.extent(0)),
+               "matrix_vector_product: the number of rows of A must be the size of y");
+
+  using _Acc = typename _OutVec::value_type;
+
+  const auto __m = static_cast<ptrdiff_t>(__a.extent(0));
+  const auto __n = static_cast<ptrdiff_t>(__a.extent(1));
+  if constexpr (__is_dense_v<_InMat> && __is_dense_v<_InVec> && __is_dense_v<_OutVec>)
+  {
+    // Four rows or columns at a time, so that every element of x or y that is loaded is used four times
+    constexpr ptrdiff_t __block = 4;
+
+    const auto __mat = ::cuda::std::linalg::__detail::__make_dense_matrix(__a);
+    const auto* __xp = __x.data_handle();
+    auto* __yp       = __y.data_handle();
+    if (__mat.__col_stride_ == 1)
+    {
+      // Rows are contiguous, compute the dot products of blocks of rows with x
+      ptrdiff_t __i = 0;
+      for (; __i + __block <= __m; __i += __block)
+      {
+        _Acc __acc[__block]{};
+        for (ptrdiff_t __j = 0; __j < __n; ++__j)
+        {
+          for (ptrdiff_t __r = 0; __r < __block; ++__r)
+          {
+            __acc[__r] += __mat(__i + __r, __j) * __xp[__j];
+          }
+        }
+        for (ptrdiff_t __r = 0; __r < __block; ++__r)
+        {
+          __yp[__i + __r] += __acc[__r];
+        }
+      }
+      for (; __i < __m; ++__i)
+      {
+        _Acc __acc{};
+        for (ptrdiff_t __j = 0; __j < __n; ++__j)
+        {
+          __acc += __mat(__i, __j) * __xp[__j];
+        }
+        __yp[__i] += __acc;
+      }
+    }
+    else
+    {
+      // Columns are contiguous, add blocks of scaled columns to y
+      ptrdiff_t __j = 0;
+      for (; __j + __block <= __n; __j += __block)
+      {
+        for (ptrdiff_t __i = 0; __i < __m; ++__i)
+        {
+          _Acc __acc{};
+          for (ptrdiff_t __c = 0; __c < __block; ++__c)
+          {
+            __acc += __mat(__i, __j + __c) * __xp[__j + __c];
+          }
+          __yp[__i] += __acc;
+        }
+      }
+      for (; __j < __n; ++__j)
+      {
+        for (ptrdiff_t __i = 0; __i < __m; ++__i)
+        {
+          __yp[__i] += __mat(__i, __j) * __xp[__j];
+        }
+      }
+    }
+  }
+  else
+  {
+    for (ptrdiff_t __i = 0; __i < __m; ++__i)
+    {
+      _Acc __acc{};
+      for (ptrdiff_t __j = 0; __j < __n; ++__j)
+      {
+        __acc += __a(__i, __j) * __x(__j);
+      }
+      __y(__i) += __acc;
+    }
+  }
+}
+} // namespace __detail
+
+//! @brief Computes y = A * x
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX,
+          class _ElementTypeY,
+          class _ExtentsY,
+          class _LayoutY,
+          class _AccessorY>
+_CCCL_API constexpr void matrix_vector_product(mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+                                               mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x,
+                                               mdspan<_ElementTypeY, _ExtentsY, _LayoutY, _AccessorY> __y)
+{
+  for (ptrdiff_t __i = 0; __i < static_cast<ptrdiff_t>(__y.extent(0)); ++__i)
+  {
+    __y(__i) = remove_cv_t<_ElementTypeY>{};
+  }
+  ::cuda::std::linalg::__detail::__add_matrix_vector_product(__a, __x, __y);
+}
+
+//! @brief Computes z = y + A * x, where z may be y
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX,
+          class _ElementTypeY,
+          class _ExtentsY,
+          class _LayoutY,
+          class _AccessorY,
+          class _ElementTypeZ,
+          class _ExtentsZ,
+          class _LayoutZ,
+          class _AccessorZ>
+_CCCL_API constexpr void matrix_vector_product(mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+                                               mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x,
+                                               mdspan<_ElementTypeY, _ExtentsY, _LayoutY, _AccessorY> __y,
+                                               mdspan<_ElementTypeZ, _ExtentsZ, _LayoutZ, _AccessorZ> __z)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__y.extent(0)) == static_cast<size_t>(__z.extent(0)),
+               "matrix_vector_product: y and z must have the same size");
+  for (ptrdiff_t __i = 0; __i < static_cast<ptrdiff_t>(__z.extent(0)); ++__i)
+  {
+    __z(__i) = __y(__i);
+  }
+  ::cuda::std::linalg::__detail::__add_matrix_vector_product(__a, __x, __z);
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_MATRIX_VECTOR_PRODUCT_H
@@ -0,0 +1,210 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_TRIANGULAR_MATRIX_MATRIX_SOLVE_H
+#define _CUDA_STD___LINALG_TRIANGULAR_MATRIX_MATRIX_SOLVE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__linalg/transposed.h>
+#include <cuda/std/__linalg/triangular_matrix_vector_solve.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+template <class _Triangle>
+using __opposite_triangle_t = conditional_t<is_same_v<_Triangle, upper_triangle_t>, lower_triangle_t, upper_triangle_t>;
+
+//! @brief Overwrites __x with the solution X of A * X = __x, where A is the triangle of __a. The rows of X are solved
+//! in order, every one by subtracting the solved rows times the elements of A, so the inner loops run along the rows.
+template <class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat>
+_CCCL_API constexpr void __triangular_matrix_matrix_left_solve(const _InMat& __a, const _InOutMat& __x)
+{
+  static_assert(_InMat::rank() == 2 && _InOutMat::rank() == 2,
+                "triangular_matrix_matrix_solve: the arguments must be matrices");
+  static_assert(__is_triangle_v<_Triangle>, "triangular_matrix_matrix_solve: invalid triangle");
+  static_assert(__is_diagonal_storage_v<_DiagonalStorage>, "triangular_matrix_matrix_solve: invalid diagonal storage");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__a.extent(1)),
+               "triangular_matrix_matrix_solve: A must be square");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__x.extent(0)),
+               "triangular_matrix_matrix_solve: the extents of A and B do not match");
+
+  constexpr bool __lower    = is_same_v<_Triangle, lower_triangle_t>;
+  constexpr bool __explicit = is_same_v<_DiagonalStorage, explicit_diagonal_t>;
+
+  const auto __n    = static_cast<ptrdiff_t>(__a.extent(0));
+  const auto __ncol = static_cast<ptrdiff_t>(__x.extent(1));
+  for (ptrdiff_t __s = 0; __s < __n; ++__s)
+  {
+    const ptrdiff_t __i = (__lower) ? __s : __n - 1 - __s;
+    const ptrdiff_t __b = (__lower) ? 0 : __i + 1;
+    const ptrdiff_t __e = (__lower) ? __i : __n;
+    for (ptrdiff_t __k = __b; __k < __e; ++__k)
+    {
+      const auto __aik = __a(__i, __k);
+      for (ptrdiff_t __j = 0; __j < __ncol; ++__j)
+      {
+        __x(__i, __j) -= __aik * __x(__k, __j);
+      }
+    }
+    if constexpr (__explicit)
+    {
+      const auto __aii = __a(__i, __i);
+      for (ptrdiff_t __j = 0; __j < __ncol; ++__j)
+      {
+        __x(__i, __j) = __x(__i, __j) / __aii;
+      }
+    }
+  }
+}
+
+template <class _InMat, class _OutMat>
+_CCCL_API constexpr void __copy_matrix(const _InMat& __b, const _OutMat& __x)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__b.extent(0)) == static_cast<size_t>(__x.extent(0))
+                 && static_cast<size_t>(__b.extent(1)) == static_cast<size_t>(__x.extent(1)),
+               "triangular_matrix_matrix_solve: B and X must have the same extents");
+  for (ptrdiff_t __i = 0; __i < static_cast<ptrdiff_t>(__x.extent(0)); ++__i)
+  {
+    for (ptrdiff_t __j = 0; __j < static_cast<ptrdiff_t>(__x.extent(1)); ++__j)
+    {
+      __x(__i, __j) = __b(__i, __j);
+    }
+  }
+}
+} // namespace __detail
+
+//! @brief Computes the solution X of A * X = B, where A is the selected triangle of __a with the selected diagonal
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle,
+          class _DiagonalStorage,
+          class _ElementTypeB,
+          class _ExtentsB,
+          class _LayoutB,
+          class _AccessorB,
+          class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX>
+_CCCL_API constexpr void triangular_matrix_matrix_left_solve(
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle,
+  _DiagonalStorage,
+  mdspan<_ElementTypeB, _ExtentsB, _LayoutB, _AccessorB> __b,
+  mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x)
+{
+  ::cuda::std::linalg::__detail::__copy_matrix(__b, __x);
+  ::cuda::std::linalg::__detail::__triangular_matrix_matrix_left_solve<decltype(__a), _Triangle, _DiagonalStorage>(
+    __a, __x);
+}
+
+//! @brief Overwrites B with the solution X of A * X = B, where A is the selected triangle of __a with the selected
+//! diagonal
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle,
+          class _DiagonalStorage,
+          class _ElementTypeB,
+          class _ExtentsB,
+          class _LayoutB,
+          class _AccessorB>
+_CCCL_API constexpr void triangular_matrix_matrix_left_solve(
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle,
+  _DiagonalStorage,
+  mdspan<_ElementTypeB, _ExtentsB, _LayoutB, _AccessorB> __b)
+{
+  ::cuda::std::linalg::__detail::__triangular_matrix_matrix_left_solve<decltype(__a), _Triangle, _DiagonalStorage>(
+    __a, __b);
+}
+
+//! @brief Computes the solution X of X * A = B, where A is the selected triangle of __a with the selected diagonal.
+//! This is the left solve of A^T * X^T = B^T, in which the triangle is the opposite one.
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle,
+          class _DiagonalStorage,
+          class _ElementTypeB,
+          class _ExtentsB,
+          class _LayoutB,
+          class _AccessorB,
+          class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX>
+_CCCL_API constexpr void triangular_matrix_matrix_right_solve(
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle,
+  _DiagonalStorage,
+  mdspan<_ElementTypeB, _ExtentsB, _LayoutB, _AccessorB> __b,
+  mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x)
+{
+  ::cuda::std::linalg::__detail::__copy_matrix(__b, __x);
+  const auto __at = ::cuda::std::linalg::transposed(__a);
+  ::cuda::std::linalg::__detail::
+    __triangular_matrix_matrix_left_solve<decltype(__at), __detail::__opposite_triangle_t<_Triangle>, _DiagonalStorage>(
+      __at, ::cuda::std::linalg::transposed(__x));
+}
+
+//! @brief Overwrites B with the solution X of X * A = B, where A is the selected triangle of __a with the selected
+//! diagonal
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle,
+          class _DiagonalStorage,
+          class _ElementTypeB,
+          class _ExtentsB,
+          class _LayoutB,
+          class _AccessorB>
+_CCCL_API constexpr void triangular_matrix_matrix_right_solve(
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle,
+  _DiagonalStorage,
+  mdspan<_ElementTypeB, _ExtentsB, _LayoutB, _AccessorB> __b)
+{
+  const auto __at = ::cuda::std::linalg::transposed(__a);
+  ::cuda::std::linalg::__detail::
+    __triangular_matrix_matrix_left_solve<decltype(__at), __detail::__opposite_triangle_t<_Triangle>, _DiagonalStorage>(
+      __at, ::cuda::std::linalg::transposed(__b));
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_TRIANGULAR_MATRIX_MATRIX_SOLVE_H
@@ -0,0 +1,153 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_TRIANGULAR_MATRIX_VECTOR_SOLVE_H
+#define _CUDA_STD___LINALG_TRIANGULAR_MATRIX_VECTOR_SOLVE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! @brief Overwrites __x with the solution of A * x = __x, where A is the triangle of __a. If the columns of __a are
+//! contiguous the solution is computed by subtracting the solved elements times their column from the remaining ones,
+//! otherwise every element is computed from the dot product of its row with the solved elements.
+template <class _InMat, class _Triangle, class _DiagonalStorage, class _InOutVec>
+_CCCL_API constexpr void __triangular_matrix_vector_solve(const _InMat& __a, const _InOutVec& __x)
+{
+  static_assert(_InMat::rank() == 2 && _InOutVec::rank() == 1,
+                "triangular_matrix_vector_solve: the arguments must be a matrix and vectors");
+  static_assert(__is_triangle_v<_Triangle>, "triangular_matrix_vector_solve: invalid triangle");
+  static_assert(__is_diagonal_storage_v<_DiagonalStorage>, "triangular_matrix_vector_solve: invalid diagonal storage");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__a.extent(1)),
+               "triangular_matrix_vector_solve: A must be square");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__x.extent(0)),
+               "triangular_matrix_vector_solve: the size of the vectors must be the size of A");
+
+  constexpr bool __lower    = is_same_v<_Triangle, lower_triangle_t>;
+  constexpr bool __explicit = is_same_v<_DiagonalStorage, explicit_diagonal_t>;
+
+  const auto __n = static_cast<ptrdiff_t>(__a.extent(0));
+  if constexpr (is_same_v<typename _InMat::layout_type, layout_left>)
+  {
+    for (ptrdiff_t __s = 0; __s < __n; ++__s)
+    {
+      const ptrdiff_t __j = (__lower) ? __s : __n - 1 - __s;
+      if constexpr (__explicit)
+      {
+        __x(__j) = __x(__j) / __a(__j, __j);
+      }
+      const auto __xj     = __x(__j);
+      const ptrdiff_t __b = (__lower) ? __j + 1 : 0;
+      const ptrdiff_t __e = (__lower) ? __n : __j;
+      for (ptrdiff_t __i = __b; __i < __e; ++__i)
+      {
+        __x(__i) -= __a(__i, __j) * __xj;
+      }
+    }
+  }
+  else
+  {
+    for (ptrdiff_t __s = 0; __s < __n; ++__s)
+    {
+      const ptrdiff_t __i = (__lower) ? __s : __n - 1 - __s;
+      const ptrdiff_t __b = (__lower) ? 0 : __i + 1;
+      const ptrdiff_t __e = (__lower) ? __i : __n;
+      auto __acc          = __x(__i);
+      for (ptrdiff_t __j = __b; __j < __e; ++__j)
+      {
+        __acc -= __a(__i, __j) * __x(__j);
+      }
+      if constexpr (__explicit)
+      {
+        __acc = __acc / __a(__i, __i);
+      }
+      __x(__i) = __acc;
+    }
+  }
+}
+} // namespace __detail
+
+//! @brief Computes the solution x of A * x = b, where A is the selected triangle of __a with the selected diagonal
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle,
+          class _DiagonalStorage,
+          class _ElementTypeB,
+          class _ExtentsB,
+          class _LayoutB,
+          class _AccessorB,
+          class _ElementTypeX,
+          class _ExtentsX,
+          class _LayoutX,
+          class _AccessorX>
+_CCCL_API constexpr void triangular_matrix_vector_solve(
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle,
+  _DiagonalStorage,
+  mdspan<_ElementTypeB, _ExtentsB, _LayoutB, _AccessorB> __b,
+  mdspan<_ElementTypeX, _ExtentsX, _LayoutX, _AccessorX> __x)
+{
+  _CCCL_ASSERT(static_cast<size_t>(__b.extent(0)) == static_cast<size_t>(__x.extent(0)),
+               "triangular_matrix_vector_solve: b and x must have the same size");
+  for (ptrdiff_t __i = 0; __i < static_cast<ptrdiff_t>(__x.extent(0)); ++__i)
+  {
+    __x(__i) = __b(__i);
+  }
+  ::cuda::std::linalg::__detail::__triangular_matrix_vector_solve<decltype(__a), _Triangle, _DiagonalStorage>(__a, __x);
+}
+
+//! @brief Overwrites b with the solution x of A * x = b, where A is the selected triangle of __a with the selected
+//! diagonal
+template <class _ElementTypeA,
+          class _ExtentsA,
+          class _LayoutA,
+          class _AccessorA,
+          class _Triangle,
+          class _DiagonalStorage,
+          class _ElementTypeB,
+          class _ExtentsB,
+          class _LayoutB,
+          class _AccessorB>
+_CCCL_API constexpr void triangular_matrix_vector_solve(
+  mdspan<_ElementTypeA, _ExtentsA, _LayoutA, _AccessorA> __a,
+  _Triangle,
+  _DiagonalStorage,
+  mdspan<_ElementTypeB, _ExtentsB, _LayoutB, _AccessorB> __b)
+{
+  ::cuda::std::linalg::__detail::__triangular_matrix_vector_solve<decltype(__a), _Triangle, _DiagonalStorage>(__a, __b);
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_TRIANGULAR_MATRIX_VECTOR_SOLVE_H
@@ -0,0 +1,134 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_VECTOR_TWO_NORM_H
+#define _CUDA_STD___LINALG_VECTOR_TWO_NORM_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/abs.h>
+#include <cuda/std/__cmath/isinf.h>
+#include <cuda/std/__cmath/roots.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__type_traits/is_unsigned.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/complex>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! @brief Returns the absolute value, or the value itself if it is unsigned
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __abs_if_needed(const _Tp& __t)
+{
+  if constexpr (is_unsigned_v<_Tp>)
+  {
+    return __t;
+  }
+  else
+  {
+    using ::cuda::std::abs;
+    return abs(__t);
+  }
+}
+
+template <class _InVec>
+using __vector_two_norm_result_t = decltype(__abs_if_needed(::cuda::std::declval<typename _InVec::value_type>()));
+} // namespace __detail
+
+//! @brief Returns the square root of the sum of the square of __init and the squares of the absolute values of the
+//! elements of __v. Floating-point sums are scaled by the largest absolute value, so that they neither overflow nor
+//! underflow unless the result does. Like hypot, the result is +inf if any of the values is infinite, even if another
+//! one is NaN.
+template <class _ElementType, class _Extents, class _Layout, class _Accessor, class _Scalar>
+[[nodiscard]] _CCCL_API _Scalar vector_two_norm(mdspan<_ElementType, _Extents, _Layout, _Accessor> __v, _Scalar __init)
+{
+  static_assert(_Extents::rank() == 1, "vector_two_norm: the argument must be a vector");
+  using ::cuda::std::sqrt;
+
+  const auto __n = static_cast<ptrdiff_t>(__v.extent(0));
+  if constexpr (is_integral_v<_Scalar>)
+  {
+    _Scalar __sum = __init * __init;
+    for (ptrdiff_t __i = 0; __i < __n; ++__i)
+    {
+      const _Scalar __abs = __detail::__abs_if_needed(__v(__i));
+      __sum += __abs * __abs;
+    }
+    return static_cast<_Scalar>(sqrt(__sum));
+  }
+  else
+  {
+    using ::cuda::std::isinf;
+
+    // The norm is __scale * sqrt(__ssq)
+    _Scalar __scale = __detail::__abs_if_needed(__init);
+    if (isinf(__scale))
+    {
+      return __scale;
+    }
+    _Scalar __ssq = (__scale == _Scalar{}) ? _Scalar{} : _Scalar{1};
+    for (ptrdiff_t __i = 0; __i < __n; ++__i)
+    {
+      const _Scalar __abs = __detail::__abs_if_needed(__v(__i));
+      if (__abs == _Scalar{})
+      {
+        continue;
+      }
+      // scaling by an infinite value would turn the sum into NaN
+      if (isinf(__abs))
+      {
+        return __abs;
+      }
+      if (__scale < __abs)
+      {
+        const _Scalar __ratio = __scale / __abs;
+        __ssq                 = _Scalar{1} + __ssq * __ratio * __ratio;
+        __scale               = __abs;
+      }
+      else
+      {
+        const _Scalar __ratio = __abs / __scale;
+        __ssq += __ratio * __ratio;
+      }
+    }
+    return __scale * sqrt(__ssq);
+  }
+}
+
+//! @brief Returns the Euclidean norm of __v
+template <class _ElementType, class _Extents, class _Layout, class _Accessor>
+[[nodiscard]] _CCCL_API auto vector_two_norm(mdspan<_ElementType, _Extents, _Layout, _Accessor> __v)
+{
+  using _Scalar = __detail::__vector_two_norm_result_t<decltype(__v)>;
+  return ::cuda::std::linalg::vector_two_norm(__v, _Scalar{});
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_VECTOR_TWO_NORM_H
@@ -39,6 +39,10 @@
 #    include <cuda/std/__pstl/cuda/adjacent_difference.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_CPU_BACKEND()
+#    include <cuda/std/__pstl/cpu/adjacent_difference.h>
+#  endif // _CCCL_HAS_CPU_BACKEND()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -42,6 +42,10 @@
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_CPU_BACKEND()
+#    include <cuda/std/__pstl/cpu/find_if.h>
+#  endif // _CCCL_HAS_CPU_BACKEND()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -66,11 +70,17 @@ _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND is_execution_po
       return __first;
     }
 
-    auto __zipped_ret = __dispatch(
+    const auto __zipped_last = ::cuda::zip_iterator{::cuda::std::prev(__last), __last};
+    auto __zipped_ret        = __dispatch(
       __policy,
       ::cuda::zip_iterator{__first, ::cuda::std::next(__first)},
-      ::cuda::zip_iterator{::cuda::std::prev(__last), __last},
+      __zipped_last,
       ::cuda::zip_function{::cuda::std::move(__pred)});
+    // no adjacent pair matched
+    if (__zipped_ret == __zipped_last)
+    {
+      return __last;
+    }
     return ::cuda::std::get<0>(__zipped_ret.__iterators());
   }
   else
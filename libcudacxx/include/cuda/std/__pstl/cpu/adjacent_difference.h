@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_ADJACENT_DIFFERENCE_H
+#define _CUDA_STD___PSTL_CPU_ADJACENT_DIFFERENCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__numeric/adjacent_difference.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__pstl/cpu/cpu_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <__execution_backend _Backend>
+struct __pstl_cpu_dispatch<__pstl_algorithm::__adjacent_difference, _Backend>
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _BinaryOp __binary_op) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      // The input and the output do not overlap, so every difference can be computed on its own
+      const auto __count  = static_cast<size_t>(::cuda::std::distance(__first, __last));
+      const auto __chunks = ::cuda::std::execution::__cpu_make_chunks<_Backend>(__count);
+      ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+        size_t __i = __chunks.__begin(__chunk);
+        auto __in  = ::cuda::std::execution::__cpu_next(__first, __i);
+        auto __out = ::cuda::std::execution::__cpu_next(__result, __i);
+        if (__i == 0)
+        {
+          *__out = *__in;
+          ++__i, (void) ++__in, (void) ++__out;
+        }
+        for (; __i != __chunks.__end(__chunk); ++__i, (void) ++__in, (void) ++__out)
+        {
+          *__out = __binary_op(*__in, *(__in - 1));
+        }
+      });
+      return ::cuda::std::execution::__cpu_next(__result, __count);
+    }
+    else
+    {
+      return ::cuda::std::adjacent_difference(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__binary_op));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__adjacent_difference, __execution_backend::__omp>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__adjacent_difference, __execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__adjacent_difference, __execution_backend::__tbb>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__adjacent_difference, __execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_ADJACENT_DIFFERENCE_H
@@ -0,0 +1,111 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_CHUNKS_H
+#define _CUDA_STD___PSTL_CPU_CHUNKS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/__cmath/ceil_div.h>
+#  include <cuda/std/__algorithm/clamp.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/cpu/cpu_traits.h>
+#  include <cuda/std/cstddef>
+
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/cpu_traits.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/cpu_traits.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Chunks are at least this long, so that shorter ranges are processed by a single thread
+inline constexpr size_t __cpu_min_chunk_size = 4096;
+
+//! @brief Every thread gets this many chunks on average, so that the threads that finish early can take over some of
+//! the work of the others
+inline constexpr size_t __cpu_chunks_per_thread = 4;
+
+//! @brief Splits [0, __n) into chunks of equal size, except for the last one
+struct __cpu_chunks
+{
+  size_t __n_;
+  size_t __size_;
+  size_t __count_;
+
+  [[nodiscard]] _CCCL_HOST_API size_t __begin(size_t __chunk) const noexcept
+  {
+    return __chunk * __size_;
+  }
+
+  [[nodiscard]] _CCCL_HOST_API size_t __end(size_t __chunk) const noexcept
+  {
+    return (::cuda::std::min)(__n_, (__chunk + 1) * __size_);
+  }
+};
+
+template <__execution_backend _Backend>
+[[nodiscard]] _CCCL_HOST_API __cpu_chunks __cpu_make_chunks(size_t __n) noexcept
+{
+  const size_t __max_chunks = __cpu_traits<_Backend>::__concurrency() * __cpu_chunks_per_thread;
+  const size_t __num_chunks = ::cuda::std::clamp(__n / __cpu_min_chunk_size, size_t{1}, __max_chunks);
+  const size_t __size       = ::cuda::ceil_div(__n, __num_chunks);
+  return __cpu_chunks{__n, __size, __size == 0 ? 0 : ::cuda::ceil_div(__n, __size)};
+}
+
+//! @brief Returns the iterator @p __n elements after @p __it
+template <class _Iter>
+[[nodiscard]] _CCCL_HOST_API _Iter __cpu_next(_Iter __it, size_t __n)
+{
+  return __it + static_cast<iter_difference_t<_Iter>>(__n);
+}
+
+//! @brief Calls __fn(__chunk) for every chunk of __chunks, in parallel if there is more than one
+template <__execution_backend _Backend, class _Fn>
+_CCCL_HOST_API void __cpu_for_each_chunk(const __cpu_chunks& __chunks, _Fn __fn)
+{
+  if (__chunks.__count_ == 1)
+  {
+    __fn(size_t{0});
+  }
+  else if (__chunks.__count_ > 1)
+  {
+    __cpu_traits<_Backend>::__for_each_chunk(__chunks.__count_, __fn);
+  }
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_CHUNKS_H
@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_CPU_TRAITS_H
+#define _CUDA_STD___PSTL_CPU_CPU_TRAITS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__pstl/dispatch.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief The primitives a CPU backend provides to the parallel algorithms in __pstl/cpu
+//!
+//! A specialization for a backend must provide
+//! * `static size_t __concurrency() noexcept`, which returns the number of threads that work can be spread over
+//! * `template <class _Fn> static void __for_each_chunk(size_t __num_chunks, _Fn& __fn)`, which calls `__fn(__chunk)`
+//!   for every `__chunk` in `[0, __num_chunks)`, possibly concurrently, and returns when all calls have returned
+template <__execution_backend _Backend>
+struct __cpu_traits;
+
+//! @brief Implements @tparam _Algorithm with the primitives of the CPU backend @tparam _Backend. The specializations
+//! of @class __pstl_dispatch for the CPU backends derive from it.
+template <__pstl_algorithm _Algorithm, __execution_backend _Backend>
+struct __pstl_cpu_dispatch;
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_CPU_TRAITS_H
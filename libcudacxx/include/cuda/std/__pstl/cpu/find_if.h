@@ -0,0 +1,120 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_FIND_IF_H
+#define _CUDA_STD___PSTL_CPU_FIND_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__algorithm/find_if.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__pstl/cpu/cpu_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief A chunk checks between blocks of this many elements whether a preceding chunk has found a match already
+inline constexpr size_t __cpu_find_if_block_size = 256;
+
+template <__execution_backend _Backend>
+struct __pstl_cpu_dispatch<__pstl_algorithm::__find_if, _Backend>
+{
+  template <class _Policy, class _Iter, class _UnaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Iter
+  operator()([[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __last, _UnaryOp __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      const auto __count  = static_cast<size_t>(::cuda::std::distance(__first, __last));
+      const auto __chunks = ::cuda::std::execution::__cpu_make_chunks<_Backend>(__count);
+
+      // index of the first match found so far
+      size_t __found = __count;
+      ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+        ::cuda::std::atomic_ref<size_t> __found_ref{__found};
+
+        size_t __i = __chunks.__begin(__chunk);
+        auto __it  = ::cuda::std::execution::__cpu_next(__first, __i);
+        while (__i != __chunks.__end(__chunk))
+        {
+          // Stop as soon as a match before this chunk is known
+          if (__found_ref.load(::cuda::std::memory_order_relaxed) < __i)
+          {
+            return;
+          }
+
+          const size_t __block_end = (::cuda::std::min)(__chunks.__end(__chunk), __i + __cpu_find_if_block_size);
+          for (; __i != __block_end; ++__i, (void) ++__it)
+          {
+            if (__pred(*__it))
+            {
+              size_t __expected = __found_ref.load(::cuda::std::memory_order_relaxed);
+              while (__i < __expected
+                     && !__found_ref.compare_exchange_weak(__expected, __i, ::cuda::std::memory_order_relaxed))
+              {
+              }
+              return;
+            }
+          }
+        }
+      });
+      return ::cuda::std::execution::__cpu_next(__first, __found);
+    }
+    else
+    {
+      return ::cuda::std::find_if(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__find_if, __execution_backend::__omp>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__find_if, __execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__find_if, __execution_backend::__tbb>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__find_if, __execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_FIND_IF_H
@@ -0,0 +1,138 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_MERGE_H
+#define _CUDA_STD___PSTL_CPU_MERGE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__algorithm/merge.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__pstl/cpu/cpu_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Returns how many of the first __diagonal elements of the merged range come from [__first1, __first1 + __n1).
+//! Equivalent elements are taken from the first range first, so that the merge is stable.
+template <class _InputIterator1, class _InputIterator2, class _Compare>
+[[nodiscard]] _CCCL_HOST_API size_t __cpu_merge_path(
+  _InputIterator1 __first1, size_t __n1, _InputIterator2 __first2, size_t __n2, size_t __diagonal, _Compare& __comp)
+{
+  size_t __lo = __diagonal > __n2 ? __diagonal - __n2 : 0;
+  size_t __hi = (::cuda::std::min)(__diagonal, __n1);
+  while (__lo < __hi)
+  {
+    const size_t __mid = __lo + (__hi - __lo) / 2;
+    if (__comp(*::cuda::std::execution::__cpu_next(__first2, __diagonal - __mid - 1),
+               *::cuda::std::execution::__cpu_next(__first1, __mid)))
+    {
+      __hi = __mid;
+    }
+    else
+    {
+      __lo = __mid + 1;
+    }
+  }
+  return __lo;
+}
+
+template <__execution_backend _Backend>
+struct __pstl_cpu_dispatch<__pstl_algorithm::__merge, _Backend>
+{
+  template <class _Policy, class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator1 __first1,
+    _InputIterator1 __last1,
+    _InputIterator2 __first2,
+    _InputIterator2 __last2,
+    _OutputIterator __result,
+    _Compare __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_InputIterator2>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      // Every chunk of the output is merged on its own from the parts of the inputs found by a binary search
+      const auto __n1     = static_cast<size_t>(::cuda::std::distance(__first1, __last1));
+      const auto __n2     = static_cast<size_t>(::cuda::std::distance(__first2, __last2));
+      const auto __chunks = ::cuda::std::execution::__cpu_make_chunks<_Backend>(__n1 + __n2);
+      ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+        const size_t __begin = __chunks.__begin(__chunk);
+        const size_t __end   = __chunks.__end(__chunk);
+        const size_t __begin1 =
+          ::cuda::std::execution::__cpu_merge_path(__first1, __n1, __first2, __n2, __begin, __comp);
+        const size_t __end1 = ::cuda::std::execution::__cpu_merge_path(__first1, __n1, __first2, __n2, __end, __comp);
+        (void) ::cuda::std::merge(::cuda::std::execution::__cpu_next(__first1, __begin1),
+                                  ::cuda::std::execution::__cpu_next(__first1, __end1),
+                                  ::cuda::std::execution::__cpu_next(__first2, __begin - __begin1),
+                                  ::cuda::std::execution::__cpu_next(__first2, __end - __end1),
+                                  ::cuda::std::execution::__cpu_next(__result, __begin),
+                                  __comp);
+      });
+      return ::cuda::std::execution::__cpu_next(__result, __n1 + __n2);
+    }
+    else
+    {
+      return ::cuda::std::merge(
+        ::cuda::std::move(__first1),
+        ::cuda::std::move(__last1),
+        ::cuda::std::move(__first2),
+        ::cuda::std::move(__last2),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__comp));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__merge, __execution_backend::__omp>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__merge, __execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__merge, __execution_backend::__tbb>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__merge, __execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_MERGE_H
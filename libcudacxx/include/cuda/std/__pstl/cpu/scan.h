@@ -0,0 +1,147 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_SCAN_H
+#define _CUDA_STD___PSTL_CPU_SCAN_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/unique_ptr.h>
+#  include <cuda/std/__numeric/exclusive_scan.h>
+#  include <cuda/std/__numeric/inclusive_scan.h>
+#  include <cuda/std/__optional/optional.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Scans [__first, __first + __count) into __result in three passes: the chunks are reduced in parallel, the
+//! sums of the chunks are scanned serially, and then the chunks are scanned in parallel, each starting from the sum of
+//! the preceding chunks. The result may alias the input.
+//! @tparam _Inclusive Whether to compute an inclusive or an exclusive scan
+//! @tparam _HasInit Whether __init holds an initial value, which exclusive scans always require
+template <__execution_backend _Backend,
+          bool _Inclusive,
+          bool _HasInit,
+          class _InputIterator,
+          class _OutputIterator,
+          class _Tp,
+          class _BinaryOp>
+_CCCL_HOST_API _OutputIterator __cpu_scan(
+  _InputIterator __first, size_t __count, _OutputIterator __result, optional<_Tp> __init, _BinaryOp& __binary_op)
+{
+  static_assert(_Inclusive || _HasInit, "An exclusive scan requires an initial value");
+
+  const auto __chunks = ::cuda::std::execution::__cpu_make_chunks<_Backend>(__count);
+
+  // As in transform_reduce, the sum of a chunk starts from its first two elements, and chunks with a single element
+  // are added when the sums are scanned. The last chunk does not contribute to any other chunk.
+  auto __sums = ::cuda::std::make_unique<optional<_Tp>[]>(__chunks.__count_);
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    const size_t __begin = __chunks.__begin(__chunk);
+    const size_t __end   = __chunks.__end(__chunk);
+    if (__chunk + 1 == __chunks.__count_ || __end - __begin < 2)
+    {
+      return;
+    }
+
+    auto __it = ::cuda::std::execution::__cpu_next(__first, __begin);
+    _Tp __acc(__binary_op(*__it, *(__it + 1)));
+    __it += 2;
+    for (size_t __i = __begin + 2; __i != __end; ++__i, (void) ++__it)
+    {
+      __acc = __binary_op(::cuda::std::move(__acc), *__it);
+    }
+    __sums[__chunk].emplace(::cuda::std::move(__acc));
+  });
+
+  // Turn the sums into the value every chunk starts from
+  auto __carry = ::cuda::std::move(__init);
+  for (size_t __chunk = 0; __chunk != __chunks.__count_; ++__chunk)
+  {
+    optional<_Tp> __next_carry{};
+    if (__chunk + 1 != __chunks.__count_)
+    {
+      if (__sums[__chunk].has_value())
+      {
+        if constexpr (_HasInit)
+        {
+          __next_carry.emplace(__binary_op(*__carry, *__sums[__chunk]));
+        }
+        else
+        {
+          __next_carry.emplace(__carry.has_value() ? _Tp(__binary_op(*__carry, *__sums[__chunk]))
+                                                   : ::cuda::std::move(*__sums[__chunk]));
+        }
+      }
+      else
+      {
+        auto __it = ::cuda::std::execution::__cpu_next(__first, __chunks.__begin(__chunk));
+        if constexpr (_HasInit)
+        {
+          __next_carry.emplace(__binary_op(*__carry, *__it));
+        }
+        else
+        {
+          __next_carry.emplace(__carry.has_value() ? _Tp(__binary_op(*__carry, *__it)) : _Tp(*__it));
+        }
+      }
+    }
+    __sums[__chunk] = ::cuda::std::move(__carry);
+    __carry         = ::cuda::std::move(__next_carry);
+  }
+
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    const auto __in_first = ::cuda::std::execution::__cpu_next(__first, __chunks.__begin(__chunk));
+    const auto __in_last  = ::cuda::std::execution::__cpu_next(__first, __chunks.__end(__chunk));
+    const auto __out      = ::cuda::std::execution::__cpu_next(__result, __chunks.__begin(__chunk));
+    if constexpr (!_Inclusive)
+    {
+      (void) ::cuda::std::exclusive_scan(__in_first, __in_last, __out, ::cuda::std::move(*__sums[__chunk]), __binary_op);
+    }
+    else if (__sums[__chunk].has_value())
+    {
+      (void) ::cuda::std::inclusive_scan(__in_first, __in_last, __out, __binary_op, ::cuda::std::move(*__sums[__chunk]));
+    }
+    else
+    {
+      (void) ::cuda::std::inclusive_scan(__in_first, __in_last, __out, __binary_op);
+    }
+  });
+
+  return ::cuda::std::execution::__cpu_next(__result, __count);
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_SCAN_H
@@ -0,0 +1,266 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_SORT_H
+#define _CUDA_STD___PSTL_CPU_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__algorithm/sort.h>
+#  include <cuda/std/__algorithm/stable_sort.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__pstl/cpu/cpu_traits.h>
+#  include <cuda/std/__pstl/cpu/merge.h>
+#  include <cuda/std/__pstl/cpu/temporary_buffer.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__type_traits/is_nothrow_move_constructible.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Moves the elements of the sorted ranges [__first1, __last1) and [__first2, __last2) to __result, merged.
+//! Unlike merge over move iterators, the comparison sees the elements as lvalues.
+template <class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare>
+_CCCL_HOST_API void __cpu_move_merge(
+  _InputIterator1 __first1,
+  _InputIterator1 __last1,
+  _InputIterator2 __first2,
+  _InputIterator2 __last2,
+  _OutputIterator __result,
+  _Compare& __comp)
+{
+  for (; __first1 != __last1 && __first2 != __last2; ++__result)
+  {
+    if (__comp(*__first2, *__first1))
+    {
+      *__result = ::cuda::std::move(*__first2);
+      ++__first2;
+    }
+    else
+    {
+      *__result = ::cuda::std::move(*__first1);
+      ++__first1;
+    }
+  }
+  for (; __first1 != __last1; ++__first1, (void) ++__result)
+  {
+    *__result = ::cuda::std::move(*__first1);
+  }
+  for (; __first2 != __last2; ++__first2, (void) ++__result)
+  {
+    *__result = ::cuda::std::move(*__first2);
+  }
+}
+
+//! @brief Merges every pair of adjacent sorted runs of length __width of [__src, __src + __chunks.__n_) into
+//! [__dst, __dst + __chunks.__n_). Every chunk of the output is merged on its own from the parts of the runs found by a
+//! binary search, so that the last passes, which only merge a few long runs, still use all threads.
+template <__execution_backend _Backend, class _SrcIter, class _DstIter, class _Compare>
+_CCCL_HOST_API void
+__cpu_merge_runs(const __cpu_chunks& __chunks, _SrcIter __src, _DstIter __dst, size_t __width, _Compare& __comp)
+{
+  const size_t __n = __chunks.__n_;
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    const size_t __begin = __chunks.__begin(__chunk);
+    const size_t __end   = __chunks.__end(__chunk);
+    for (size_t __pair = __begin - __begin % (2 * __width); __pair < __end; __pair += 2 * __width)
+    {
+      const size_t __n1  = (::cuda::std::min)(__width, __n - __pair);
+      const size_t __n2  = (::cuda::std::min)(__width, __n - __pair - __n1);
+      const auto __run1  = ::cuda::std::execution::__cpu_next(__src, __pair);
+      const auto __run2  = ::cuda::std::execution::__cpu_next(__run1, __n1);
+      const size_t __lo  = (::cuda::std::max)(__begin, __pair) - __pair;
+      const size_t __hi  = (::cuda::std::min)(__end, __pair + __n1 + __n2) - __pair;
+      const size_t __lo1 = ::cuda::std::execution::__cpu_merge_path(__run1, __n1, __run2, __n2, __lo, __comp);
+      const size_t __hi1 = ::cuda::std::execution::__cpu_merge_path(__run1, __n1, __run2, __n2, __hi, __comp);
+      ::cuda::std::execution::__cpu_move_merge(
+        ::cuda::std::execution::__cpu_next(__run1, __lo1),
+        ::cuda::std::execution::__cpu_next(__run1, __hi1),
+        ::cuda::std::execution::__cpu_next(__run2, __lo - __lo1),
+        ::cuda::std::execution::__cpu_next(__run2, __hi - __hi1),
+        ::cuda::std::execution::__cpu_next(__dst, __pair + __lo),
+        __comp);
+    }
+  });
+}
+
+//! @brief Sorts [__first, __last) with a merge sort. The range is moved into a temporary buffer, where every chunk is
+//! sorted serially, then the sorted runs are merged pairwise back and forth between the range and the buffer until one
+//! is left. The merges prefer the left run, so the result is stable if the chunks are sorted stably. All elements of
+//! the buffer are constructed before the first comparison, so that they are destroyed if the comparison throws.
+template <__execution_backend _Backend, bool _Stable, class _RandomAccessIterator, class _Compare>
+_CCCL_HOST_API void __cpu_sort(_RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+{
+  using _Tp = iter_value_t<_RandomAccessIterator>;
+
+  const auto __chunks = ::cuda::std::execution::__cpu_make_chunks<_Backend>(
+    static_cast<size_t>(::cuda::std::distance(__first, __last)));
+
+  // Short ranges are sorted by a single thread
+  if (__chunks.__count_ <= 1)
+  {
+    if constexpr (_Stable)
+    {
+      ::cuda::std::stable_sort(__first, __last, __comp);
+    }
+    else
+    {
+      ::cuda::std::sort(__first, __last, __comp);
+    }
+    return;
+  }
+
+  __cpu_temporary_buffer<_Tp> __buffer{__chunks.__n_};
+  _Tp* const __data = __buffer.__data();
+
+  if constexpr (is_nothrow_move_constructible_v<_Tp>)
+  {
+    ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+      auto __in = ::cuda::std::execution::__cpu_next(__first, __chunks.__begin(__chunk));
+      for (size_t __i = __chunks.__begin(__chunk); __i != __chunks.__end(__chunk); ++__i, (void) ++__in)
+      {
+        ::cuda::std::__construct_at(__data + __i, ::cuda::std::move(*__in));
+      }
+    });
+    __buffer.__set_constructed(__chunks.__n_);
+  }
+  else
+  {
+    // A throwing move leaves a prefix of the buffer constructed, which is only known when moving serially
+    auto __in = __first;
+    for (size_t __i = 0; __i != __chunks.__n_; ++__i, (void) ++__in)
+    {
+      ::cuda::std::__construct_at(__data + __i, ::cuda::std::move(*__in));
+      __buffer.__set_constructed(__i + 1);
+    }
+  }
+
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    if constexpr (_Stable)
+    {
+      ::cuda::std::stable_sort(__data + __chunks.__begin(__chunk), __data + __chunks.__end(__chunk), __comp);
+    }
+    else
+    {
+      ::cuda::std::sort(__data + __chunks.__begin(__chunk), __data + __chunks.__end(__chunk), __comp);
+    }
+  });
+
+  bool __in_buffer = true;
+  for (size_t __width = __chunks.__size_; __width < __chunks.__n_; __width *= 2)
+  {
+    if (__in_buffer)
+    {
+      ::cuda::std::execution::__cpu_merge_runs<_Backend>(__chunks, __data, __first, __width, __comp);
+    }
+    else
+    {
+      ::cuda::std::execution::__cpu_merge_runs<_Backend>(__chunks, __first, __data, __width, __comp);
+    }
+    __in_buffer = !__in_buffer;
+  }
+
+  // the last pass destroys the elements of the buffer itself
+  __buffer.__set_constructed(0);
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    auto __out = ::cuda::std::execution::__cpu_next(__first, __chunks.__begin(__chunk));
+    for (size_t __i = __chunks.__begin(__chunk); __i != __chunks.__end(__chunk); ++__i, (void) ++__out)
+    {
+      if (__in_buffer)
+      {
+        *__out = ::cuda::std::move(__data[__i]);
+      }
+      ::cuda::std::__destroy_at(__data + __i);
+    }
+  });
+}
+
+template <__execution_backend _Backend>
+struct __pstl_cpu_dispatch<__pstl_algorithm::__sort, _Backend>
+{
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API void operator()([[maybe_unused]] const _Policy& __policy,
+                                 _RandomAccessIterator __first,
+                                 _RandomAccessIterator __last,
+                                 _Compare __comp) const
+  {
+    ::cuda::std::execution::__cpu_sort<_Backend, false>(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+  }
+};
+
+template <__execution_backend _Backend>
+struct __pstl_cpu_dispatch<__pstl_algorithm::__stable_sort, _Backend>
+{
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API void operator()([[maybe_unused]] const _Policy& __policy,
+                                 _RandomAccessIterator __first,
+                                 _RandomAccessIterator __last,
+                                 _Compare __comp) const
+  {
+    ::cuda::std::execution::__cpu_sort<_Backend, true>(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__sort, __execution_backend::__omp>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__sort, __execution_backend::__omp>
+{};
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__stable_sort, __execution_backend::__omp>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__stable_sort, __execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__sort, __execution_backend::__tbb>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__sort, __execution_backend::__tbb>
+{};
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__stable_sort, __execution_backend::__tbb>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__stable_sort, __execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_SORT_H
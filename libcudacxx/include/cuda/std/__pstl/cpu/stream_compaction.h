@@ -0,0 +1,185 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_STREAM_COMPACTION_H
+#define _CUDA_STD___PSTL_CPU_STREAM_COMPACTION_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__memory/unique_ptr.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__pstl/cpu/temporary_buffer.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief The flags of the elements of a range, and for every chunk the number of flagged elements before it
+struct __cpu_flags
+{
+  unique_ptr<bool[]> __flags_;
+  unique_ptr<size_t[]> __offsets_;
+  size_t __num_selected_;
+};
+
+//! @brief Flags every element of [__first, __first + __chunks.__n_) with __flag(__it, __i), where __it points to the
+//! element with index __i. All flags are computed before anything is written, so they may look at the neighbours.
+template <__execution_backend _Backend, class _Iter, class _FlagFn>
+[[nodiscard]] _CCCL_HOST_API __cpu_flags
+__cpu_make_flags(const __cpu_chunks& __chunks, _Iter __first, _FlagFn __flag)
+{
+  __cpu_flags __res{::cuda::std::make_unique_for_overwrite<bool[]>(__chunks.__n_),
+                    ::cuda::std::make_unique_for_overwrite<size_t[]>(__chunks.__count_),
+                    0};
+
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    size_t __count = 0;
+    auto __it      = ::cuda::std::execution::__cpu_next(__first, __chunks.__begin(__chunk));
+    for (size_t __i = __chunks.__begin(__chunk); __i != __chunks.__end(__chunk); ++__i, (void) ++__it)
+    {
+      const bool __selected = static_cast<bool>(__flag(__it, __i));
+      __res.__flags_[__i]   = __selected;
+      __count += __selected;
+    }
+    __res.__offsets_[__chunk] = __count;
+  });
+
+  for (size_t __chunk = 0; __chunk != __chunks.__count_; ++__chunk)
+  {
+    const size_t __count      = __res.__offsets_[__chunk];
+    __res.__offsets_[__chunk] = __res.__num_selected_;
+    __res.__num_selected_ += __count;
+  }
+  return __res;
+}
+
+//! @brief Copies the flagged elements to __result, keeping their order
+template <__execution_backend _Backend, class _InputIterator, class _OutputIterator>
+_CCCL_HOST_API void __cpu_copy_flagged(
+  const __cpu_chunks& __chunks, const __cpu_flags& __flags, _InputIterator __first, _OutputIterator __result)
+{
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    auto __in  = ::cuda::std::execution::__cpu_next(__first, __chunks.__begin(__chunk));
+    auto __out = ::cuda::std::execution::__cpu_next(__result, __flags.__offsets_[__chunk]);
+    for (size_t __i = __chunks.__begin(__chunk); __i != __chunks.__end(__chunk); ++__i, (void) ++__in)
+    {
+      if (__flags.__flags_[__i])
+      {
+        *__out = *__in;
+        ++__out;
+      }
+    }
+  });
+}
+
+//! @brief Copies the flagged elements to __result_true and the others to __result_false, keeping their order
+template <__execution_backend _Backend, class _InputIterator, class _OutputIterator1, class _OutputIterator2>
+_CCCL_HOST_API void __cpu_partition_copy_flagged(
+  const __cpu_chunks& __chunks,
+  const __cpu_flags& __flags,
+  _InputIterator __first,
+  _OutputIterator1 __result_true,
+  _OutputIterator2 __result_false)
+{
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    const size_t __begin = __chunks.__begin(__chunk);
+    auto __in            = ::cuda::std::execution::__cpu_next(__first, __begin);
+    auto __out_true      = ::cuda::std::execution::__cpu_next(__result_true, __flags.__offsets_[__chunk]);
+    auto __out_false     = ::cuda::std::execution::__cpu_next(__result_false, __begin - __flags.__offsets_[__chunk]);
+    for (size_t __i = __begin; __i != __chunks.__end(__chunk); ++__i, (void) ++__in)
+    {
+      if (__flags.__flags_[__i])
+      {
+        *__out_true = *__in;
+        ++__out_true;
+      }
+      else
+      {
+        *__out_false = *__in;
+        ++__out_false;
+      }
+    }
+  });
+}
+
+//! @brief Moves the flagged elements of [__first, __first + __chunks.__n_) to its front, keeping their order. If
+//! _KeepRejected is true, the other elements follow them, again in order, otherwise they are left in a valid but
+//! unspecified state. Chunks would overwrite the elements other chunks are still reading, so the elements are moved to
+//! a temporary buffer first.
+template <__execution_backend _Backend, bool _KeepRejected, class _Iter>
+_CCCL_HOST_API void __cpu_compact_flagged(const __cpu_chunks& __chunks, const __cpu_flags& __flags, _Iter __first)
+{
+  using _Tp = iter_value_t<_Iter>;
+
+  // Nothing needs to move when no element or all elements are selected
+  if (__flags.__num_selected_ == 0 || __flags.__num_selected_ == __chunks.__n_)
+  {
+    return;
+  }
+
+  const size_t __size = _KeepRejected ? __chunks.__n_ : __flags.__num_selected_;
+  __cpu_temporary_buffer<_Tp> __buffer{__size};
+  _Tp* const __data = __buffer.__data();
+
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    const size_t __begin = __chunks.__begin(__chunk);
+    size_t __selected    = __flags.__offsets_[__chunk];
+    size_t __rejected    = __flags.__num_selected_ + __begin - __selected;
+    auto __in            = ::cuda::std::execution::__cpu_next(__first, __begin);
+    for (size_t __i = __begin; __i != __chunks.__end(__chunk); ++__i, (void) ++__in)
+    {
+      if (__flags.__flags_[__i])
+      {
+        ::cuda::std::__construct_at(__data + __selected++, ::cuda::std::move(*__in));
+      }
+      else if constexpr (_KeepRejected)
+      {
+        ::cuda::std::__construct_at(__data + __rejected++, ::cuda::std::move(*__in));
+      }
+    }
+  });
+
+  const auto __back_chunks = ::cuda::std::execution::__cpu_make_chunks<_Backend>(__size);
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__back_chunks, [&](size_t __chunk) {
+    auto __out = ::cuda::std::execution::__cpu_next(__first, __back_chunks.__begin(__chunk));
+    for (size_t __i = __back_chunks.__begin(__chunk); __i != __back_chunks.__end(__chunk); ++__i, (void) ++__out)
+    {
+      *__out = ::cuda::std::move(__data[__i]);
+      ::cuda::std::__destroy_at(__data + __i);
+    }
+  });
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_STREAM_COMPACTION_H
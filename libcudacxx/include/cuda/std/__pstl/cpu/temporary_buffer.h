@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_TEMPORARY_BUFFER_H
+#define _CUDA_STD___PSTL_CPU_TEMPORARY_BUFFER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__memory/allocator.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Uninitialized storage for the elements an algorithm moves out of its range. The first elements that the
+//! algorithm declared as constructed with __set_constructed are destroyed with the buffer, so that they do not leak
+//! when the algorithm exits with an exception.
+template <class _Tp>
+class __cpu_temporary_buffer
+{
+public:
+  _CCCL_HOST_API explicit __cpu_temporary_buffer(size_t __size)
+      : __data_{allocator<_Tp>{}.allocate(__size)}
+      , __size_{__size}
+  {}
+
+  __cpu_temporary_buffer(const __cpu_temporary_buffer&)            = delete;
+  __cpu_temporary_buffer& operator=(const __cpu_temporary_buffer&) = delete;
+
+  _CCCL_HOST_API ~__cpu_temporary_buffer()
+  {
+    for (size_t __i = 0; __i != __constructed_; ++__i)
+    {
+      ::cuda::std::__destroy_at(__data_ + __i);
+    }
+    allocator<_Tp>{}.deallocate(__data_, __size_);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API _Tp* __data() const noexcept
+  {
+    return __data_;
+  }
+
+  //! @brief Declares the first @p __count elements as constructed, or none of them once the algorithm destroyed them
+  _CCCL_HOST_API void __set_constructed(size_t __count) noexcept
+  {
+    __constructed_ = __count;
+  }
+
+private:
+  _Tp* __data_;
+  size_t __size_;
+  size_t __constructed_ = 0;
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_TEMPORARY_BUFFER_H
@@ -0,0 +1,176 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_TRANSFORM_H
+#define _CUDA_STD___PSTL_CPU_TRANSFORM_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__functional/invoke.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__pstl/cpu/cpu_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Predicate of the transform dispatch that selects every element
+struct __cpu_transform_always_true
+{
+  template <class... _Args>
+  [[nodiscard]] _CCCL_API constexpr bool operator()(_Args&&...) const noexcept
+  {
+    return true;
+  }
+};
+
+template <__execution_backend _Backend>
+struct __pstl_cpu_dispatch<__pstl_algorithm::__transform, _Backend>
+{
+  //! Writes __func(*__first) to *__result for every element with __pred(*__first) and skips the others
+  _CCCL_TEMPLATE(class _Policy,
+                 class _InputIterator,
+                 class _OutputIterator,
+                 class _UnaryOp,
+                 class _Predicate = __cpu_transform_always_true)
+  _CCCL_REQUIRES(is_invocable_v<_UnaryOp, iter_reference_t<_InputIterator>>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _UnaryOp __func,
+    _Predicate __pred = {}) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const auto __count  = static_cast<size_t>(::cuda::std::distance(__first, __last));
+      const auto __chunks = ::cuda::std::execution::__cpu_make_chunks<_Backend>(__count);
+      ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+        auto __in  = ::cuda::std::execution::__cpu_next(__first, __chunks.__begin(__chunk));
+        auto __out = ::cuda::std::execution::__cpu_next(__result, __chunks.__begin(__chunk));
+        for (size_t __i = __chunks.__begin(__chunk); __i != __chunks.__end(__chunk); ++__i, (void) ++__in, (void) ++__out)
+        {
+          if (__pred(*__in))
+          {
+            *__out = __func(*__in);
+          }
+        }
+      });
+      return ::cuda::std::execution::__cpu_next(__result, __count);
+    }
+    else
+    {
+      for (; __first != __last; ++__first, (void) ++__result)
+      {
+        if (__pred(*__first))
+        {
+          *__result = __func(*__first);
+        }
+      }
+      return __result;
+    }
+  }
+
+  //! Writes __func(*__first1, *__first2) to *__result for every pair of elements with __pred(*__first1, *__first2)
+  _CCCL_TEMPLATE(class _Policy,
+                 class _InputIterator1,
+                 class _InputIterator2,
+                 class _OutputIterator,
+                 class _BinaryOp,
+                 class _Predicate = __cpu_transform_always_true)
+  _CCCL_REQUIRES(is_invocable_v<_BinaryOp, iter_reference_t<_InputIterator1>, iter_reference_t<_InputIterator2>>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator1 __first1,
+    _InputIterator1 __last1,
+    _InputIterator2 __first2,
+    _OutputIterator __result,
+    _BinaryOp __func,
+    _Predicate __pred = {}) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_InputIterator2>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const auto __count  = static_cast<size_t>(::cuda::std::distance(__first1, __last1));
+      const auto __chunks = ::cuda::std::execution::__cpu_make_chunks<_Backend>(__count);
+      ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+        auto __in1 = ::cuda::std::execution::__cpu_next(__first1, __chunks.__begin(__chunk));
+        auto __in2 = ::cuda::std::execution::__cpu_next(__first2, __chunks.__begin(__chunk));
+        auto __out = ::cuda::std::execution::__cpu_next(__result, __chunks.__begin(__chunk));
+        for (size_t __i = __chunks.__begin(__chunk); __i != __chunks.__end(__chunk);
+             ++__i, (void) ++__in1, (void) ++__in2, (void) ++__out)
+        {
+          if (__pred(*__in1, *__in2))
+          {
+            *__out = __func(*__in1, *__in2);
+          }
+        }
+      });
+      return ::cuda::std::execution::__cpu_next(__result, __count);
+    }
+    else
+    {
+      for (; __first1 != __last1; ++__first1, (void) ++__first2, (void) ++__result)
+      {
+        if (__pred(*__first1, *__first2))
+        {
+          *__result = __func(*__first1, *__first2);
+        }
+      }
+      return __result;
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__transform, __execution_backend::__omp>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__transform, __execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__transform, __execution_backend::__tbb>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__transform, __execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_TRANSFORM_H
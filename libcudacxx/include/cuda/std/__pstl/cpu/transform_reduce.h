@@ -0,0 +1,137 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CPU_TRANSFORM_REDUCE_H
+#define _CUDA_STD___PSTL_CPU_TRANSFORM_REDUCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_CPU_BACKEND()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/unique_ptr.h>
+#  include <cuda/std/__numeric/transform_reduce.h>
+#  include <cuda/std/__optional/optional.h>
+#  include <cuda/std/__pstl/cpu/chunks.h>
+#  include <cuda/std/__pstl/cpu/cpu_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Reduces __transform_op(__first[__i]) for every __i in [0, __count) into __init
+template <__execution_backend _Backend, class _Iter, class _Tp, class _ReductionOp, class _TransformOp>
+[[nodiscard]] _CCCL_HOST_API _Tp __cpu_transform_reduce(
+  _Iter __first, size_t __count, _Tp __init, _ReductionOp& __reduction_op, _TransformOp& __transform_op)
+{
+  const auto __chunks = ::cuda::std::execution::__cpu_make_chunks<_Backend>(__count);
+
+  // There is no identity element to start the partial results of the chunks from, so they start from the first two
+  // elements of the chunk. Chunks with a single element are added when the partial results are combined
+  auto __partials = ::cuda::std::make_unique<optional<_Tp>[]>(__chunks.__count_);
+  ::cuda::std::execution::__cpu_for_each_chunk<_Backend>(__chunks, [&](size_t __chunk) {
+    const size_t __begin = __chunks.__begin(__chunk);
+    const size_t __end   = __chunks.__end(__chunk);
+    if (__end - __begin < 2)
+    {
+      return;
+    }
+
+    auto __it = ::cuda::std::execution::__cpu_next(__first, __begin);
+    _Tp __acc(__reduction_op(__transform_op(*__it), __transform_op(*(__it + 1))));
+    __it += 2;
+    for (size_t __i = __begin + 2; __i != __end; ++__i, (void) ++__it)
+    {
+      __acc = __reduction_op(::cuda::std::move(__acc), __transform_op(*__it));
+    }
+    __partials[__chunk].emplace(::cuda::std::move(__acc));
+  });
+
+  for (size_t __chunk = 0; __chunk != __chunks.__count_; ++__chunk)
+  {
+    if (__partials[__chunk].has_value())
+    {
+      __init = __reduction_op(::cuda::std::move(__init), ::cuda::std::move(*__partials[__chunk]));
+    }
+    else
+    {
+      __init = __reduction_op(
+        ::cuda::std::move(__init),
+        __transform_op(*::cuda::std::execution::__cpu_next(__first, __chunks.__begin(__chunk))));
+    }
+  }
+  return __init;
+}
+
+template <__execution_backend _Backend>
+struct __pstl_cpu_dispatch<__pstl_algorithm::__transform_reduce, _Backend>
+{
+  template <class _Policy, class _InputIterator, class _Size, class _Tp, class _ReductionOp, class _TransformOp>
+  [[nodiscard]] _CCCL_HOST_API _Tp operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _Size __count,
+    _Tp __init,
+    _ReductionOp __reduction_op,
+    _TransformOp __transform_op) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      return ::cuda::std::execution::__cpu_transform_reduce<_Backend>(
+        ::cuda::std::move(__first), static_cast<size_t>(__count), ::cuda::std::move(__init), __reduction_op, __transform_op);
+    }
+    else
+    {
+      for (; __count > 0; --__count, (void) ++__first)
+      {
+        __init = __reduction_op(::cuda::std::move(__init), __transform_op(*__first));
+      }
+      return __init;
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__transform_reduce, __execution_backend::__omp>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__transform_reduce, __execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__transform_reduce, __execution_backend::__tbb>
+    : __pstl_cpu_dispatch<__pstl_algorithm::__transform_reduce, __execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_CPU_BACKEND()
+
+#endif // _CUDA_STD___PSTL_CPU_TRANSFORM_REDUCE_H
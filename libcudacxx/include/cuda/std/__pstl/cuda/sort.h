@@ -0,0 +1,280 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CUDA_SORT_H
+#define _CUDA_STD___PSTL_CUDA_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_CUDA()
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_CLANG("-Wshadow")
+_CCCL_DIAG_SUPPRESS_CLANG("-Wunused-local-typedef")
+_CCCL_DIAG_SUPPRESS_GCC("-Wattributes")
+_CCCL_DIAG_SUPPRESS_NVHPC(attribute_requires_external_linkage)
+
+#  include <cub/device/device_merge_sort.cuh>
+#  include <cub/device/device_radix_sort.cuh>
+#  include <cub/util_type.cuh>
+
+_CCCL_DIAG_POP
+
+#  include <cuda/__execution/policy.h>
+#  include <cuda/__functional/call_or.h>
+#  include <cuda/__stream/get_stream.h>
+#  include <cuda/__stream/stream_ref.h>
+#  include <cuda/std/__algorithm/sort.h>
+#  include <cuda/std/__algorithm/stable_sort.h>
+#  include <cuda/std/__exception/cuda_error.h>
+#  include <cuda/std/__exception/exception_macros.h>
+#  include <cuda/std/__execution/env.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__functional/operations.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/incrementable_traits.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/pointer_traits.h>
+#  include <cuda/std/__pstl/cuda/temporary_storage.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__type_traits/is_arithmetic.h>
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Arithmetic values in contiguous memory that are ordered by less or greater can be radix sorted, which is
+//! stable and much faster than a merge sort. CUB cannot radix sort long double.
+template <class _Iter, class _Compare>
+inline constexpr bool __pstl_cuda_can_radix_sort =
+  contiguous_iterator<_Iter> && is_arithmetic_v<iter_value_t<_Iter>> && !is_same_v<iter_value_t<_Iter>, long double>
+  && (is_same_v<_Compare, less<>> || is_same_v<_Compare, less<iter_value_t<_Iter>>> || is_same_v<_Compare, greater<>>
+      || is_same_v<_Compare, greater<iter_value_t<_Iter>>>);
+
+template <bool _Stable>
+struct __pstl_cuda_sort
+{
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API static void
+  __radix_sort(const _Policy& __policy, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare)
+  {
+    using _Tp = iter_value_t<_RandomAccessIterator>;
+
+    constexpr bool __descending =
+      is_same_v<_Compare, greater<>> || is_same_v<_Compare, greater<iter_value_t<_RandomAccessIterator>>>;
+
+    _Tp* const __keys  = ::cuda::std::to_address(__first);
+    const auto __count = ::cuda::std::distance(__first, __last);
+
+    // Determine temporary device storage requirements for device_radix_sort
+    size_t __num_bytes = 0;
+    CUB_NS_QUALIFIER::DoubleBuffer<_Tp> __buffers{};
+    if constexpr (__descending)
+    {
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceRadixSort::SortKeysDescending,
+        "__pstl_cuda_sort: determination of device storage for cub::DeviceRadixSort::SortKeysDescending failed",
+        static_cast<void*>(nullptr),
+        __num_bytes,
+        __buffers,
+        __count);
+    }
+    else
+    {
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceRadixSort::SortKeys,
+        "__pstl_cuda_sort: determination of device storage for cub::DeviceRadixSort::SortKeys failed",
+        static_cast<void*>(nullptr),
+        __num_bytes,
+        __buffers,
+        __count);
+    }
+
+    // Allocate memory for result
+    auto __stream = ::cuda::__call_or(::cuda::get_stream, ::cuda::stream_ref{cudaStreamPerThread}, __policy);
+    {
+      // The radix sort ping-pongs between the input and an alternate buffer of the same size
+      __temporary_storage<_Tp> __storage{__policy, __num_bytes, __count};
+      __buffers = CUB_NS_QUALIFIER::DoubleBuffer<_Tp>{__keys, __storage.template __get_raw_ptr<0>()};
+
+      // Run the kernel
+      if constexpr (__descending)
+      {
+        _CCCL_TRY_CUDA_API(
+          CUB_NS_QUALIFIER::DeviceRadixSort::SortKeysDescending,
+          "__pstl_cuda_sort: kernel launch of cub::DeviceRadixSort::SortKeysDescending failed",
+          __storage.__get_temp_storage(),
+          __num_bytes,
+          __buffers,
+          __count,
+          0,
+          static_cast<int>(sizeof(_Tp) * 8),
+          __stream.get());
+      }
+      else
+      {
+        _CCCL_TRY_CUDA_API(
+          CUB_NS_QUALIFIER::DeviceRadixSort::SortKeys,
+          "__pstl_cuda_sort: kernel launch of cub::DeviceRadixSort::SortKeys failed",
+          __storage.__get_temp_storage(),
+          __num_bytes,
+          __buffers,
+          __count,
+          0,
+          static_cast<int>(sizeof(_Tp) * 8),
+          __stream.get());
+      }
+
+      // Copy the result back if it ended up in the alternate buffer
+      if (__buffers.Current() != __keys)
+      {
+        _CCCL_TRY_CUDA_API(
+          ::cudaMemcpyAsync,
+          "__pstl_cuda_sort: copy of sorted keys from temporary storage failed",
+          __keys,
+          __buffers.Current(),
+          static_cast<size_t>(__count) * sizeof(_Tp),
+          ::cudaMemcpyDefault,
+          __stream.get());
+      }
+    }
+
+    __stream.sync();
+  }
+
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API static void
+  __merge_sort(const _Policy& __policy, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+  {
+    const auto __count = ::cuda::std::distance(__first, __last);
+
+    // Determine temporary device storage requirements for device_merge_sort
+    size_t __num_bytes = 0;
+    if constexpr (_Stable)
+    {
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceMergeSort::StableSortKeys,
+        "__pstl_cuda_sort: determination of device storage for cub::DeviceMergeSort::StableSortKeys failed",
+        static_cast<void*>(nullptr),
+        __num_bytes,
+        __first,
+        __count,
+        __comp);
+    }
+    else
+    {
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceMergeSort::SortKeys,
+        "__pstl_cuda_sort: determination of device storage for cub::DeviceMergeSort::SortKeys failed",
+        static_cast<void*>(nullptr),
+        __num_bytes,
+        __first,
+        __count,
+        __comp);
+    }
+
+    // Allocate memory for result
+    auto __stream = ::cuda::__call_or(::cuda::get_stream, ::cuda::stream_ref{cudaStreamPerThread}, __policy);
+    {
+      __temporary_storage<> __storage{__policy, __num_bytes};
+
+      // Run the kernel
+      if constexpr (_Stable)
+      {
+        _CCCL_TRY_CUDA_API(
+          CUB_NS_QUALIFIER::DeviceMergeSort::StableSortKeys,
+          "__pstl_cuda_sort: kernel launch of cub::DeviceMergeSort::StableSortKeys failed",
+          __storage.__get_temp_storage(),
+          __num_bytes,
+          ::cuda::std::move(__first),
+          __count,
+          ::cuda::std::move(__comp),
+          __stream.get());
+      }
+      else
+      {
+        _CCCL_TRY_CUDA_API(
+          CUB_NS_QUALIFIER::DeviceMergeSort::SortKeys,
+          "__pstl_cuda_sort: kernel launch of cub::DeviceMergeSort::SortKeys failed",
+          __storage.__get_temp_storage(),
+          __num_bytes,
+          ::cuda::std::move(__first),
+          __count,
+          ::cuda::std::move(__comp),
+          __stream.get());
+      }
+    }
+
+    __stream.sync();
+  }
+
+  _CCCL_TEMPLATE(class _Policy, class _RandomAccessIterator, class _Compare)
+  _CCCL_REQUIRES(__has_random_access_traversal<_RandomAccessIterator>)
+  _CCCL_HOST_API void operator()([[maybe_unused]] const _Policy& __policy,
+                                 _RandomAccessIterator __first,
+                                 _RandomAccessIterator __last,
+                                 _Compare __comp) const
+  {
+    try
+    {
+      if constexpr (__pstl_cuda_can_radix_sort<_RandomAccessIterator, _Compare>)
+      {
+        __radix_sort(__policy, ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+      }
+      else
+      {
+        __merge_sort(__policy, ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+      }
+    }
+    catch (const ::cuda::cuda_error& __err)
+    {
+      if (__err.status() == cudaErrorMemoryAllocation)
+      {
+        _CCCL_THROW(::std::bad_alloc);
+      }
+      else
+      {
+        throw __err;
+      }
+    }
+  }
+};
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__sort, __execution_backend::__cuda> : __pstl_cuda_sort<false>
+{};
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__stable_sort, __execution_backend::__cuda> : __pstl_cuda_sort<true>
+{};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_CUDA()
+
+#endif // _CUDA_STD___PSTL_CUDA_SORT_H
@@ -45,6 +45,8 @@ enum class __pstl_algorithm
   __partition_copy,
   __reduce,
   __remove_if,
+  __sort,
+  __stable_sort,
   __transform,
   __transform_reduce,
   __unique,
@@ -73,6 +75,16 @@ template <__pstl_algorithm _Algorithm, __execution_backend _Backend>
 inline constexpr bool __pstl_can_dispatch<__pstl_dispatch<_Algorithm, _Backend>> =
   !::cuda::std::is_base_of_v<__pstl_no_dispatch, __pstl_dispatch<_Algorithm, _Backend>>;
 
+//! @brief The backend that runs the standard parallel policies, which do not select a backend themselves. The TBB
+//! backend needs to be requested explicitly, so it takes precedence over the OpenMP backend.
+#if _CCCL_HAS_BACKEND_TBB()
+inline constexpr __execution_backend __pstl_default_cpu_backend = __execution_backend::__tbb;
+#elif _CCCL_HAS_BACKEND_OMP()
+inline constexpr __execution_backend __pstl_default_cpu_backend = __execution_backend::__omp;
+#else // ^^^ _CCCL_HAS_BACKEND_OMP() ^^^ / vvv !_CCCL_HAS_CPU_BACKEND() vvv
+inline constexpr __execution_backend __pstl_default_cpu_backend = __execution_backend::__none;
+#endif // !_CCCL_HAS_CPU_BACKEND()
+
 _CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
 
 //! @brief Top layer dispatcher that returns a concrete dispatch if possible
@@ -87,6 +99,13 @@ template <__pstl_algorithm _Algorithm, class _Policy>
   {
     return __pstl_dispatch<_Algorithm, __backend>{};
   }
+  // The standard parallel policies run on the CPU backend, if there is one
+  else if constexpr (__backend == __execution_backend::__none
+                     && (static_cast<uint32_t>(_Policy::__get_policy())
+                         & static_cast<uint32_t>(__execution_policy::__parallel)))
+  {
+    return __pstl_dispatch<_Algorithm, __pstl_default_cpu_backend>{};
+  }
   else
   {
     // No dispatch found, return invalid to signal serial execution
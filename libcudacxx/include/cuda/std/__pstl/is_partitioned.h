@@ -40,6 +40,10 @@
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_CPU_BACKEND()
+#    include <cuda/std/__pstl/cpu/find_if.h>
+#  endif // _CCCL_HAS_CPU_BACKEND()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -50,7 +54,7 @@ struct __is_partitioned_fn
   _UnaryPred __pred_;
 
   template <class _Tuple>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr bool operator()(const _Tuple& __tuple) const
+  [[nodiscard]] _CCCL_API constexpr bool operator()(const _Tuple& __tuple) const
   {
     const bool __pred_lhs = __pred_(::cuda::std::get<0>(__tuple));
     const bool __pred_rhs = __pred_(::cuda::std::get<1>(__tuple));
@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_CPU_TRAITS_H
+#define _CUDA_STD___PSTL_OMP_CPU_TRAITS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__pstl/cpu/cpu_traits.h>
+#  include <cuda/std/cstddef>
+
+#  include <omp.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __cpu_traits<__execution_backend::__omp>
+{
+  [[nodiscard]] _CCCL_HOST_API static size_t __concurrency() noexcept
+  {
+    return static_cast<size_t>(::omp_get_max_threads());
+  }
+
+  template <class _Fn>
+  _CCCL_HOST_API static void __for_each_chunk(size_t __num_chunks, _Fn& __fn)
+  {
+    const auto __count = static_cast<ptrdiff_t>(__num_chunks);
+
+    // Chunks are handed out in order, which lets find_if skip the chunks behind a match
+    _CCCL_PRAGMA(omp parallel for schedule(dynamic, 1))
+    for (ptrdiff_t __chunk = 0; __chunk < __count; ++__chunk)
+    {
+      __fn(static_cast<size_t>(__chunk));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_CPU_TRAITS_H
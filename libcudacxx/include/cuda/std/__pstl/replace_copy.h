@@ -40,6 +40,10 @@
 #    include <cuda/std/__pstl/cuda/transform.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_CPU_BACKEND()
+#    include <cuda/std/__pstl/cpu/transform.h>
+#  endif // _CCCL_HAS_CPU_BACKEND()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -57,7 +61,7 @@ struct __replace_copy_select
   {}
 
   template <class _Up>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr _Tp operator()(const _Up& __val) const
+  [[nodiscard]] _CCCL_API constexpr _Tp operator()(const _Up& __val) const
     noexcept(is_nothrow_copy_constructible_v<_Tp>)
   {
     return __val == __old_value_ ? __new_value_ : static_cast<_Tp>(__val);
@@ -42,6 +42,10 @@
 #    include <cuda/std/__pstl/cuda/for_each_n.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
 
+#  if _CCCL_HAS_CPU_BACKEND()
+#    include <cuda/std/__pstl/cpu/for_each_n.h>
+#  endif // _CCCL_HAS_CPU_BACKEND()
+
 #  include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
@@ -62,7 +66,7 @@ struct __reverse_fn
       , __count_(__count)
   {}
 
-  _CCCL_DEVICE_API constexpr void operator()(const iter_difference_t<_InputIterator> __index) const noexcept
+  _CCCL_API constexpr void operator()(const iter_difference_t<_InputIterator> __index) const noexcept
   {
     ::cuda::std::iter_swap(__first_ + __index, __last_ + __index);
   }
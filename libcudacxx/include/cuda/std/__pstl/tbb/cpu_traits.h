@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_CPU_TRAITS_H
+#define _CUDA_STD___PSTL_TBB_CPU_TRAITS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__pstl/cpu/cpu_traits.h>
+#  include <cuda/std/cstddef>
+
+#  include <tbb/blocked_range.h>
+#  include <tbb/parallel_for.h>
+#  include <tbb/partitioner.h>
+#  include <tbb/task_arena.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <>
+struct __cpu_traits<__execution_backend::__tbb>
+{
+  [[nodiscard]] _CCCL_HOST_API static size_t __concurrency() noexcept
+  {
+    return static_cast<size_t>(::tbb::this_task_arena::max_concurrency());
+  }
+
+  template <class _Fn>
+  _CCCL_HOST_API static void __for_each_chunk(size_t __num_chunks, _Fn& __fn)
+  {
+    // The chunks are already sized for the arena, so every chunk becomes a task of its own
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<size_t>{0, __num_chunks, 1},
+      [&__fn](const ::tbb::blocked_range<size_t>& __range) {
+        for (size_t __chunk = __range.begin(); __chunk != __range.end(); ++__chunk)
+        {
+          __fn(__chunk);
+        }
+      },
+      ::tbb::simple_partitioner{});
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_CPU_TRAITS_H
@@ -20,9 +20,12 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__limits/numeric_limits.h>
 #include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
 
 #if !_CCCL_COMPILER(NVRTC)
 #  include <ios>
@@ -95,6 +98,30 @@ public:
     return ::cuda::std::generate_canonical<double, numeric_limits<double>::digits>(__g) < __p.p();
   }
 
+  // Fills __out with values of the distribution, comparing a chunk of uniform values at a time
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void operator()(_URng& __g, span<result_type, _Extent> __out) noexcept
+  {
+    (*this)(__g, __out, __p_);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void operator()(_URng& __g, span<result_type, _Extent> __out, const param_type& __p) noexcept
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    double __u[__random_bulk_chunk_size] = {};
+    for (size_t __i = 0; __i < __out.size(); __i += __random_bulk_chunk_size)
+    {
+      const size_t __m = ::cuda::std::min(__out.size() - __i, __random_bulk_chunk_size);
+      ::cuda::std::__generate_canonical_n(__g, __u, __m);
+      for (size_t __j = 0; __j < __m; ++__j)
+      {
+        __out[__i + __j] = __u[__j] < __p.p();
+      }
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr double p() const noexcept
   {
@@ -25,6 +25,8 @@
 #include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__random/uniform_real_distribution.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
 
 #if !_CCCL_COMPILER(NVRTC)
 #  include <iosfwd>
@@ -103,6 +105,23 @@ public:
          / __p.lambda();
   }
 
+  // Fills __out with values of the distribution, transforming a chunk of uniform values at a time
+  template <class _URng, size_t _Extent>
+  _CCCL_API void operator()(_URng& __g, span<result_type, _Extent> __out)
+  {
+    (*this)(__g, __out, __p_);
+  }
+  template <class _URng, size_t _Extent>
+  _CCCL_API void operator()(_URng& __g, span<result_type, _Extent> __out, const param_type& __p)
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    ::cuda::std::__generate_canonical_n(__g, __out.data(), __out.size());
+    for (auto& __x : __out)
+    {
+      __x = -::cuda::std::log(result_type{1} - __x) / __p.lambda();
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr result_type lambda() const noexcept
   {
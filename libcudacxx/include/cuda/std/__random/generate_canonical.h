@@ -20,8 +20,11 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/__random/generate_random.h>
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__bit/integral.h>
 #include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -49,6 +52,65 @@ template <class _RealType, size_t __bits, class _URng>
   return __sp / __base;
 }
 
+// The bulk overloads of operator() of the distributions work on chunks of this many engine values, which are small
+// enough to live on the stack
+inline constexpr size_t __random_bulk_chunk_size = 256;
+
+// Fills [__first, __first + __n) with the next __n values of __g, with cuda::generate_random for the engines that it
+// fills ranges with in bulk
+_CCCL_EXEC_CHECK_DISABLE
+template <class _URng>
+_CCCL_API constexpr void __generate_bits(_URng& __g, typename _URng::result_type* __first, size_t __n)
+{
+  if constexpr (::cuda::__has_bulk_generate_v<_URng>)
+  {
+    ::cuda::generate_random(__first, __first + __n, __g);
+  }
+  else
+  {
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      __first[__i] = __g();
+    }
+  }
+}
+
+// Fills [__first, __first + __n) with as many values of generate_canonical<_RealType, digits>. The engine values are
+// drawn a chunk at a time, so that the conversion is a loop the compiler can vectorize.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _RealType, class _URng>
+_CCCL_API constexpr void __generate_canonical_n(_URng& __g, _RealType* __first, size_t __n)
+{
+  using _Bits                = typename _URng::result_type;
+  constexpr size_t __b       = numeric_limits<_RealType>::digits;
+  const size_t __log_r       = ::cuda::std::__bit_log2<uint64_t>((_URng::max) () - (_URng::min) () + uint64_t(1));
+  const size_t __k           = __b / __log_r + (__b % __log_r != 0);
+  const _RealType __rp       = static_cast<_RealType>((_URng::max) () - (_URng::min) ()) + _RealType(1);
+  const size_t __chunk_count = __random_bulk_chunk_size / __k;
+
+  _Bits __bits[__random_bulk_chunk_size] = {};
+  while (__n != 0)
+  {
+    const size_t __m = ::cuda::std::min(__n, __chunk_count);
+    ::cuda::std::__generate_bits(__g, __bits, __m * __k);
+
+    for (size_t __i = 0; __i < __m; ++__i)
+    {
+      const _Bits* __digits = __bits + __i * __k;
+      _RealType __base      = __rp;
+      _RealType __sp        = static_cast<_RealType>(__digits[0] - (_URng::min) ());
+      for (size_t __j = 1; __j < __k; ++__j, __base *= __rp)
+      {
+        __sp += static_cast<_RealType>(__digits[__j] - (_URng::min) ()) * __base;
+      }
+      __first[__i] = __sp / __base;
+    }
+
+    __first += __m;
+    __n -= __m;
+  }
+}
+
 _CCCL_END_NAMESPACE_CUDA_STD
 
 #include <cuda/std/__cccl/epilogue.h>
@@ -20,11 +20,15 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__cmath/logarithms.h>
 #include <cuda/std/__cmath/roots.h>
 #include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__random/uniform_real_distribution.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
 
 #if !_CCCL_COMPILER(NVRTC)
 #  include <ios>
@@ -134,6 +138,64 @@ public:
     return __up * __p.stddev() + __p.mean();
   }
 
+  // Fills __out with values of the distribution, with the polar method of the scalar operator() on a chunk of uniform
+  // values at a time. Every pair of uniform values is transformed, and the pairs outside of the unit circle are dropped
+  // by not advancing the output position, so that the loop has no branches. The values are not the ones of as many
+  // calls of the scalar operator(), but an unused value is kept for the next call the same way.
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void operator()(_URng& __g, span<result_type, _Extent> __out)
+  {
+    (*this)(__g, __out, __p_);
+  }
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void operator()(_URng& __g, span<result_type, _Extent> __out, const param_type& __p)
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    result_type* __first = __out.data();
+    size_t __n           = __out.size();
+    if (__n != 0 && __v_hot_)
+    {
+      __v_hot_ = false;
+      *__first = __v_ * __p.stddev() + __p.mean();
+      ++__first;
+      --__n;
+    }
+
+    result_type __u[__random_bulk_chunk_size] = {};
+    result_type __z[__random_bulk_chunk_size] = {};
+    while (__n != 0)
+    {
+      // about 4 of 5 pairs are in the unit circle
+      const size_t __m = ::cuda::std::min(__random_bulk_chunk_size, (__n + 1) / 2 * 2);
+      ::cuda::std::__generate_canonical_n(__g, __u, __m);
+
+      size_t __k = 0;
+      for (size_t __i = 0; __i < __m; __i += 2)
+      {
+        const result_type __x  = 2 * __u[__i] - 1;
+        const result_type __y  = 2 * __u[__i + 1] - 1;
+        const result_type __s  = __x * __x + __y * __y;
+        const result_type __fp = ::cuda::std::sqrt(-2 * ::cuda::std::log(__s) / __s);
+        __z[__k]               = __x * __fp;
+        __z[__k + 1]           = __y * __fp;
+        __k += (__s <= 1 && __s != 0) ? 2 : 0;
+      }
+
+      const size_t __count = ::cuda::std::min(__k, __n);
+      for (size_t __i = 0; __i < __count; ++__i)
+      {
+        __first[__i] = __z[__i] * __p.stddev() + __p.mean();
+      }
+      if (__k > __n)
+      {
+        __v_     = __z[__n];
+        __v_hot_ = true;
+      }
+      __first += __count;
+      __n -= __count;
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr result_type mean() const noexcept
   {
@@ -24,6 +24,7 @@
 #include <cuda/__cmath/mul_hi.h>
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__random/is_seed_sequence.h>
+#include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/make_nbit_int.h>
 #include <cuda/std/__utility/pair.h>
 #include <cuda/std/array>
@@ -287,6 +288,31 @@ public:
     }
   }
 
+  // Fills [__first, __last) with the values that as many calls of operator() would return, and leaves the engine in
+  // the same state as those calls. Whole blocks of word_count values are generated __lane_count counters at a time,
+  // which lets the compiler vectorize the rounds on the host. This is not part of the standard interface; it backs
+  // cuda::generate_random.
+  template <class _RandomAccessIterator>
+  _CCCL_API constexpr void __generate(_RandomAccessIterator __first, _RandomAccessIterator __last)
+  {
+    // use up the values left from the last block
+    for (; __first != __last && __j_ != word_count - 1; ++__first)
+    {
+      *__first = (*this)();
+    }
+
+    constexpr auto __batch = static_cast<ptrdiff_t>(__lane_count * word_count);
+    for (; __last - __first >= __batch; __first += __batch)
+    {
+      __philox_lanes(__first);
+    }
+
+    for (; __first != __last; ++__first)
+    {
+      *__first = (*this)();
+    }
+  }
+
   //! This function checks two philox_engines for equality.
   //! @param lhs The first philox_engine to test.
   //! @param rhs The second philox_engine to test.
@@ -467,52 +493,129 @@ private:
     return pair{__hi & max(), __lo & max()};
   }
 
-  static _CCCL_API constexpr auto __mulhilo(result_type __a, result_type __b) noexcept
+  // The high and low word of __a * __b as _Word, which is result_type or the narrower type of the lanes of
+  // __philox_lanes
+  template <class _Word>
+  static _CCCL_API constexpr auto __mulhilo(_Word __a, result_type __b) noexcept
   {
-    if constexpr (word_size == 32 || word_size == 64)
+    if constexpr (word_size == 32)
+    {
+      // a single widening multiplication, which also vectorizes
+      const auto __product = static_cast<uint64_t>(static_cast<uint32_t>(__a)) * static_cast<uint32_t>(__b);
+      return pair{static_cast<_Word>(__product >> 32), static_cast<_Word>(static_cast<uint32_t>(__product))};
+    }
+    else if constexpr (word_size == 64)
     {
       using _Up       = __make_nbit_uint_t<word_size>;
-      auto __hi       = static_cast<result_type>(::cuda::mul_hi(static_cast<_Up>(__a), static_cast<_Up>(__b)));
-      const auto __lo = (__a * __b) & max();
+      auto __hi       = static_cast<_Word>(::cuda::mul_hi(static_cast<_Up>(__a), static_cast<_Up>(__b)));
+      const auto __lo = static_cast<_Word>((__a * __b) & max());
       return pair{__hi, __lo};
     }
     else
     {
-      return __mulhilo_fallback(__a, __b);
+      const auto [__hi, __lo] = __mulhilo_fallback(__a, __b);
+      return pair{static_cast<_Word>(__hi), static_cast<_Word>(__lo)};
     }
   }
 
-  _CCCL_API constexpr void __philox() noexcept
+  // One round of the Philox permutation on the words of a counter
+  template <class _Word>
+  [[nodiscard]] _CCCL_API static constexpr array<_Word, word_count>
+  __round(const array<_Word, word_count>& __S, const array<result_type, word_count / 2>& __K) noexcept
   {
     // Only two variants are allowed, n=2 or n=4
+    if constexpr (word_count == 2)
+    {
+      auto [__hi, __lo] = __mulhilo(__S[0], multipliers[0]);
+      return {static_cast<_Word>(__hi ^ __K[0] ^ __S[1]), __lo};
+    }
+    else // word_count == 4
+    {
+      auto [__hi0, __lo0] = __mulhilo(__S[2], multipliers[0]);
+      auto [__hi2, __lo2] = __mulhilo(__S[0], multipliers[1]);
+      return {static_cast<_Word>(__hi0 ^ __K[0] ^ __S[1]), __lo0, static_cast<_Word>(__hi2 ^ __K[1] ^ __S[3]), __lo2};
+    }
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr array<result_type, word_count / 2>
+  __bump_key(const array<result_type, word_count / 2>& __K) noexcept
+  {
+    array<result_type, word_count / 2> __result = {};
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __i = 0; __i < word_count / 2; ++__i)
+    {
+      __result[__i] = (__K[__i] + round_consts[__i]) & max();
+    }
+    return __result;
+  }
+
+  _CCCL_API constexpr void __philox() noexcept
+  {
     array<result_type, word_count> __S     = __x_;
     array<result_type, word_count / 2> __K = __k_;
 
     _CCCL_PRAGMA_UNROLL_FULL()
     for (size_t __j = 0; __j < round_count; ++__j)
     {
-      // Only two variants are allowed, n=2 or n=4
-      if constexpr (word_count == 2)
+      __S = __round(__S, __K);
+      __K = __bump_key(__K);
+    }
+    __y_ = __S;
+  }
+
+  // The number of counters __philox_lanes encrypts at once
+  static constexpr size_t __lane_count = 16;
+
+  // The lanes of __philox_lanes store words of up to 32 bits in 32 bits, which fits twice as many into a vector
+  using __lane_type = conditional_t<(word_size <= 32), uint32_t, result_type>;
+
+  // Writes the blocks of the __lane_count counters starting at __x_ to __result and advances __x_ past them. The words
+  // of the counters are kept in separate arrays, so that every round is a loop over the lanes the compiler can
+  // vectorize.
+  template <class _RandomAccessIterator>
+  _CCCL_API constexpr void __philox_lanes(_RandomAccessIterator __result)
+  {
+    array<array<__lane_type, __lane_count>, word_count> __S = {};
+    for (size_t __l = 0; __l < __lane_count; ++__l)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __i = 0; __i < word_count; ++__i)
+      {
+        __S[__i][__l] = static_cast<__lane_type>(__x_[__i]);
+      }
+      __increment_counter();
+    }
+
+    array<result_type, word_count / 2> __K = __k_;
+    for (size_t __j = 0; __j < round_count; ++__j)
+    {
+      for (size_t __l = 0; __l < __lane_count; ++__l)
       {
-        auto [__hi, __lo] = __mulhilo(__S[0], multipliers[0]);
-        __S[0]            = __hi ^ __K[0] ^ __S[1];
-        __S[1]            = __lo;
-        __K[0]            = (__K[0] + round_consts[0]) & max();
+        array<__lane_type, word_count> __lane = {};
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __i = 0; __i < word_count; ++__i)
+        {
+          __lane[__i] = __S[__i][__l];
+        }
+        __lane = __round(__lane, __K);
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __i = 0; __i < word_count; ++__i)
+        {
+          __S[__i][__l] = __lane[__i];
+        }
       }
-      else // word_count == 4
+      __K = __bump_key(__K);
+    }
+
+    for (size_t __l = 0; __l < __lane_count; ++__l)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __i = 0; __i < word_count; ++__i)
       {
-        array<result_type, word_count> __V = {__S[2], __S[1], __S[0], __S[3]};
-        auto [__hi0, __lo0]                = __mulhilo(__V[0], multipliers[0]);
-        auto [__hi2, __lo2]                = __mulhilo(__V[2], multipliers[1]);
-        __S[0]                             = __hi0 ^ __K[0] ^ __V[1];
-        __S[1]                             = __lo0;
-        __S[2]                             = __hi2 ^ __K[1] ^ __V[3];
-        __S[3]                             = __lo2;
-        __K[0]                             = (__K[0] + round_consts[0]) & max();
-        __K[1]                             = (__K[1] + round_consts[1]) & max();
+        __y_[__i]                                                = __S[__i][__l];
+        __result[static_cast<ptrdiff_t>(__l * word_count + __i)] = __y_[__i];
       }
     }
-    __y_ = __S;
   }
 
   // The counter X, a big integer stored as word_count w-bit words.
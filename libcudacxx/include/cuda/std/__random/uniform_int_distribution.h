@@ -20,14 +20,18 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__bit/countl.h>
 #include <cuda/std/__bit/integral.h>
 #include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/make_unsigned.h>
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
+#include <cuda/std/span>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -257,6 +261,79 @@ public:
     return static_cast<result_type>(__u + __p.a());
   }
 
+  // Fills __out with values of the distribution.
+  //
+  // For engines that produce 32 uniform bits and result types of at most 32 bits, every engine value is mapped to the
+  // range with Lemire's nearly divisionless method: the high word of the product of the value and the size of the range
+  // is the result, unless the low word is below (2^32 - size) % size, which rejects the few values that would make it
+  // biased. A chunk of engine values is mapped in a loop without branches the compiler can vectorize, and the rejected
+  // values are replaced afterwards. 64-bit words need a 128-bit product per value that does not vectorize and is slower
+  // than the masking of the scalar operator(), which the other engines and the full range of result_type use.
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void operator()(_URng& __g, span<result_type, _Extent> __out) noexcept
+  {
+    (*this)(__g, __out, __p_);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void operator()(_URng& __g, span<result_type, _Extent> __out, const param_type& __p) noexcept
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    using _UIntType = conditional_t<sizeof(result_type) <= sizeof(uint32_t), uint32_t, make_unsigned_t<result_type>>;
+    using _Bits     = typename _URng::result_type;
+
+    constexpr bool __bits32 = (_URng::min) () == 0 && (_URng::max) () == numeric_limits<uint32_t>::max();
+
+    const _UIntType __rp = _UIntType(__p.b()) - _UIntType(__p.a()) + _UIntType(1);
+    if constexpr (__bits32 && sizeof(_UIntType) <= sizeof(uint32_t))
+    {
+      using _Word = uint32_t;
+      if (__rp > 1)
+      {
+        const _Word __range     = static_cast<_Word>(__rp);
+        const _Word __threshold = static_cast<_Word>(_Word{0} - __range) % __range;
+        const _UIntType __a     = _UIntType(__p.a());
+
+        _Bits __bits[__random_bulk_chunk_size] = {};
+        for (size_t __i = 0; __i < __out.size(); __i += __random_bulk_chunk_size)
+        {
+          const size_t __m     = ::cuda::std::min(__out.size() - __i, __random_bulk_chunk_size);
+          result_type* __chunk = __out.data() + __i;
+          ::cuda::std::__generate_bits(__g, __bits, __m);
+
+          size_t __rejected = 0;
+          for (size_t __j = 0; __j < __m; ++__j)
+          {
+            const _Word __x = static_cast<_Word>(__bits[__j]);
+            __chunk[__j]    = static_cast<result_type>(_UIntType(::cuda::mul_hi(__x, __range)) + __a);
+            __rejected += static_cast<_Word>(__x * __range) < __threshold;
+          }
+
+          for (size_t __j = 0; __rejected != 0 && __j < __m; ++__j)
+          {
+            _Word __x = static_cast<_Word>(__bits[__j]);
+            if (static_cast<_Word>(__x * __range) < __threshold)
+            {
+              --__rejected;
+              do
+              {
+                __x = static_cast<_Word>(__g());
+              } while (static_cast<_Word>(__x * __range) < __threshold);
+              __chunk[__j] = static_cast<result_type>(_UIntType(::cuda::mul_hi(__x, __range)) + __a);
+            }
+          }
+        }
+        return;
+      }
+    }
+
+    for (auto& __x : __out)
+    {
+      __x = (*this)(__g, __p);
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr result_type a() const noexcept
   {
@@ -23,6 +23,8 @@
 #include <cuda/std/__limits/numeric_limits.h>
 #include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
 
 #if !_CCCL_COMPILER(NVRTC)
 #  include <iosfwd>
@@ -106,6 +108,28 @@ public:
          + __p.a();
   }
 
+  // Fills __out with values of the distribution, converting a chunk of engine values at a time
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void operator()(_URng& __g, span<result_type, _Extent> __out) noexcept
+  {
+    (*this)(__g, __out, __p_);
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void operator()(_URng& __g, span<result_type, _Extent> __out, const param_type& __p) noexcept
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    ::cuda::std::__generate_canonical_n(__g, __out.data(), __out.size());
+
+    const result_type __a     = __p.a();
+    const result_type __scale = __p.b() - __p.a();
+    for (auto& __x : __out)
+    {
+      __x = __scale * __x + __a;
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr result_type a() const noexcept
   {
@@ -134,6 +134,59 @@ _CCCL_API inline void __cccl_thread_sleep_for(::cuda::std::chrono::nanoseconds _
     ;
 }
 
+#  if defined(__linux__)
+#    define _LIBCUDACXX_HAS_FUTEX 1
+
+// Futex
+
+// Blocks while *__addr == __expected, until woken up or for at most __timeout
+_CCCL_API inline void __cccl_futex_wait(int* __addr, int __expected, ::cuda::std::chrono::nanoseconds __timeout)
+{
+  const auto __ts = __cccl_to_timespec(__timeout);
+  syscall(SYS_futex, __addr, FUTEX_WAIT_PRIVATE, __expected, &__ts, nullptr, 0);
+}
+
+// Returns the CLOCK_MONOTONIC time that lies __timeout in the future, as expected by __cccl_futex_wait_until
+_CCCL_API inline timespec __cccl_futex_deadline(::cuda::std::chrono::nanoseconds __timeout)
+{
+  constexpr auto __ts_sec_max = numeric_limits<time_t>::max();
+
+  timespec __deadline{};
+  clock_gettime(CLOCK_MONOTONIC, &__deadline);
+
+  const auto __ts = __cccl_to_timespec(__timeout);
+  if (__ts.tv_sec >= __ts_sec_max - __deadline.tv_sec)
+  {
+    __deadline.tv_sec  = __ts_sec_max;
+    __deadline.tv_nsec = 999999999;
+    return __deadline;
+  }
+
+  __deadline.tv_sec += __ts.tv_sec;
+  __deadline.tv_nsec += __ts.tv_nsec;
+  if (__deadline.tv_nsec >= 1000000000)
+  {
+    ++__deadline.tv_sec;
+    __deadline.tv_nsec -= 1000000000;
+  }
+  return __deadline;
+}
+
+// Blocks while *__addr == __expected, until woken up or until the CLOCK_MONOTONIC time __deadline. Returns false if
+// the deadline has passed.
+_CCCL_API inline bool __cccl_futex_wait_until(int* __addr, int __expected, const timespec& __deadline)
+{
+  return syscall(SYS_futex, __addr, FUTEX_WAIT_BITSET_PRIVATE, __expected, &__deadline, nullptr, FUTEX_BITSET_MATCH_ANY)
+         != -1
+      || errno != ETIMEDOUT;
+}
+
+_CCCL_API inline void __cccl_futex_wake_all(int* __addr)
+{
+  syscall(SYS_futex, __addr, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+#  endif // __linux__
+
 _CCCL_END_NAMESPACE_CUDA_STD
 
 #  include <cuda/std/__cccl/epilogue.h>
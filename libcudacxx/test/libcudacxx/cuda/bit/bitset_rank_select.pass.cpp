@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the libcu++ Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/bit>
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+
+#include "test_macros.h"
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr void test(const cuda::std::bitset<N>& bits)
+{
+  const cuda::bitset_rank_select<N> rs(bits);
+  assert(rs.bits() == bits);
+  assert(rs.count() == bits.count());
+
+  cuda::std::size_t rank = 0;
+  for (cuda::std::size_t i = 0; i < N; ++i)
+  {
+    assert(rs.rank(i) == rank);
+    if (bits[i])
+    {
+      assert(rs.select(rank) == i);
+      ++rank;
+    }
+  }
+  assert(rs.rank(N) == rank);
+  assert(rs.select(rank) == N);
+  assert(rs.select(rank + 100) == N);
+}
+
+// bit i is set when i % stride is at most fill
+template <cuda::std::size_t N>
+__host__ __device__ constexpr void test(cuda::std::size_t stride, cuda::std::size_t fill)
+{
+  cuda::std::bitset<N> bits;
+  for (cuda::std::size_t i = 0; i < N; ++i)
+  {
+    bits[i] = i % stride <= fill;
+  }
+  test(bits);
+}
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr void test()
+{
+  test(cuda::std::bitset<N>());
+  test(~cuda::std::bitset<N>());
+  test<N>(3, 0);
+  test<N>(7, 4);
+  test<N>(N / 2 + 1, 0);
+}
+
+__host__ __device__ constexpr bool test()
+{
+  test(cuda::std::bitset<0>());
+  test<1>();
+  test<7>();
+  test<16>();
+  test<32>();
+  test<33>();
+  test<64>();
+  test<100>();
+
+  return true;
+}
+
+__host__ __device__ bool test_large()
+{
+  // several blocks, the last of them partial
+  test<512>();
+  test<1500>();
+  test<4096>();
+
+  // a single set bit after many clear words
+  cuda::std::bitset<3000> bits;
+  bits.set(2999);
+  test(bits);
+  bits.set(700);
+  test(bits);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  test_large(); // not in constexpr because of constexpr evaluation step limits
+  static_assert(test(), "");
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/random>
+
+#include <cuda/random>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_iterators.h"
+#include "test_macros.h"
+
+template <typename Engine, typename Iterator>
+__host__ __device__ TEST_CONSTEXPR_CXX20 void test_range(int offset, int length)
+{
+  Engine e1(17);
+  Engine e2(17);
+  e1.discard(offset);
+  e2.discard(offset);
+
+  typename Engine::result_type values[130] = {};
+  cuda::generate_random(Iterator(values), Iterator(values + length), e1);
+  for (int i = 0; i < length; ++i)
+  {
+    assert(values[i] == e2());
+  }
+  assert(e1 == e2);
+  assert(e1() == e2());
+}
+
+template <typename Engine>
+__host__ __device__ TEST_CONSTEXPR_CXX20 bool test_generate_random()
+{
+  using result_type = typename Engine::result_type;
+
+  // lengths around the blocks of 4 values and the batches of 16 blocks philox_engine works on
+  const int offsets[] = {0, 1, 3, 4, 63, 64, 65};
+  const int lengths[] = {0, 1, 2, 4, 5, 63, 64, 65, 130};
+  for (auto offset : offsets)
+  {
+    for (auto length : lengths)
+    {
+      test_range<Engine, result_type*>(offset, length);
+      test_range<Engine, forward_iterator<result_type*>>(offset, length);
+    }
+  }
+
+  Engine e;
+  result_type values[1] = {};
+  static_assert(cuda::std::is_void_v<decltype(cuda::generate_random(values, values + 1, e))>);
+  return true;
+}
+
+__host__ __device__ TEST_CONSTEXPR_CXX20 bool test_philox_counter_carry()
+{
+  // the counter is carried across words within a batch
+  cuda::std::philox4x32 e1(5);
+  cuda::std::philox4x32 e2(5);
+  e1.set_counter({0, 0, 0, cuda::std::numeric_limits<cuda::std::uint32_t>::max() - 2});
+  e2.set_counter({0, 0, 0, cuda::std::numeric_limits<cuda::std::uint32_t>::max() - 2});
+  cuda::std::philox4x32::result_type values[70] = {};
+  cuda::generate_random(values, values + 70, e1);
+  for (auto value : values)
+  {
+    assert(value == e2());
+  }
+  assert(e1 == e2);
+  return true;
+}
+
+__host__ __device__ TEST_CONSTEXPR_CXX20 bool test()
+{
+  test_generate_random<cuda::std::philox4x32>();
+  test_generate_random<cuda::std::philox4x64>();
+  test_generate_random<cuda::pcg64>();
+  test_generate_random<cuda::std::minstd_rand>();
+  test_philox_counter_carry();
+
+  static_assert(cuda::__has_bulk_generate_v<cuda::std::philox4x32>);
+  static_assert(cuda::__has_bulk_generate_v<cuda::pcg64>);
+  static_assert(!cuda::__has_bulk_generate_v<cuda::std::minstd_rand>);
+  return true;
+}
+
+// a few ranges only, the exhaustive test takes too many steps to be constant evaluated
+__host__ __device__ TEST_CONSTEXPR_CXX20 bool test_constexpr()
+{
+  test_range<cuda::std::philox4x32, cuda::std::philox4x32::result_type*>(1, 130);
+  test_range<cuda::std::philox4x64, cuda::std::philox4x64::result_type*>(1, 65);
+  test_range<cuda::pcg64, cuda::pcg64::result_type*>(1, 65);
+  test_philox_counter_carry();
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+#if TEST_STD_VER >= 2020
+  static_assert(test_constexpr());
+#endif // TEST_STD_VER >= 2020
+  return 0;
+}
@@ -121,6 +121,36 @@ __host__ __device__ constexpr bool test_against_reference()
   return true;
 }
 
+__host__ __device__ constexpr bool test_generate()
+{
+  // lengths around the 4 interleaved steps generate works on
+  constexpr int offsets[] = {0, 1, 3};
+  constexpr int lengths[] = {0, 1, 2, 3, 4, 5, 8, 9, 31};
+  for (auto offset : offsets)
+  {
+    for (auto length : lengths)
+    {
+      cuda::pcg64 e1(17);
+      cuda::pcg64 e2(17);
+      e1.discard(offset);
+      e2.discard(offset);
+
+      cuda::std::uint64_t values[31] = {};
+      e1.generate(values, values + length);
+      for (int i = 0; i < length; ++i)
+      {
+        assert(values[i] == e2());
+      }
+      assert(e1 == e2);
+    }
+  }
+
+  cuda::pcg64 e;
+  cuda::std::uint64_t values[1] = {};
+  static_assert(cuda::std::is_void_v<decltype(e.generate(values, values + 1))>);
+  return true;
+}
+
 int main(int, char**)
 {
 #if _CCCL_HAS_INT128()
@@ -129,5 +159,7 @@ int main(int, char**)
 
   test_engine<cuda::pcg64, 11135645891219275043ul>();
   test_against_reference();
+  test_generate();
+  static_assert(test_generate());
   return 0;
 }
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+// ForwardIterator2 copy(ExecutionPolicy&& exec,
+//                       ForwardIterator1 first, ForwardIterator1 last,
+//                       ForwardIterator2 result);
+// template<class ExecutionPolicy, class ForwardIterator1, class Size, class ForwardIterator2>
+// ForwardIterator2 copy_n(ExecutionPolicy&& exec, ForwardIterator1 first, Size n, ForwardIterator2 result);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+#include "test_iterators.h"
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+template <class Policy>
+void test_copy(const Policy& policy, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    const auto res =
+      cuda::std::copy(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+    CHECK(res == nullptr);
+  }
+
+  {
+    cuda::std::fill(policy, output.begin(), output.end(), -1);
+    const auto res = cuda::std::copy(policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, output.begin());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::counting_iterator{0}));
+    CHECK(res == output.end());
+  }
+
+  { // with conversion
+    cuda::std::fill(policy, output.begin(), output.end(), -1);
+    const auto res = cuda::std::copy_n(policy, cuda::counting_iterator{0ll}, size - 1, output.begin());
+    CHECK(thrust::equal(output.begin(), output.end() - 1, cuda::counting_iterator{0}));
+    CHECK(output.back() == -1);
+    CHECK(res == output.end() - 1);
+  }
+
+  { // non contiguous output
+    cuda::std::fill(policy, output.begin(), output.end(), -1);
+    auto* ptr      = output.data();
+    const auto res = cuda::std::copy(
+      policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, random_access_iterator{ptr});
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::counting_iterator{0}));
+    CHECK(res == random_access_iterator{ptr + size});
+  }
+}
+
+C2H_TEST("cuda::std::copy on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> output(size);
+
+  SECTION("with par")
+  {
+    test_copy(cuda::std::execution::par, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_copy(cuda::std::execution::par_unseq, output);
+  }
+}
@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template <class Policy, class InputIterator, class OutputIterator>
+// void copy_if(const Policy&  policy,
+//              InputIterator  first,
+//              InputIterator  last,
+//              OutoutIterator result);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+#include "test_iterators.h"
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct is_even
+{
+  constexpr bool operator()(const int& val) const noexcept
+  {
+    return (val % 2) == 0;
+  }
+};
+
+template <class Policy>
+void test_copy_if(const Policy& policy, const thrust::host_vector<int>& input, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    const auto res = cuda::std::copy_if(
+      policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), static_cast<int*>(nullptr), is_even{});
+    CHECK(res == nullptr);
+  }
+
+  { // the selected elements keep their order
+    cuda::std::fill(policy, output.begin(), output.end(), -1);
+    const auto res = cuda::std::copy_if(policy, input.begin(), input.end(), output.begin(), is_even{});
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+    CHECK(res == output.end());
+  }
+
+  { // with a fancy iterator
+    cuda::std::fill(policy, output.begin(), output.end(), -1);
+    const auto res = cuda::std::copy_if(
+      policy, cuda::counting_iterator{short{0}}, cuda::counting_iterator{short{20000}}, output.begin(), is_even{});
+    CHECK(thrust::equal(output.begin(), output.begin() + 10000, cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+    CHECK(res == output.begin() + 10000);
+  }
+
+  { // non contiguous input
+    cuda::std::fill(policy, output.begin(), output.end(), -1);
+    const auto* ptr = input.data();
+    const auto res  = cuda::std::copy_if(
+      policy, random_access_iterator{ptr}, random_access_iterator{ptr + size}, output.begin(), is_even{});
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+    CHECK(res == output.end());
+  }
+}
+
+C2H_TEST("cuda::std::copy_if on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> input(size);
+  thrust::host_vector<int> output(size / 2);
+  thrust::sequence(input.begin(), input.end(), 0);
+
+  SECTION("with par")
+  {
+    test_copy_if(cuda::std::execution::par, input, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_copy_if(cuda::std::execution::par_unseq, input, output);
+  }
+}
@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class T>
+// void fill(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, const T& value);
+// template<class ExecutionPolicy, class ForwardIterator, class Size, class T>
+// ForwardIterator fill_n(ExecutionPolicy&& exec, ForwardIterator first, Size n, const T& value);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/count.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+template <class Policy>
+void test_fill(const Policy& policy, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    cuda::std::fill(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), 42);
+  }
+
+  {
+    cuda::std::fill(policy, output.begin(), output.end(), 42);
+    CHECK(thrust::count(output.begin(), output.end(), 42) == size);
+  }
+
+  {
+    const auto res = cuda::std::fill_n(policy, output.begin(), size - 1, 1337);
+    CHECK(res == output.end() - 1);
+    CHECK(thrust::count(output.begin(), output.end(), 1337) == size - 1);
+    CHECK(output.back() == 42);
+  }
+}
+
+C2H_TEST("cuda::std::fill on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> output(size);
+
+  SECTION("with par")
+  {
+    test_fill(cuda::std::execution::par, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_fill(cuda::std::execution::par_unseq, output);
+  }
+}
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class Generator>
+// void generate(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, Generator gen);
+// template<class ExecutionPolicy, class ForwardIterator, class Size, class Generator>
+// ForwardIterator generate_n(ExecutionPolicy&& exec, ForwardIterator first, Size n, Generator gen);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/count.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct gen_val
+{
+  int val;
+
+  constexpr int operator()() const noexcept
+  {
+    return val;
+  }
+};
+
+template <class Policy>
+void test_generate(const Policy& policy, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    cuda::std::generate(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), gen_val{42});
+  }
+
+  {
+    cuda::std::generate(policy, output.begin(), output.end(), gen_val{42});
+    CHECK(thrust::count(output.begin(), output.end(), 42) == size);
+  }
+
+  {
+    const auto res = cuda::std::generate_n(policy, output.begin(), size - 1, gen_val{1337});
+    CHECK(res == output.end() - 1);
+    CHECK(thrust::count(output.begin(), output.end(), 1337) == size - 1);
+    CHECK(output.back() == 42);
+  }
+}
+
+C2H_TEST("cuda::std::generate on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> output(size);
+
+  SECTION("with par")
+  {
+    test_generate(cuda::std::execution::par, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_generate(cuda::std::execution::par_unseq, output);
+  }
+}
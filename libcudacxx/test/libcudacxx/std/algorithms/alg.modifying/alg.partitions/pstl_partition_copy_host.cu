@@ -0,0 +1,88 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class ForwardIterator1, class ForwardIterator2,
+//          class Predicate>
+// pair<ForwardIterator1, ForwardIterator2> partition_copy(ExecutionPolicy&& exec,
+//                                                         ForwardIterator first,
+//                                                         ForwardIterator last,
+//                                                         ForwardIterator1 out_true,
+//                                                         ForwardIterator2 out_false,
+//                                                         Predicate pred);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct is_even
+{
+  constexpr bool operator()(const int& val) const noexcept
+  {
+    return (val % 2) == 0;
+  }
+};
+
+template <class Policy>
+void test_partition_copy(
+  const Policy& policy, thrust::host_vector<int>& output_true, thrust::host_vector<int>& output_false)
+{
+  { // empty should not access anything
+    const auto res = cuda::std::partition_copy(
+      policy,
+      static_cast<int*>(nullptr),
+      static_cast<int*>(nullptr),
+      static_cast<int*>(nullptr),
+      static_cast<int*>(nullptr),
+      is_even{});
+    CHECK(res.first == nullptr);
+    CHECK(res.second == nullptr);
+  }
+
+  { // both outputs keep the order of the input
+    const auto res = cuda::std::partition_copy(
+      policy,
+      cuda::counting_iterator{0},
+      cuda::counting_iterator{size},
+      output_true.begin(),
+      output_false.begin(),
+      is_even{});
+    CHECK(res.first == output_true.end());
+    CHECK(res.second == output_false.end());
+    CHECK(thrust::equal(output_true.begin(), output_true.end(), cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+    CHECK(
+      thrust::equal(output_false.begin(), output_false.end(), cuda::strided_iterator{cuda::counting_iterator{1}, 2}));
+  }
+}
+
+C2H_TEST("cuda::std::partition_copy on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> output_true(size / 2);
+  thrust::host_vector<int> output_false(size / 2);
+
+  SECTION("with par")
+  {
+    test_partition_copy(cuda::std::execution::par, output_true, output_false);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_partition_copy(cuda::std::execution::par_unseq, output_true, output_false);
+  }
+}
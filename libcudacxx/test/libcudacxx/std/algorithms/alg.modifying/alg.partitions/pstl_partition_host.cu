@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class Predicate>
+// ForwardIterator partition(ExecutionPolicy&& exec,
+//                           ForwardIterator first,
+//                           ForwardIterator last,
+//                           Predicate pred);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct is_even
+{
+  constexpr bool operator()(const int& val) const noexcept
+  {
+    return (val % 2) == 0;
+  }
+};
+
+struct less_than
+{
+  int bound;
+
+  constexpr bool operator()(const int& val) const noexcept
+  {
+    return val < bound;
+  }
+};
+
+template <class Policy>
+void test_partition(const Policy& policy, thrust::host_vector<int>& data)
+{
+  { // empty should not access anything
+    const auto res = cuda::std::partition(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), is_even{});
+    CHECK(res == nullptr);
+  }
+
+  {
+    thrust::sequence(data.begin(), data.end(), 0);
+    const auto res = cuda::std::partition(policy, data.begin(), data.end(), is_even{});
+    CHECK(res == data.begin() + size / 2);
+    CHECK(cuda::std::is_partitioned(policy, data.begin(), data.end(), is_even{}));
+    CHECK(cuda::std::count_if(policy, data.begin(), res, is_even{}) == size / 2);
+  }
+
+  { // every element in the first chunk is selected, none in the others
+    thrust::sequence(data.begin(), data.end(), 0);
+    const auto res = cuda::std::partition(policy, data.begin(), data.end(), less_than{10});
+    CHECK(res == data.begin() + 10);
+    CHECK(thrust::equal(data.begin(), res, cuda::counting_iterator{0}));
+  }
+
+  { // every element is selected
+    thrust::sequence(data.begin(), data.end(), 0);
+    const auto res = cuda::std::partition(policy, data.begin(), data.end(), less_than{size});
+    CHECK(res == data.end());
+    CHECK(thrust::equal(data.begin(), data.end(), cuda::counting_iterator{0}));
+  }
+}
+
+C2H_TEST("cuda::std::partition on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> data(size);
+
+  SECTION("with par")
+  {
+    test_partition(cuda::std::execution::par, data);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_partition(cuda::std::execution::par_unseq, data);
+  }
+}
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class Predicate>
+// ForwardIterator remove_if(ExecutionPolicy&& exec,
+//                           ForwardIterator first,
+//                           ForwardIterator last,
+//                           Predicate pred);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct is_odd
+{
+  constexpr bool operator()(const int& val) const noexcept
+  {
+    return (val % 2) == 1;
+  }
+};
+
+template <class Policy>
+void test_remove_if(const Policy& policy, thrust::host_vector<int>& data, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    const auto res = cuda::std::remove_if(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), is_odd{});
+    CHECK(res == nullptr);
+  }
+
+  { // the remaining elements keep their order
+    thrust::sequence(data.begin(), data.end(), 0);
+    const auto res = cuda::std::remove_if(policy, data.begin(), data.end(), is_odd{});
+    CHECK(res == data.begin() + size / 2);
+    CHECK(thrust::equal(data.begin(), res, cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+  }
+
+  {
+    thrust::sequence(data.begin(), data.end(), 0);
+    const auto res = cuda::std::remove(policy, data.begin(), data.end(), 42);
+    CHECK(res == data.end() - 1);
+    CHECK(thrust::equal(data.begin(), data.begin() + 42, cuda::counting_iterator{0}));
+    CHECK(thrust::equal(data.begin() + 42, res, cuda::counting_iterator{43}));
+  }
+
+  {
+    const auto res = cuda::std::remove_copy_if(
+      policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, output.begin(), is_odd{});
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+  }
+}
+
+C2H_TEST("cuda::std::remove_if on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> data(size);
+  thrust::host_vector<int> output(size / 2);
+
+  SECTION("with par")
+  {
+    test_remove_if(cuda::std::execution::par, data, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_remove_if(cuda::std::execution::par_unseq, data, output);
+  }
+}
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class T>
+// void replace(ExecutionPolicy&& exec,
+//              ForwardIterator first,
+//              ForwardIterator last,
+//              const T& old_value,
+//              const T& new_value);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/count.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct is_odd
+{
+  constexpr bool operator()(const int& val) const noexcept
+  {
+    return (val % 2) == 1;
+  }
+};
+
+template <class Policy>
+void test_replace(const Policy& policy, thrust::host_vector<int>& data)
+{
+  { // empty should not access anything
+    cuda::std::replace(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), 0, 1);
+  }
+
+  {
+    cuda::std::copy(policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, data.begin());
+    cuda::std::replace_if(policy, data.begin(), data.end(), is_odd{}, -1);
+    CHECK(thrust::count(data.begin(), data.end(), -1) == size / 2);
+    cuda::std::replace(policy, data.begin(), data.end(), -1, 1);
+    CHECK(thrust::count(data.begin(), data.end(), 1) == size / 2);
+  }
+
+  {
+    cuda::std::replace_copy(policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, data.begin(), 7, -7);
+    CHECK(data[7] == -7);
+    CHECK(data[size - 1] == size - 1);
+    CHECK(thrust::count(data.begin(), data.end(), -7) == 1);
+  }
+}
+
+C2H_TEST("cuda::std::replace on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> data(size);
+
+  SECTION("with par")
+  {
+    test_replace(cuda::std::execution::par, data);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_replace(cuda::std::execution::par_unseq, data);
+  }
+}
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class BidirectionalIterator>
+// void reverse(ExecutionPolicy&& exec, BidirectionalIterator first, BidirectionalIterator last);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/iterator>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100001;
+
+template <class Policy>
+void test_reverse(const Policy& policy, thrust::host_vector<int>& data, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    cuda::std::reverse(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+  }
+
+  { // odd number of elements
+    thrust::sequence(data.begin(), data.end(), 0);
+    cuda::std::reverse(policy, data.begin(), data.end());
+    CHECK(thrust::equal(data.begin(), data.end(), cuda::std::reverse_iterator{cuda::counting_iterator{size}}));
+  }
+
+  { // even number of elements
+    thrust::sequence(data.begin(), data.end(), 0);
+    cuda::std::reverse(policy, data.begin(), data.end() - 1);
+    CHECK(thrust::equal(data.begin(), data.end() - 1, cuda::std::reverse_iterator{cuda::counting_iterator{size - 1}}));
+    CHECK(data.back() == size - 1);
+  }
+
+  {
+    const auto res =
+      cuda::std::reverse_copy(policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, output.begin());
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::std::reverse_iterator{cuda::counting_iterator{size}}));
+  }
+}
+
+C2H_TEST("cuda::std::reverse on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> data(size);
+  thrust::host_vector<int> output(size);
+
+  SECTION("with par")
+  {
+    test_reverse(cuda::std::execution::par, data, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_reverse(cuda::std::execution::par_unseq, data, output);
+  }
+}
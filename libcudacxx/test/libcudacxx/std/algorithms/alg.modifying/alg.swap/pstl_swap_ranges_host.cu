@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template <class Policy, class InputIterator1, class InputIterator2>
+// InputIterator2 swap_ranges(const Policy&  policy,
+//                            InputIterator1 first1,
+//                            InputIterator1 last1,
+//                            InputIterator2 first2);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/count.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+template <class Policy>
+void test_swap_ranges(const Policy& policy, thrust::host_vector<int>& lhs, thrust::host_vector<int>& rhs)
+{
+  { // empty should not access anything
+    const auto res = cuda::std::swap_ranges(
+      policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+    CHECK(res == nullptr);
+  }
+
+  {
+    cuda::std::fill(policy, lhs.begin(), lhs.end(), 1);
+    cuda::std::fill(policy, rhs.begin(), rhs.end(), 2);
+    const auto res = cuda::std::swap_ranges(policy, lhs.begin(), lhs.end(), rhs.begin());
+    CHECK(res == rhs.end());
+    CHECK(thrust::count(lhs.begin(), lhs.end(), 2) == size);
+    CHECK(thrust::count(rhs.begin(), rhs.end(), 1) == size);
+  }
+}
+
+C2H_TEST("cuda::std::swap_ranges on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> lhs(size);
+  thrust::host_vector<int> rhs(size);
+
+  SECTION("with par")
+  {
+    test_swap_ranges(cuda::std::execution::par, lhs, rhs);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_swap_ranges(cuda::std::execution::par_unseq, lhs, rhs);
+  }
+}
@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class UnaryOperation>
+// ForwardIterator2 transform(ExecutionPolicy&& exec,
+//                            ForwardIterator1 first1, ForwardIterator1 last1,
+//                            ForwardIterator2 result, UnaryOperation op);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class ForwardIterator,
+//          class BinaryOperation>
+// ForwardIterator transform(ExecutionPolicy&& exec,
+//                           ForwardIterator1 first1, ForwardIterator1 last1,
+//                           ForwardIterator2 first2, ForwardIterator result,
+//                           BinaryOperation binary_op);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+
+#include <testing.cuh>
+
+#include "test_iterators.h"
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct times_two
+{
+  constexpr int operator()(const int val) const noexcept
+  {
+    return 2 * val;
+  }
+};
+
+template <class Policy>
+void test_transform(const Policy& policy, const thrust::host_vector<int>& input, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    const auto res = cuda::std::transform(
+      policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), static_cast<int*>(nullptr), times_two{});
+    CHECK(res == nullptr);
+  }
+
+  {
+    const auto res = cuda::std::transform(policy, input.begin(), input.end(), output.begin(), times_two{});
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+  }
+
+  { // binary
+    const auto res = cuda::std::transform(
+      policy, input.begin(), input.end(), cuda::counting_iterator{0}, output.begin(), cuda::std::plus<>{});
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+  }
+
+  { // non contiguous input
+    const auto* ptr = input.data();
+    const auto res  = cuda::std::transform(
+      policy, random_access_iterator{ptr}, random_access_iterator{ptr + size}, output.begin(), times_two{});
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+  }
+}
+
+C2H_TEST("cuda::std::transform on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> input(size);
+  thrust::host_vector<int> output(size);
+  thrust::sequence(input.begin(), input.end(), 0);
+
+  SECTION("with par")
+  {
+    test_transform(cuda::std::execution::par, input, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_transform(cuda::std::execution::par_unseq, input, output);
+  }
+}
@@ -0,0 +1,87 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator>
+// ForwardIterator unique(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+// ForwardIterator2 unique_copy(ExecutionPolicy&& exec,
+//                              ForwardIterator1 first, ForwardIterator1 last,
+//                              ForwardIterator2 result);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+// every value repeats three times, so runs of equal elements cross the chunk boundaries
+struct div_three
+{
+  constexpr int operator()(const int val) const noexcept
+  {
+    return val / 3;
+  }
+};
+
+template <class Policy>
+void test_unique(const Policy& policy, thrust::host_vector<int>& data, thrust::host_vector<int>& output)
+{
+  constexpr int num_unique = (size + 2) / 3;
+
+  { // empty should not access anything
+    const auto res = cuda::std::unique(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+    CHECK(res == nullptr);
+  }
+
+  {
+    cuda::std::transform(policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, data.begin(), div_three{});
+    const auto res = cuda::std::unique(policy, data.begin(), data.end());
+    CHECK(res == data.begin() + num_unique);
+    CHECK(thrust::equal(data.begin(), res, cuda::counting_iterator{0}));
+  }
+
+  {
+    const auto first = cuda::transform_iterator{cuda::counting_iterator{0}, div_three{}};
+    const auto res   = cuda::std::unique_copy(policy, first, first + size, output.begin());
+    CHECK(res == output.begin() + num_unique);
+    CHECK(thrust::equal(output.begin(), res, cuda::counting_iterator{0}));
+  }
+
+  { // no duplicates
+    const auto res =
+      cuda::std::unique_copy(policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, output.begin());
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::counting_iterator{0}));
+  }
+}
+
+C2H_TEST("cuda::std::unique on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> data(size);
+  thrust::host_vector<int> output(size);
+
+  SECTION("with par")
+  {
+    test_unique(cuda::std::execution::par, data, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_unique(cuda::std::execution::par_unseq, data, output);
+  }
+}
@@ -44,6 +44,11 @@ void test_adjacent_find(const Policy& policy, const thrust::device_vector<int>&
     CHECK(*res == *(input.begin() + 41));
   }
 
+  { // no match returns last
+    auto res = cuda::std::adjacent_find(policy, input.begin(), input.begin() + 41);
+    CHECK(res == input.begin() + 41);
+  }
+
   { // non contiguous input
     auto* inptr = thrust::raw_pointer_cast(input.data());
     auto res    = cuda::std::adjacent_find(policy, random_access_iterator{inptr}, random_access_iterator{inptr + size});
@@ -0,0 +1,91 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class Policy, class InputIterator, class BinaryPredicate>
+// InputIterator adjacent_find(Policy policy,
+//                             InputIterator first,
+//                             InputIterator last,
+//                             BinaryPredicate pred)
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+
+#include <testing.cuh>
+
+#include "test_iterators.h"
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+template <class Policy>
+void test_adjacent_find(const Policy& policy, thrust::host_vector<int>& input)
+{
+  { // empty should not access anything
+    auto res = cuda::std::adjacent_find(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+    CHECK(res == static_cast<int*>(nullptr));
+  }
+
+  { // a single element has no adjacent pair
+    auto res = cuda::std::adjacent_find(policy, input.begin(), input.begin() + 1);
+    CHECK(res == input.begin() + 1);
+  }
+
+  { // no match returns last
+    auto res = cuda::std::adjacent_find(policy, input.begin(), input.end());
+    CHECK(res == input.end());
+  }
+
+  { // the first of several matches in different chunks
+    input[size - 10] = input[size - 11];
+    input[4242]      = input[4241];
+    auto res         = cuda::std::adjacent_find(policy, input.begin(), input.end());
+    CHECK(res == input.begin() + 4241);
+    input[4242] = 4243;
+  }
+
+  { // a match in the last chunk
+    auto res = cuda::std::adjacent_find(policy, input.begin() + size / 2, input.end());
+    CHECK(res == input.begin() + size - 11);
+    input[size - 10] = size - 9;
+  }
+
+  { // with a predicate
+    auto res = cuda::std::adjacent_find(policy, input.begin(), input.end(), cuda::std::greater<int>{});
+    CHECK(res == input.end());
+  }
+
+  { // non contiguous input
+    auto* inptr = input.data();
+    auto res    = cuda::std::adjacent_find(policy, random_access_iterator{inptr}, random_access_iterator{inptr + size});
+    CHECK(res == random_access_iterator{inptr + size});
+  }
+}
+
+C2H_TEST("cuda::std::adjacent_find on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> input(size);
+  thrust::sequence(input.begin(), input.end(), 1);
+
+  SECTION("with par")
+  {
+    test_adjacent_find(cuda::std::execution::par, input);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_adjacent_find(cuda::std::execution::par_unseq, input);
+  }
+}
@@ -47,6 +47,11 @@ void test_adjacent_find(const Policy& policy, const thrust::device_vector<int>&
     CHECK(*res == *(input.begin() + 42));
   }
 
+  { // no match returns last
+    auto res = cuda::std::adjacent_find(policy, input.begin(), input.begin() + 42, cuda::std::greater<>{});
+    CHECK(res == input.begin() + 42);
+  }
+
   { // non contiguous input
     auto* inptr = thrust::raw_pointer_cast(input.data());
     auto res    = cuda::std::adjacent_find(
@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class Predicate>
+// bool all_of(ExecutionPolicy&& exec,
+//             ForwardIterator first,
+//             ForwardIterator last,
+//             Predicate pred);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct less_than
+{
+  int bound;
+
+  constexpr bool operator()(const int val) const noexcept
+  {
+    return val < bound;
+  }
+};
+
+template <class Policy>
+void test_all_of(const Policy& policy, const thrust::host_vector<int>& input)
+{
+  { // empty should not access anything
+    CHECK(cuda::std::all_of(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), less_than{0}));
+  }
+
+  {
+    CHECK(cuda::std::all_of(policy, input.begin(), input.end(), less_than{size}));
+  }
+
+  { // only the last element fails
+    CHECK(!cuda::std::all_of(policy, input.begin(), input.end(), less_than{size - 1}));
+  }
+}
+
+C2H_TEST("cuda::std::all_of on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> input(size);
+  thrust::sequence(input.begin(), input.end(), 0);
+
+  SECTION("with par")
+  {
+    test_all_of(cuda::std::execution::par, input);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_all_of(cuda::std::execution::par_unseq, input);
+  }
+}
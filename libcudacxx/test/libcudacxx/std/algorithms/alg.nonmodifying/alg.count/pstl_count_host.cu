@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class T>
+// typename iterator_traits<ForwardIterator>::difference_type
+//   count(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, const T& value);
+// template<class ExecutionPolicy, class ForwardIterator, class Predicate>
+// typename iterator_traits<ForwardIterator>::difference_type
+//   count_if(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, Predicate pred);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct is_odd
+{
+  constexpr bool operator()(const int val) const noexcept
+  {
+    return (val % 2) == 1;
+  }
+};
+
+template <class Policy>
+void test_count(const Policy& policy, const thrust::host_vector<int>& input)
+{
+  { // empty should not access anything
+    CHECK(cuda::std::count(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), 0) == 0);
+  }
+
+  {
+    CHECK(cuda::std::count(policy, input.begin(), input.end(), 7) == size / 10);
+    CHECK(cuda::std::count(policy, input.begin(), input.end(), 10) == 0);
+  }
+
+  {
+    CHECK(cuda::std::count_if(policy, input.begin(), input.end(), is_odd{}) == size / 2);
+    CHECK(cuda::std::count_if(policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, is_odd{}) == size / 2);
+  }
+}
+
+C2H_TEST("cuda::std::count on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> input(size);
+  for (int i = 0; i < size; ++i)
+  {
+    input[i] = i % 10;
+  }
+
+  SECTION("with par")
+  {
+    test_count(cuda::std::execution::par, input);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_count(cuda::std::execution::par_unseq, input);
+  }
+}
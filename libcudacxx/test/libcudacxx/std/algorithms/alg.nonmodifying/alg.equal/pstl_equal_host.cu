@@ -0,0 +1,69 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+// bool equal(ExecutionPolicy&& exec
+//            ForwardIterator1 first1,
+//            ForwardIterator1 last1,
+//            ForwardIterator2 first2);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+template <class Policy>
+void test_equal(const Policy& policy, thrust::host_vector<int>& input)
+{
+  { // empty should not access anything
+    CHECK(cuda::std::equal(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), static_cast<int*>(nullptr)));
+  }
+
+  {
+    CHECK(cuda::std::equal(policy, input.begin(), input.end(), cuda::counting_iterator{0}));
+  }
+
+  { // a difference in the last chunk
+    input[size - 3] = -1;
+    CHECK(!cuda::std::equal(policy, input.begin(), input.end(), cuda::counting_iterator{0}));
+    CHECK(cuda::std::mismatch(policy, input.begin(), input.end(), cuda::counting_iterator{0}).first
+          == input.begin() + size - 3);
+    input[size - 3] = size - 3;
+  }
+
+  { // mismatch returns last if there is no difference
+    CHECK(cuda::std::mismatch(policy, input.begin(), input.end(), cuda::counting_iterator{0}).first == input.end());
+  }
+}
+
+C2H_TEST("cuda::std::equal on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> input(size);
+  thrust::sequence(input.begin(), input.end(), 0);
+
+  SECTION("with par")
+  {
+    test_equal(cuda::std::execution::par, input);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_equal(cuda::std::execution::par_unseq, input);
+  }
+}
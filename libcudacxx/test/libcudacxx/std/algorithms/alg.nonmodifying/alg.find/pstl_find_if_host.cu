@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class Predicate>
+// ForwardIterator find_if(ExecutionPolicy&& exec,
+//                         ForwardIterator first,
+//                         ForwardIterator last,
+//                         Predicate pred);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+#include "test_iterators.h"
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct greater_than
+{
+  int bound;
+
+  constexpr bool operator()(const int val) const noexcept
+  {
+    return val > bound;
+  }
+};
+
+template <class Policy>
+void test_find_if(const Policy& policy, const thrust::host_vector<int>& input)
+{
+  { // empty should not access anything
+    auto res = cuda::std::find_if(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), greater_than{0});
+    CHECK(res == static_cast<int*>(nullptr));
+  }
+
+  { // the first match wins, even though every later chunk matches as well
+    auto res = cuda::std::find_if(policy, input.begin(), input.end(), greater_than{4242});
+    CHECK(res == input.begin() + 4243);
+  }
+
+  { // a match in the last element
+    auto res = cuda::std::find_if(policy, input.begin(), input.end(), greater_than{size - 2});
+    CHECK(res == input.end() - 1);
+  }
+
+  { // no match returns last
+    auto res = cuda::std::find_if(policy, input.begin(), input.end(), greater_than{size});
+    CHECK(res == input.end());
+  }
+
+  { // find and find_if_not
+    CHECK(cuda::std::find(policy, input.begin(), input.end(), 77777) == input.begin() + 77777);
+    CHECK(cuda::std::find(policy, input.begin(), input.end(), -1) == input.end());
+    CHECK(cuda::std::find_if_not(policy, input.begin(), input.end(), greater_than{-1}) == input.end());
+  }
+
+  { // with a fancy iterator
+    auto res = cuda::std::find_if(policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, greater_than{9999});
+    CHECK(res == cuda::counting_iterator{10000});
+  }
+
+  { // non contiguous input
+    const auto* ptr = input.data();
+    auto res        = cuda::std::find_if(
+      policy, random_access_iterator{ptr}, random_access_iterator{ptr + size}, greater_than{size / 2});
+    CHECK(res == random_access_iterator{ptr + size / 2 + 1});
+  }
+}
+
+C2H_TEST("cuda::std::find_if on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> input(size);
+  thrust::sequence(input.begin(), input.end(), 0);
+
+  SECTION("with par")
+  {
+    test_find_if(cuda::std::execution::par, input);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_find_if(cuda::std::execution::par_unseq, input);
+  }
+}
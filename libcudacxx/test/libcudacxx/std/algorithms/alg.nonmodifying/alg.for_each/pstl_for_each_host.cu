@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator, class Function>
+// void for_each(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, Function f);
+// template<class ExecutionPolicy, class ForwardIterator, class Size, class Function>
+// ForwardIterator for_each_n(ExecutionPolicy&& exec, ForwardIterator first, Size n, Function f);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+struct times_two
+{
+  constexpr void operator()(int& val) const noexcept
+  {
+    val *= 2;
+  }
+};
+
+template <class Policy>
+void test_for_each(const Policy& policy, thrust::host_vector<int>& input)
+{
+  { // empty should not access anything
+    cuda::std::for_each(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), times_two{});
+  }
+
+  thrust::sequence(input.begin(), input.end(), 0);
+  cuda::std::for_each(policy, input.begin(), input.end(), times_two{});
+  CHECK(thrust::equal(input.begin(), input.end(), cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+
+  thrust::sequence(input.begin(), input.end(), 0);
+  auto res = cuda::std::for_each_n(policy, input.begin(), size - 1, times_two{});
+  CHECK(res == input.end() - 1);
+  CHECK(thrust::equal(input.begin(), input.end() - 1, cuda::strided_iterator{cuda::counting_iterator{0}, 2}));
+  CHECK(input[size - 1] == size - 1);
+}
+
+C2H_TEST("cuda::std::for_each on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> input(size);
+
+  SECTION("with par")
+  {
+    test_for_each(cuda::std::execution::par, input);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_for_each(cuda::std::execution::par_unseq, input);
+  }
+}
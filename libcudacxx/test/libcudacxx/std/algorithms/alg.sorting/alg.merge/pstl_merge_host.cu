@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class ForwardIterator>
+// ForwardIterator merge(ExecutionPolicy&& exec,
+//                       ForwardIterator1 first1, ForwardIterator1 last1,
+//                       ForwardIterator2 first2, ForwardIterator2 last2,
+//                       ForwardIterator result);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/iterator>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+// 2 * i and 2 * i + 1 are equivalent
+struct half_less
+{
+  constexpr bool operator()(const int lhs, const int rhs) const noexcept
+  {
+    return lhs / 2 < rhs / 2;
+  }
+};
+
+template <class Policy>
+void test_merge(const Policy& policy, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    const auto res = cuda::std::merge(
+      policy,
+      static_cast<int*>(nullptr),
+      static_cast<int*>(nullptr),
+      static_cast<int*>(nullptr),
+      static_cast<int*>(nullptr),
+      static_cast<int*>(nullptr));
+    CHECK(res == nullptr);
+  }
+
+  { // interleaved inputs
+    const auto evens = cuda::strided_iterator{cuda::counting_iterator{0}, 2};
+    const auto odds  = cuda::strided_iterator{cuda::counting_iterator{1}, 2};
+    const auto res   = cuda::std::merge(policy, evens, evens + size / 2, odds, odds + size / 2, output.begin());
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::counting_iterator{0}));
+  }
+
+  { // inputs of different lengths that do not overlap
+    const auto res = cuda::std::merge(
+      policy,
+      cuda::counting_iterator{size - 10},
+      cuda::counting_iterator{size},
+      cuda::counting_iterator{0},
+      cuda::counting_iterator{size - 10},
+      output.begin());
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::counting_iterator{0}));
+  }
+
+  { // equivalent elements of the first range come first
+    const auto evens = cuda::strided_iterator{cuda::counting_iterator{0}, 2};
+    const auto odds  = cuda::strided_iterator{cuda::counting_iterator{1}, 2};
+    const auto res   =
+      cuda::std::merge(policy, odds, odds + size / 2, evens, evens + size / 2, output.begin(), half_less{});
+    CHECK(res == output.end());
+    CHECK(output[0] == 1);
+    CHECK(output[1] == 0);
+    CHECK(output[size - 2] == size - 1);
+    CHECK(output[size - 1] == size - 2);
+  }
+
+  { // with a comparator
+    const auto first = cuda::std::reverse_iterator{cuda::counting_iterator{size}};
+    const auto res   = cuda::std::merge(
+      policy, first, first + size / 2, first + size / 2, first + size, output.begin(), cuda::std::greater<>{});
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), first));
+  }
+}
+
+C2H_TEST("cuda::std::merge on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> output(size);
+
+  SECTION("with par")
+  {
+    test_merge(cuda::std::execution::par, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_merge(cuda::std::execution::par_unseq, output);
+  }
+}
@@ -0,0 +1,165 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class RandomIt>
+// void sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last);
+//
+// template<class ExecutionPolicy, class RandomIt, class Compare>
+// void sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last, Compare comp);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+
+#include <atomic>
+#include <stdexcept>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+// Scatters [0, size) so that the input is not sorted
+struct scramble
+{
+  constexpr int operator()(const int val) const noexcept
+  {
+    return (val * 7919) % size;
+  }
+};
+
+// An element that counts how many of its kind are alive
+struct counted
+{
+  static inline std::atomic<int> alive{0};
+
+  int value = 0;
+
+  counted() noexcept
+  {
+    ++alive;
+  }
+  counted(int v) noexcept
+      : value{v}
+  {
+    ++alive;
+  }
+  counted(const counted& other) noexcept
+      : value{other.value}
+  {
+    ++alive;
+  }
+  counted& operator=(const counted&) noexcept = default;
+  ~counted()
+  {
+    --alive;
+  }
+
+  friend bool operator<(const counted& lhs, const counted& rhs) noexcept
+  {
+    return lhs.value < rhs.value;
+  }
+  friend bool operator==(const counted& lhs, const int rhs) noexcept
+  {
+    return lhs.value == rhs;
+  }
+};
+
+// Throws once it has been called a given number of times
+struct throwing_less
+{
+  std::atomic<int>* calls;
+  int limit;
+
+  bool operator()(const counted& lhs, const counted& rhs) const
+  {
+    if (++*calls == limit)
+    {
+      throw std::runtime_error{"comparison failed"};
+    }
+    return lhs < rhs;
+  }
+};
+
+template <class Policy>
+void test_sort(const Policy& policy, thrust::host_vector<int>& input)
+{
+  { // empty should not access anything
+    cuda::std::sort(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+  }
+
+  cuda::std::copy_n(cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}}, size, input.begin());
+  { // default comparison
+    cuda::std::sort(policy, input.begin(), input.end());
+    CHECK(thrust::equal(input.begin(), input.end(), cuda::counting_iterator{0}));
+  }
+
+  cuda::std::copy_n(cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}}, size, input.begin());
+  { // descending comparison
+    cuda::std::sort(policy, input.begin(), input.end(), cuda::std::greater<>{});
+    CHECK(thrust::equal(input.begin(), input.end(), cuda::strided_iterator{cuda::counting_iterator{size - 1}, -1}));
+  }
+
+  { // elements that are not trivially copyable are all destroyed again
+    thrust::host_vector<counted> elements(
+      cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}},
+      cuda::transform_iterator{cuda::counting_iterator{size}, scramble{}});
+    const int alive = counted::alive;
+
+    cuda::std::sort(policy, elements.begin(), elements.end());
+    CHECK(thrust::equal(elements.begin(), elements.end(), cuda::counting_iterator{0}));
+    CHECK(counted::alive == alive);
+  }
+
+  // an exception that escapes an OpenMP parallel region terminates the program
+#if _CCCL_HAS_BACKEND_TBB()
+  { // a throwing comparison does not leak the elements moved to the temporary buffer
+    thrust::host_vector<counted> elements(
+      cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}},
+      cuda::transform_iterator{cuda::counting_iterator{size}, scramble{}});
+    const int alive = counted::alive;
+
+    // count the comparisons of a whole sort, to throw from its first, middle and last one
+    std::atomic<int> calls{0};
+    cuda::std::sort(policy, elements.begin(), elements.end(), throwing_less{&calls, -1});
+    const int total = calls;
+
+    for (const int limit : {1, total / 2, total})
+    {
+      cuda::std::copy_n(cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}}, size, elements.begin());
+      calls = 0;
+      CHECK_THROWS_AS(cuda::std::sort(policy, elements.begin(), elements.end(), throwing_less{&calls, limit}),
+                      std::runtime_error);
+      CHECK(counted::alive == alive);
+    }
+  }
+#endif // _CCCL_HAS_BACKEND_TBB()
+}
+
+C2H_TEST("cuda::std::sort on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> input(size);
+
+  SECTION("with par")
+  {
+    test_sort(cuda::std::execution::par, input);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_sort(cuda::std::execution::par_unseq, input);
+  }
+}
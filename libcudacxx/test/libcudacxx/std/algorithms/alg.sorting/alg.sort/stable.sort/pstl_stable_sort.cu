@@ -0,0 +1,115 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class RandomIt>
+// void stable_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last);
+//
+// template<class ExecutionPolicy, class RandomIt, class Compare>
+// void stable_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last, Compare comp);
+
+#include <thrust/device_vector.h>
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/memory_pool>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/iterator>
+#include <cuda/stream>
+
+#include <algorithm>
+
+#include <testing.cuh>
+#include <utility.cuh>
+
+inline constexpr int size = 1000;
+
+// Scatters [0, size) so that the input is not sorted
+struct scramble
+{
+  __host__ __device__ constexpr int operator()(const int val) const noexcept
+  {
+    return (val * 337) % size;
+  }
+};
+
+// Orders by the tens only, so that every ten elements are equivalent
+struct less_by_tens
+{
+  __host__ __device__ constexpr bool operator()(const int lhs, const int rhs) const noexcept
+  {
+    return lhs / 10 < rhs / 10;
+  }
+};
+
+template <class Policy>
+void test_stable_sort(const Policy& policy, thrust::device_vector<int>& input)
+{
+  { // empty should not access anything
+    cuda::std::stable_sort(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+  }
+
+  cuda::std::copy_n(policy, cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}}, size, input.begin());
+  { // default comparison
+    cuda::std::stable_sort(policy, input.begin(), input.end());
+    CHECK(thrust::equal(input.begin(), input.end(), cuda::counting_iterator{0}));
+  }
+
+  cuda::std::copy_n(policy, cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}}, size, input.begin());
+  { // descending comparison
+    cuda::std::stable_sort(policy, input.begin(), input.end(), cuda::std::greater<>{});
+    CHECK(thrust::equal(input.begin(), input.end(), cuda::strided_iterator{cuda::counting_iterator{size - 1}, -1}));
+  }
+
+  cuda::std::copy_n(policy, cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}}, size, input.begin());
+  { // equivalent elements keep their order
+    thrust::host_vector<int> expected(input);
+    std::stable_sort(expected.begin(), expected.end(), less_by_tens{});
+
+    cuda::std::stable_sort(policy, input.begin(), input.end(), less_by_tens{});
+    CHECK(thrust::equal(input.begin(), input.end(), thrust::device_vector<int>(expected).begin()));
+  }
+}
+
+C2H_TEST("cuda::std::stable_sort", "[parallel algorithm]")
+{
+  thrust::device_vector<int> input(size, thrust::no_init);
+
+  SECTION("with default stream")
+  {
+    const auto policy = cuda::execution::gpu;
+    test_stable_sort(policy, input);
+  }
+
+  SECTION("with provided stream")
+  {
+    cuda::stream stream{cuda::device_ref{0}};
+    const auto policy = cuda::execution::gpu.with(cuda::get_stream, stream);
+    test_stable_sort(policy, input);
+  }
+
+  SECTION("with provided memory_resource")
+  {
+    cuda::device_memory_pool_ref device_resource = cuda::device_default_memory_pool(cuda::device_ref{0});
+    const auto policy = cuda::execution::gpu.with(cuda::mr::get_memory_resource, device_resource);
+    test_stable_sort(policy, input);
+  }
+
+  SECTION("with provided stream and memory_resource")
+  {
+    cuda::stream stream{cuda::device_ref{0}};
+    cuda::device_memory_pool_ref device_resource = cuda::device_default_memory_pool(stream.device());
+    const auto policy =
+      cuda::execution::gpu.with(cuda::mr::get_memory_resource, device_resource).with(cuda::get_stream, stream);
+    test_stable_sort(policy, input);
+  }
+}
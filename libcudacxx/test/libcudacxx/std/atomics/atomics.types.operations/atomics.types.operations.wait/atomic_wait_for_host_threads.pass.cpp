@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/std/atomic>
+
+// The internal __wait_for of atomics and atomic_refs returns true once the value differs from the given one, and false
+// when the duration elapses first. Host threads blocked in it are woken by notify_one from other threads.
+
+#include <cuda/atomic>
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include <chrono>
+#include <thread>
+
+#include "test_macros.h"
+
+// gives the waiters time to go to sleep before they are notified
+void let_waiters_sleep()
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+}
+
+// long enough that a test only passes in time if the waiter is woken by the notification
+constexpr cuda::std::chrono::hours forever{1};
+
+void test_timeout()
+{
+  cuda::std::atomic<int> a{0};
+
+  const auto start = std::chrono::steady_clock::now();
+  assert(!a.__wait_for(0, cuda::std::chrono::milliseconds(10)));
+  assert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(10));
+
+  // a duration that is not positive only checks the value
+  assert(!a.__wait_for(0, cuda::std::chrono::nanoseconds::zero()));
+  assert(!a.__wait_for(0, cuda::std::chrono::nanoseconds(-1), cuda::std::memory_order_relaxed));
+  assert(a.__wait_for(1, cuda::std::chrono::nanoseconds::zero()));
+  assert(a.__wait_for(1, forever));
+}
+
+template <class Atomic, class T>
+void test_notify(Atomic& a, T old_value, T new_value)
+{
+  std::thread waiter([&] {
+    assert(a.__wait_for(old_value, forever, cuda::std::memory_order_acquire));
+    assert(a.load() == new_value);
+  });
+
+  let_waiters_sleep();
+  a.store(new_value, cuda::std::memory_order_release);
+  a.notify_one();
+  waiter.join();
+}
+
+void test_atomic_ref()
+{
+  int value = 0;
+  std::thread waiter([&] {
+    assert(cuda::std::atomic_ref<int>{value}.__wait_for(0, forever));
+  });
+
+  // the notification reaches the waiter through another atomic_ref to the same object
+  let_waiters_sleep();
+  cuda::std::atomic_ref<int>{value}.store(1);
+  cuda::std::atomic_ref<int>{value}.notify_one();
+  waiter.join();
+}
+
+void test()
+{
+  test_timeout();
+  {
+    cuda::std::atomic<int> a{0};
+    test_notify(a, 0, 1);
+  }
+  {
+    int item = 0;
+    cuda::std::atomic<int*> a{nullptr};
+    test_notify(a, static_cast<int*>(nullptr), &item);
+  }
+  {
+    cuda::atomic<long long, cuda::thread_scope_device> a{0};
+    test_notify(a, 0ll, -1ll);
+  }
+  {
+    short value = 0;
+    cuda::atomic_ref<short, cuda::thread_scope_system> a{value};
+    test_notify(a, short{0}, short{2});
+  }
+  test_atomic_ref();
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test();))
+
+  return 0;
+}
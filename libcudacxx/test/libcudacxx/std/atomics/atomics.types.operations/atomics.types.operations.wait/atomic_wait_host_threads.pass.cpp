@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// <cuda/std/atomic>
+
+// Host threads blocked in wait() are woken by notify_one and notify_all from other threads, also through other
+// atomic_refs and when the atomics they wait on share a slot of the waiter table.
+
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "test_macros.h"
+
+// Atomics that are 4096 bytes apart only differ in address bits that the waiter table does not hash, so they share a
+// slot
+struct alignas(4096) page
+{
+  cuda::std::atomic<int> value{0};
+};
+
+page pages[4];
+
+// gives the waiters time to go to sleep before they are notified
+void let_waiters_sleep()
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+}
+
+void test_notify_one()
+{
+  cuda::std::atomic<int> a{0};
+  std::thread waiter([&] {
+    a.wait(0);
+    assert(a.load() == 1);
+  });
+
+  let_waiters_sleep();
+  a.store(1);
+  a.notify_one();
+  waiter.join();
+}
+
+void test_notify_all()
+{
+  cuda::std::atomic<int> a{0};
+  cuda::std::atomic<int> woken{0};
+
+  std::vector<std::thread> waiters;
+  for (int i = 0; i < 4; ++i)
+  {
+    waiters.emplace_back([&] {
+      a.wait(0);
+      ++woken;
+    });
+  }
+
+  let_waiters_sleep();
+  a.store(1);
+  a.notify_all();
+  for (auto& waiter : waiters)
+  {
+    waiter.join();
+  }
+  assert(woken.load() == 4);
+}
+
+void test_atomic_ref()
+{
+  int value = 0;
+  std::thread waiter([&] {
+    cuda::std::atomic_ref<int>{value}.wait(0);
+    assert(cuda::std::atomic_ref<int>{value}.load() == 1);
+  });
+
+  // a waiter is woken through any atomic_ref to the object it waits on
+  let_waiters_sleep();
+  cuda::std::atomic_ref<int>{value}.store(1);
+  cuda::std::atomic_ref<int>{value}.notify_one();
+  waiter.join();
+}
+
+void test_shared_slot()
+{
+  cuda::std::atomic<int> woken{0};
+
+  std::vector<std::thread> waiters;
+  for (auto& p : pages)
+  {
+    waiters.emplace_back([&] {
+      p.value.wait(0);
+      ++woken;
+    });
+  }
+
+  // notifying one of the atomics wakes its waiter, even though the other waiters sleep on the same slot
+  let_waiters_sleep();
+  pages[2].value.store(1);
+  pages[2].value.notify_one();
+  waiters[2].join();
+  assert(woken.load() == 1);
+
+  // the others go back to sleep since their values did not change
+  let_waiters_sleep();
+  assert(woken.load() == 1);
+
+  for (auto& p : pages)
+  {
+    p.value.store(1);
+    p.value.notify_all();
+  }
+  for (int i = 0; i < 4; ++i)
+  {
+    if (i != 2)
+    {
+      waiters[i].join();
+    }
+  }
+  assert(woken.load() == 4);
+}
+
+void test()
+{
+  test_notify_one();
+  test_notify_all();
+  test_atomic_ref();
+  test_shared_slot();
+}
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test();))
+
+  return 0;
+}
@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/complex>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+__host__ __device__ void test_dense()
+{
+  using E = cuda::std::dextents<int, 1>;
+  cuda::std::array<int, 11> x{};
+  cuda::std::array<int, 11> y{};
+  int expected = 0;
+  for (int i = 0; i < 11; ++i)
+  {
+    x[i] = i + 1;
+    y[i] = 2 * i - 5;
+    expected += x[i] * y[i];
+  }
+  // every number of elements exercises a different remainder of the unrolled loop
+  for (int n = 0; n <= 11; ++n)
+  {
+    int partial = 0;
+    for (int i = 0; i < n; ++i)
+    {
+      partial += x[i] * y[i];
+    }
+    cuda::std::mdspan<const int, E> vx(x.data(), n);
+    cuda::std::mdspan<const int, E> vy(y.data(), n);
+    assert(cuda::std::linalg::dot(vx, vy) == partial);
+    assert(cuda::std::linalg::dot(vx, vy, 100) == partial + 100);
+  }
+  cuda::std::mdspan<int, E> vx(x.data(), 11);
+  cuda::std::mdspan<int, E, cuda::std::layout_left> vy(y.data(), 11);
+  assert(cuda::std::linalg::dot(vx, vy) == expected);
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::dot(vx, vy, 0.0)), double>);
+}
+
+__host__ __device__ void test_strided()
+{
+  using E = cuda::std::dextents<int, 1>;
+  cuda::std::array<int, 10> x{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  cuda::std::array<int, 5> y{1, -1, 2, -2, 3};
+  cuda::std::mdspan<int, E, cuda::std::layout_stride> vx(
+    x.data(), cuda::std::layout_stride::mapping<E>(E{5}, cuda::std::array<int, 1>{2}));
+  cuda::std::mdspan<int, E> vy(y.data(), 5);
+  // x is {1, 3, 5, 7, 9}
+  assert(cuda::std::linalg::dot(vx, vy) == 1 - 3 + 10 - 14 + 27);
+  assert(cuda::std::linalg::dot(cuda::std::linalg::scaled(2, vy), vx) == 2 * (1 - 3 + 10 - 14 + 27));
+}
+
+__host__ __device__ void test_complex()
+{
+  using E = cuda::std::dextents<int, 1>;
+  using C = cuda::std::complex<double>;
+  cuda::std::array<C, 5> x{C{1, 2}, C{0, -1}, C{3, 0}, C{-2, 1}, C{1, 1}};
+  cuda::std::array<C, 5> y{C{2, 0}, C{1, 1}, C{0, 2}, C{1, -1}, C{-1, 3}};
+  cuda::std::mdspan<C, E> vx(x.data(), 5);
+  cuda::std::mdspan<C, E> vy(y.data(), 5);
+
+  C expected{};
+  C expected_c{};
+  for (int i = 0; i < 5; ++i)
+  {
+    expected += x[i] * y[i];
+    expected_c += cuda::std::conj(x[i]) * y[i];
+  }
+  assert(cuda::std::linalg::dot(vx, vy) == expected);
+  assert(cuda::std::linalg::dotc(vx, vy) == expected_c);
+  assert(cuda::std::linalg::dotc(vx, vy, C(1, 1)) == expected_c + C(1, 1));
+  assert(cuda::std::linalg::dot(cuda::std::linalg::conjugated(vx), vy) == expected_c);
+}
+
+int main(int, char**)
+{
+  test_dense();
+  test_strided();
+  test_complex();
+  return 0;
+}
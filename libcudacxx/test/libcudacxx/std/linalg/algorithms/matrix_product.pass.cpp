@@ -0,0 +1,159 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+
+#include <vector>
+
+template <class LayoutA, class LayoutB, class LayoutC>
+__host__ __device__ void
+test_product(int m, int k, int n, long long* a_data, long long* b_data, long long* c_data, long long* e_data)
+{
+  using E  = cuda::std::dextents<int, 2>;
+  using Er = cuda::std::mdspan<long long, E, cuda::std::layout_right>;
+  cuda::std::mdspan<long long, E, LayoutA> a(a_data, m, k);
+  cuda::std::mdspan<long long, E, LayoutB> b(b_data, k, n);
+  cuda::std::mdspan<long long, E, LayoutC> c(c_data, m, n);
+  Er e(e_data, m, n);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int p = 0; p < k; ++p)
+    {
+      a(i, p) = (i * 7 + p * 3) % 11 - 5;
+    }
+  }
+  for (int p = 0; p < k; ++p)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      b(p, j) = (p * 5 + j * 2) % 13 - 6;
+    }
+  }
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      c(i, j) = 42;
+      e(i, j) = i - j;
+    }
+  }
+
+  const auto expected = [&](int i, int j) {
+    long long sum = 0;
+    for (int p = 0; p < k; ++p)
+    {
+      sum += a(i, p) * b(p, j);
+    }
+    return sum;
+  };
+
+  cuda::std::linalg::matrix_product(a, b, c);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(c(i, j) == expected(i, j));
+    }
+  }
+
+  cuda::std::linalg::matrix_product(a, b, e, c);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(c(i, j) == e(i, j) + expected(i, j));
+    }
+  }
+
+  // C = C + A * B, in place
+  cuda::std::linalg::matrix_product(a, b, c, c);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(c(i, j) == e(i, j) + 2 * expected(i, j));
+    }
+  }
+}
+
+template <class LayoutA, class LayoutB, class LayoutC>
+__host__ __device__ void test_small()
+{
+  // not a multiple of the register tile in any dimension
+  constexpr int m = 9;
+  constexpr int k = 5;
+  constexpr int n = 11;
+  cuda::std::array<long long, m * k> a{};
+  cuda::std::array<long long, k * n> b{};
+  cuda::std::array<long long, m * n> c{};
+  cuda::std::array<long long, m * n> e{};
+  test_product<LayoutA, LayoutB, LayoutC>(m, k, n, a.data(), b.data(), c.data(), e.data());
+}
+
+template <class LayoutA, class LayoutB, class LayoutC>
+void test_large(int m, int k, int n)
+{
+  std::vector<long long> a(m * k);
+  std::vector<long long> b(k * n);
+  std::vector<long long> c(m * n);
+  std::vector<long long> e(m * n);
+  test_product<LayoutA, LayoutB, LayoutC>(m, k, n, a.data(), b.data(), c.data(), e.data());
+}
+
+void test_large()
+{
+  using cuda::std::layout_left;
+  using cuda::std::layout_right;
+  // more than one cache block of rows of A and of the inner dimension
+  test_large<layout_right, layout_right, layout_right>(70, 300, 21);
+  test_large<layout_left, layout_right, layout_left>(70, 300, 21);
+  // more than one cache block of columns of B
+  test_large<layout_right, layout_left, layout_right>(5, 3, 530);
+}
+
+__host__ __device__ void test_views()
+{
+  using E = cuda::std::dextents<int, 2>;
+  cuda::std::array<int, 6> a_data{1, 2, 3, 4, 5, 6};
+  cuda::std::array<int, 4> c_data{};
+  cuda::std::mdspan<int, E> a(a_data.data(), 2, 3);
+  cuda::std::mdspan<int, E> c(c_data.data(), 2, 2);
+
+  // A * A^T, where A^T is layout_left
+  cuda::std::linalg::matrix_product(a, cuda::std::linalg::transposed(a), c);
+  assert(c(0, 0) == 14 && c(0, 1) == 32 && c(1, 0) == 32 && c(1, 1) == 77);
+
+  // scaled matrices take the element-wise path
+  cuda::std::linalg::matrix_product(cuda::std::linalg::scaled(2, a), cuda::std::linalg::transposed(a), c);
+  assert(c(0, 0) == 28 && c(0, 1) == 64 && c(1, 0) == 64 && c(1, 1) == 154);
+
+  // layout_stride takes the element-wise path
+  cuda::std::mdspan<int, E, cuda::std::layout_stride> as(
+    a_data.data(), cuda::std::layout_stride::mapping<E>(E{2, 2}, cuda::std::array<int, 2>{3, 2}));
+  cuda::std::linalg::matrix_product(as, as, c);
+  // {{1, 3}, {4, 6}}^2
+  assert(c(0, 0) == 13 && c(0, 1) == 21 && c(1, 0) == 28 && c(1, 1) == 48);
+}
+
+int main(int, char**)
+{
+  using cuda::std::layout_left;
+  using cuda::std::layout_right;
+  test_small<layout_right, layout_right, layout_right>();
+  test_small<layout_left, layout_left, layout_left>();
+  test_small<layout_right, layout_left, layout_right>();
+  test_small<layout_left, layout_right, layout_left>();
+  test_small<layout_right, layout_right, layout_left>();
+  test_views();
+  NV_IF_TARGET(NV_IS_HOST, (test_large();))
+  return 0;
+}
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+
+template <class Layout, class Vector>
+__host__ __device__ void test_layout()
+{
+  using E2 = cuda::std::dextents<int, 2>;
+  using E1 = cuda::std::dextents<int, 1>;
+  // odd sizes leave a remainder after the blocks of four rows or columns
+  constexpr int m = 7;
+  constexpr int n = 9;
+
+  cuda::std::array<int, m * n> a_data{};
+  cuda::std::mdspan<int, E2, Layout> a(a_data.data(), m, n);
+  cuda::std::array<int, n> x_data{};
+  cuda::std::mdspan<int, E1, Vector> x(x_data.data(), n);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      a(i, j) = (i + 1) * (j % 3) - j;
+    }
+  }
+  for (int j = 0; j < n; ++j)
+  {
+    x(j) = j - 4;
+  }
+  cuda::std::array<int, m> expected{};
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      expected[i] += a(i, j) * x(j);
+    }
+  }
+
+  cuda::std::array<int, m> y_data{};
+  cuda::std::mdspan<int, E1, Vector> y(y_data.data(), m);
+  for (int i = 0; i < m; ++i)
+  {
+    y(i) = 42;
+  }
+  cuda::std::linalg::matrix_vector_product(a, x, y);
+  for (int i = 0; i < m; ++i)
+  {
+    assert(y(i) == expected[i]);
+  }
+
+  // z = y + A * x, in place
+  cuda::std::linalg::matrix_vector_product(a, x, y, y);
+  for (int i = 0; i < m; ++i)
+  {
+    assert(y(i) == 2 * expected[i]);
+  }
+
+  // A^T * y
+  cuda::std::array<int, n> z_data{};
+  cuda::std::mdspan<int, E1> z(z_data.data(), n);
+  cuda::std::linalg::matrix_vector_product(cuda::std::linalg::transposed(a), y, z);
+  for (int j = 0; j < n; ++j)
+  {
+    int sum = 0;
+    for (int i = 0; i < m; ++i)
+    {
+      sum += a(i, j) * y(i);
+    }
+    assert(z(j) == sum);
+  }
+
+  // scaled matrices take the element-wise path
+  cuda::std::linalg::matrix_vector_product(cuda::std::linalg::scaled(3, a), x, y);
+  for (int i = 0; i < m; ++i)
+  {
+    assert(y(i) == 3 * expected[i]);
+  }
+}
+
+__host__ __device__ void test_strided()
+{
+  using E2 = cuda::std::dextents<int, 2>;
+  using E1 = cuda::std::dextents<int, 1>;
+  cuda::std::array<int, 12> a_data{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  // the 2 x 3 matrix {{1, 3, 5}, {7, 9, 11}}
+  cuda::std::mdspan<int, E2, cuda::std::layout_stride> a(
+    a_data.data(), cuda::std::layout_stride::mapping<E2>(E2{2, 3}, cuda::std::array<int, 2>{6, 2}));
+  cuda::std::array<int, 3> x_data{1, -1, 2};
+  cuda::std::mdspan<int, E1> x(x_data.data(), 3);
+  cuda::std::array<int, 2> y_data{};
+  cuda::std::mdspan<int, E1> y(y_data.data(), 2);
+  cuda::std::linalg::matrix_vector_product(a, x, y);
+  assert(y(0) == 1 - 3 + 10);
+  assert(y(1) == 7 - 9 + 22);
+}
+
+int main(int, char**)
+{
+  test_layout<cuda::std::layout_right, cuda::std::layout_right>();
+  test_layout<cuda::std::layout_left, cuda::std::layout_right>();
+  test_layout<cuda::std::layout_right, cuda::std::layout_left>();
+  test_layout<cuda::std::layout_left, cuda::std::layout_left>();
+  test_strided();
+  return 0;
+}
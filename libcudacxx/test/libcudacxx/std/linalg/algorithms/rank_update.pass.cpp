@@ -0,0 +1,165 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/complex>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+template <class Triangle>
+__host__ __device__ bool in_triangle(int i, int j)
+{
+  return cuda::std::is_same_v<Triangle, cuda::std::linalg::lower_triangle_t> ? i >= j : i <= j;
+}
+
+template <class Layout>
+__host__ __device__ void test_rank_1()
+{
+  using E2 = cuda::std::dextents<int, 2>;
+  using E1 = cuda::std::dextents<int, 1>;
+  cuda::std::array<int, 3> x_data{1, 2, 3};
+  cuda::std::array<int, 4> y_data{-1, 0, 2, 5};
+  cuda::std::array<int, 12> a_data{};
+  cuda::std::mdspan<int, E1> x(x_data.data(), 3);
+  cuda::std::mdspan<int, E1> y(y_data.data(), 4);
+  cuda::std::mdspan<int, E2, Layout> a(a_data.data(), 3, 4);
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      a(i, j) = i - j;
+    }
+  }
+  cuda::std::linalg::matrix_rank_1_update(x, y, a);
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      assert(a(i, j) == i - j + x(i) * y(j));
+    }
+  }
+}
+
+__host__ __device__ void test_rank_1_c()
+{
+  using E2 = cuda::std::dextents<int, 2>;
+  using E1 = cuda::std::dextents<int, 1>;
+  using C  = cuda::std::complex<double>;
+  cuda::std::array<C, 2> x_data{C(1, 1), C(0, 2)};
+  cuda::std::array<C, 2> y_data{C(2, -1), C(1, 3)};
+  cuda::std::array<C, 4> a_data{};
+  cuda::std::mdspan<C, E1> x(x_data.data(), 2);
+  cuda::std::mdspan<C, E1> y(y_data.data(), 2);
+  cuda::std::mdspan<C, E2> a(a_data.data(), 2, 2);
+  cuda::std::linalg::matrix_rank_1_update_c(x, y, a);
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      assert(a(i, j) == x(i) * cuda::std::conj(y(j)));
+    }
+  }
+}
+
+template <class Layout, class Triangle>
+__host__ __device__ void test_symmetric()
+{
+  using E2        = cuda::std::dextents<int, 2>;
+  using E1        = cuda::std::dextents<int, 1>;
+  constexpr int n = 5;
+  constexpr int k = 3;
+  cuda::std::array<int, n> x_data{1, -2, 3, 0, 4};
+  cuda::std::array<int, n * k> b_data{};
+  cuda::std::array<int, n * n> a_data{};
+  cuda::std::mdspan<int, E1> x(x_data.data(), n);
+  cuda::std::mdspan<int, E2, Layout> b(b_data.data(), n, k);
+  cuda::std::mdspan<int, E2, Layout> a(a_data.data(), n, n);
+  for (int i = 0; i < n; ++i)
+  {
+    for (int p = 0; p < k; ++p)
+    {
+      b(i, p) = (i * 2 + p) % 5 - 2;
+    }
+  }
+
+  cuda::std::linalg::symmetric_matrix_rank_1_update(x, a, Triangle{});
+  cuda::std::linalg::symmetric_matrix_rank_1_update(2, x, a, Triangle{});
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(a(i, j) == (in_triangle<Triangle>(i, j) ? 3 * x(i) * x(j) : 0));
+    }
+  }
+
+  cuda::std::linalg::symmetric_matrix_rank_k_update(b, a, Triangle{});
+  cuda::std::linalg::symmetric_matrix_rank_k_update(-1, b, a, Triangle{});
+  cuda::std::linalg::symmetric_matrix_rank_k_update(3, b, a, Triangle{});
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      int bbt = 0;
+      for (int p = 0; p < k; ++p)
+      {
+        bbt += b(i, p) * b(j, p);
+      }
+      assert(a(i, j) == (in_triangle<Triangle>(i, j) ? 3 * x(i) * x(j) + 3 * bbt : 0));
+    }
+  }
+}
+
+template <class Triangle>
+__host__ __device__ void test_hermitian()
+{
+  using E2 = cuda::std::dextents<int, 2>;
+  using E1 = cuda::std::dextents<int, 1>;
+  using C  = cuda::std::complex<double>;
+  cuda::std::array<C, 3> x_data{C(1, 1), C(0, -2), C(3, 0)};
+  cuda::std::array<C, 6> b_data{C(1, 0), C(2, 1), C(0, 1), C(-1, 1), C(1, -2), C(0, 0)};
+  cuda::std::array<C, 9> a_data{};
+  cuda::std::mdspan<C, E1> x(x_data.data(), 3);
+  cuda::std::mdspan<C, E2> b(b_data.data(), 3, 2);
+  cuda::std::mdspan<C, E2, cuda::std::layout_left> a(a_data.data(), 3, 3);
+
+  cuda::std::linalg::hermitian_matrix_rank_1_update(x, a, Triangle{});
+  cuda::std::linalg::hermitian_matrix_rank_k_update(2.0, b, a, Triangle{});
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 3; ++j)
+    {
+      C expected = x(i) * cuda::std::conj(x(j));
+      for (int p = 0; p < 2; ++p)
+      {
+        expected += 2.0 * b(i, p) * cuda::std::conj(b(j, p));
+      }
+      assert(a(i, j) == (in_triangle<Triangle>(i, j) ? expected : C{}));
+    }
+  }
+}
+
+int main(int, char**)
+{
+  using cuda::std::layout_left;
+  using cuda::std::layout_right;
+  using cuda::std::linalg::lower_triangle_t;
+  using cuda::std::linalg::upper_triangle_t;
+  test_rank_1<layout_right>();
+  test_rank_1<layout_left>();
+  test_rank_1_c();
+  test_symmetric<layout_right, lower_triangle_t>();
+  test_symmetric<layout_right, upper_triangle_t>();
+  test_symmetric<layout_left, lower_triangle_t>();
+  test_symmetric<layout_left, upper_triangle_t>();
+  test_hermitian<lower_triangle_t>();
+  test_hermitian<upper_triangle_t>();
+  return 0;
+}
@@ -0,0 +1,183 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+constexpr int n = 6;
+constexpr int r = 4;
+
+// The elements of the other triangle, and of the diagonal if it is implicit, are garbage that must not be read
+template <class Triangle, class Diagonal, class Mat>
+__host__ __device__ void fill_triangular(Mat a)
+{
+  constexpr bool lower     = cuda::std::is_same_v<Triangle, cuda::std::linalg::lower_triangle_t>;
+  constexpr bool explicit_ = cuda::std::is_same_v<Diagonal, cuda::std::linalg::explicit_diagonal_t>;
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      if (i == j)
+      {
+        a(i, j) = explicit_ ? double(1 << (i % 3)) : 1000.0;
+      }
+      else if ((i > j) == lower)
+      {
+        a(i, j) = double((i * 3 + j) % 5 - 2);
+      }
+      else
+      {
+        a(i, j) = 1000.0;
+      }
+    }
+  }
+}
+
+template <class Triangle, class Diagonal, class Mat>
+__host__ __device__ double element(const Mat& a, int i, int j)
+{
+  constexpr bool lower = cuda::std::is_same_v<Triangle, cuda::std::linalg::lower_triangle_t>;
+  if (i == j)
+  {
+    return cuda::std::is_same_v<Diagonal, cuda::std::linalg::explicit_diagonal_t> ? a(i, i) : 1.0;
+  }
+  return ((i > j) == lower) ? a(i, j) : 0.0;
+}
+
+template <class Layout, class Triangle, class Diagonal>
+__host__ __device__ void test_vector_solve()
+{
+  using E2 = cuda::std::dextents<int, 2>;
+  using E1 = cuda::std::dextents<int, 1>;
+  cuda::std::array<double, n * n> a_data{};
+  cuda::std::mdspan<double, E2, Layout> a(a_data.data(), n, n);
+  fill_triangular<Triangle, Diagonal>(a);
+
+  cuda::std::array<double, n> b_data{};
+  cuda::std::mdspan<double, E1> b(b_data.data(), n);
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      b(i) += element<Triangle, Diagonal>(a, i, j) * (j - 2);
+    }
+  }
+
+  cuda::std::array<double, n> x_data{};
+  cuda::std::mdspan<double, E1> x(x_data.data(), n);
+  cuda::std::linalg::triangular_matrix_vector_solve(a, Triangle{}, Diagonal{}, b, x);
+  for (int i = 0; i < n; ++i)
+  {
+    assert(x(i) == i - 2);
+  }
+
+  cuda::std::linalg::triangular_matrix_vector_solve(a, Triangle{}, Diagonal{}, b);
+  for (int i = 0; i < n; ++i)
+  {
+    assert(b(i) == i - 2);
+  }
+}
+
+template <class Layout, class LayoutB, class Triangle, class Diagonal>
+__host__ __device__ void test_matrix_solve()
+{
+  using E = cuda::std::dextents<int, 2>;
+  cuda::std::array<double, n * n> a_data{};
+  cuda::std::mdspan<double, E, Layout> a(a_data.data(), n, n);
+  fill_triangular<Triangle, Diagonal>(a);
+
+  const auto solution = [](int i, int j) {
+    return double((i + 2 * j) % 7 - 3);
+  };
+
+  // A * X = B, with X of n x r
+  {
+    cuda::std::array<double, n * r> b_data{};
+    cuda::std::mdspan<double, E, LayoutB> b(b_data.data(), n, r);
+    for (int i = 0; i < n; ++i)
+    {
+      for (int j = 0; j < r; ++j)
+      {
+        for (int p = 0; p < n; ++p)
+        {
+          b(i, j) += element<Triangle, Diagonal>(a, i, p) * solution(p, j);
+        }
+      }
+    }
+    cuda::std::array<double, n * r> x_data{};
+    cuda::std::mdspan<double, E, LayoutB> x(x_data.data(), n, r);
+    cuda::std::linalg::triangular_matrix_matrix_left_solve(a, Triangle{}, Diagonal{}, b, x);
+    cuda::std::linalg::triangular_matrix_matrix_left_solve(a, Triangle{}, Diagonal{}, b);
+    for (int i = 0; i < n; ++i)
+    {
+      for (int j = 0; j < r; ++j)
+      {
+        assert(x(i, j) == solution(i, j));
+        assert(b(i, j) == solution(i, j));
+      }
+    }
+  }
+
+  // X * A = B, with X of r x n
+  {
+    cuda::std::array<double, r * n> b_data{};
+    cuda::std::mdspan<double, E, LayoutB> b(b_data.data(), r, n);
+    for (int i = 0; i < r; ++i)
+    {
+      for (int j = 0; j < n; ++j)
+      {
+        for (int p = 0; p < n; ++p)
+        {
+          b(i, j) += solution(i, p) * element<Triangle, Diagonal>(a, p, j);
+        }
+      }
+    }
+    cuda::std::array<double, r * n> x_data{};
+    cuda::std::mdspan<double, E, LayoutB> x(x_data.data(), r, n);
+    cuda::std::linalg::triangular_matrix_matrix_right_solve(a, Triangle{}, Diagonal{}, b, x);
+    cuda::std::linalg::triangular_matrix_matrix_right_solve(a, Triangle{}, Diagonal{}, b);
+    for (int i = 0; i < r; ++i)
+    {
+      for (int j = 0; j < n; ++j)
+      {
+        assert(x(i, j) == solution(i, j));
+        assert(b(i, j) == solution(i, j));
+      }
+    }
+  }
+}
+
+template <class Layout, class Triangle>
+__host__ __device__ void test_layout_triangle()
+{
+  using cuda::std::layout_left;
+  using cuda::std::layout_right;
+  using cuda::std::linalg::explicit_diagonal_t;
+  using cuda::std::linalg::implicit_unit_diagonal_t;
+  test_vector_solve<Layout, Triangle, explicit_diagonal_t>();
+  test_vector_solve<Layout, Triangle, implicit_unit_diagonal_t>();
+  test_matrix_solve<Layout, layout_right, Triangle, explicit_diagonal_t>();
+  test_matrix_solve<Layout, layout_left, Triangle, implicit_unit_diagonal_t>();
+}
+
+int main(int, char**)
+{
+  using cuda::std::layout_left;
+  using cuda::std::layout_right;
+  using cuda::std::linalg::lower_triangle_t;
+  using cuda::std::linalg::upper_triangle_t;
+  test_layout_triangle<layout_right, lower_triangle_t>();
+  test_layout_triangle<layout_right, upper_triangle_t>();
+  test_layout_triangle<layout_left, lower_triangle_t>();
+  test_layout_triangle<layout_left, upper_triangle_t>();
+  return 0;
+}
@@ -0,0 +1,96 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/complex>
+#include <cuda/std/limits>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+__host__ __device__ void test_real()
+{
+  using E = cuda::std::dextents<int, 1>;
+  cuda::std::array<double, 4> x{3.0, -4.0, 0.0, 12.0};
+  cuda::std::mdspan<double, E> v(x.data(), 4);
+  assert(cuda::std::linalg::vector_two_norm(v) == 13.0);
+  assert(cuda::std::linalg::vector_two_norm(v, 84.0) == 85.0);
+  assert(cuda::std::linalg::vector_two_norm(cuda::std::mdspan<double, E>(x.data(), 0)) == 0.0);
+
+  cuda::std::array<int, 2> xi{-3, 4};
+  cuda::std::mdspan<int, E> vi(xi.data(), 2);
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::vector_two_norm(vi)), int>);
+  assert(cuda::std::linalg::vector_two_norm(vi) == 5);
+}
+
+__host__ __device__ void test_scaling()
+{
+  // the squares of the elements overflow or underflow, but the norm does not
+  using E        = cuda::std::dextents<int, 1>;
+  const double h = cuda::std::numeric_limits<double>::max() / 4;
+  cuda::std::array<double, 2> big{3 * (h / 8), 4 * (h / 8)};
+  cuda::std::mdspan<double, E> vbig(big.data(), 2);
+  assert(cuda::std::abs(cuda::std::linalg::vector_two_norm(vbig) / (5 * (h / 8)) - 1.0) < 1e-15);
+
+  const double l = cuda::std::numeric_limits<double>::min();
+  cuda::std::array<double, 2> small{3 * l, -4 * l};
+  cuda::std::mdspan<double, E> vsmall(small.data(), 2);
+  assert(cuda::std::abs(cuda::std::linalg::vector_two_norm(vsmall) / (5 * l) - 1.0) < 1e-15);
+}
+
+__host__ __device__ void test_non_finite()
+{
+  // like hypot, an infinite value makes the norm +inf, even next to a NaN
+  using E          = cuda::std::dextents<int, 1>;
+  const double inf = cuda::std::numeric_limits<double>::infinity();
+  const double nan = cuda::std::numeric_limits<double>::quiet_NaN();
+
+  cuda::std::array<double, 2> infs{inf, inf};
+  assert(cuda::std::linalg::vector_two_norm(cuda::std::mdspan<double, E>(infs.data(), 2)) == inf);
+
+  cuda::std::array<double, 3> neg_inf{1.0, -inf, 2.0};
+  assert(cuda::std::linalg::vector_two_norm(cuda::std::mdspan<double, E>(neg_inf.data(), 3)) == inf);
+
+  cuda::std::array<double, 3> nan_then_inf{nan, 1.0, inf};
+  assert(cuda::std::linalg::vector_two_norm(cuda::std::mdspan<double, E>(nan_then_inf.data(), 3)) == inf);
+
+  cuda::std::array<double, 2> inf_then_nan{-inf, nan};
+  assert(cuda::std::linalg::vector_two_norm(cuda::std::mdspan<double, E>(inf_then_nan.data(), 2)) == inf);
+
+  cuda::std::array<double, 3> with_nan{3.0, nan, 4.0};
+  cuda::std::mdspan<double, E> vnan(with_nan.data(), 3);
+  assert(cuda::std::isnan(cuda::std::linalg::vector_two_norm(vnan)));
+  assert(cuda::std::linalg::vector_two_norm(vnan, -inf) == inf);
+
+  cuda::std::array<float, 2> finf{-cuda::std::numeric_limits<float>::infinity(), 1.0f};
+  assert(cuda::std::linalg::vector_two_norm(cuda::std::mdspan<float, E>(finf.data(), 2))
+         == cuda::std::numeric_limits<float>::infinity());
+}
+
+__host__ __device__ void test_complex()
+{
+  using E = cuda::std::dextents<int, 1>;
+  using C = cuda::std::complex<double>;
+  cuda::std::array<C, 3> x{C(3, 4), C(0, 0), C(0, -12)};
+  cuda::std::mdspan<C, E, cuda::std::layout_stride> v(
+    x.data(), cuda::std::layout_stride::mapping<E>(E{3}, cuda::std::array<int, 1>{1}));
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::linalg::vector_two_norm(v)), double>);
+  assert(cuda::std::abs(cuda::std::linalg::vector_two_norm(v) - 13.0) < 1e-14);
+}
+
+int main(int, char**)
+{
+  test_real();
+  test_scaling();
+  test_non_finite();
+  test_complex();
+  return 0;
+}
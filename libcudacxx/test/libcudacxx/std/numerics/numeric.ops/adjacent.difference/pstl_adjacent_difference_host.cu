@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+// ForwardIterator2 adjacent_difference(ExecutionPolicy&& exec,
+//                                      ForwardIterator1 first,
+//                                      ForwardIterator1 last,
+//                                      ForwardIterator2 result);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/count.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+template <class Policy>
+void test_adjacent_difference(const Policy& policy, thrust::host_vector<int>& data, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    const auto res = cuda::std::adjacent_difference(
+      policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+    CHECK(res == nullptr);
+  }
+
+  { // the first element of every chunk needs the last element of the previous one
+    const auto res =
+      cuda::std::adjacent_difference(policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, output.begin());
+    CHECK(res == output.end());
+    CHECK(output[0] == 0);
+    CHECK(thrust::count(output.begin() + 1, output.end(), 1) == size - 1);
+  }
+
+  { // with an operator
+    const auto res = cuda::std::adjacent_difference(
+      policy, cuda::counting_iterator{0}, cuda::counting_iterator{size}, output.begin(), cuda::std::plus<>{});
+    CHECK(res == output.end());
+    CHECK(output[0] == 0);
+    CHECK(output[size - 1] == 2 * size - 3);
+  }
+
+  { // the values of the input
+    thrust::sequence(data.begin(), data.end(), 0, 3);
+    const auto res = cuda::std::adjacent_difference(policy, data.begin(), data.end(), output.begin());
+    CHECK(res == output.end());
+    CHECK(output[0] == 0);
+    CHECK(thrust::count(output.begin() + 1, output.end(), 3) == size - 1);
+  }
+}
+
+C2H_TEST("cuda::std::adjacent_difference on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> data(size);
+  thrust::host_vector<int> output(size);
+
+  SECTION("with par")
+  {
+    test_adjacent_difference(cuda::std::execution::par, data, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_adjacent_difference(cuda::std::execution::par_unseq, data, output);
+  }
+}
@@ -0,0 +1,99 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2>
+// ForwardIterator2 inclusive_scan(ExecutionPolicy&& exec,
+//                                 ForwardIterator1 first,
+//                                 ForwardIterator1 last,
+//                                 ForwardIterator2 result);
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class BinaryOperation, class T>
+// ForwardIterator2 inclusive_scan(ExecutionPolicy&& exec,
+//                                 ForwardIterator1 first,
+//                                 ForwardIterator1 last,
+//                                 ForwardIterator2 result,
+//                                 BinaryOperation binary_op,
+//                                 T init);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/equal.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr int size = 100000;
+
+template <class Policy>
+void test_inclusive_scan(const Policy& policy, thrust::host_vector<int>& data, thrust::host_vector<int>& output)
+{
+  { // empty should not access anything
+    const auto res = cuda::std::inclusive_scan(
+      policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+    CHECK(res == nullptr);
+  }
+
+  { // the carry of every chunk is the sum of the previous ones
+    const auto res =
+      cuda::std::inclusive_scan(policy, cuda::constant_iterator{1}, cuda::constant_iterator{1} + size, output.begin());
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::counting_iterator{1}));
+  }
+
+  { // with an operator and init
+    const auto res = cuda::std::inclusive_scan(
+      policy, cuda::constant_iterator{1}, cuda::constant_iterator{1} + size, output.begin(), cuda::std::plus<>{}, 42);
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::counting_iterator{43}));
+  }
+
+  { // in place
+    thrust::sequence(data.begin(), data.end(), 1, 0);
+    const auto res = cuda::std::inclusive_scan(policy, data.begin(), data.end(), data.begin());
+    CHECK(res == data.end());
+    CHECK(thrust::equal(data.begin(), data.end(), cuda::counting_iterator{1}));
+  }
+
+  { // transform_inclusive_scan
+    const auto res = cuda::std::transform_inclusive_scan(
+      policy,
+      cuda::counting_iterator{0},
+      cuda::counting_iterator{size},
+      output.begin(),
+      cuda::std::plus<>{},
+      [](const int) {
+        return 2;
+      });
+    CHECK(res == output.end());
+    CHECK(thrust::equal(output.begin(), output.end(), cuda::strided_iterator{cuda::counting_iterator{2}, 2}));
+  }
+}
+
+C2H_TEST("cuda::std::inclusive_scan on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<int> data(size);
+  thrust::host_vector<int> output(size);
+
+  SECTION("with par")
+  {
+    test_inclusive_scan(cuda::std::execution::par, data, output);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_inclusive_scan(cuda::std::execution::par_unseq, data, output);
+  }
+}
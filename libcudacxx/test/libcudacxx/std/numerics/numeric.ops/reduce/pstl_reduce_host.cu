@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator>
+//   typename iterator_traits<ForwardIterator>::value_type
+//     reduce(ExecutionPolicy&& exec,
+//            ForwardIterator first, ForwardIterator last);
+// template<class ExecutionPolicy, class ForwardIterator, class T, class BinaryOperation>
+//   T reduce(ExecutionPolicy&& exec,
+//            ForwardIterator first, ForwardIterator last, T init,
+//            BinaryOperation binary_op);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+
+#include <cuda/iterator>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include <testing.cuh>
+
+#include "test_iterators.h"
+
+// more than one chunk of the CPU backends
+inline constexpr long long size = 100000;
+
+template <class Policy>
+void test_reduce(const Policy& policy, const thrust::host_vector<long long>& data)
+{
+  constexpr long long expected = size * (size + 1) / 2;
+
+  { // empty should not access anything
+    CHECK(cuda::std::reduce(policy, static_cast<long long*>(nullptr), static_cast<long long*>(nullptr)) == 0);
+  }
+
+  {
+    CHECK(cuda::std::reduce(policy, data.begin(), data.end()) == expected);
+  }
+
+  { // with init and operator
+    CHECK(cuda::std::reduce(policy, data.begin(), data.end(), 42ll, cuda::std::plus<>{}) == expected + 42);
+  }
+
+  { // with a fancy iterator
+    CHECK(cuda::std::reduce(policy, cuda::counting_iterator{1ll}, cuda::counting_iterator{size + 1}) == expected);
+  }
+
+  { // non contiguous input
+    const auto* ptr = data.data();
+    CHECK(cuda::std::reduce(policy, random_access_iterator{ptr}, random_access_iterator{ptr + size}) == expected);
+  }
+}
+
+C2H_TEST("cuda::std::reduce on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<long long> data(size);
+  thrust::sequence(data.begin(), data.end(), 1);
+
+  SECTION("with par")
+  {
+    test_reduce(cuda::std::execution::par, data);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_reduce(cuda::std::execution::par_unseq, data);
+  }
+}
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class ForwardIterator1, class ForwardIterator2, class T>
+// T transform_reduce(ExecutionPolicy&& exec,
+//                    ForwardIterator1 first1, ForwardIterator1 last1,
+//                    ForwardIterator2 first2, T init);
+// template<class ExecutionPolicy, class ForwardIterator, class T, class BinaryOperation, class UnaryOperation>
+// T transform_reduce(ExecutionPolicy&& exec,
+//                    ForwardIterator first, ForwardIterator last, T init,
+//                    BinaryOperation binary_op, UnaryOperation unary_op);
+
+// Runs the standard parallel policies on the CPU backend this test is built with
+
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include <testing.cuh>
+
+// more than one chunk of the CPU backends
+inline constexpr long long size = 100000;
+
+struct times_two
+{
+  constexpr long long operator()(const long long val) const noexcept
+  {
+    return 2 * val;
+  }
+};
+
+template <class Policy>
+void test_transform_reduce(const Policy& policy, const thrust::host_vector<long long>& data)
+{
+  constexpr long long expected = size * (size - 1) / 2;
+
+  { // empty should not access anything
+    auto* ptr = static_cast<long long*>(nullptr);
+    CHECK(cuda::std::transform_reduce(policy, ptr, ptr, 0ll, cuda::std::plus<>{}, times_two{}) == 0);
+  }
+
+  { // unary
+    CHECK(cuda::std::transform_reduce(
+            policy, cuda::counting_iterator{0ll}, cuda::counting_iterator{size}, 42ll, cuda::std::plus<>{}, times_two{})
+          == 2 * expected + 42);
+  }
+
+  { // binary
+    CHECK(cuda::std::transform_reduce(policy, data.begin(), data.end(), cuda::counting_iterator{0ll}, 0ll) == expected);
+  }
+}
+
+C2H_TEST("cuda::std::transform_reduce on the CPU backend", "[parallel algorithm]")
+{
+  thrust::host_vector<long long> data(size, 1);
+
+  SECTION("with par")
+  {
+    test_transform_reduce(cuda::std::execution::par, data);
+  }
+
+  SECTION("with par_unseq")
+  {
+    test_transform_reduce(cuda::std::execution::par_unseq, data);
+  }
+}
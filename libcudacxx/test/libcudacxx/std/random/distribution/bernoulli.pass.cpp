@@ -45,6 +45,7 @@ __host__ __device__ void test()
   using G                                    = cuda::std::philox4x64;
   constexpr cuda::std::array<P, 5> params    = {P(0.5), P(0.1), P(0.9), P(0.25), P(0.75)};
   test_distribution<D, false, G, test_constexpr>(params, bernoulli_cdf{});
+  test_distribution_bulk<D, false, G>(params, bernoulli_cdf{});
 }
 
 int main(int, char**)
@@ -47,6 +47,7 @@ __host__ __device__ void test()
   using G                                    = cuda::std::philox4x64;
   cuda::std::array<P, 5> params              = {P(T(1)), P(T(0.5)), P(T(2)), P(T(0.1)), P(T(10))};
   test_distribution<D, true, G, test_constexpr>(params, exponential_cdf<T>{});
+  test_distribution_bulk<D, true, G>(params, exponential_cdf<T>{});
 }
 
 int main(int, char**)
@@ -42,6 +42,7 @@ __host__ __device__ void test()
   using G                       = cuda::std::philox4x64;
   cuda::std::array<P, 5> params = {P(0, 1), P(10, 2), P(-5, 0.5), P(4, 5), P(1000, 100)};
   test_distribution<D, true, G, test_constexpr>(params, normal_cdf<T>{});
+  test_distribution_bulk<D, true, G>(params, normal_cdf<T>{});
 }
 
 int main(int, char**)
@@ -14,6 +14,7 @@
 // template<class IntType = int>
 // class uniform_int_distribution
 
+#include <cuda/random>
 #include <cuda/std/cassert>
 #include <cuda/std/random>
 
@@ -58,6 +59,13 @@ __host__ __device__ void test()
     P(cuda::std::numeric_limits<T>::min(), cuda::std::numeric_limits<T>::max()),
     P(100, 1000)};
   test_distribution<D, false, G, test_constexpr>(params, uniform_int_cdf<T>{});
+  // 32 uniform bits take Lemire's method, the 64 bits of philox4x64 and the 31 bits of minstd_rand the scalar
+  // operator()
+  test_distribution_bulk<D, false, G>(params, uniform_int_cdf<T>{});
+  test_distribution_bulk<D, false, cuda::std::philox4x32>(params, uniform_int_cdf<T>{});
+  test_distribution_bulk<D, false, cuda::std::minstd_rand>(params, uniform_int_cdf<T>{});
+  // Lemire's method draws the bits of philox4x32 with cuda::generate_random
+  static_assert(cuda::__has_bulk_generate_v<cuda::std::philox4x32>);
 }
 
 int main(int, char**)
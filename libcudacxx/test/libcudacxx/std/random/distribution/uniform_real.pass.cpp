@@ -14,6 +14,7 @@
 // template<class RealType = double>
 // class uniform_real_distribution
 
+#include <cuda/random>
 #include <cuda/std/cassert>
 #include <cuda/std/cmath>
 #include <cuda/std/random>
@@ -52,6 +53,15 @@ __host__ __device__ void test()
   using G                                    = cuda::std::philox4x64;
   cuda::std::array<P, 5> params              = {P(0, 1), P(-5, 5), P(10, 20), P(0, 100), P(-10, 0)};
   test_distribution<D, true, G, test_constexpr>(params, uniform_real_cdf<T>{});
+  test_distribution_bulk<D, true, G>(params, uniform_real_cdf<T>{});
+  test_distribution_bulk<D, true, cuda::std::philox4x32>(params, uniform_real_cdf<T>{});
+  test_distribution_bulk<D, true, cuda::pcg64>(params, uniform_real_cdf<T>{});
+  test_distribution_bulk<D, true, cuda::std::minstd_rand>(params, uniform_real_cdf<T>{});
+  // the bits of these engines are drawn with cuda::generate_random, the ones of minstd_rand with operator()
+  static_assert(cuda::__has_bulk_generate_v<G>);
+  static_assert(cuda::__has_bulk_generate_v<cuda::std::philox4x32>);
+  static_assert(cuda::__has_bulk_generate_v<cuda::pcg64>);
+  static_assert(!cuda::__has_bulk_generate_v<cuda::std::minstd_rand>);
 }
 
 int main(int, char**)
@@ -0,0 +1,401 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/bit>
+#include <cuda/std/charconv>
+#include <cuda/std/cmath>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr auto fixed      = cuda::std::chars_format::fixed;
+constexpr auto scientific = cuda::std::chars_format::scientific;
+constexpr auto general    = cuda::std::chars_format::general;
+constexpr auto hex        = cuda::std::chars_format::hex;
+
+constexpr auto ok           = cuda::std::errc{};
+constexpr auto invalid      = cuda::std::errc::invalid_argument;
+constexpr auto out_of_range = cuda::std::errc::result_out_of_range;
+
+constexpr double init_value = 7.25;
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  double val;
+  cuda::std::errc ec;
+  cuda::std::ptrdiff_t len;
+};
+
+// Source code for the generation of the test items, the float items are generated by passing any argument
+// #include <charconv>
+// #include <cstdio>
+// #include <cstring>
+// #include <iostream>
+// #include <string>
+//
+// constexpr const char* strs[] = {
+//   "0", "-0", "1", "0.1", "-2.5", ".5", "5.", "1e5", "1E-5x", "1e", "1e+", "12.5e-1", "00012.50", "", "-", "+1", ".",
+//   "e5", "123456789012345678901234567890", "0.000000000000000000000000000000001e33", "9007199254740993",
+//   "9007199254740993.0000000000000000000001", "1.00000000000000011102230246251565404236316680908203125",
+//   "1.000000000000000111022302462515654042363166809082031250001", "1.000000059604644775390625",
+//   "1.0000000596046447753906250000001", "2.4703282292062327e-324", "2.4703282292062328e-324",
+//   "4.9406564584124654e-324", "1.7976931348623157e308", "1.7976931348623159e308", "1e400", "-1e-400",
+//   "3.4028235e38", "3.40282357e38", "1.4e-45", "7e-46", "7.1e-46", "0x1p3", "1p3", "1.8p-3", "ff.8p+1", "1p-1074",
+//   "1p-1075", "1.0000001p-1075", "1p1024", "1.fffffffffffff8p1023", "ffffffp-149", "1p-150", "1.000001p-150",
+//   "1.ffffffp127"};
+// constexpr const char* fmt_names[] = {"fixed", "scientific", "general", "hex"};
+// constexpr std::chars_format fmts[] = {
+//   std::chars_format::fixed, std::chars_format::scientific, std::chars_format::general, std::chars_format::hex};
+//
+// const char* errc_name(std::errc ec)
+// {
+//   switch (ec)
+//   {
+//     case std::errc{}:
+//       return "ok";
+//     case std::errc::invalid_argument:
+//       return "invalid";
+//     default:
+//       return "out_of_range";
+//   }
+// }
+//
+// // The value is not modified on error, so the expected value is the initial one
+// template <class T>
+// void print_items(T init, const char* suffix)
+// {
+//   for (const char* str : strs)
+//   {
+//     for (int f = 0; f < 4; ++f)
+//     {
+//       T val        = init;
+//       const auto r = std::from_chars(str, str + std::strlen(str), val, fmts[f]);
+//       char val_str[64];
+//       std::snprintf(val_str, sizeof(val_str), "%a%s", static_cast<double>(val), suffix);
+//       std::cout << "    TestItem{\"" << str << "\", " << fmt_names[f] << ", " << val_str << ", " << errc_name(r.ec)
+//                 << ", " << (r.ptr - str) << "},\n";
+//     }
+//   }
+// }
+//
+// int main(int argc, char**)
+// {
+//   if (argc == 1)
+//   {
+//     print_items(7.25, "");
+//   }
+//   else
+//   {
+//     print_items(7.25f, "f");
+//   }
+// }
+
+__host__ __device__ constexpr cuda::std::array<TestItem, 204> get_test_items()
+{
+  return {{
+    TestItem{"0", fixed, 0x0p+0, ok, 1},
+    TestItem{"0", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"0", general, 0x0p+0, ok, 1},
+    TestItem{"0", hex, 0x0p+0, ok, 1},
+    TestItem{"-0", fixed, -0x0p+0, ok, 2},
+    TestItem{"-0", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"-0", general, -0x0p+0, ok, 2},
+    TestItem{"-0", hex, -0x0p+0, ok, 2},
+    TestItem{"1", fixed, 0x1p+0, ok, 1},
+    TestItem{"1", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1", general, 0x1p+0, ok, 1},
+    TestItem{"1", hex, 0x1p+0, ok, 1},
+    TestItem{"0.1", fixed, 0x1.999999999999ap-4, ok, 3},
+    TestItem{"0.1", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"0.1", general, 0x1.999999999999ap-4, ok, 3},
+    TestItem{"0.1", hex, 0x1p-4, ok, 3},
+    TestItem{"-2.5", fixed, -0x1.4p+1, ok, 4},
+    TestItem{"-2.5", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"-2.5", general, -0x1.4p+1, ok, 4},
+    TestItem{"-2.5", hex, -0x1.28p+1, ok, 4},
+    TestItem{".5", fixed, 0x1p-1, ok, 2},
+    TestItem{".5", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{".5", general, 0x1p-1, ok, 2},
+    TestItem{".5", hex, 0x1.4p-2, ok, 2},
+    TestItem{"5.", fixed, 0x1.4p+2, ok, 2},
+    TestItem{"5.", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"5.", general, 0x1.4p+2, ok, 2},
+    TestItem{"5.", hex, 0x1.4p+2, ok, 2},
+    TestItem{"1e5", fixed, 0x1p+0, ok, 1},
+    TestItem{"1e5", scientific, 0x1.86ap+16, ok, 3},
+    TestItem{"1e5", general, 0x1.86ap+16, ok, 3},
+    TestItem{"1e5", hex, 0x1.e5p+8, ok, 3},
+    TestItem{"1E-5x", fixed, 0x1p+0, ok, 1},
+    TestItem{"1E-5x", scientific, 0x1.4f8b588e368f1p-17, ok, 4},
+    TestItem{"1E-5x", general, 0x1.4f8b588e368f1p-17, ok, 4},
+    TestItem{"1E-5x", hex, 0x1.ep+4, ok, 2},
+    TestItem{"1e", fixed, 0x1p+0, ok, 1},
+    TestItem{"1e", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1e", general, 0x1p+0, ok, 1},
+    TestItem{"1e", hex, 0x1.ep+4, ok, 2},
+    TestItem{"1e+", fixed, 0x1p+0, ok, 1},
+    TestItem{"1e+", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1e+", general, 0x1p+0, ok, 1},
+    TestItem{"1e+", hex, 0x1.ep+4, ok, 2},
+    TestItem{"12.5e-1", fixed, 0x1.9p+3, ok, 4},
+    TestItem{"12.5e-1", scientific, 0x1.4p+0, ok, 7},
+    TestItem{"12.5e-1", general, 0x1.4p+0, ok, 7},
+    TestItem{"12.5e-1", hex, 0x1.25ep+4, ok, 5},
+    TestItem{"00012.50", fixed, 0x1.9p+3, ok, 8},
+    TestItem{"00012.50", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"00012.50", general, 0x1.9p+3, ok, 8},
+    TestItem{"00012.50", hex, 0x1.25p+4, ok, 8},
+    TestItem{"", fixed, 0x1.dp+2, invalid, 0},
+    TestItem{"", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"", general, 0x1.dp+2, invalid, 0},
+    TestItem{"", hex, 0x1.dp+2, invalid, 0},
+    TestItem{"-", fixed, 0x1.dp+2, invalid, 0},
+    TestItem{"-", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"-", general, 0x1.dp+2, invalid, 0},
+    TestItem{"-", hex, 0x1.dp+2, invalid, 0},
+    TestItem{"+1", fixed, 0x1.dp+2, invalid, 0},
+    TestItem{"+1", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"+1", general, 0x1.dp+2, invalid, 0},
+    TestItem{"+1", hex, 0x1.dp+2, invalid, 0},
+    TestItem{".", fixed, 0x1.dp+2, invalid, 0},
+    TestItem{".", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{".", general, 0x1.dp+2, invalid, 0},
+    TestItem{".", hex, 0x1.dp+2, invalid, 0},
+    TestItem{"e5", fixed, 0x1.dp+2, invalid, 0},
+    TestItem{"e5", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"e5", general, 0x1.dp+2, invalid, 0},
+    TestItem{"e5", hex, 0x1.cap+7, ok, 2},
+    TestItem{"123456789012345678901234567890", fixed, 0x1.8ee90ff6c373ep+96, ok, 30},
+    TestItem{"123456789012345678901234567890", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"123456789012345678901234567890", general, 0x1.8ee90ff6c373ep+96, ok, 30},
+    TestItem{"123456789012345678901234567890", hex, 0x1.2345678901234p+116, ok, 30},
+    TestItem{"0.000000000000000000000000000000001e33", fixed, 0x1.4c4e977ba1f5cp-110, ok, 35},
+    TestItem{"0.000000000000000000000000000000001e33", scientific, 0x1p+0, ok, 38},
+    TestItem{"0.000000000000000000000000000000001e33", general, 0x1p+0, ok, 38},
+    TestItem{"0.000000000000000000000000000000001e33", hex, 0x1.e33p-132, ok, 38},
+    TestItem{"9007199254740993", fixed, 0x1p+53, ok, 16},
+    TestItem{"9007199254740993", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"9007199254740993", general, 0x1p+53, ok, 16},
+    TestItem{"9007199254740993", hex, 0x1.200e3324a8e81p+63, ok, 16},
+    TestItem{"9007199254740993.0000000000000000000001", fixed, 0x1.0000000000001p+53, ok, 39},
+    TestItem{"9007199254740993.0000000000000000000001", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"9007199254740993.0000000000000000000001", general, 0x1.0000000000001p+53, ok, 39},
+    TestItem{"9007199254740993.0000000000000000000001", hex, 0x1.200e3324a8e81p+63, ok, 39},
+    TestItem{"1.00000000000000011102230246251565404236316680908203125", fixed, 0x1p+0, ok, 55},
+    TestItem{"1.00000000000000011102230246251565404236316680908203125", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1.00000000000000011102230246251565404236316680908203125", general, 0x1p+0, ok, 55},
+    TestItem{"1.00000000000000011102230246251565404236316680908203125", hex, 0x1p+0, ok, 55},
+    TestItem{"1.000000000000000111022302462515654042363166809082031250001", fixed, 0x1.0000000000001p+0, ok, 59},
+    TestItem{"1.000000000000000111022302462515654042363166809082031250001", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1.000000000000000111022302462515654042363166809082031250001", general, 0x1.0000000000001p+0, ok, 59},
+    TestItem{"1.000000000000000111022302462515654042363166809082031250001", hex, 0x1p+0, ok, 59},
+    TestItem{"1.000000059604644775390625", fixed, 0x1.000001p+0, ok, 26},
+    TestItem{"1.000000059604644775390625", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1.000000059604644775390625", general, 0x1.000001p+0, ok, 26},
+    TestItem{"1.000000059604644775390625", hex, 0x1.0000000596046p+0, ok, 26},
+    TestItem{"1.0000000596046447753906250000001", fixed, 0x1.000001p+0, ok, 33},
+    TestItem{"1.0000000596046447753906250000001", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1.0000000596046447753906250000001", general, 0x1.000001p+0, ok, 33},
+    TestItem{"1.0000000596046447753906250000001", hex, 0x1.0000000596046p+0, ok, 33},
+    TestItem{"2.4703282292062327e-324", fixed, 0x1.3c33b72569c63p+1, ok, 18},
+    TestItem{"2.4703282292062327e-324", scientific, 0x1.dp+2, out_of_range, 23},
+    TestItem{"2.4703282292062327e-324", general, 0x1.dp+2, out_of_range, 23},
+    TestItem{"2.4703282292062327e-324", hex, 0x1.2381941149031p+1, ok, 19},
+    TestItem{"2.4703282292062328e-324", fixed, 0x1.3c33b72569c64p+1, ok, 18},
+    TestItem{"2.4703282292062328e-324", scientific, 0x0.0000000000001p-1022, ok, 23},
+    TestItem{"2.4703282292062328e-324", general, 0x0.0000000000001p-1022, ok, 23},
+    TestItem{"2.4703282292062328e-324", hex, 0x1.2381941149031p+1, ok, 19},
+    TestItem{"4.9406564584124654e-324", fixed, 0x1.3c33b72569c63p+2, ok, 18},
+    TestItem{"4.9406564584124654e-324", scientific, 0x0.0000000000001p-1022, ok, 23},
+    TestItem{"4.9406564584124654e-324", general, 0x0.0000000000001p-1022, ok, 23},
+    TestItem{"4.9406564584124654e-324", hex, 0x1.2501959161049p+2, ok, 19},
+    TestItem{"1.7976931348623157e308", fixed, 0x1.cc359e067a348p+0, ok, 18},
+    TestItem{"1.7976931348623157e308", scientific, 0x1.fffffffffffffp+1023, ok, 22},
+    TestItem{"1.7976931348623157e308", general, 0x1.fffffffffffffp+1023, ok, 22},
+    TestItem{"1.7976931348623157e308", hex, 0x1.7976931348623p+0, ok, 22},
+    TestItem{"1.7976931348623159e308", fixed, 0x1.cc359e067a349p+0, ok, 18},
+    TestItem{"1.7976931348623159e308", scientific, 0x1.dp+2, out_of_range, 22},
+    TestItem{"1.7976931348623159e308", general, 0x1.dp+2, out_of_range, 22},
+    TestItem{"1.7976931348623159e308", hex, 0x1.7976931348623p+0, ok, 22},
+    TestItem{"1e400", fixed, 0x1p+0, ok, 1},
+    TestItem{"1e400", scientific, 0x1.dp+2, out_of_range, 5},
+    TestItem{"1e400", general, 0x1.dp+2, out_of_range, 5},
+    TestItem{"1e400", hex, 0x1.e4p+16, ok, 5},
+    TestItem{"-1e-400", fixed, -0x1p+0, ok, 2},
+    TestItem{"-1e-400", scientific, 0x1.dp+2, out_of_range, 7},
+    TestItem{"-1e-400", general, 0x1.dp+2, out_of_range, 7},
+    TestItem{"-1e-400", hex, -0x1.ep+4, ok, 3},
+    TestItem{"3.4028235e38", fixed, 0x1.b38fb86f47b67p+1, ok, 9},
+    TestItem{"3.4028235e38", scientific, 0x1.fffffe54daff8p+127, ok, 12},
+    TestItem{"3.4028235e38", general, 0x1.fffffe54daff8p+127, ok, 12},
+    TestItem{"3.4028235e38", hex, 0x1.a01411af1cp+1, ok, 12},
+    TestItem{"3.40282357e38", fixed, 0x1.b38fb9059a9eap+1, ok, 10},
+    TestItem{"3.40282357e38", scientific, 0x1.ffffff058f701p+127, ok, 13},
+    TestItem{"3.40282357e38", general, 0x1.ffffff058f701p+127, ok, 13},
+    TestItem{"3.40282357e38", hex, 0x1.a01411abf1cp+1, ok, 13},
+    TestItem{"1.4e-45", fixed, 0x1.6666666666666p+0, ok, 3},
+    TestItem{"1.4e-45", scientific, 0x1.ff868bf4d956ap-150, ok, 7},
+    TestItem{"1.4e-45", general, 0x1.ff868bf4d956ap-150, ok, 7},
+    TestItem{"1.4e-45", hex, 0x1.4ep+0, ok, 4},
+    TestItem{"7e-46", fixed, 0x1.cp+2, ok, 1},
+    TestItem{"7e-46", scientific, 0x1.ff868bf4d956ap-151, ok, 5},
+    TestItem{"7e-46", general, 0x1.ff868bf4d956ap-151, ok, 5},
+    TestItem{"7e-46", hex, 0x1.f8p+6, ok, 2},
+    TestItem{"7.1e-46", fixed, 0x1.c666666666666p+2, ok, 3},
+    TestItem{"7.1e-46", scientific, 0x1.036aa2680f22cp-150, ok, 7},
+    TestItem{"7.1e-46", general, 0x1.036aa2680f22cp-150, ok, 7},
+    TestItem{"7.1e-46", hex, 0x1.c78p+2, ok, 4},
+    TestItem{"0x1p3", fixed, 0x0p+0, ok, 1},
+    TestItem{"0x1p3", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"0x1p3", general, 0x0p+0, ok, 1},
+    TestItem{"0x1p3", hex, 0x0p+0, ok, 1},
+    TestItem{"1p3", fixed, 0x1p+0, ok, 1},
+    TestItem{"1p3", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1p3", general, 0x1p+0, ok, 1},
+    TestItem{"1p3", hex, 0x1p+3, ok, 3},
+    TestItem{"1.8p-3", fixed, 0x1.ccccccccccccdp+0, ok, 3},
+    TestItem{"1.8p-3", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1.8p-3", general, 0x1.ccccccccccccdp+0, ok, 3},
+    TestItem{"1.8p-3", hex, 0x1.8p-3, ok, 6},
+    TestItem{"ff.8p+1", fixed, 0x1.dp+2, invalid, 0},
+    TestItem{"ff.8p+1", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"ff.8p+1", general, 0x1.dp+2, invalid, 0},
+    TestItem{"ff.8p+1", hex, 0x1.ffp+8, ok, 7},
+    TestItem{"1p-1074", fixed, 0x1p+0, ok, 1},
+    TestItem{"1p-1074", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1p-1074", general, 0x1p+0, ok, 1},
+    TestItem{"1p-1074", hex, 0x0.0000000000001p-1022, ok, 7},
+    TestItem{"1p-1075", fixed, 0x1p+0, ok, 1},
+    TestItem{"1p-1075", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1p-1075", general, 0x1p+0, ok, 1},
+    TestItem{"1p-1075", hex, 0x1.dp+2, out_of_range, 7},
+    TestItem{"1.0000001p-1075", fixed, 0x1.000001ad7f29bp+0, ok, 9},
+    TestItem{"1.0000001p-1075", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1.0000001p-1075", general, 0x1.000001ad7f29bp+0, ok, 9},
+    TestItem{"1.0000001p-1075", hex, 0x0.0000000000001p-1022, ok, 15},
+    TestItem{"1p1024", fixed, 0x1p+0, ok, 1},
+    TestItem{"1p1024", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1p1024", general, 0x1p+0, ok, 1},
+    TestItem{"1p1024", hex, 0x1.dp+2, out_of_range, 6},
+    TestItem{"1.fffffffffffff8p1023", fixed, 0x1p+0, ok, 2},
+    TestItem{"1.fffffffffffff8p1023", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1.fffffffffffff8p1023", general, 0x1p+0, ok, 2},
+    TestItem{"1.fffffffffffff8p1023", hex, 0x1.dp+2, out_of_range, 21},
+    TestItem{"ffffffp-149", fixed, 0x1.dp+2, invalid, 0},
+    TestItem{"ffffffp-149", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"ffffffp-149", general, 0x1.dp+2, invalid, 0},
+    TestItem{"ffffffp-149", hex, 0x1.fffffep-126, ok, 11},
+    TestItem{"1p-150", fixed, 0x1p+0, ok, 1},
+    TestItem{"1p-150", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1p-150", general, 0x1p+0, ok, 1},
+    TestItem{"1p-150", hex, 0x1p-150, ok, 6},
+    TestItem{"1.000001p-150", fixed, 0x1.000010c6f7a0bp+0, ok, 8},
+    TestItem{"1.000001p-150", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1.000001p-150", general, 0x1.000010c6f7a0bp+0, ok, 8},
+    TestItem{"1.000001p-150", hex, 0x1.000001p-150, ok, 13},
+    TestItem{"1.ffffffp127", fixed, 0x1p+0, ok, 2},
+    TestItem{"1.ffffffp127", scientific, 0x1.dp+2, invalid, 0},
+    TestItem{"1.ffffffp127", general, 0x1p+0, ok, 2},
+    TestItem{"1.ffffffp127", hex, 0x1.ffffffp+127, ok, 12},
+  }};
+}
+
+__host__ __device__ void test_from_chars(const TestItem& item)
+{
+  using bits_type = cuda::std::conditional_t<sizeof(double) == 4, cuda::std::uint32_t, cuda::std::uint64_t>;
+
+  const char* first = item.str;
+  const char* last  = first + cuda::std::strlen(first);
+
+  double val        = init_value;
+  const auto result = cuda::std::from_chars(first, last, val, item.fmt);
+  assert(result.ec == item.ec);
+  assert(result.ptr == first + item.len);
+
+  // Compare the representations to distinguish the signed zeros
+  assert(cuda::std::bit_cast<bits_type>(val) == cuda::std::bit_cast<bits_type>(item.val));
+}
+
+__host__ __device__ void test_non_finite()
+{
+  struct NonFiniteItem
+  {
+    const char* str;
+    cuda::std::ptrdiff_t len;
+    bool is_nan;
+    bool negative;
+  };
+
+  constexpr NonFiniteItem items[] = {
+    {"inf", 3, false, false},
+    {"-INF", 4, false, true},
+    {"infinity", 8, false, false},
+    {"-Infinityx", 9, false, true},
+    {"infinit", 3, false, false},
+    {"nan", 3, true, false},
+    {"-NaN", 4, true, true},
+    {"nan(abc_123)", 12, true, false},
+    {"nan()", 5, true, false},
+    {"nan(abc", 3, true, false},
+    {"nan(a-b)", 3, true, false},
+  };
+
+  for (const auto fmt : {fixed, scientific, general, hex})
+  {
+    for (const auto& item : items)
+    {
+      const char* first = item.str;
+      const char* last  = first + cuda::std::strlen(first);
+
+      double val        = init_value;
+      const auto result = cuda::std::from_chars(first, last, val, fmt);
+      assert(result.ec == ok);
+      assert(result.ptr == first + item.len);
+      assert((val != val) == item.is_nan);
+      assert(item.is_nan || val == ((item.negative) ? -1 : 1) * cuda::std::numeric_limits<double>::infinity());
+      assert(cuda::std::signbit(val) == item.negative);
+    }
+  }
+}
+
+__host__ __device__ void test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<const char*>(),
+                                       cuda::std::declval<double&>()))>);
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<double&>())));
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<double&>(), general)));
+
+  constexpr auto items = get_test_items();
+
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+
+  test_non_finite();
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
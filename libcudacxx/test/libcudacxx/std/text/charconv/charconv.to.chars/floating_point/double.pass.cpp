@@ -0,0 +1,456 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr int no_precision = INT_MIN;
+
+struct TestItem
+{
+  double val;
+  cuda::std::chars_format fmt;
+  int precision;
+  const char* str;
+};
+
+// Source code for the generation of the test items, the float items are generated by passing any argument
+// #include <charconv>
+// #include <iostream>
+// #include <string>
+//
+// constexpr const char* fmt_names[] = {
+//   "cuda::std::chars_format{}",
+//   "cuda::std::chars_format::fixed",
+//   "cuda::std::chars_format::scientific",
+//   "cuda::std::chars_format::general",
+//   "cuda::std::chars_format::hex"};
+// constexpr std::chars_format fmts[] = {
+//   std::chars_format{},
+//   std::chars_format::fixed,
+//   std::chars_format::scientific,
+//   std::chars_format::general,
+//   std::chars_format::hex};
+// constexpr int precisions[] = {-1, 0, 3, 17};
+//
+// // Items that do not fit into a line are skipped
+// void print_item(const char* lit, const char* fmt, const std::string& precision, const char* first, const char* last)
+// {
+//   const std::string item =
+//     "    TestItem{" + std::string(lit) + ", " + fmt + ", " + precision + ", \"" + std::string(first, last) + "\"},";
+//   if (item.size() <= 120)
+//   {
+//     std::cout << item << "\n";
+//   }
+// }
+//
+// template <class T, std::size_t N>
+// void print_items(const char* const (&lits)[N], const T (&vals)[N])
+// {
+//   for (std::size_t i = 0; i < N; ++i)
+//   {
+//     char buff[1000];
+//     auto r = std::to_chars(buff, buff + 1000, vals[i]);
+//     print_item(lits[i], fmt_names[0], "no_precision", buff, r.ptr);
+//     for (int f = 1; f < 5; ++f)
+//     {
+//       r = std::to_chars(buff, buff + 1000, vals[i], fmts[f]);
+//       print_item(lits[i], fmt_names[f], "no_precision", buff, r.ptr);
+//       for (int p : precisions)
+//       {
+//         r = std::to_chars(buff, buff + 1000, vals[i], fmts[f], p);
+//         print_item(lits[i], fmt_names[f], std::to_string(p), buff, r.ptr);
+//       }
+//     }
+//   }
+// }
+//
+// int main(int argc, char**)
+// {
+//   if (argc == 1)
+//   {
+//     const char* const lits[] = {
+//       "0.0", "-0.0", "1.0", "0.1", "-2.5", "123456.789", "1e-7", "1e23", "9007199254740993.0", "5e-324",
+//       "2.2250738585072014e-308", "1.7976931348623157e308"};
+//     const double vals[] = {
+//       0.0, -0.0, 1.0, 0.1, -2.5, 123456.789, 1e-7, 1e23, 9007199254740993.0, 5e-324,
+//       2.2250738585072014e-308, 1.7976931348623157e308};
+//     print_items(lits, vals);
+//   }
+//   else
+//   {
+//     const char* const lits[] = {
+//       "0.0f", "-0.0f", "1.0f", "0.1f", "-2.5f", "123456.79f", "1e-7f", "67108864.0f", "1e-45f", "1.17549435e-38f",
+//       "3.40282347e38f"};
+//     const float vals[] = {
+//       0.0f, -0.0f, 1.0f, 0.1f, -2.5f, 123456.79f, 1e-7f, 67108864.0f, 1e-45f, 1.17549435e-38f, 3.40282347e38f};
+//     print_items(lits, vals);
+//   }
+// }
+
+__host__ __device__ constexpr cuda::std::array<TestItem, 245> get_test_items()
+{
+  return {{
+    TestItem{0.0, cuda::std::chars_format{}, no_precision, "0"},
+    TestItem{0.0, cuda::std::chars_format::fixed, no_precision, "0"},
+    TestItem{0.0, cuda::std::chars_format::fixed, -1, "0.000000"},
+    TestItem{0.0, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.0, cuda::std::chars_format::fixed, 3, "0.000"},
+    TestItem{0.0, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{0.0, cuda::std::chars_format::scientific, no_precision, "0e+00"},
+    TestItem{0.0, cuda::std::chars_format::scientific, -1, "0.000000e+00"},
+    TestItem{0.0, cuda::std::chars_format::scientific, 0, "0e+00"},
+    TestItem{0.0, cuda::std::chars_format::scientific, 3, "0.000e+00"},
+    TestItem{0.0, cuda::std::chars_format::scientific, 17, "0.00000000000000000e+00"},
+    TestItem{0.0, cuda::std::chars_format::general, no_precision, "0"},
+    TestItem{0.0, cuda::std::chars_format::general, -1, "0"},
+    TestItem{0.0, cuda::std::chars_format::general, 0, "0"},
+    TestItem{0.0, cuda::std::chars_format::general, 3, "0"},
+    TestItem{0.0, cuda::std::chars_format::general, 17, "0"},
+    TestItem{0.0, cuda::std::chars_format::hex, no_precision, "0p+0"},
+    TestItem{0.0, cuda::std::chars_format::hex, -1, "0p+0"},
+    TestItem{0.0, cuda::std::chars_format::hex, 0, "0p+0"},
+    TestItem{0.0, cuda::std::chars_format::hex, 3, "0.000p+0"},
+    TestItem{0.0, cuda::std::chars_format::hex, 17, "0.00000000000000000p+0"},
+    TestItem{-0.0, cuda::std::chars_format{}, no_precision, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::fixed, no_precision, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::fixed, -1, "-0.000000"},
+    TestItem{-0.0, cuda::std::chars_format::fixed, 0, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::fixed, 3, "-0.000"},
+    TestItem{-0.0, cuda::std::chars_format::fixed, 17, "-0.00000000000000000"},
+    TestItem{-0.0, cuda::std::chars_format::scientific, no_precision, "-0e+00"},
+    TestItem{-0.0, cuda::std::chars_format::scientific, -1, "-0.000000e+00"},
+    TestItem{-0.0, cuda::std::chars_format::scientific, 0, "-0e+00"},
+    TestItem{-0.0, cuda::std::chars_format::scientific, 3, "-0.000e+00"},
+    TestItem{-0.0, cuda::std::chars_format::scientific, 17, "-0.00000000000000000e+00"},
+    TestItem{-0.0, cuda::std::chars_format::general, no_precision, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::general, -1, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::general, 0, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::general, 3, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::general, 17, "-0"},
+    TestItem{-0.0, cuda::std::chars_format::hex, no_precision, "-0p+0"},
+    TestItem{-0.0, cuda::std::chars_format::hex, -1, "-0p+0"},
+    TestItem{-0.0, cuda::std::chars_format::hex, 0, "-0p+0"},
+    TestItem{-0.0, cuda::std::chars_format::hex, 3, "-0.000p+0"},
+    TestItem{-0.0, cuda::std::chars_format::hex, 17, "-0.00000000000000000p+0"},
+    TestItem{1.0, cuda::std::chars_format{}, no_precision, "1"},
+    TestItem{1.0, cuda::std::chars_format::fixed, no_precision, "1"},
+    TestItem{1.0, cuda::std::chars_format::fixed, -1, "1.000000"},
+    TestItem{1.0, cuda::std::chars_format::fixed, 0, "1"},
+    TestItem{1.0, cuda::std::chars_format::fixed, 3, "1.000"},
+    TestItem{1.0, cuda::std::chars_format::fixed, 17, "1.00000000000000000"},
+    TestItem{1.0, cuda::std::chars_format::scientific, no_precision, "1e+00"},
+    TestItem{1.0, cuda::std::chars_format::scientific, -1, "1.000000e+00"},
+    TestItem{1.0, cuda::std::chars_format::scientific, 0, "1e+00"},
+    TestItem{1.0, cuda::std::chars_format::scientific, 3, "1.000e+00"},
+    TestItem{1.0, cuda::std::chars_format::scientific, 17, "1.00000000000000000e+00"},
+    TestItem{1.0, cuda::std::chars_format::general, no_precision, "1"},
+    TestItem{1.0, cuda::std::chars_format::general, -1, "1"},
+    TestItem{1.0, cuda::std::chars_format::general, 0, "1"},
+    TestItem{1.0, cuda::std::chars_format::general, 3, "1"},
+    TestItem{1.0, cuda::std::chars_format::general, 17, "1"},
+    TestItem{1.0, cuda::std::chars_format::hex, no_precision, "1p+0"},
+    TestItem{1.0, cuda::std::chars_format::hex, -1, "1p+0"},
+    TestItem{1.0, cuda::std::chars_format::hex, 0, "1p+0"},
+    TestItem{1.0, cuda::std::chars_format::hex, 3, "1.000p+0"},
+    TestItem{1.0, cuda::std::chars_format::hex, 17, "1.00000000000000000p+0"},
+    TestItem{0.1, cuda::std::chars_format{}, no_precision, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::fixed, no_precision, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::fixed, -1, "0.100000"},
+    TestItem{0.1, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.1, cuda::std::chars_format::fixed, 3, "0.100"},
+    TestItem{0.1, cuda::std::chars_format::fixed, 17, "0.10000000000000001"},
+    TestItem{0.1, cuda::std::chars_format::scientific, no_precision, "1e-01"},
+    TestItem{0.1, cuda::std::chars_format::scientific, -1, "1.000000e-01"},
+    TestItem{0.1, cuda::std::chars_format::scientific, 0, "1e-01"},
+    TestItem{0.1, cuda::std::chars_format::scientific, 3, "1.000e-01"},
+    TestItem{0.1, cuda::std::chars_format::scientific, 17, "1.00000000000000006e-01"},
+    TestItem{0.1, cuda::std::chars_format::general, no_precision, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::general, -1, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::general, 0, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::general, 3, "0.1"},
+    TestItem{0.1, cuda::std::chars_format::general, 17, "0.10000000000000001"},
+    TestItem{0.1, cuda::std::chars_format::hex, no_precision, "1.999999999999ap-4"},
+    TestItem{0.1, cuda::std::chars_format::hex, -1, "1.999999999999ap-4"},
+    TestItem{0.1, cuda::std::chars_format::hex, 0, "2p-4"},
+    TestItem{0.1, cuda::std::chars_format::hex, 3, "1.99ap-4"},
+    TestItem{0.1, cuda::std::chars_format::hex, 17, "1.999999999999a0000p-4"},
+    TestItem{-2.5, cuda::std::chars_format{}, no_precision, "-2.5"},
+    TestItem{-2.5, cuda::std::chars_format::fixed, no_precision, "-2.5"},
+    TestItem{-2.5, cuda::std::chars_format::fixed, -1, "-2.500000"},
+    TestItem{-2.5, cuda::std::chars_format::fixed, 0, "-2"},
+    TestItem{-2.5, cuda::std::chars_format::fixed, 3, "-2.500"},
+    TestItem{-2.5, cuda::std::chars_format::fixed, 17, "-2.50000000000000000"},
+    TestItem{-2.5, cuda::std::chars_format::scientific, no_precision, "-2.5e+00"},
+    TestItem{-2.5, cuda::std::chars_format::scientific, -1, "-2.500000e+00"},
+    TestItem{-2.5, cuda::std::chars_format::scientific, 0, "-2e+00"},
+    TestItem{-2.5, cuda::std::chars_format::scientific, 3, "-2.500e+00"},
+    TestItem{-2.5, cuda::std::chars_format::scientific, 17, "-2.50000000000000000e+00"},
+    TestItem{-2.5, cuda::std::chars_format::general, no_precision, "-2.5"},
+    TestItem{-2.5, cuda::std::chars_format::general, -1, "-2.5"},
+    TestItem{-2.5, cuda::std::chars_format::general, 0, "-2"},
+    TestItem{-2.5, cuda::std::chars_format::general, 3, "-2.5"},
+    TestItem{-2.5, cuda::std::chars_format::general, 17, "-2.5"},
+    TestItem{-2.5, cuda::std::chars_format::hex, no_precision, "-1.4p+1"},
+    TestItem{-2.5, cuda::std::chars_format::hex, -1, "-1.4p+1"},
+    TestItem{-2.5, cuda::std::chars_format::hex, 0, "-1p+1"},
+    TestItem{-2.5, cuda::std::chars_format::hex, 3, "-1.400p+1"},
+    TestItem{-2.5, cuda::std::chars_format::hex, 17, "-1.40000000000000000p+1"},
+    TestItem{123456.789, cuda::std::chars_format{}, no_precision, "123456.789"},
+    TestItem{123456.789, cuda::std::chars_format::fixed, no_precision, "123456.789"},
+    TestItem{123456.789, cuda::std::chars_format::fixed, -1, "123456.789000"},
+    TestItem{123456.789, cuda::std::chars_format::fixed, 0, "123457"},
+    TestItem{123456.789, cuda::std::chars_format::fixed, 3, "123456.789"},
+    TestItem{123456.789, cuda::std::chars_format::fixed, 17, "123456.78900000000430737"},
+    TestItem{123456.789, cuda::std::chars_format::scientific, no_precision, "1.23456789e+05"},
+    TestItem{123456.789, cuda::std::chars_format::scientific, -1, "1.234568e+05"},
+    TestItem{123456.789, cuda::std::chars_format::scientific, 0, "1e+05"},
+    TestItem{123456.789, cuda::std::chars_format::scientific, 3, "1.235e+05"},
+    TestItem{123456.789, cuda::std::chars_format::scientific, 17, "1.23456789000000004e+05"},
+    TestItem{123456.789, cuda::std::chars_format::general, no_precision, "123456.789"},
+    TestItem{123456.789, cuda::std::chars_format::general, -1, "123457"},
+    TestItem{123456.789, cuda::std::chars_format::general, 0, "1e+05"},
+    TestItem{123456.789, cuda::std::chars_format::general, 3, "1.23e+05"},
+    TestItem{123456.789, cuda::std::chars_format::general, 17, "123456.789"},
+    TestItem{123456.789, cuda::std::chars_format::hex, no_precision, "1.e240c9fbe76c9p+16"},
+    TestItem{123456.789, cuda::std::chars_format::hex, -1, "1.e240c9fbe76c9p+16"},
+    TestItem{123456.789, cuda::std::chars_format::hex, 0, "2p+16"},
+    TestItem{123456.789, cuda::std::chars_format::hex, 3, "1.e24p+16"},
+    TestItem{123456.789, cuda::std::chars_format::hex, 17, "1.e240c9fbe76c90000p+16"},
+    TestItem{1e-7, cuda::std::chars_format{}, no_precision, "1e-07"},
+    TestItem{1e-7, cuda::std::chars_format::fixed, no_precision, "0.0000001"},
+    TestItem{1e-7, cuda::std::chars_format::fixed, -1, "0.000000"},
+    TestItem{1e-7, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{1e-7, cuda::std::chars_format::fixed, 3, "0.000"},
+    TestItem{1e-7, cuda::std::chars_format::fixed, 17, "0.00000010000000000"},
+    TestItem{1e-7, cuda::std::chars_format::scientific, no_precision, "1e-07"},
+    TestItem{1e-7, cuda::std::chars_format::scientific, -1, "1.000000e-07"},
+    TestItem{1e-7, cuda::std::chars_format::scientific, 0, "1e-07"},
+    TestItem{1e-7, cuda::std::chars_format::scientific, 3, "1.000e-07"},
+    TestItem{1e-7, cuda::std::chars_format::scientific, 17, "9.99999999999999955e-08"},
+    TestItem{1e-7, cuda::std::chars_format::general, no_precision, "1e-07"},
+    TestItem{1e-7, cuda::std::chars_format::general, -1, "1e-07"},
+    TestItem{1e-7, cuda::std::chars_format::general, 0, "1e-07"},
+    TestItem{1e-7, cuda::std::chars_format::general, 3, "1e-07"},
+    TestItem{1e-7, cuda::std::chars_format::general, 17, "9.9999999999999995e-08"},
+    TestItem{1e-7, cuda::std::chars_format::hex, no_precision, "1.ad7f29abcaf48p-24"},
+    TestItem{1e-7, cuda::std::chars_format::hex, -1, "1.ad7f29abcaf48p-24"},
+    TestItem{1e-7, cuda::std::chars_format::hex, 0, "2p-24"},
+    TestItem{1e-7, cuda::std::chars_format::hex, 3, "1.ad8p-24"},
+    TestItem{1e-7, cuda::std::chars_format::hex, 17, "1.ad7f29abcaf480000p-24"},
+    TestItem{1e23, cuda::std::chars_format{}, no_precision, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::fixed, no_precision, "99999999999999991611392"},
+    TestItem{1e23, cuda::std::chars_format::fixed, -1, "99999999999999991611392.000000"},
+    TestItem{1e23, cuda::std::chars_format::fixed, 0, "99999999999999991611392"},
+    TestItem{1e23, cuda::std::chars_format::fixed, 3, "99999999999999991611392.000"},
+    TestItem{1e23, cuda::std::chars_format::fixed, 17, "99999999999999991611392.00000000000000000"},
+    TestItem{1e23, cuda::std::chars_format::scientific, no_precision, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::scientific, -1, "1.000000e+23"},
+    TestItem{1e23, cuda::std::chars_format::scientific, 0, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::scientific, 3, "1.000e+23"},
+    TestItem{1e23, cuda::std::chars_format::scientific, 17, "9.99999999999999916e+22"},
+    TestItem{1e23, cuda::std::chars_format::general, no_precision, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::general, -1, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::general, 0, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::general, 3, "1e+23"},
+    TestItem{1e23, cuda::std::chars_format::general, 17, "9.9999999999999992e+22"},
+    TestItem{1e23, cuda::std::chars_format::hex, no_precision, "1.52d02c7e14af6p+76"},
+    TestItem{1e23, cuda::std::chars_format::hex, -1, "1.52d02c7e14af6p+76"},
+    TestItem{1e23, cuda::std::chars_format::hex, 0, "1p+76"},
+    TestItem{1e23, cuda::std::chars_format::hex, 3, "1.52dp+76"},
+    TestItem{1e23, cuda::std::chars_format::hex, 17, "1.52d02c7e14af60000p+76"},
+    TestItem{9007199254740993.0, cuda::std::chars_format{}, no_precision, "9007199254740992"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::fixed, no_precision, "9007199254740992"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::fixed, -1, "9007199254740992.000000"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::fixed, 0, "9007199254740992"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::fixed, 3, "9007199254740992.000"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::fixed, 17, "9007199254740992.00000000000000000"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::scientific, no_precision, "9.007199254740992e+15"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::scientific, -1, "9.007199e+15"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::scientific, 0, "9e+15"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::scientific, 3, "9.007e+15"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::scientific, 17, "9.00719925474099200e+15"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::general, no_precision, "9.007199254740992e+15"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::general, -1, "9.0072e+15"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::general, 0, "9e+15"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::general, 3, "9.01e+15"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::general, 17, "9007199254740992"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::hex, no_precision, "1p+53"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::hex, -1, "1p+53"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::hex, 0, "1p+53"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::hex, 3, "1.000p+53"},
+    TestItem{9007199254740993.0, cuda::std::chars_format::hex, 17, "1.00000000000000000p+53"},
+    TestItem{5e-324, cuda::std::chars_format{}, no_precision, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::fixed, -1, "0.000000"},
+    TestItem{5e-324, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{5e-324, cuda::std::chars_format::fixed, 3, "0.000"},
+    TestItem{5e-324, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{5e-324, cuda::std::chars_format::scientific, no_precision, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::scientific, -1, "4.940656e-324"},
+    TestItem{5e-324, cuda::std::chars_format::scientific, 0, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::scientific, 3, "4.941e-324"},
+    TestItem{5e-324, cuda::std::chars_format::scientific, 17, "4.94065645841246544e-324"},
+    TestItem{5e-324, cuda::std::chars_format::general, no_precision, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::general, -1, "4.94066e-324"},
+    TestItem{5e-324, cuda::std::chars_format::general, 0, "5e-324"},
+    TestItem{5e-324, cuda::std::chars_format::general, 3, "4.94e-324"},
+    TestItem{5e-324, cuda::std::chars_format::general, 17, "4.9406564584124654e-324"},
+    TestItem{5e-324, cuda::std::chars_format::hex, no_precision, "0.0000000000001p-1022"},
+    TestItem{5e-324, cuda::std::chars_format::hex, -1, "0.0000000000001p-1022"},
+    TestItem{5e-324, cuda::std::chars_format::hex, 0, "0p-1022"},
+    TestItem{5e-324, cuda::std::chars_format::hex, 3, "0.000p-1022"},
+    TestItem{5e-324, cuda::std::chars_format::hex, 17, "0.00000000000010000p-1022"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format{}, no_precision, "2.2250738585072014e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::fixed, -1, "0.000000"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::fixed, 3, "0.000"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::scientific, no_precision, "2.2250738585072014e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::scientific, -1, "2.225074e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::scientific, 0, "2e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::scientific, 3, "2.225e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::scientific, 17, "2.22507385850720138e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::general, no_precision, "2.2250738585072014e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::general, -1, "2.22507e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::general, 0, "2e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::general, 3, "2.23e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::general, 17, "2.2250738585072014e-308"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::hex, no_precision, "1p-1022"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::hex, -1, "1p-1022"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::hex, 0, "1p-1022"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::hex, 3, "1.000p-1022"},
+    TestItem{2.2250738585072014e-308, cuda::std::chars_format::hex, 17, "1.00000000000000000p-1022"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format{}, no_precision, "1.7976931348623157e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::scientific, no_precision, "1.7976931348623157e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::scientific, -1, "1.797693e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::scientific, 0, "2e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::scientific, 3, "1.798e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::scientific, 17, "1.79769313486231571e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::general, no_precision, "1.7976931348623157e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::general, -1, "1.79769e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::general, 0, "2e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::general, 3, "1.8e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::general, 17, "1.7976931348623157e+308"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::hex, no_precision, "1.fffffffffffffp+1023"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::hex, -1, "1.fffffffffffffp+1023"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::hex, 0, "2p+1023"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::hex, 3, "2.000p+1023"},
+    TestItem{1.7976931348623157e308, cuda::std::chars_format::hex, 17, "1.fffffffffffff0000p+1023"},
+  }};
+}
+
+__host__ __device__ cuda::std::to_chars_result
+call_to_chars(char* first, char* last, double val, cuda::std::chars_format fmt, int precision)
+{
+  if (fmt == cuda::std::chars_format{})
+  {
+    return cuda::std::to_chars(first, last, val);
+  }
+  else if (precision == no_precision)
+  {
+    return cuda::std::to_chars(first, last, val, fmt);
+  }
+  else
+  {
+    return cuda::std::to_chars(first, last, val, fmt, precision);
+  }
+}
+
+__host__ __device__ void test_to_chars(double val, cuda::std::chars_format fmt, int precision, const char* ref_str)
+{
+  constexpr cuda::std::size_t buff_size = 150;
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(ref_str);
+
+  // Check valid buffer size
+  {
+    const auto result = call_to_chars(buff_start, buff_start + buff_size, val, fmt, precision);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, ref_str, ref_len) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start + ref_len - 1, val, fmt, precision);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start, val, fmt, precision);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+__host__ __device__ void test_non_finite()
+{
+  constexpr cuda::std::chars_format formats[] = {
+    cuda::std::chars_format{},
+    cuda::std::chars_format::fixed,
+    cuda::std::chars_format::scientific,
+    cuda::std::chars_format::general,
+    cuda::std::chars_format::hex};
+
+  for (const auto fmt : formats)
+  {
+    for (const int precision : {no_precision, 0, 6})
+    {
+      test_to_chars(cuda::std::numeric_limits<double>::infinity(), fmt, precision, "inf");
+      test_to_chars(-cuda::std::numeric_limits<double>::infinity(), fmt, precision, "-inf");
+      test_to_chars(cuda::std::numeric_limits<double>::quiet_NaN(), fmt, precision, "nan");
+      test_to_chars(-cuda::std::numeric_limits<double>::quiet_NaN(), fmt, precision, "-nan");
+    }
+  }
+}
+
+__host__ __device__ void test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::to_chars_result,
+                                     decltype(cuda::std::to_chars(
+                                       cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format::general)));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format::general, int{})));
+
+  constexpr auto items = get_test_items();
+
+  for (const auto& item : items)
+  {
+    test_to_chars(item.val, item.fmt, item.precision, item.str);
+  }
+
+  test_non_finite();
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
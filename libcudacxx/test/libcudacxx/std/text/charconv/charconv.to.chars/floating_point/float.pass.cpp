@@ -0,0 +1,440 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+constexpr int no_precision = INT_MIN;
+
+struct TestItem
+{
+  float val;
+  cuda::std::chars_format fmt;
+  int precision;
+  const char* str;
+};
+
+// Source code for the generation of the test items, the float items are generated by passing any argument
+// #include <charconv>
+// #include <iostream>
+// #include <string>
+//
+// constexpr const char* fmt_names[] = {
+//   "cuda::std::chars_format{}",
+//   "cuda::std::chars_format::fixed",
+//   "cuda::std::chars_format::scientific",
+//   "cuda::std::chars_format::general",
+//   "cuda::std::chars_format::hex"};
+// constexpr std::chars_format fmts[] = {
+//   std::chars_format{},
+//   std::chars_format::fixed,
+//   std::chars_format::scientific,
+//   std::chars_format::general,
+//   std::chars_format::hex};
+// constexpr int precisions[] = {-1, 0, 3, 17};
+//
+// // Items that do not fit into a line are skipped
+// void print_item(const char* lit, const char* fmt, const std::string& precision, const char* first, const char* last)
+// {
+//   const std::string item =
+//     "    TestItem{" + std::string(lit) + ", " + fmt + ", " + precision + ", \"" + std::string(first, last) + "\"},";
+//   if (item.size() <= 120)
+//   {
+//     std::cout << item << "\n";
+//   }
+// }
+//
+// template <class T, std::size_t N>
+// void print_items(const char* const (&lits)[N], const T (&vals)[N])
+// {
+//   for (std::size_t i = 0; i < N; ++i)
+//   {
+//     char buff[1000];
+//     auto r = std::to_chars(buff, buff + 1000, vals[i]);
+//     print_item(lits[i], fmt_names[0], "no_precision", buff, r.ptr);
+//     for (int f = 1; f < 5; ++f)
+//     {
+//       r = std::to_chars(buff, buff + 1000, vals[i], fmts[f]);
+//       print_item(lits[i], fmt_names[f], "no_precision", buff, r.ptr);
+//       for (int p : precisions)
+//       {
+//         r = std::to_chars(buff, buff + 1000, vals[i], fmts[f], p);
+//         print_item(lits[i], fmt_names[f], std::to_string(p), buff, r.ptr);
+//       }
+//     }
+//   }
+// }
+//
+// int main(int argc, char**)
+// {
+//   if (argc == 1)
+//   {
+//     const char* const lits[] = {
+//       "0.0", "-0.0", "1.0", "0.1", "-2.5", "123456.789", "1e-7", "1e23", "9007199254740993.0", "5e-324",
+//       "2.2250738585072014e-308", "1.7976931348623157e308"};
+//     const double vals[] = {
+//       0.0, -0.0, 1.0, 0.1, -2.5, 123456.789, 1e-7, 1e23, 9007199254740993.0, 5e-324,
+//       2.2250738585072014e-308, 1.7976931348623157e308};
+//     print_items(lits, vals);
+//   }
+//   else
+//   {
+//     const char* const lits[] = {
+//       "0.0f", "-0.0f", "1.0f", "0.1f", "-2.5f", "123456.79f", "1e-7f", "67108864.0f", "1e-45f", "1.17549435e-38f",
+//       "3.40282347e38f"};
+//     const float vals[] = {
+//       0.0f, -0.0f, 1.0f, 0.1f, -2.5f, 123456.79f, 1e-7f, 67108864.0f, 1e-45f, 1.17549435e-38f, 3.40282347e38f};
+//     print_items(lits, vals);
+//   }
+// }
+
+__host__ __device__ constexpr cuda::std::array<TestItem, 229> get_test_items()
+{
+  return {{
+    TestItem{0.0f, cuda::std::chars_format{}, no_precision, "0"},
+    TestItem{0.0f, cuda::std::chars_format::fixed, no_precision, "0"},
+    TestItem{0.0f, cuda::std::chars_format::fixed, -1, "0.000000"},
+    TestItem{0.0f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.0f, cuda::std::chars_format::fixed, 3, "0.000"},
+    TestItem{0.0f, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{0.0f, cuda::std::chars_format::scientific, no_precision, "0e+00"},
+    TestItem{0.0f, cuda::std::chars_format::scientific, -1, "0.000000e+00"},
+    TestItem{0.0f, cuda::std::chars_format::scientific, 0, "0e+00"},
+    TestItem{0.0f, cuda::std::chars_format::scientific, 3, "0.000e+00"},
+    TestItem{0.0f, cuda::std::chars_format::scientific, 17, "0.00000000000000000e+00"},
+    TestItem{0.0f, cuda::std::chars_format::general, no_precision, "0"},
+    TestItem{0.0f, cuda::std::chars_format::general, -1, "0"},
+    TestItem{0.0f, cuda::std::chars_format::general, 0, "0"},
+    TestItem{0.0f, cuda::std::chars_format::general, 3, "0"},
+    TestItem{0.0f, cuda::std::chars_format::general, 17, "0"},
+    TestItem{0.0f, cuda::std::chars_format::hex, no_precision, "0p+0"},
+    TestItem{0.0f, cuda::std::chars_format::hex, -1, "0p+0"},
+    TestItem{0.0f, cuda::std::chars_format::hex, 0, "0p+0"},
+    TestItem{0.0f, cuda::std::chars_format::hex, 3, "0.000p+0"},
+    TestItem{0.0f, cuda::std::chars_format::hex, 17, "0.00000000000000000p+0"},
+    TestItem{-0.0f, cuda::std::chars_format{}, no_precision, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::fixed, no_precision, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::fixed, -1, "-0.000000"},
+    TestItem{-0.0f, cuda::std::chars_format::fixed, 0, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::fixed, 3, "-0.000"},
+    TestItem{-0.0f, cuda::std::chars_format::fixed, 17, "-0.00000000000000000"},
+    TestItem{-0.0f, cuda::std::chars_format::scientific, no_precision, "-0e+00"},
+    TestItem{-0.0f, cuda::std::chars_format::scientific, -1, "-0.000000e+00"},
+    TestItem{-0.0f, cuda::std::chars_format::scientific, 0, "-0e+00"},
+    TestItem{-0.0f, cuda::std::chars_format::scientific, 3, "-0.000e+00"},
+    TestItem{-0.0f, cuda::std::chars_format::scientific, 17, "-0.00000000000000000e+00"},
+    TestItem{-0.0f, cuda::std::chars_format::general, no_precision, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::general, -1, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::general, 0, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::general, 3, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::general, 17, "-0"},
+    TestItem{-0.0f, cuda::std::chars_format::hex, no_precision, "-0p+0"},
+    TestItem{-0.0f, cuda::std::chars_format::hex, -1, "-0p+0"},
+    TestItem{-0.0f, cuda::std::chars_format::hex, 0, "-0p+0"},
+    TestItem{-0.0f, cuda::std::chars_format::hex, 3, "-0.000p+0"},
+    TestItem{-0.0f, cuda::std::chars_format::hex, 17, "-0.00000000000000000p+0"},
+    TestItem{1.0f, cuda::std::chars_format{}, no_precision, "1"},
+    TestItem{1.0f, cuda::std::chars_format::fixed, no_precision, "1"},
+    TestItem{1.0f, cuda::std::chars_format::fixed, -1, "1.000000"},
+    TestItem{1.0f, cuda::std::chars_format::fixed, 0, "1"},
+    TestItem{1.0f, cuda::std::chars_format::fixed, 3, "1.000"},
+    TestItem{1.0f, cuda::std::chars_format::fixed, 17, "1.00000000000000000"},
+    TestItem{1.0f, cuda::std::chars_format::scientific, no_precision, "1e+00"},
+    TestItem{1.0f, cuda::std::chars_format::scientific, -1, "1.000000e+00"},
+    TestItem{1.0f, cuda::std::chars_format::scientific, 0, "1e+00"},
+    TestItem{1.0f, cuda::std::chars_format::scientific, 3, "1.000e+00"},
+    TestItem{1.0f, cuda::std::chars_format::scientific, 17, "1.00000000000000000e+00"},
+    TestItem{1.0f, cuda::std::chars_format::general, no_precision, "1"},
+    TestItem{1.0f, cuda::std::chars_format::general, -1, "1"},
+    TestItem{1.0f, cuda::std::chars_format::general, 0, "1"},
+    TestItem{1.0f, cuda::std::chars_format::general, 3, "1"},
+    TestItem{1.0f, cuda::std::chars_format::general, 17, "1"},
+    TestItem{1.0f, cuda::std::chars_format::hex, no_precision, "1p+0"},
+    TestItem{1.0f, cuda::std::chars_format::hex, -1, "1p+0"},
+    TestItem{1.0f, cuda::std::chars_format::hex, 0, "1p+0"},
+    TestItem{1.0f, cuda::std::chars_format::hex, 3, "1.000p+0"},
+    TestItem{1.0f, cuda::std::chars_format::hex, 17, "1.00000000000000000p+0"},
+    TestItem{0.1f, cuda::std::chars_format{}, no_precision, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::fixed, no_precision, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::fixed, -1, "0.100000"},
+    TestItem{0.1f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0.1f, cuda::std::chars_format::fixed, 3, "0.100"},
+    TestItem{0.1f, cuda::std::chars_format::fixed, 17, "0.10000000149011612"},
+    TestItem{0.1f, cuda::std::chars_format::scientific, no_precision, "1e-01"},
+    TestItem{0.1f, cuda::std::chars_format::scientific, -1, "1.000000e-01"},
+    TestItem{0.1f, cuda::std::chars_format::scientific, 0, "1e-01"},
+    TestItem{0.1f, cuda::std::chars_format::scientific, 3, "1.000e-01"},
+    TestItem{0.1f, cuda::std::chars_format::scientific, 17, "1.00000001490116119e-01"},
+    TestItem{0.1f, cuda::std::chars_format::general, no_precision, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::general, -1, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::general, 0, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::general, 3, "0.1"},
+    TestItem{0.1f, cuda::std::chars_format::general, 17, "0.10000000149011612"},
+    TestItem{0.1f, cuda::std::chars_format::hex, no_precision, "1.99999ap-4"},
+    TestItem{0.1f, cuda::std::chars_format::hex, -1, "1.99999ap-4"},
+    TestItem{0.1f, cuda::std::chars_format::hex, 0, "2p-4"},
+    TestItem{0.1f, cuda::std::chars_format::hex, 3, "1.99ap-4"},
+    TestItem{0.1f, cuda::std::chars_format::hex, 17, "1.99999a00000000000p-4"},
+    TestItem{-2.5f, cuda::std::chars_format{}, no_precision, "-2.5"},
+    TestItem{-2.5f, cuda::std::chars_format::fixed, no_precision, "-2.5"},
+    TestItem{-2.5f, cuda::std::chars_format::fixed, -1, "-2.500000"},
+    TestItem{-2.5f, cuda::std::chars_format::fixed, 0, "-2"},
+    TestItem{-2.5f, cuda::std::chars_format::fixed, 3, "-2.500"},
+    TestItem{-2.5f, cuda::std::chars_format::fixed, 17, "-2.50000000000000000"},
+    TestItem{-2.5f, cuda::std::chars_format::scientific, no_precision, "-2.5e+00"},
+    TestItem{-2.5f, cuda::std::chars_format::scientific, -1, "-2.500000e+00"},
+    TestItem{-2.5f, cuda::std::chars_format::scientific, 0, "-2e+00"},
+    TestItem{-2.5f, cuda::std::chars_format::scientific, 3, "-2.500e+00"},
+    TestItem{-2.5f, cuda::std::chars_format::scientific, 17, "-2.50000000000000000e+00"},
+    TestItem{-2.5f, cuda::std::chars_format::general, no_precision, "-2.5"},
+    TestItem{-2.5f, cuda::std::chars_format::general, -1, "-2.5"},
+    TestItem{-2.5f, cuda::std::chars_format::general, 0, "-2"},
+    TestItem{-2.5f, cuda::std::chars_format::general, 3, "-2.5"},
+    TestItem{-2.5f, cuda::std::chars_format::general, 17, "-2.5"},
+    TestItem{-2.5f, cuda::std::chars_format::hex, no_precision, "-1.4p+1"},
+    TestItem{-2.5f, cuda::std::chars_format::hex, -1, "-1.4p+1"},
+    TestItem{-2.5f, cuda::std::chars_format::hex, 0, "-1p+1"},
+    TestItem{-2.5f, cuda::std::chars_format::hex, 3, "-1.400p+1"},
+    TestItem{-2.5f, cuda::std::chars_format::hex, 17, "-1.40000000000000000p+1"},
+    TestItem{123456.79f, cuda::std::chars_format{}, no_precision, "123456.79"},
+    TestItem{123456.79f, cuda::std::chars_format::fixed, no_precision, "123456.79"},
+    TestItem{123456.79f, cuda::std::chars_format::fixed, -1, "123456.789062"},
+    TestItem{123456.79f, cuda::std::chars_format::fixed, 0, "123457"},
+    TestItem{123456.79f, cuda::std::chars_format::fixed, 3, "123456.789"},
+    TestItem{123456.79f, cuda::std::chars_format::fixed, 17, "123456.78906250000000000"},
+    TestItem{123456.79f, cuda::std::chars_format::scientific, no_precision, "1.2345679e+05"},
+    TestItem{123456.79f, cuda::std::chars_format::scientific, -1, "1.234568e+05"},
+    TestItem{123456.79f, cuda::std::chars_format::scientific, 0, "1e+05"},
+    TestItem{123456.79f, cuda::std::chars_format::scientific, 3, "1.235e+05"},
+    TestItem{123456.79f, cuda::std::chars_format::scientific, 17, "1.23456789062500000e+05"},
+    TestItem{123456.79f, cuda::std::chars_format::general, no_precision, "123456.79"},
+    TestItem{123456.79f, cuda::std::chars_format::general, -1, "123457"},
+    TestItem{123456.79f, cuda::std::chars_format::general, 0, "1e+05"},
+    TestItem{123456.79f, cuda::std::chars_format::general, 3, "1.23e+05"},
+    TestItem{123456.79f, cuda::std::chars_format::general, 17, "123456.7890625"},
+    TestItem{123456.79f, cuda::std::chars_format::hex, no_precision, "1.e240cap+16"},
+    TestItem{123456.79f, cuda::std::chars_format::hex, -1, "1.e240cap+16"},
+    TestItem{123456.79f, cuda::std::chars_format::hex, 0, "2p+16"},
+    TestItem{123456.79f, cuda::std::chars_format::hex, 3, "1.e24p+16"},
+    TestItem{123456.79f, cuda::std::chars_format::hex, 17, "1.e240ca00000000000p+16"},
+    TestItem{1e-7f, cuda::std::chars_format{}, no_precision, "1e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::fixed, no_precision, "0.0000001"},
+    TestItem{1e-7f, cuda::std::chars_format::fixed, -1, "0.000000"},
+    TestItem{1e-7f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{1e-7f, cuda::std::chars_format::fixed, 3, "0.000"},
+    TestItem{1e-7f, cuda::std::chars_format::fixed, 17, "0.00000010000000117"},
+    TestItem{1e-7f, cuda::std::chars_format::scientific, no_precision, "1e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::scientific, -1, "1.000000e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::scientific, 0, "1e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::scientific, 3, "1.000e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::scientific, 17, "1.00000001168609742e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::general, no_precision, "1e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::general, -1, "1e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::general, 0, "1e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::general, 3, "1e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::general, 17, "1.0000000116860974e-07"},
+    TestItem{1e-7f, cuda::std::chars_format::hex, no_precision, "1.ad7f2ap-24"},
+    TestItem{1e-7f, cuda::std::chars_format::hex, -1, "1.ad7f2ap-24"},
+    TestItem{1e-7f, cuda::std::chars_format::hex, 0, "2p-24"},
+    TestItem{1e-7f, cuda::std::chars_format::hex, 3, "1.ad8p-24"},
+    TestItem{1e-7f, cuda::std::chars_format::hex, 17, "1.ad7f2a00000000000p-24"},
+    TestItem{67108864.0f, cuda::std::chars_format{}, no_precision, "67108864"},
+    TestItem{67108864.0f, cuda::std::chars_format::fixed, no_precision, "67108864"},
+    TestItem{67108864.0f, cuda::std::chars_format::fixed, -1, "67108864.000000"},
+    TestItem{67108864.0f, cuda::std::chars_format::fixed, 0, "67108864"},
+    TestItem{67108864.0f, cuda::std::chars_format::fixed, 3, "67108864.000"},
+    TestItem{67108864.0f, cuda::std::chars_format::fixed, 17, "67108864.00000000000000000"},
+    TestItem{67108864.0f, cuda::std::chars_format::scientific, no_precision, "6.7108864e+07"},
+    TestItem{67108864.0f, cuda::std::chars_format::scientific, -1, "6.710886e+07"},
+    TestItem{67108864.0f, cuda::std::chars_format::scientific, 0, "7e+07"},
+    TestItem{67108864.0f, cuda::std::chars_format::scientific, 3, "6.711e+07"},
+    TestItem{67108864.0f, cuda::std::chars_format::scientific, 17, "6.71088640000000000e+07"},
+    TestItem{67108864.0f, cuda::std::chars_format::general, no_precision, "6.7108864e+07"},
+    TestItem{67108864.0f, cuda::std::chars_format::general, -1, "6.71089e+07"},
+    TestItem{67108864.0f, cuda::std::chars_format::general, 0, "7e+07"},
+    TestItem{67108864.0f, cuda::std::chars_format::general, 3, "6.71e+07"},
+    TestItem{67108864.0f, cuda::std::chars_format::general, 17, "67108864"},
+    TestItem{67108864.0f, cuda::std::chars_format::hex, no_precision, "1p+26"},
+    TestItem{67108864.0f, cuda::std::chars_format::hex, -1, "1p+26"},
+    TestItem{67108864.0f, cuda::std::chars_format::hex, 0, "1p+26"},
+    TestItem{67108864.0f, cuda::std::chars_format::hex, 3, "1.000p+26"},
+    TestItem{67108864.0f, cuda::std::chars_format::hex, 17, "1.00000000000000000p+26"},
+    TestItem{1e-45f, cuda::std::chars_format{}, no_precision, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::fixed, no_precision, "0.000000000000000000000000000000000000000000001"},
+    TestItem{1e-45f, cuda::std::chars_format::fixed, -1, "0.000000"},
+    TestItem{1e-45f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{1e-45f, cuda::std::chars_format::fixed, 3, "0.000"},
+    TestItem{1e-45f, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{1e-45f, cuda::std::chars_format::scientific, no_precision, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::scientific, -1, "1.401298e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::scientific, 0, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::scientific, 3, "1.401e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::scientific, 17, "1.40129846432481707e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::general, no_precision, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::general, -1, "1.4013e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::general, 0, "1e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::general, 3, "1.4e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::general, 17, "1.4012984643248171e-45"},
+    TestItem{1e-45f, cuda::std::chars_format::hex, no_precision, "0.000002p-126"},
+    TestItem{1e-45f, cuda::std::chars_format::hex, -1, "0.000002p-126"},
+    TestItem{1e-45f, cuda::std::chars_format::hex, 0, "0p-126"},
+    TestItem{1e-45f, cuda::std::chars_format::hex, 3, "0.000p-126"},
+    TestItem{1e-45f, cuda::std::chars_format::hex, 17, "0.00000200000000000p-126"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format{}, no_precision, "1.1754944e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::fixed, -1, "0.000000"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::fixed, 3, "0.000"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::scientific, no_precision, "1.1754944e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::scientific, -1, "1.175494e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::scientific, 0, "1e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::scientific, 3, "1.175e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::scientific, 17, "1.17549435082228751e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::general, no_precision, "1.1754944e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::general, -1, "1.17549e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::general, 0, "1e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::general, 3, "1.18e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::general, 17, "1.1754943508222875e-38"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::hex, no_precision, "1p-126"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::hex, -1, "1p-126"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::hex, 0, "1p-126"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::hex, 3, "1.000p-126"},
+    TestItem{1.17549435e-38f, cuda::std::chars_format::hex, 17, "1.00000000000000000p-126"},
+    TestItem{3.40282347e38f, cuda::std::chars_format{}, no_precision, "3.4028235e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::fixed, no_precision, "340282346638528859811704183484516925440"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::fixed, -1, "340282346638528859811704183484516925440.000000"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::fixed, 0, "340282346638528859811704183484516925440"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::fixed, 3, "340282346638528859811704183484516925440.000"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::scientific, no_precision, "3.4028235e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::scientific, -1, "3.402823e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::scientific, 0, "3e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::scientific, 3, "3.403e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::scientific, 17, "3.40282346638528860e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::general, no_precision, "3.4028235e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::general, -1, "3.40282e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::general, 0, "3e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::general, 3, "3.4e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::general, 17, "3.4028234663852886e+38"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::hex, no_precision, "1.fffffep+127"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::hex, -1, "1.fffffep+127"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::hex, 0, "2p+127"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::hex, 3, "2.000p+127"},
+    TestItem{3.40282347e38f, cuda::std::chars_format::hex, 17, "1.fffffe00000000000p+127"},
+  }};
+}
+
+__host__ __device__ cuda::std::to_chars_result
+call_to_chars(char* first, char* last, float val, cuda::std::chars_format fmt, int precision)
+{
+  if (fmt == cuda::std::chars_format{})
+  {
+    return cuda::std::to_chars(first, last, val);
+  }
+  else if (precision == no_precision)
+  {
+    return cuda::std::to_chars(first, last, val, fmt);
+  }
+  else
+  {
+    return cuda::std::to_chars(first, last, val, fmt, precision);
+  }
+}
+
+__host__ __device__ void test_to_chars(float val, cuda::std::chars_format fmt, int precision, const char* ref_str)
+{
+  constexpr cuda::std::size_t buff_size = 150;
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(ref_str);
+
+  // Check valid buffer size
+  {
+    const auto result = call_to_chars(buff_start, buff_start + buff_size, val, fmt, precision);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, ref_str, ref_len) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start + ref_len - 1, val, fmt, precision);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start, val, fmt, precision);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+__host__ __device__ void test_non_finite()
+{
+  constexpr cuda::std::chars_format formats[] = {
+    cuda::std::chars_format{},
+    cuda::std::chars_format::fixed,
+    cuda::std::chars_format::scientific,
+    cuda::std::chars_format::general,
+    cuda::std::chars_format::hex};
+
+  for (const auto fmt : formats)
+  {
+    for (const int precision : {no_precision, 0, 6})
+    {
+      test_to_chars(cuda::std::numeric_limits<float>::infinity(), fmt, precision, "inf");
+      test_to_chars(-cuda::std::numeric_limits<float>::infinity(), fmt, precision, "-inf");
+      test_to_chars(cuda::std::numeric_limits<float>::quiet_NaN(), fmt, precision, "nan");
+      test_to_chars(-cuda::std::numeric_limits<float>::quiet_NaN(), fmt, precision, "-nan");
+    }
+  }
+}
+
+__host__ __device__ void test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::to_chars_result,
+                                     decltype(cuda::std::to_chars(
+                                       cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format::general)));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format::general, int{})));
+
+  constexpr auto items = get_test_items();
+
+  for (const auto& item : items)
+  {
+    test_to_chars(item.val, item.fmt, item.precision, item.str);
+  }
+
+  test_non_finite();
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// size_t _Find_first() const noexcept; // extension
+// size_t _Find_next(size_t prev) const noexcept; // extension
+
+#include <cuda/std/bitset>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+
+#include "../bitset_test_cases.h"
+#include "test_macros.h"
+
+TEST_NV_DIAG_SUPPRESS(186)
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr void test_find_next(const cuda::std::bitset<N>& v)
+{
+  static_assert(noexcept(v._Find_first()));
+  static_assert(noexcept(v._Find_next(0)));
+
+  // the set bits in order, then size()
+  cuda::std::size_t pos = v._Find_first();
+  for (cuda::std::size_t i = 0; i < N; ++i)
+  {
+    if (v[i])
+    {
+      assert(pos == i);
+      pos = v._Find_next(pos);
+    }
+  }
+  assert(pos == N);
+
+  for (cuda::std::size_t i = 0; i < N; ++i)
+  {
+    cuda::std::size_t next = i + 1;
+    while (next < N && !v[next])
+    {
+      ++next;
+    }
+    assert(v._Find_next(i) == next);
+  }
+  assert(v._Find_next(N) == N);
+}
+
+template <cuda::std::size_t N>
+__host__ __device__ constexpr void test_find_next()
+{
+  auto const& cases = get_test_cases(cuda::std::integral_constant<int, N>());
+  for (cuda::std::size_t c = 0; c != cases.size(); ++c)
+  {
+    test_find_next(cuda::std::bitset<N>(cases[c]));
+  }
+}
+
+// a sparse bitset with set bits in a few words only
+template <cuda::std::size_t N>
+__host__ __device__ constexpr void test_find_next_sparse()
+{
+  cuda::std::bitset<N> v;
+  test_find_next(v);
+  v.set(N - 1);
+  test_find_next(v);
+  v.set(0);
+  v.set(N / 2);
+  v.set(N / 3 + 1);
+  test_find_next(v);
+}
+
+__host__ __device__ constexpr bool test()
+{
+  test_find_next<0>();
+  test_find_next<1>();
+  test_find_next<31>();
+  test_find_next<32>();
+  test_find_next<33>();
+  test_find_next<63>();
+  test_find_next<64>();
+  test_find_next<65>();
+  test_find_next_sparse<100>();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  test_find_next<1000>(); // not in constexpr because of constexpr evaluation step limits
+  test_find_next_sparse<5000>();
+  static_assert(test(), "");
+
+  return 0;
+}
@@ -10,10 +10,12 @@
 #ifndef LIBCUDACXX_TEST_SUPPORT_RANDOM_UTILITIES_TEST_DISTRIBUTION_H
 #define LIBCUDACXX_TEST_SUPPORT_RANDOM_UTILITIES_TEST_DISTRIBUTION_H
 
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__algorithm/partial_sort.h>
 #include <cuda/std/__memory_>
 #include <cuda/std/array>
 #include <cuda/std/cstddef>
+#include <cuda/std/span>
 
 #if !_CCCL_COMPILER(NVRTC)
 #  include <sstream>
@@ -183,7 +185,34 @@ __host__ __device__ double ks_test_statistic_discrete(
 
 // Perform a kolmogorov-Smirnov test, comparing the observed and expected cumulative
 // distribution function from a continuous distribution.
-// Generates a fixed size of 10000 samples
+template <class D, bool continuous, class CDF>
+__host__ __device__ bool
+test_ks(typename D::result_type* samples, cuda::std::size_t num_samples, const typename D::param_type& param, CDF cdf)
+{
+  // Use sort when available
+  cuda::std::partial_sort(samples, samples + num_samples, samples + num_samples);
+
+  // Compute the KS statistic - specially handle discrete case
+  // Arnold, Taylor B., and John W. Emerson. "Nonparametric goodness-of-fit tests for discrete null distributions."
+  // (2011).
+  double d_max = 0.0;
+  if constexpr (continuous)
+  {
+    d_max = ks_test_statistic_continuous<D>(samples, num_samples, param, cdf);
+  }
+  else
+  {
+    d_max = ks_test_statistic_discrete<D>(samples, num_samples, param, cdf);
+  }
+
+  // Note that this critical value from the KS distribution is only valid for discrete distributions when num_samples is
+  // large
+  const double critical_value = 0.016259280113043572; // for alpha = 0.01 and n = 10000
+  assert(d_max < critical_value);
+  return true;
+}
+
+// Generates a fixed size of 10000 samples and tests them with test_ks
 template <class D, bool continuous, class URNG, bool test_constexpr, class CDF>
 __host__ __device__ bool test_eval(const typename D::param_type param, CDF cdf)
 {
@@ -210,28 +239,51 @@ __host__ __device__ bool test_eval(const typename D::param_type param, CDF cdf)
   {
     samples[i] = dist(g, param);
   }
-  // Use sort when available
-  cuda::std::partial_sort(samples.get(), samples.get() + num_samples, samples.get() + num_samples);
+  return test_ks<D, continuous>(samples.get(), num_samples, param, cdf);
+}
 
-  // Compute the KS statistic - specially handle discrete case
-  // Arnold, Taylor B., and John W. Emerson. "Nonparametric goodness-of-fit tests for discrete null distributions."
-  // (2011).
-  double d_max = 0.0;
-  if constexpr (continuous)
+// Same as test_eval, with the samples from the bulk operator() of the distribution
+template <class D, bool continuous, class URNG, class CDF>
+__host__ __device__ bool test_eval_bulk(const typename D::param_type param, CDF cdf)
+{
+  using result_type = typename D::result_type;
+
+  // First check the operator with param is equivalent to the constructor param, for an odd number of values
   {
-    d_max = ks_test_statistic_continuous<D>(samples.get(), num_samples, param, cdf);
+    D d1(param);
+    D d2(param);
+    URNG g_1{};
+    URNG g_2{};
+    result_type values1[101] = {};
+    result_type values2[101] = {};
+    d1(g_1, cuda::std::span<result_type>(values1), param);
+    d2(g_2, cuda::std::span<result_type>(values2));
+    for (cuda::std::size_t i = 0; i < 101; ++i)
+    {
+      assert((values1[i] == values2[i]) || (cuda::std::isnan(values1[i]) && cuda::std::isnan(values2[i])));
+    }
   }
-  else
+
+  D dist(param);
+  URNG g{};
+  const cuda::std::size_t num_samples = 10000;
+
+  // fill the samples in calls of sizes around the chunks the distributions work on
+  auto samples                         = cuda::std::make_unique<result_type[]>(num_samples);
+  const cuda::std::size_t call_sizes[] = {0, 1, 255, 256, 257, 511, 3};
+  cuda::std::size_t filled             = 0;
+  for (cuda::std::size_t i = 0; filled < num_samples; ++i)
   {
-    d_max = ks_test_statistic_discrete<D>(samples.get(), num_samples, param, cdf);
+    const cuda::std::size_t size = cuda::std::min(call_sizes[i % 7], num_samples - filled);
+    dist(g, cuda::std::span<result_type>(samples.get() + filled, size), param);
+    filled += size;
   }
+  static_assert(cuda::std::is_void_v<decltype(dist(g, cuda::std::span<result_type>(samples.get(), 1)))>);
+  static_assert(cuda::std::is_void_v<decltype(dist(g, cuda::std::span<result_type>(samples.get(), 1), param))>);
 
-  // Note that this critical value from the KS distribution is only valid for discrete distributions when num_samples is
-  // large
-  const double critical_value = 0.016259280113043572; // for alpha = 0.01 and n = 10000
-  assert(d_max < critical_value);
-  return true;
+  return test_ks<D, continuous>(samples.get(), num_samples, param, cdf);
 }
+
 template <class D, class URNG>
 __host__ __device__ constexpr bool test_eval_constexpr()
 {
@@ -274,4 +326,14 @@ __host__ __device__ void constexpr test_distribution(cuda::std::array<typename D
   }
 }
 
+// Tests the bulk operator() of distributions that have one
+template <class D, bool continuous, class URNG, class CDF, cuda::std::size_t N>
+__host__ __device__ void test_distribution_bulk(cuda::std::array<typename D::param_type, N> params, CDF cdf)
+{
+  for (cuda::std::size_t i = 0; i < N; ++i)
+  {
+    detail::test_eval_bulk<D, continuous, URNG>(params[i], cdf);
+  }
+}
+
 #endif // LIBCUDACXX_TEST_SUPPORT_RANDOM_UTILITIES_TEST_DISTRIBUTION_H
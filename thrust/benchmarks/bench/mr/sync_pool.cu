@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+#include <thrust/mr/sync_pool.h>
+
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "nvbench_helper.cuh"
+
+// The pool the synchronized_pool_resource used to be: one mutex around an unsynchronized pool
+struct mutex_pool_resource
+{
+  void* allocate(std::size_t bytes)
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    return pool.do_allocate(bytes);
+  }
+
+  void deallocate(void* p, std::size_t bytes)
+  {
+    std::lock_guard<std::mutex> lock(mtx);
+    pool.do_deallocate(p, bytes);
+  }
+
+  std::mutex mtx;
+  thrust::mr::unsynchronized_pool_resource<thrust::mr::new_delete_resource> pool;
+};
+
+struct synchronized_resource
+{
+  void* allocate(std::size_t bytes)
+  {
+    return pool.do_allocate(bytes);
+  }
+
+  void deallocate(void* p, std::size_t bytes)
+  {
+    pool.do_deallocate(p, bytes);
+  }
+
+  thrust::mr::synchronized_pool_resource<thrust::mr::new_delete_resource> pool;
+};
+
+// Every thread repeatedly allocates a handful of blocks of mixed sizes and frees them again, like temporary_array
+// allocations inside parallel algorithms do
+template <typename Resource>
+void run(nvbench::state& state, std::size_t threads, std::size_t rounds)
+{
+  constexpr std::size_t sizes[] = {16, 48, 256, 1000, 4096, 24, 512, 8192};
+  constexpr std::size_t live    = sizeof(sizes) / sizeof(sizes[0]);
+
+  Resource resource;
+
+  state.add_element_count(threads * rounds * live, "Allocations");
+
+  state.exec(nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+      workers.emplace_back([&] {
+        void* blocks[live];
+        for (std::size_t r = 0; r < rounds; ++r)
+        {
+          for (std::size_t i = 0; i < live; ++i)
+          {
+            blocks[i] = resource.allocate(sizes[i]);
+          }
+          for (std::size_t i = 0; i < live; ++i)
+          {
+            resource.deallocate(blocks[i], sizes[i]);
+          }
+        }
+      });
+    }
+    for (auto& worker : workers)
+    {
+      worker.join();
+    }
+  });
+}
+
+static void throughput(nvbench::state& state)
+{
+  const auto threads = static_cast<std::size_t>(state.get_int64("Threads"));
+  const auto rounds  = static_cast<std::size_t>(state.get_int64("Rounds"));
+
+  if (state.get_string("Resource") == "mutex")
+  {
+    run<mutex_pool_resource>(state, threads, rounds);
+  }
+  else
+  {
+    run<synchronized_resource>(state, threads, rounds);
+  }
+}
+
+NVBENCH_BENCH(throughput)
+  .set_name("base")
+  .add_int64_power_of_two_axis("Threads", nvbench::range(0, 6, 1))
+  .add_int64_axis("Rounds", {10000})
+  .add_string_axis("Resource", {"mutex", "synchronized"});
@@ -2,6 +2,8 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/retag.h>
 
+#include <cuda/random>
+
 #include <unittest/unittest.h>
 
 _CCCL_DIAG_PUSH
@@ -212,4 +214,45 @@ void TestGenerateTuple()
 };
 DECLARE_UNITTEST(TestGenerateTuple);
 
+template <typename Engine>
+void TestGenerateRandomEngine()
+{
+  using T = typename Engine::result_type;
+
+  // sizes around the blocks that are filled in parallel
+  for (size_t n : {0, 1, 255, 256, 257, 10000})
+  {
+    Engine engine(42);
+    engine.discard(3);
+
+    // the values of a single engine called in order
+    Engine reference = engine;
+    thrust::host_vector<T> expected(n);
+    for (auto& x : expected)
+    {
+      x = reference();
+    }
+
+    thrust::host_vector<T> h_result(n);
+    thrust::generate(h_result.begin(), h_result.end(), engine);
+    ASSERT_EQUAL(h_result, expected);
+
+    thrust::device_vector<T> d_result(n);
+    thrust::generate(d_result.begin(), d_result.end(), engine);
+    ASSERT_EQUAL(d_result, expected);
+
+    thrust::device_vector<T> d_result_n(n);
+    ASSERT_EQUAL(thrust::generate_n(d_result_n.begin(), n, engine) - d_result_n.begin(), static_cast<ptrdiff_t>(n));
+    ASSERT_EQUAL(d_result_n, expected);
+  }
+}
+
+void TestGenerateRandomEngines()
+{
+  TestGenerateRandomEngine<cuda::std::philox4x32>();
+  TestGenerateRandomEngine<cuda::std::philox4x64>();
+  TestGenerateRandomEngine<cuda::pcg64>();
+}
+DECLARE_UNITTEST(TestGenerateRandomEngines);
+
 _CCCL_DIAG_POP
@@ -292,6 +292,57 @@ void TestDisjointSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachingOversized);
 
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolCachedBytesLimit()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts   = Pool::get_default_options();
+  opts.cache_oversized            = true;
+  opts.largest_block_size         = 1024;
+  opts.max_cached_oversized_bytes = 6144;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  upstream.id_to_allocate = 1;
+  alloc_id a1             = pool.do_allocate(4096, 32);
+  upstream.id_to_allocate = 2;
+  alloc_id a2             = pool.do_allocate(4096, 32);
+
+  pool.do_deallocate(a1, 4096, 32);
+
+  // make sure that caching a block doesn't exceed options.max_cached_oversized_bytes
+  upstream.id_to_deallocate = 2;
+  pool.do_deallocate(a2, 4096, 32);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  alloc_id a3 = pool.do_allocate(4096, 32);
+  ASSERT_EQUAL(a3.id, 1u);
+
+  // the block taken from the cache makes room for a new one
+  upstream.id_to_allocate = 3;
+  alloc_id a4             = pool.do_allocate(2048, 32);
+  ASSERT_EQUAL(a4.id, 3u);
+
+  pool.do_deallocate(a4, 2048, 32);
+  pool.do_deallocate(a3, 4096, 32);
+}
+
+void TestDisjointUnsynchronizedPoolCachedBytesLimit()
+{
+  TestDisjointPoolCachedBytesLimit<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolCachedBytesLimit);
+
+void TestDisjointSynchronizedPoolCachedBytesLimit()
+{
+  TestDisjointPoolCachedBytesLimit<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachedBytesLimit);
+
 template <template <typename, typename> class PoolTemplate>
 void TestDisjointGlobalPool()
 {
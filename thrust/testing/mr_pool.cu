@@ -353,6 +353,68 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+template <template <typename> class PoolTemplate>
+void TestPoolCachingOversizedBestFit()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts   = Pool::get_default_options();
+  opts.cache_oversized            = true;
+  opts.largest_block_size         = 1024;
+  opts.max_cached_oversized_bytes = 8192;
+
+  Pool pool(&upstream, opts);
+
+  upstream.id_to_allocate  = 1;
+  tracked_pointer<void> a1 = pool.do_allocate(4096, 32);
+  upstream.id_to_allocate  = 2;
+  tracked_pointer<void> a2 = pool.do_allocate(3072, 32);
+  upstream.id_to_allocate  = 3;
+  tracked_pointer<void> a3 = pool.do_allocate(2048, 32);
+
+  pool.do_deallocate(a2, 3072, 32);
+  pool.do_deallocate(a1, 4096, 32);
+
+  // make sure that caching a block doesn't exceed options.max_cached_oversized_bytes
+  upstream.id_to_deallocate = 3;
+  pool.do_deallocate(a3, 2048, 32);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  // make sure that the smallest fitting block is used, not the most recently cached one
+  tracked_pointer<void> a4 = pool.do_allocate(2560, 32);
+  ASSERT_EQUAL(a4.id, 2u);
+
+  tracked_pointer<void> a5 = pool.do_allocate(3584, 32);
+  ASSERT_EQUAL(a5.id, 1u);
+
+  // the blocks taken from the cache make room for new ones
+  upstream.id_to_allocate  = 4;
+  tracked_pointer<void> a6 = pool.do_allocate(2048, 32);
+  ASSERT_EQUAL(a6.id, 4u);
+
+  pool.do_deallocate(a6, 2048, 32);
+  pool.do_deallocate(a4, 2560, 32);
+  pool.do_deallocate(a5, 3584, 32);
+
+  upstream.id_to_allocate = 0;
+}
+
+void TestUnsynchronizedPoolCachingOversizedBestFit()
+{
+  TestPoolCachingOversizedBestFit<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCachingOversizedBestFit);
+
+void TestSynchronizedPoolCachingOversizedBestFit()
+{
+  TestPoolCachingOversizedBestFit<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCachingOversizedBestFit);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -0,0 +1,41 @@
+#include <thrust/host_vector.h>
+#include <thrust/random.h>
+#include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/system/omp/vector.h>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+// With several threads, large shuffles are split into blocks even on a single core, which must give the same
+// permutation as the sequential shuffle
+void TestOmpShuffleBlocked()
+{
+  const int num_threads = omp_get_max_threads();
+  omp_set_num_threads(4);
+
+  for (size_t n : {1000, 1 << 16, (1 << 17) + 3})
+  {
+    thrust::host_vector<int> h_input(n);
+    thrust::sequence(h_input.begin(), h_input.end());
+    thrust::omp::vector<int> d_input = h_input;
+
+    thrust::host_vector<int> h_result(n);
+    thrust::omp::vector<int> d_result(n);
+
+    thrust::default_random_engine h_g(183);
+    thrust::default_random_engine d_g(183);
+
+    thrust::shuffle_copy(h_input.begin(), h_input.end(), h_result.begin(), h_g);
+    thrust::shuffle_copy(thrust::omp::par, d_input.begin(), d_input.end(), d_result.begin(), d_g);
+    ASSERT_EQUAL(h_result, d_result);
+
+    thrust::shuffle(h_input.begin(), h_input.end(), h_g);
+    thrust::shuffle(thrust::omp::par, d_input.begin(), d_input.end(), d_g);
+    ASSERT_EQUAL(h_input, d_input);
+  }
+
+  omp_set_num_threads(num_threads);
+}
+DECLARE_UNITTEST(TestOmpShuffleBlocked);
@@ -0,0 +1,123 @@
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/system/tbb/vector.h>
+
+#include <memory>
+
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+#include <unittest/unittest.h>
+
+struct record_max_concurrency
+{
+  int* result;
+
+  void operator()(int) const
+  {
+    *result = ::tbb::this_task_arena::max_concurrency();
+  }
+};
+
+void TestTbbExecuteOnArena()
+{
+  ::tbb::task_arena arena(3);
+
+  thrust::tbb::vector<int> v(1000);
+  int max_concurrency = 0;
+
+  thrust::for_each(thrust::tbb::par.on(arena), v.begin(), v.end(), record_max_concurrency{&max_concurrency});
+  ASSERT_EQUAL(max_concurrency, 3);
+
+  max_concurrency = 0;
+  thrust::for_each(
+    thrust::tbb::par(std::allocator<char>()).on(arena), v.begin(), v.end(), record_max_concurrency{&max_concurrency});
+  ASSERT_EQUAL(max_concurrency, 3);
+}
+DECLARE_UNITTEST(TestTbbExecuteOnArena);
+
+template <typename ExecutionPolicy>
+void TestTbbExecutionParameters(ExecutionPolicy exec, size_t n)
+{
+  thrust::host_vector<int> h_input = unittest::random_integers<int>(n);
+  thrust::tbb::vector<int> d_input = h_input;
+
+  ASSERT_EQUAL(thrust::reduce(exec, d_input.begin(), d_input.end()), thrust::reduce(h_input.begin(), h_input.end()));
+
+  thrust::host_vector<int> h_output(n);
+  thrust::tbb::vector<int> d_output(n);
+
+  thrust::inclusive_scan(h_input.begin(), h_input.end(), h_output.begin());
+  thrust::inclusive_scan(exec, d_input.begin(), d_input.end(), d_output.begin());
+  ASSERT_EQUAL(h_output, d_output);
+
+  thrust::exclusive_scan(h_input.begin(), h_input.end(), h_output.begin(), 13);
+  thrust::exclusive_scan(exec, d_input.begin(), d_input.end(), d_output.begin(), 13);
+  ASSERT_EQUAL(h_output, d_output);
+
+  const auto h_end = thrust::copy_if(h_input.begin(), h_input.end(), h_output.begin(), thrust::placeholders::_1 > 0);
+  const auto d_end =
+    thrust::copy_if(exec, d_input.begin(), d_input.end(), d_output.begin(), thrust::placeholders::_1 > 0);
+  ASSERT_EQUAL(h_end - h_output.begin(), d_end - d_output.begin());
+  ASSERT_EQUAL(h_output, d_output);
+
+  thrust::stable_sort(h_input.begin(), h_input.end(), ::cuda::std::greater<int>());
+  thrust::stable_sort(exec, d_input.begin(), d_input.end(), ::cuda::std::greater<int>());
+  ASSERT_EQUAL(h_input, d_input);
+}
+
+void TestTbbExecutionParametersGrainSize()
+{
+  ::tbb::task_arena arena(4);
+
+  for (size_t grain_size : {1, 7, 4096})
+  {
+    TestTbbExecutionParameters(thrust::tbb::par.with_grain_size(grain_size), 10000);
+    TestTbbExecutionParameters(thrust::tbb::par.on(arena).with_grain_size(grain_size), 10000);
+  }
+}
+DECLARE_UNITTEST(TestTbbExecutionParametersGrainSize);
+
+void TestTbbExplicitGrainSizeIsHonored()
+{
+  namespace detail = thrust::system::tbb::detail;
+  ::tbb::task_arena arena(4);
+
+  // not capped so that every thread gets some work
+  auto exec         = thrust::tbb::par.on(arena).with_grain_size(4096);
+  const auto params = detail::parameters(exec);
+  ASSERT_EQUAL(detail::grain_size<int>(params, size_t{10000}), 4096u);
+  ASSERT_EQUAL(detail::grain_size<int>(params, size_t{1000}), 1000u);
+
+  // the length up to which sort runs serially does not depend on the grain size
+  ASSERT_EQUAL(detail::sort_detail::threshold<int>(), detail::sort_detail::serial_bytes / sizeof(int));
+}
+DECLARE_UNITTEST(TestTbbExplicitGrainSizeIsHonored);
+
+void TestTbbExecutionParametersPartitioner()
+{
+  ::tbb::task_arena arena(4);
+  ::tbb::affinity_partitioner affinity;
+
+  for (auto partitioner : {thrust::tbb::partitioner_kind::automatic,
+                           thrust::tbb::partitioner_kind::simple,
+                           thrust::tbb::partitioner_kind::static_,
+                           thrust::tbb::partitioner_kind::affinity})
+  {
+    TestTbbExecutionParameters(thrust::tbb::par.with_partitioner(partitioner), 100000);
+    TestTbbExecutionParameters(thrust::tbb::par.on(arena).with_partitioner(partitioner).with_grain_size(1000), 100000);
+  }
+
+  // the same affinity_partitioner replays its assignment of tasks to threads
+  for (int i = 0; i < 2; ++i)
+  {
+    TestTbbExecutionParameters(thrust::tbb::par.on(arena).with_partitioner(affinity), 100000);
+  }
+}
+DECLARE_UNITTEST(TestTbbExecutionParametersPartitioner);
@@ -0,0 +1,100 @@
+#include <thrust/host_vector.h>
+#include <thrust/random.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/system/tbb/vector.h>
+
+#include <climits>
+
+#include <tbb/task_arena.h>
+#include <unittest/unittest.h>
+
+// An arena with several threads buckets large scatters by destination block even on a single core, which must give
+// the same output as the sequential scatter, also for duplicate destinations and destinations past the input size
+void TestTbbScatterBlocked()
+{
+  ::tbb::task_arena arena(4);
+
+  for (size_t n : {1000, (1 << 20) + 3})
+  {
+    thrust::host_vector<int> h_input(n);
+    thrust::sequence(h_input.begin(), h_input.end(), 1);
+    thrust::tbb::vector<int> d_input = h_input;
+
+    thrust::host_vector<int> h_map(n);
+    thrust::sequence(h_map.begin(), h_map.end());
+    thrust::default_random_engine g(97);
+    thrust::shuffle(h_map.begin(), h_map.end(), g);
+
+    // a permutation
+    {
+      thrust::tbb::vector<int> d_map = h_map;
+      thrust::host_vector<int> h_result(n);
+      thrust::tbb::vector<int> d_result(n);
+      thrust::scatter(h_input.begin(), h_input.end(), h_map.begin(), h_result.begin());
+      thrust::scatter(thrust::tbb::par.on(arena), d_input.begin(), d_input.end(), d_map.begin(), d_result.begin());
+      ASSERT_EQUAL(h_result, d_result);
+    }
+
+    // destinations spread over three times the input size
+    {
+      thrust::host_vector<int> h_spread_map(n);
+      for (size_t i = 0; i < n; ++i)
+      {
+        h_spread_map[i] = 3 * h_map[i] + 2;
+      }
+      thrust::tbb::vector<int> d_spread_map = h_spread_map;
+      thrust::host_vector<int> h_result(3 * n);
+      thrust::tbb::vector<int> d_result(3 * n);
+      thrust::scatter(h_input.begin(), h_input.end(), h_spread_map.begin(), h_result.begin());
+      thrust::scatter(
+        thrust::tbb::par.on(arena), d_input.begin(), d_input.end(), d_spread_map.begin(), d_result.begin());
+      ASSERT_EQUAL(h_result, d_result);
+    }
+
+    // duplicate destinations are written in input order
+    {
+      thrust::host_vector<int> h_dup_map(n);
+      for (size_t i = 0; i < n; ++i)
+      {
+        h_dup_map[i] = h_map[i] % 1000;
+      }
+      thrust::tbb::vector<int> d_dup_map = h_dup_map;
+      thrust::host_vector<int> h_result(1000);
+      thrust::tbb::vector<int> d_result(1000);
+      thrust::scatter(h_input.begin(), h_input.end(), h_dup_map.begin(), h_result.begin());
+      thrust::scatter(thrust::tbb::par.on(arena), d_input.begin(), d_input.end(), d_dup_map.begin(), d_result.begin());
+      ASSERT_EQUAL(h_result, d_result);
+    }
+
+    // elements that are not selected neither write nor widen the destination blocks
+    {
+      thrust::host_vector<int> h_stencil(n);
+      thrust::host_vector<int> h_if_map = h_map;
+      for (size_t i = 0; i < n; ++i)
+      {
+        h_stencil[i] = i % 3 == 0;
+        if (!h_stencil[i])
+        {
+          h_if_map[i] = INT_MAX;
+        }
+      }
+      thrust::tbb::vector<int> d_stencil = h_stencil;
+      thrust::tbb::vector<int> d_if_map  = h_if_map;
+      thrust::host_vector<int> h_result(n);
+      thrust::tbb::vector<int> d_result(n);
+      thrust::scatter_if(h_input.begin(), h_input.end(), h_if_map.begin(), h_stencil.begin(), h_result.begin());
+      thrust::scatter_if(
+        thrust::tbb::par.on(arena),
+        d_input.begin(),
+        d_input.end(),
+        d_if_map.begin(),
+        d_stencil.begin(),
+        d_result.begin());
+      ASSERT_EQUAL(h_result, d_result);
+    }
+  }
+}
+DECLARE_UNITTEST(TestTbbScatterBlocked);
@@ -0,0 +1,38 @@
+#include <thrust/host_vector.h>
+#include <thrust/random.h>
+#include <thrust/sequence.h>
+#include <thrust/shuffle.h>
+#include <thrust/system/tbb/execution_policy.h>
+#include <thrust/system/tbb/vector.h>
+
+#include <tbb/task_arena.h>
+#include <unittest/unittest.h>
+
+// An arena with several threads splits large shuffles into blocks even on a single core, which must give the same
+// permutation as the sequential shuffle
+void TestTbbShuffleBlocked()
+{
+  ::tbb::task_arena arena(4);
+
+  for (size_t n : {1000, 1 << 16, (1 << 17) + 3})
+  {
+    thrust::host_vector<int> h_input(n);
+    thrust::sequence(h_input.begin(), h_input.end());
+    thrust::tbb::vector<int> d_input = h_input;
+
+    thrust::host_vector<int> h_result(n);
+    thrust::tbb::vector<int> d_result(n);
+
+    thrust::default_random_engine h_g(183);
+    thrust::default_random_engine d_g(183);
+
+    thrust::shuffle_copy(h_input.begin(), h_input.end(), h_result.begin(), h_g);
+    thrust::shuffle_copy(thrust::tbb::par.on(arena), d_input.begin(), d_input.end(), d_result.begin(), d_g);
+    ASSERT_EQUAL(h_result, d_result);
+
+    thrust::shuffle(h_input.begin(), h_input.end(), h_g);
+    thrust::shuffle(thrust::tbb::par.on(arena), d_input.begin(), d_input.end(), d_g);
+    ASSERT_EQUAL(h_input, d_input);
+  }
+}
+DECLARE_UNITTEST(TestTbbShuffleBlocked);
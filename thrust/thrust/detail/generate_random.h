@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//! \file generate_random.h
+//! \brief Lets generate fill a range in parallel blocks with a random engine that has a bulk generate
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/__random/generate_random.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace detail
+{
+// The number of values every block of a generate with an engine that has a bulk generate is filled with
+inline constexpr int generate_random_block_size = 256;
+
+// Engines like cuda::std::philox_engine or cuda::pcg64 can discard values cheaply, so a generate into a random access
+// range can give every block its own copy of the engine that starts at the first value of the block. The result is
+// the same as calling the engine once per element in order, no matter how the blocks are scheduled.
+template <typename Generator, typename Iterator>
+inline constexpr bool use_generate_random =
+  ::cuda::__has_bulk_generate_v<Generator>
+  && ::cuda::std::is_convertible_v<iterator_traversal_t<Iterator>, random_access_traversal_tag>;
+
+template <typename Size>
+_CCCL_HOST_DEVICE Size generate_random_num_blocks(Size n)
+{
+  return (n + generate_random_block_size - 1) / generate_random_block_size;
+}
+
+// Fills one block of [first, first + n) with the values engine would return for it
+template <typename Engine, typename RandomAccessIterator, typename Size>
+struct generate_random_block_functor
+{
+  Engine engine;
+  RandomAccessIterator first;
+  Size n;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE void operator()(Size block) const
+  {
+    const Size begin = block * generate_random_block_size;
+    const Size end   = ::cuda::std::min<Size>(begin + generate_random_block_size, n);
+
+    Engine block_engine = engine;
+    block_engine.discard(static_cast<unsigned long long>(begin));
+    ::cuda::generate_random(first + begin, first + end, block_engine);
+  }
+};
+} // namespace detail
+THRUST_NAMESPACE_END
@@ -29,6 +29,10 @@ THRUST_NAMESPACE_BEGIN
  *
  *  The algorithm's execution is parallelized as determined by \p exec.
  *
+ *  If \p gen is a \c cuda::std::philox_engine or a \c cuda::pcg64 and \p ForwardIterator is a random access iterator,
+ *  the range is filled in parallel blocks with the values that \p gen returns when it is called once per element in
+ *  order.
+ *
  *  \param exec The execution policy to use for parallelization.
  *  \param first The first element in the range of interest.
  *  \param last The last element in the range of interest.
@@ -113,6 +117,10 @@ void generate(ForwardIterator first, ForwardIterator last, Generator gen);
  *
  *  The algorithm's execution is parallelized as determined by \p exec.
  *
+ *  If \p gen is a \c cuda::std::philox_engine or a \c cuda::pcg64 and \p OutputIterator is a random access iterator,
+ *  the range is filled in parallel blocks with the values that \p gen returns when it is called once per element in
+ *  order.
+ *
  *  \param exec The execution policy to use for parallelization.
  *  \param first The first element in the range of interest.
  *  \param n The size of the range of interest.
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2018, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2018-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
 /*! \file
@@ -115,6 +115,7 @@ public:
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
+      , m_cached_oversized_bytes(0)
       , m_oversized(m_bookkeeper)
   {
     assert(m_options.validate());
@@ -138,6 +139,7 @@ public:
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
+      , m_cached_oversized_bytes(0)
       , m_oversized(m_bookkeeper)
   {
     assert(m_options.validate());
@@ -256,6 +258,8 @@ private:
   chunk_vector m_allocated;
   // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
   oversized_block_vector m_cached_oversized;
+  // total size of the above
+  std::size_t m_cached_oversized_bytes;
   // list of all oversized/overaligned allocations from upstream
   oversized_block_vector m_oversized;
 
@@ -286,6 +290,7 @@ public:
     m_allocated.clear();
     m_oversized.clear();
     m_cached_oversized.clear();
+    m_cached_oversized_bytes = 0;
   }
 
   void squeeze()
@@ -338,6 +343,7 @@ public:
       m_oversized.erase(find(m_oversized.begin(), m_oversized.end(), *it));
       it = m_cached_oversized.erase(it);
     }
+    m_cached_oversized_bytes = 0;
   }
 
   [[nodiscard]] virtual void_ptr
@@ -404,6 +410,7 @@ public:
         if (it != m_cached_oversized.end())
         {
           oversized.pointer = (*it).pointer;
+          m_cached_oversized_bytes -= (*it).size;
           m_cached_oversized.erase(it);
           return oversized.pointer;
         }
@@ -483,11 +490,14 @@ public:
 
       oversized_block_descriptor oversized = *it;
 
-      if (m_options.cache_oversized)
+      // cache the block, unless that would exceed the limit on the total size of cached blocks
+      if (m_options.cache_oversized
+          && oversized.size <= m_options.max_cached_oversized_bytes - m_cached_oversized_bytes)
       {
         typename oversized_block_vector::iterator position =
           lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
         m_cached_oversized.insert(position, oversized);
+        m_cached_oversized_bytes += oversized.size;
         return;
       }
 
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2018, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2018-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
 /*! \file
@@ -28,6 +28,7 @@
 #include <cuda/__memory/is_valid_alignment.h>
 #include <cuda/std/__host_stdlib/algorithm>
 #include <cuda/std/cassert>
+#include <cuda/std/climits>
 #include <cuda/std/cstdint>
 
 THRUST_NAMESPACE_BEGIN
@@ -105,6 +106,7 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_oversized_bytes(0)
   {
     assert(m_options.validate());
 
@@ -126,6 +128,7 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_oversized_bytes(0)
   {
     assert(m_options.validate());
 
@@ -167,8 +170,8 @@ private:
 
   // this was originally a forward list, but I made it a doubly linked list
   // because that way deallocation when not caching is faster and doesn't require
-  // traversal of a linked list (it's still a forward list for the cached list,
-  // because allocation from that list already traverses)
+  // traversal of a linked list (the cached blocks are additionally kept in a treap,
+  // see cache_insert)
   //
   // TODO: investigate whether it's better to have this be a doubly-linked list
   // with fast do_deallocate when !m_options.cache_oversized, or to have this be
@@ -183,10 +186,23 @@ private:
     std::size_t alignment;
     oversized_block_descriptor_ptr prev;
     oversized_block_descriptor_ptr next;
-    oversized_block_descriptor_ptr next_cached;
+    oversized_block_descriptor_ptr left;
+    oversized_block_descriptor_ptr right;
     std::size_t current_size;
   };
 
+  // the order of cached oversized blocks of the same alignment: by size, and then by address to make keys unique
+  struct cache_key
+  {
+    std::size_t size;
+    ::cuda::std::uintptr_t address;
+
+    bool operator<(const cache_key& other) const
+    {
+      return size < other.size || (size == other.size && address < other.address);
+    }
+  };
+
   struct pool
   {
     block_descriptor_ptr free_list;
@@ -203,7 +219,133 @@ private:
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+  // one treap of cached blocks per power of two alignment
+  oversized_block_descriptor_ptr m_cached_oversized[sizeof(std::size_t) * CHAR_BIT];
+  std::size_t m_cached_oversized_bytes;
+
+  static ::cuda::std::uintptr_t address_of(oversized_block_descriptor_ptr ptr)
+  {
+    return reinterpret_cast<::cuda::std::uintptr_t>(oversized_block_ptr_traits::get(ptr));
+  }
+
+  static cache_key key_of(oversized_block_descriptor_ptr ptr)
+  {
+    return {thrust::raw_reference_cast(*ptr).size, address_of(ptr)};
+  }
+
+  // a hash of the address, which makes the shape of the treap independent of the order blocks are cached in
+  static ::cuda::std::uint64_t priority_of(oversized_block_descriptor_ptr ptr)
+  {
+    ::cuda::std::uint64_t x = address_of(ptr);
+    x                       = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x                       = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+  }
+
+  // joins two treaps, where all the keys in lhs are smaller than all the keys in rhs
+  static oversized_block_descriptor_ptr
+  cache_merge(oversized_block_descriptor_ptr lhs, oversized_block_descriptor_ptr rhs)
+  {
+    if (!oversized_block_ptr_traits::get(lhs))
+    {
+      return rhs;
+    }
+    if (!oversized_block_ptr_traits::get(rhs))
+    {
+      return lhs;
+    }
+
+    if (priority_of(lhs) > priority_of(rhs))
+    {
+      thrust::raw_reference_cast(*lhs).right = cache_merge(thrust::raw_reference_cast(*lhs).right, rhs);
+      return lhs;
+    }
+
+    thrust::raw_reference_cast(*rhs).left = cache_merge(lhs, thrust::raw_reference_cast(*rhs).left);
+    return rhs;
+  }
+
+  // splits a treap into the blocks with keys smaller than key, and the rest
+  static void cache_split(oversized_block_descriptor_ptr root,
+                          const cache_key& key,
+                          oversized_block_descriptor_ptr& lhs,
+                          oversized_block_descriptor_ptr& rhs)
+  {
+    if (!oversized_block_ptr_traits::get(root))
+    {
+      lhs = oversized_block_descriptor_ptr();
+      rhs = oversized_block_descriptor_ptr();
+      return;
+    }
+
+    if (key_of(root) < key)
+    {
+      lhs = root;
+      cache_split(thrust::raw_reference_cast(*root).right, key, thrust::raw_reference_cast(*root).right, rhs);
+    }
+    else
+    {
+      rhs = root;
+      cache_split(thrust::raw_reference_cast(*root).left, key, lhs, thrust::raw_reference_cast(*root).left);
+    }
+  }
+
+  // cached oversized blocks are kept in treaps threaded through their descriptors, so that finding the best fit for a
+  // request takes logarithmic time, and caching a block doesn't need any memory
+  void cache_insert(oversized_block_descriptor_ptr block)
+  {
+    oversized_block_descriptor_ptr& root =
+      m_cached_oversized[::cuda::ilog2(thrust::raw_reference_cast(*block).alignment)];
+
+    thrust::raw_reference_cast(*block).left  = oversized_block_descriptor_ptr();
+    thrust::raw_reference_cast(*block).right = oversized_block_descriptor_ptr();
+
+    oversized_block_descriptor_ptr lhs = oversized_block_descriptor_ptr();
+    oversized_block_descriptor_ptr rhs = oversized_block_descriptor_ptr();
+    cache_split(root, key_of(block), lhs, rhs);
+    root = cache_merge(cache_merge(lhs, block), rhs);
+
+    m_cached_oversized_bytes += thrust::raw_reference_cast(*block).size;
+  }
+
+  void cache_erase(oversized_block_descriptor_ptr block)
+  {
+    const cache_key key = key_of(block);
+
+    oversized_block_descriptor_ptr* link =
+      &m_cached_oversized[::cuda::ilog2(thrust::raw_reference_cast(*block).alignment)];
+    while (address_of(*link) != key.address)
+    {
+      link = key < key_of(*link) ? &thrust::raw_reference_cast(**link).left : &thrust::raw_reference_cast(**link).right;
+    }
+    *link = cache_merge(thrust::raw_reference_cast(*block).left, thrust::raw_reference_cast(*block).right);
+
+    m_cached_oversized_bytes -= thrust::raw_reference_cast(*block).size;
+  }
+
+  // returns the smallest cached block with the given alignment and at least the given size, if any
+  oversized_block_descriptor_ptr cache_lower_bound(std::size_t alignment_log2, std::size_t bytes) const
+  {
+    const cache_key key = {bytes, 0};
+
+    oversized_block_descriptor_ptr ret  = oversized_block_descriptor_ptr();
+    oversized_block_descriptor_ptr node = m_cached_oversized[alignment_log2];
+    while (oversized_block_ptr_traits::get(node))
+    {
+      oversized_block_descriptor desc = *node;
+      if (cache_key{desc.size, address_of(node)} < key)
+      {
+        node = desc.right;
+      }
+      else
+      {
+        ret  = node;
+        node = desc.left;
+      }
+    }
+
+    return ret;
+  }
 
 public:
   /*! Releases all held memory to upstream.
@@ -241,7 +383,11 @@ public:
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
     }
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+    for (oversized_block_descriptor_ptr& root : m_cached_oversized)
+    {
+      root = oversized_block_descriptor_ptr();
+    }
+    m_cached_oversized_bytes = 0;
   }
 
   [[nodiscard]] virtual void_ptr
@@ -255,80 +401,70 @@ public:
     {
       if (m_options.cache_oversized)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (oversized_block_ptr_traits::get(ptr))
+        // look for the smallest big enough block among the cached blocks of every alignment that isn't bigger than the
+        // requested one by a factor bigger than or equal to the specified cutoff for alignment; blocks bigger than the
+        // requested size by a factor bigger than or equal to the specified cutoff for size aren't used either
+        oversized_block_descriptor_ptr ptr = oversized_block_descriptor_ptr();
+        std::size_t best_size              = 0;
+        for (std::size_t a = ::cuda::ilog2(alignment);
+             a < sizeof(std::size_t) * CHAR_BIT && (static_cast<std::size_t>(1) << a) / alignment
+                                                     < m_options.cached_alignment_cutoff_factor;
+             ++a)
         {
-          oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
+          if (!oversized_block_ptr_traits::get(m_cached_oversized[a]))
+          {
+            continue;
+          }
 
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
+          oversized_block_descriptor_ptr candidate = cache_lower_bound(a, bytes);
+          if (!oversized_block_ptr_traits::get(candidate))
           {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
-            {
-              is_good = false;
-            }
+            continue;
           }
 
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
+          std::size_t size = thrust::raw_reference_cast(*candidate).size;
+          if (size / bytes < m_options.cached_size_cutoff_factor
+              && (!oversized_block_ptr_traits::get(ptr) || size < best_size))
           {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-            {
-              is_good = false;
-            }
+            ptr       = candidate;
+            best_size = size;
           }
+        }
+
+        if (oversized_block_ptr_traits::get(ptr))
+        {
+          cache_erase(ptr);
+
+          oversized_block_descriptor desc = *ptr;
+          desc.left                       = oversized_block_descriptor_ptr();
+          desc.right                      = oversized_block_descriptor_ptr();
+
+          auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
 
-          if (is_good)
+          if (bytes != desc.size)
           {
-            if (previous != &m_cached_oversized)
+            desc.current_size = bytes;
+
+            ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+
+            if (oversized_block_ptr_traits::get(desc.prev))
             {
-              *previous = desc.next_cached;
+              thrust::raw_reference_cast(*desc.prev).next = ptr;
             }
             else
             {
-              m_cached_oversized = desc.next_cached;
+              m_oversized = ptr;
             }
 
-            desc.next_cached = oversized_block_descriptor_ptr();
-
-            auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
-
-            if (bytes != desc.size)
+            if (oversized_block_ptr_traits::get(desc.next))
             {
-              desc.current_size = bytes;
-
-              ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
-
-              if (oversized_block_ptr_traits::get(desc.prev))
-              {
-                thrust::raw_reference_cast(*desc.prev).next = ptr;
-              }
-              else
-              {
-                m_oversized = ptr;
-              }
-
-              if (oversized_block_ptr_traits::get(desc.next))
-              {
-                thrust::raw_reference_cast(*desc.next).prev = ptr;
-              }
+              thrust::raw_reference_cast(*desc.next).prev = ptr;
             }
-
-            *ptr = desc;
-
-            return static_cast<void_ptr>(ret);
           }
 
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
+          *ptr = desc;
+
+          return static_cast<void_ptr>(ret);
         }
       }
 
@@ -342,7 +478,8 @@ public:
       desc.alignment    = alignment;
       desc.prev         = oversized_block_descriptor_ptr();
       desc.next         = m_oversized;
-      desc.next_cached  = oversized_block_descriptor_ptr();
+      desc.left         = oversized_block_descriptor_ptr();
+      desc.right        = oversized_block_descriptor_ptr();
       desc.current_size = bytes;
       *block            = desc;
       m_oversized       = block;
@@ -440,12 +577,12 @@ public:
 
       oversized_block_descriptor desc = *block;
       assert(desc.current_size == n);
-      assert(desc.alignment == alignment);
+      // a cached block may be reused for a request with a smaller alignment
+      assert(desc.alignment >= alignment);
 
-      if (m_options.cache_oversized)
+      // cache the block, unless that would exceed the limit on the total size of cached blocks
+      if (m_options.cache_oversized && desc.size <= m_options.max_cached_oversized_bytes - m_cached_oversized_bytes)
       {
-        desc.next_cached = m_cached_oversized;
-
         if (desc.size != n)
         {
           desc.current_size = desc.size;
@@ -466,8 +603,8 @@ public:
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        *block = desc;
+        cache_insert(block);
 
         return;
       }
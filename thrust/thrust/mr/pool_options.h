@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2018, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2018-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
 /*! \file
@@ -84,6 +84,10 @@ struct pool_options
    * that allocation request.
    */
   std::size_t cached_alignment_cutoff_factor;
+  /*! The maximal total size of the oversized and overaligned blocks cached at any time. A deallocated block that would
+   *      exceed it is returned to the upstream resource instead of being cached. Defaults to no limit.
+   */
+  std::size_t max_cached_oversized_bytes = static_cast<std::size_t>(-1);
 
   /*! Checks if the options are self-consistent.
    *
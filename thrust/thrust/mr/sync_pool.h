@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2018, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2018-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
 /*! \file
@@ -18,7 +18,13 @@
 #endif // no system header
 #include <thrust/mr/pool.h>
 
+#include <cuda/__cmath/ilog.h>
+#include <cuda/std/__host_stdlib/algorithm>
+
+#include <atomic>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -29,6 +35,14 @@ namespace mr
  */
 
 /*! A mutex-synchronized version of \p unsynchronized_pool_resource. Uses \p std::mutex, and therefore requires C++11.
+ *
+ *  To keep threads from serializing on the mutex, small blocks are served from magazines: every thread is assigned one
+ *      of a few shards, each of which keeps a short stack of free blocks per pool. Allocations and deallocations only
+ *      lock the shard of the calling thread, which other threads rarely contend on, and take the mutex of the shared
+ *      pool only to refill an empty magazine or to return half of a full one. When a thread exits, the magazines of its
+ *      shard are drained back to the shared pool, so that the blocks they hold are not stranded in a shard that no
+ *      thread uses anymore. Oversized and overaligned allocations, and blocks bigger than \p max_magazine_block_size,
+ *      always go to the shared pool.
  *
  *  \tparam Upstream the type of memory resources that will be used for allocating memory
  */
@@ -40,6 +54,14 @@ struct synchronized_pool_resource : public memory_resource<typename Upstream::po
 
   using void_ptr = typename Upstream::pointer;
 
+  /*! The number of free blocks a magazine holds at most.
+   */
+  static constexpr std::size_t magazine_capacity = 16;
+
+  /*! The size of the biggest blocks kept in magazines. Bigger blocks would tie up too much memory in every shard.
+   */
+  static constexpr std::size_t max_magazine_block_size = static_cast<std::size_t>(1) << 15;
+
 public:
   /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
    *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
@@ -57,7 +79,13 @@ public:
    */
   synchronized_pool_resource(Upstream* upstream, pool_options options = get_default_options())
       : upstream_pool(upstream, options)
-  {}
+      , opts(options)
+      , smallest_block_log2(::cuda::ceil_ilog2(options.smallest_block_size))
+      , shards(shard_count())
+  {
+    init_shards();
+    register_pool();
+  }
 
   /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
    *
@@ -65,12 +93,37 @@ public:
    */
   synchronized_pool_resource(pool_options options = get_default_options())
       : upstream_pool(get_global_resource<Upstream>(), options)
-  {}
+      , opts(options)
+      , smallest_block_log2(::cuda::ceil_ilog2(options.smallest_block_size))
+      , shards(shard_count())
+  {
+    init_shards();
+    register_pool();
+  }
+
+  /*! Destructor. Releases all held memory to upstream.
+   */
+  ~synchronized_pool_resource()
+  {
+    unregister_pool();
+  }
 
   /*! Releases all held memory to upstream.
    */
   void release()
   {
+    // the blocks in the magazines belong to chunks the pool is about to free, so they are just forgotten
+    std::vector<std::unique_lock<std::mutex>> shard_locks;
+    shard_locks.reserve(shards.size());
+    for (shard& s : shards)
+    {
+      shard_locks.emplace_back(s.mtx);
+      for (magazine& m : s.magazines)
+      {
+        m.count = 0;
+      }
+    }
+
     lock_t lock(mtx);
     upstream_pool.release();
   }
@@ -78,19 +131,197 @@ public:
   [[nodiscard]] virtual void_ptr
   do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
-    lock_t lock(mtx);
-    return upstream_pool.do_allocate(bytes, alignment);
+    const std::size_t cls = size_class(bytes, alignment);
+    if (cls == no_class)
+    {
+      lock_t lock(mtx);
+      return upstream_pool.do_allocate(bytes, alignment);
+    }
+
+    shard& s = this_thread_shard();
+    lock_t shard_lock(s.mtx);
+    magazine& m = s.magazines[cls];
+
+    // refill half of an empty magazine from the shared pool; if that throws, the blocks taken so far are returned
+    if (m.count == 0)
+    {
+      lock_t lock(mtx);
+      _CCCL_TRY
+      {
+        for (; m.count < magazine_capacity / 2; ++m.count)
+        {
+          m.blocks[m.count] = upstream_pool.do_allocate(class_size(cls), opts.alignment);
+        }
+      }
+      _CCCL_CATCH_ALL
+      {
+        for (; m.count > 0; --m.count)
+        {
+          upstream_pool.do_deallocate(m.blocks[m.count - 1], class_size(cls), opts.alignment);
+        }
+        _CCCL_RETHROW;
+      }
+    }
+
+    return m.blocks[--m.count];
   }
 
   virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
   {
-    lock_t lock(mtx);
-    upstream_pool.do_deallocate(p, n, alignment);
+    const std::size_t cls = size_class(n, alignment);
+    if (cls == no_class)
+    {
+      lock_t lock(mtx);
+      upstream_pool.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    shard& s = this_thread_shard();
+    lock_t shard_lock(s.mtx);
+    magazine& m = s.magazines[cls];
+
+    // return the bottom half of a full magazine to the shared pool, keeping the most recently freed blocks
+    if (m.count == magazine_capacity)
+    {
+      {
+        lock_t lock(mtx);
+        for (std::size_t i = 0; i < magazine_capacity / 2; ++i)
+        {
+          upstream_pool.do_deallocate(m.blocks[i], class_size(cls), opts.alignment);
+        }
+      }
+
+      std::copy(m.blocks + magazine_capacity / 2, m.blocks + magazine_capacity, m.blocks);
+      m.count = magazine_capacity / 2;
+    }
+
+    m.blocks[m.count++] = p;
   }
 
 private:
+  static constexpr std::size_t no_class = static_cast<std::size_t>(-1);
+
+  struct magazine
+  {
+    void_ptr blocks[magazine_capacity];
+    std::size_t count = 0;
+  };
+
+  struct alignas(64) shard
+  {
+    std::mutex mtx;
+    std::vector<magazine> magazines;
+  };
+
+  // one shard per hardware thread, rounded up to a power of two and capped at 64
+  static std::size_t shard_count()
+  {
+    const std::size_t threads = (std::max) (std::thread::hardware_concurrency(), 1u);
+    return static_cast<std::size_t>(1) << ::cuda::ceil_ilog2((std::min) (threads, static_cast<std::size_t>(64)));
+  }
+
+  void init_shards()
+  {
+    const std::size_t largest = (std::min) (opts.largest_block_size, max_magazine_block_size);
+    const std::size_t classes =
+      largest < opts.smallest_block_size ? 0 : ::cuda::ceil_ilog2(largest) - smallest_block_log2 + 1;
+
+    for (shard& s : shards)
+    {
+      s.magazines.resize(classes);
+    }
+  }
+
+  // the pools that are alive, which have to drain the shard of a thread when it exits
+  static std::mutex& registry_mutex()
+  {
+    static std::mutex registry_mtx;
+    return registry_mtx;
+  }
+
+  static std::vector<synchronized_pool_resource*>& registry()
+  {
+    static std::vector<synchronized_pool_resource*> pools;
+    return pools;
+  }
+
+  void register_pool()
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    registry().push_back(this);
+  }
+
+  void unregister_pool()
+  {
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto& pools = registry();
+    pools.erase(std::find(pools.begin(), pools.end(), this));
+  }
+
+  // returns the blocks of all magazines of a shard to the shared pool
+  void drain_shard(std::size_t thread_index)
+  {
+    shard& s = shards[thread_index & (shards.size() - 1)];
+    lock_t shard_lock(s.mtx);
+    lock_t lock(mtx);
+    for (std::size_t cls = 0; cls < s.magazines.size(); ++cls)
+    {
+      magazine& m = s.magazines[cls];
+      for (; m.count > 0; --m.count)
+      {
+        upstream_pool.do_deallocate(m.blocks[m.count - 1], class_size(cls), opts.alignment);
+      }
+    }
+  }
+
+  // the index of a thread, which drains its shard of every pool when the thread exits
+  struct thread_slot
+  {
+    std::size_t index;
+
+    ~thread_slot()
+    {
+      std::lock_guard<std::mutex> lock(registry_mutex());
+      for (synchronized_pool_resource* pool : registry())
+      {
+        pool->drain_shard(index);
+      }
+    }
+  };
+
+  // threads are assigned shards round-robin in the order they first use a pool
+  shard& this_thread_shard()
+  {
+    static std::atomic<std::size_t> next_thread_index{0};
+    thread_local const thread_slot slot{next_thread_index.fetch_add(1, std::memory_order_relaxed)};
+
+    return shards[slot.index & (shards.size() - 1)];
+  }
+
+  // the index of the magazine serving a request, or no_class if the request must go to the shared pool
+  std::size_t size_class(std::size_t bytes, std::size_t alignment) const
+  {
+    bytes = (std::max) (bytes, opts.smallest_block_size);
+    if (bytes > opts.largest_block_size || bytes > max_magazine_block_size || alignment > opts.alignment)
+    {
+      return no_class;
+    }
+
+    return ::cuda::ceil_ilog2(bytes) - smallest_block_log2;
+  }
+
+  // a size the shared pool serves from the bucket of the given magazine
+  std::size_t class_size(std::size_t cls) const
+  {
+    return (std::min) (static_cast<std::size_t>(1) << (cls + smallest_block_log2), opts.largest_block_size);
+  }
+
   std::mutex mtx;
   unsync_pool upstream_pool;
+
+  pool_options opts;
+  std::size_t smallest_block_log2;
+  std::vector<shard> shards;
 };
 
 /*! \} // memory_resources
@@ -15,8 +15,11 @@
 #if _CCCL_CUDA_COMPILATION()
 #  include <cub/device/device_transform.cuh>
 
+#  include <thrust/detail/generate_random.h>
+#  include <thrust/iterator/counting_iterator.h>
 #  include <thrust/system/cuda/detail/cdp_dispatch.h>
 #  include <thrust/system/cuda/detail/dispatch.h>
+#  include <thrust/system/cuda/detail/for_each.h>
 
 #  include <cuda/std/__iterator/distance.h>
 #  include <cuda/std/tuple>
@@ -29,18 +32,31 @@ template <class Derived, class OutputIt, class Size, class Generator>
 OutputIt _CCCL_HOST_DEVICE
 generate_n(execution_policy<Derived>& policy, OutputIt result, Size count, Generator generator)
 {
-  THRUST_CDP_DISPATCH(({
-                        cudaError_t status;
-                        THRUST_INDEX_TYPE_DISPATCH(
-                          status,
-                          (CUB_NS_QUALIFIER::DeviceTransform::Generate),
-                          count,
-                          (result, count_fixed, generator, cuda_cub::stream(policy)));
-                        throw_on_error(status, "generate_n: failed inside CUB");
-                        throw_on_error(synchronize_optional(policy), "generate_n: failed to synchronize");
-                        return result + count;
-                      }),
-                      ({ return thrust::generate_n(cvt_to_seq(derived_cast(policy)), result, count, generator); }));
+  if constexpr (thrust::detail::use_generate_random<Generator, OutputIt>)
+  {
+    // every thread fills a block of the output with the values a single engine would produce in order
+    using functor_t = thrust::detail::generate_random_block_functor<Generator, OutputIt, Size>;
+    cuda_cub::for_each_n(policy,
+                         thrust::counting_iterator<Size>(0),
+                         thrust::detail::generate_random_num_blocks(count),
+                         functor_t{generator, result, count});
+    return result + count;
+  }
+  else
+  {
+    THRUST_CDP_DISPATCH(({
+                          cudaError_t status;
+                          THRUST_INDEX_TYPE_DISPATCH(
+                            status,
+                            (CUB_NS_QUALIFIER::DeviceTransform::Generate),
+                            count,
+                            (result, count_fixed, generator, cuda_cub::stream(policy)));
+                          throw_on_error(status, "generate_n: failed inside CUB");
+                          throw_on_error(synchronize_optional(policy), "generate_n: failed to synchronize");
+                          return result + count;
+                        }),
+                        ({ return thrust::generate_n(cvt_to_seq(derived_cast(policy)), result, count, generator); }));
+  }
 }
 
 template <class Derived, class OutputIt, class Generator>
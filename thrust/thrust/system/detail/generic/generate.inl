@@ -13,8 +13,12 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/generate_random.h>
 #include <thrust/for_each.h>
+#include <thrust/generate.h>
+#include <thrust/iterator/counting_iterator.h>
 
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__utility/forward.h>
 #include <cuda/std/__utility/move.h>
 
@@ -38,14 +42,34 @@ template <typename ExecutionPolicy, typename ForwardIterator, typename Generator
 _CCCL_HOST_DEVICE void
 generate(execution_policy<ExecutionPolicy>& exec, ForwardIterator first, ForwardIterator last, Generator gen)
 {
-  thrust::for_each(exec, first, last, generate_functor<Generator>{::cuda::std::move(gen)});
+  if constexpr (thrust::detail::use_generate_random<Generator, ForwardIterator>)
+  {
+    thrust::generate_n(exec, first, ::cuda::std::distance(first, last), ::cuda::std::move(gen));
+  }
+  else
+  {
+    thrust::for_each(exec, first, last, generate_functor<Generator>{::cuda::std::move(gen)});
+  }
 }
 
 template <typename ExecutionPolicy, typename OutputIterator, typename Size, typename Generator>
 _CCCL_HOST_DEVICE OutputIterator
 generate_n(execution_policy<ExecutionPolicy>& exec, OutputIterator first, Size n, Generator gen)
 {
-  return thrust::for_each_n(exec, first, n, generate_functor<Generator>{::cuda::std::move(gen)});
+  if constexpr (thrust::detail::use_generate_random<Generator, OutputIterator>)
+  {
+    // the blocks of the output are filled in parallel with the values a single engine would produce in order
+    using functor_t = thrust::detail::generate_random_block_functor<Generator, OutputIterator, Size>;
+    thrust::for_each_n(exec,
+                       thrust::counting_iterator<Size>(0),
+                       thrust::detail::generate_random_num_blocks(n),
+                       functor_t{::cuda::std::move(gen), first, n});
+    return first + n;
+  }
+  else
+  {
+    return thrust::for_each_n(exec, first, n, generate_functor<Generator>{::cuda::std::move(gen)});
+  }
 }
 } // namespace system::detail::generic
 THRUST_NAMESPACE_END
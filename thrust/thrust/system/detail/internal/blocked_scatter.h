@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file blocked_scatter.h
+ *  \brief Scatter grouped by destination block, shared by the CPU-parallel backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/transform_reduce.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/__functional/maximum.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// Scatters with fewer elements than this are not worth bucketing by destination
+inline constexpr size_t blocked_scatter_threshold = 1 << 20;
+
+// blocked_scatter_if needs random access everywhere and integral destinations to bucket
+template <typename InputIterator1, typename InputIterator2, typename InputIterator3, typename OutputIterator>
+inline constexpr bool use_blocked_scatter =
+  ::cuda::std::is_integral_v<thrust::detail::it_value_t<InputIterator2>>
+  && ::cuda::std::is_convertible_v<typename iterator_traversal<InputIterator1>::type, random_access_traversal_tag>
+  && ::cuda::std::is_convertible_v<typename iterator_traversal<InputIterator2>::type, random_access_traversal_tag>
+  && ::cuda::std::is_convertible_v<typename iterator_traversal<InputIterator3>::type, random_access_traversal_tag>
+  && ::cuda::std::is_convertible_v<typename iterator_traversal<OutputIterator>::type, random_access_traversal_tag>;
+
+// Scatters every element i of [first, first + n) with pred(stencil[i]) to output[map[i]], grouped by destination.
+// scatter does not know the size of output, so the destinations [0, max + 1) are cut into num_blocks blocks, max being
+// the largest destination that is written, found with a parallel reduction. The source indices are bucketed by the
+// block they are written to, so that every destination block is written by a single task in the end. Different tasks
+// never write to the same part of output, and elements sharing a destination are written in input order. All loops run
+// on thrust::for_each_n of exec over the blocks.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename Size,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename RandomAccessIterator,
+          typename Predicate>
+void blocked_scatter_if(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  Size n,
+  InputIterator2 map,
+  InputIterator3 stencil,
+  RandomAccessIterator output,
+  Predicate pred,
+  Size num_blocks)
+{
+  thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+  // one past the largest destination that is written, zero if nothing is
+  const Size extent = thrust::transform_reduce(
+    exec,
+    thrust::counting_iterator<Size>(0),
+    thrust::counting_iterator<Size>(n),
+    [=](Size i) {
+      return wrapped_pred(stencil[i]) ? static_cast<Size>(map[i]) + 1 : Size{0};
+    },
+    Size{0},
+    ::cuda::maximum<Size>{});
+  if (extent == 0)
+  {
+    return;
+  }
+
+  const uniform_decomposition<Size> decomp(n, 1, num_blocks);
+
+  const Size nb    = decomp.size();
+  const Size width = ::cuda::ceil_div(extent, nb);
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> histograms(exec, nb * nb);
+  thrust::detail::temporary_array<Size, DerivedPolicy> indices(exec, n);
+
+  Size* offsets = thrust::raw_pointer_cast(histograms.data());
+  Size* bucket  = thrust::raw_pointer_cast(indices.data());
+
+  // below nb for every destination in [0, extent)
+  auto block_of = [=](Size i) {
+    return static_cast<Size>(map[i]) / width;
+  };
+
+  // count the destinations of every source block per destination block
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), nb, [=](Size s) {
+    Size* histogram = offsets + s * nb;
+
+    for (Size d = 0; d < nb; ++d)
+    {
+      histogram[d] = 0;
+    }
+
+    for (Size i = decomp[s].begin(); i < decomp[s].end(); ++i)
+    {
+      if (wrapped_pred(stencil[i]))
+      {
+        ++histogram[block_of(i)];
+      }
+    }
+  });
+
+  // lay out the buckets of every destination block in source block order
+  Size sum = 0;
+  for (Size d = 0; d < nb; ++d)
+  {
+    for (Size s = 0; s < nb; ++s)
+    {
+      const Size count    = offsets[s * nb + d];
+      offsets[s * nb + d] = sum;
+      sum += count;
+    }
+  }
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), nb, [=](Size s) {
+    Size* bucket_offsets = offsets + s * nb;
+
+    for (Size i = decomp[s].begin(); i < decomp[s].end(); ++i)
+    {
+      if (wrapped_pred(stencil[i]))
+      {
+        bucket[bucket_offsets[block_of(i)]++] = i;
+      }
+    }
+  });
+
+  // the offsets of the last source block now hold the end of every destination block's bucket
+  const Size* bucket_ends = offsets + (nb - 1) * nb;
+
+  thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), nb, [=](Size d) {
+    for (Size k = (d == 0 ? 0 : bucket_ends[d - 1]); k < bucket_ends[d]; ++k)
+    {
+      const Size i   = bucket[k];
+      output[map[i]] = first[i];
+    }
+  });
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file blocked_shuffle.h
+ *  \brief Shuffle by per-block counts of a random bijection, shared by the CPU-parallel backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/random_bijection.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// Shuffles with fewer elements than this are not worth splitting into blocks
+inline constexpr size_t blocked_shuffle_threshold = 1 << 16;
+
+// blocked_shuffle_copy writes the output at computed positions
+template <typename RandomIterator, typename OutputIterator>
+inline constexpr bool use_blocked_shuffle =
+  ::cuda::std::is_convertible_v<typename iterator_traversal<RandomIterator>::type, random_access_traversal_tag>
+  && ::cuda::std::is_convertible_v<typename iterator_traversal<OutputIterator>::type, random_access_traversal_tag>;
+
+// The number of indices of the bijection a block maps at a time
+inline constexpr std::uint64_t blocked_shuffle_block_size = 1 << 14;
+
+// Copies [first, first + m) to result in the order of a feistel_bijection over [0, n), n being the power of two the
+// bijection covers, skipping the images that are m or larger. This is the permutation of generic::shuffle_copy for
+// the same generator, without its scan over all n indices: [0, n) is walked in rounds of num_blocks blocks, every
+// block of a round keeps its images below m in a buffer of its own, and after a scan of their counts every block
+// gathers its elements to its own part of result. Every image is computed once, and the buffers take
+// num_blocks * blocked_shuffle_block_size indices no matter how large m is. All loops run on thrust::for_each_n of
+// exec over the blocks.
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void blocked_shuffle_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomIterator first,
+  std::uint64_t m,
+  OutputIterator result,
+  URBG&& g,
+  std::uint64_t num_blocks)
+{
+  using Size = std::uint64_t;
+
+  const thrust::detail::feistel_bijection bijection(m, ::cuda::std::forward<URBG>(g));
+
+  const Size n          = bijection.size();
+  const Size block_size = blocked_shuffle_block_size;
+  const Size nb         = ::cuda::std::min(num_blocks, ::cuda::ceil_div(n, block_size));
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> buffers(exec, nb * block_size);
+  thrust::detail::temporary_array<Size, DerivedPolicy> counts(exec, nb + 1);
+
+  Size* keys    = thrust::raw_pointer_cast(buffers.data());
+  Size* offsets = thrust::raw_pointer_cast(counts.data());
+
+  using OutputDifference = thrust::detail::it_difference_t<OutputIterator>;
+  using InputDifference  = thrust::detail::it_difference_t<RandomIterator>;
+
+  Size written = 0;
+  for (Size round = 0; round < n; round += nb * block_size)
+  {
+    // keep the images below m of every block
+    thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), nb, [=](Size b) {
+      const Size begin = ::cuda::std::min(n, round + b * block_size);
+      const Size end   = ::cuda::std::min(n, begin + block_size);
+
+      Size* block_keys = keys + b * block_size;
+      Size count       = 0;
+
+      for (Size i = begin; i < end; ++i)
+      {
+        const Size key    = bijection(i);
+        block_keys[count] = key;
+        count += key < m;
+      }
+
+      offsets[b] = count;
+    });
+
+    // turn the counts into the output position of every block
+    Size sum = written;
+    for (Size b = 0; b < nb; ++b)
+    {
+      const Size count = offsets[b];
+      offsets[b]       = sum;
+      sum += count;
+    }
+    offsets[nb] = sum;
+    written     = sum;
+
+    thrust::for_each_n(exec, thrust::counting_iterator<Size>(0), nb, [=](Size b) {
+      const Size* block_keys = keys + b * block_size;
+      OutputIterator out     = result + static_cast<OutputDifference>(offsets[b]);
+
+      for (Size k = 0; k < offsets[b + 1] - offsets[b]; ++k, ++out)
+      {
+        *out = first[static_cast<InputDifference>(block_keys[k])];
+      }
+    });
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
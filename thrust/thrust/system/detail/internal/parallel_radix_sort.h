@@ -0,0 +1,306 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file parallel_radix_sort.h
+ *  \brief Blocked LSD radix sort for primitive keys shared by the CPU-parallel backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+namespace parallel_radix_sort_detail
+{
+inline constexpr unsigned int radix_bits     = 8;
+inline constexpr unsigned int histogram_size = 1u << radix_bits;
+
+template <typename KeyType, bool Descending>
+struct digit_functor
+{
+  using Encoder     = sequential::radix_sort_detail::RadixEncoder<KeyType>;
+  using EncodedType = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
+
+  static constexpr unsigned int num_passes = (8 * sizeof(EncodedType) + radix_bits - 1) / radix_bits;
+
+  unsigned int bit_shift;
+
+  unsigned int operator()(KeyType key) const
+  {
+    const auto digit = static_cast<unsigned int>((Encoder{}(key) >> bit_shift) & (histogram_size - 1));
+
+    // reversing the order of the digits sorts descending without giving up stability
+    return Descending ? (histogram_size - 1) - digit : digit;
+  }
+};
+
+// Moves the elements of every block of [keys_src, keys_src + n) to their digit's bucket. offsets holds one row of
+// histogram_size output positions per block, which is consumed while scattering.
+template <typename Digit, typename Decomposition, typename Iterator1, typename Iterator2, typename ForEachBlock>
+void radix_scatter(
+  Digit digit,
+  const Decomposition& decomp,
+  size_t* offsets,
+  Iterator1 keys_src,
+  Iterator2 keys_dst,
+  ForEachBlock for_each_block)
+{
+  using Size = typename Decomposition::index_type;
+
+  for_each_block(decomp.size(), [=](Size b) {
+    size_t* block_offsets = offsets + b * histogram_size;
+
+    for (Size i = decomp[b].begin(); i < decomp[b].end(); ++i)
+    {
+      keys_dst[block_offsets[digit(keys_src[i])]++] = keys_src[i];
+    }
+  });
+}
+
+// Like radix_scatter, but moves the value associated with every key alongside it
+template <typename Digit,
+          typename Decomposition,
+          typename Iterator1,
+          typename Iterator2,
+          typename Iterator3,
+          typename Iterator4,
+          typename ForEachBlock>
+void radix_scatter_by_key(
+  Digit digit,
+  const Decomposition& decomp,
+  size_t* offsets,
+  Iterator1 keys_src,
+  Iterator2 values_src,
+  Iterator3 keys_dst,
+  Iterator4 values_dst,
+  ForEachBlock for_each_block)
+{
+  using Size = typename Decomposition::index_type;
+
+  for_each_block(decomp.size(), [=](Size b) {
+    size_t* block_offsets = offsets + b * histogram_size;
+
+    for (Size i = decomp[b].begin(); i < decomp[b].end(); ++i)
+    {
+      const size_t pos = block_offsets[digit(keys_src[i])]++;
+      keys_dst[pos]    = keys_src[i];
+      values_dst[pos]  = values_src[i];
+    }
+  });
+}
+
+// Computes the per-block histograms of the digit of [keys, keys + n) and turns them into the output position of the
+// first element of every block and digit. Returns false if all keys share the same digit, in which case the pass
+// can be skipped.
+template <typename Digit, typename Decomposition, typename Iterator, typename ForEachBlock>
+bool radix_offsets(
+  Digit digit, const Decomposition& decomp, size_t* histograms, Iterator keys, size_t n, ForEachBlock for_each_block)
+{
+  using Size = typename Decomposition::index_type;
+
+  for_each_block(decomp.size(), [=](Size b) {
+    size_t* histogram = histograms + b * histogram_size;
+
+    for (unsigned int d = 0; d < histogram_size; ++d)
+    {
+      histogram[d] = 0;
+    }
+
+    for (Size i = decomp[b].begin(); i < decomp[b].end(); ++i)
+    {
+      ++histogram[digit(keys[i])];
+    }
+  });
+
+  // the buckets of a digit are laid out in block order, which keeps the sort stable
+  size_t sum = 0;
+  for (unsigned int d = 0; d < histogram_size; ++d)
+  {
+    const size_t bucket_begin = sum;
+
+    for (Size b = 0; b < decomp.size(); ++b)
+    {
+      const size_t count                 = histograms[b * histogram_size + d];
+      histograms[b * histogram_size + d] = sum;
+      sum += count;
+    }
+
+    if (sum - bucket_begin == n)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Runs the passes of a radix sort of the n keys in keys, which are moved back and forth between keys and keys_temp.
+// scatter(digit, to_temp) has to move the elements of every block to the bucket of their digit, from keys to keys_temp
+// if to_temp is true and the other way around otherwise. Returns true if the sorted keys ended up in keys_temp.
+template <bool Descending,
+          typename Decomposition,
+          typename Iterator1,
+          typename Iterator2,
+          typename ForEachBlock,
+          typename Scatter>
+bool radix_passes(
+  const Decomposition& decomp,
+  size_t* offsets,
+  Iterator1 keys,
+  Iterator2 keys_temp,
+  size_t n,
+  ForEachBlock for_each_block,
+  Scatter scatter)
+{
+  using Digit = digit_functor<thrust::detail::it_value_t<Iterator1>, Descending>;
+
+  // false if the most recent data is stored in keys
+  bool flip = false;
+
+  for (unsigned int pass = 0; pass < Digit::num_passes; ++pass)
+  {
+    const Digit digit{pass * radix_bits};
+
+    const bool needs_scatter = flip ? radix_offsets(digit, decomp, offsets, keys_temp, n, for_each_block)
+                                    : radix_offsets(digit, decomp, offsets, keys, n, for_each_block);
+
+    if (needs_scatter)
+    {
+      scatter(digit, !flip);
+      flip = !flip;
+    }
+  }
+
+  return flip;
+}
+
+// Copies every block of [src, src + n) to dst
+template <typename Decomposition, typename Iterator1, typename Iterator2, typename ForEachBlock>
+void copy_blocks(const Decomposition& decomp, Iterator1 src, Iterator2 dst, ForEachBlock for_each_block)
+{
+  using Size = typename Decomposition::index_type;
+
+  for_each_block(decomp.size(), [=](Size b) {
+    for (Size i = decomp[b].begin(); i < decomp[b].end(); ++i)
+    {
+      dst[i] = src[i];
+    }
+  });
+}
+} // namespace parallel_radix_sort_detail
+
+// Stable LSD radix sort of the primitive keys [keys_first, keys_first + n). The input is cut into num_blocks blocks;
+// every pass builds one digit histogram per block, scans them serially in (digit, block) order and lets every block
+// scatter its own elements. for_each_block(num_blocks, f) must call f(b) for every b in [0, num_blocks), possibly in
+// parallel.
+template <bool Descending, typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename ForEachBlock>
+void parallel_radix_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator keys_first,
+  Size n,
+  Size num_blocks,
+  ForEachBlock for_each_block)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const uniform_decomposition<Size> decomp(n, 1, num_blocks);
+
+  thrust::detail::temporary_array<size_t, DerivedPolicy> histograms(
+    exec, decomp.size() * parallel_radix_sort_detail::histogram_size);
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_temp(exec, n);
+
+  size_t* offsets = thrust::raw_pointer_cast(histograms.data());
+  auto temp       = keys_temp.begin();
+
+  const bool flip = parallel_radix_sort_detail::radix_passes<Descending>(
+    decomp, offsets, keys_first, temp, static_cast<size_t>(n), for_each_block, [&](auto digit, bool to_temp) {
+      if (to_temp)
+      {
+        parallel_radix_sort_detail::radix_scatter(digit, decomp, offsets, keys_first, temp, for_each_block);
+      }
+      else
+      {
+        parallel_radix_sort_detail::radix_scatter(digit, decomp, offsets, temp, keys_first, for_each_block);
+      }
+    });
+
+  // ensure final values are in keys_first
+  if (flip)
+  {
+    parallel_radix_sort_detail::copy_blocks(decomp, temp, keys_first, for_each_block);
+  }
+}
+
+// Like parallel_radix_sort, but permutes [values_first, values_first + n) alongside the keys
+template <bool Descending,
+          typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename Size,
+          typename ForEachBlock>
+void parallel_radix_sort_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator2 values_first,
+  Size n,
+  Size num_blocks,
+  ForEachBlock for_each_block)
+{
+  using KeyType   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator2>;
+
+  const uniform_decomposition<Size> decomp(n, 1, num_blocks);
+
+  thrust::detail::temporary_array<size_t, DerivedPolicy> histograms(
+    exec, decomp.size() * parallel_radix_sort_detail::histogram_size);
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_temp(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values_temp(exec, n);
+
+  size_t* offsets = thrust::raw_pointer_cast(histograms.data());
+  auto keys_tmp   = keys_temp.begin();
+  auto values_tmp = values_temp.begin();
+
+  const bool flip = parallel_radix_sort_detail::radix_passes<Descending>(
+    decomp, offsets, keys_first, keys_tmp, static_cast<size_t>(n), for_each_block, [&](auto digit, bool to_temp) {
+      if (to_temp)
+      {
+        parallel_radix_sort_detail::radix_scatter_by_key(
+          digit, decomp, offsets, keys_first, values_first, keys_tmp, values_tmp, for_each_block);
+      }
+      else
+      {
+        parallel_radix_sort_detail::radix_scatter_by_key(
+          digit, decomp, offsets, keys_tmp, values_tmp, keys_first, values_first, for_each_block);
+      }
+    });
+
+  // ensure final values are in (keys_first, values_first)
+  if (flip)
+  {
+    parallel_radix_sort_detail::copy_blocks(decomp, keys_tmp, keys_first, for_each_block);
+    parallel_radix_sort_detail::copy_blocks(decomp, values_tmp, values_first, for_each_block);
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
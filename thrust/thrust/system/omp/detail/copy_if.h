@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2008-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
@@ -13,8 +13,15 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/copy_if.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/merge_path.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
+
+#include <cuda/std/__iterator/distance.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
@@ -32,8 +39,26 @@ OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  if constexpr (merge_path_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return result
+         + stream_compaction_detail::stable_partition_copy_n(
+             exec, first, ::cuda::std::distance(first, last), stencil, result, thrust::discard_iterator<>(), pred);
+  }
+  else
+  {
+    // omp prefers generic::copy_if to cpp::copy_if
+    return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  }
 } // end copy_if()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file key_segments.h
+ *  \brief Chunking of ranges of keys into segments of equivalent keys for the OpenMP backend.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace key_segments_detail
+{
+// Inputs with fewer keys than this are processed by a single thread
+inline constexpr size_t parallel_key_segments_threshold = 1 << 14;
+
+// Number of chunks n keys are cut into, one per thread
+template <typename Size>
+Size num_chunks(Size n)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  return ::cuda::std::min<Size>(
+    omp_get_max_threads(), ::cuda::ceil_div(n, static_cast<Size>(parallel_key_segments_threshold)));
+#else
+  return 1;
+#endif
+}
+
+// Returns the position of the first key of chunk c when n keys are cut into num_chunks chunks
+template <typename Size>
+Size chunk_begin(Size n, Size c, Size num_chunks)
+{
+  return static_cast<Size>((static_cast<unsigned long long>(n) * c) / num_chunks);
+}
+
+// Returns whether keys[i] starts a new segment, i.e. is not equivalent to the key before it
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+bool is_head(RandomAccessIterator keys, Size i, BinaryPredicate binary_pred)
+{
+  thrust::detail::wrapped_function<BinaryPredicate, bool> wrapped_pred{binary_pred};
+
+  return i == 0 || !wrapped_pred(keys[i - 1], keys[i]);
+}
+
+// Returns the position of the first segment head in [begin, end), or end if there is none
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+Size first_head(RandomAccessIterator keys, Size begin, Size end, BinaryPredicate binary_pred)
+{
+  while (begin != end && !is_head(keys, begin, binary_pred))
+  {
+    ++begin;
+  }
+
+  return begin;
+}
+
+// Returns the position of the last segment head in [begin, end), which must contain at least one
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate>
+Size last_head(RandomAccessIterator keys, Size begin, Size end, BinaryPredicate binary_pred)
+{
+  Size i = end - 1;
+
+  while (i != begin && !is_head(keys, i, binary_pred))
+  {
+    --i;
+  }
+
+  return i;
+}
+
+// Counts the segment heads of every chunk of [keys, keys + n) in parallel and scans the counts into
+// offsets[0], ..., offsets[num_chunks], so that the segments starting in chunk c are the outputs
+// [offsets[c], offsets[c + 1]).
+template <typename RandomAccessIterator, typename Size, typename BinaryPredicate, typename OffsetIterator>
+void scan_heads(RandomAccessIterator keys, Size n, Size num_chunks, BinaryPredicate binary_pred, OffsetIterator offsets)
+{
+  THRUST_PRAGMA_OMP(parallel for)
+  for (Size c = 0; c < num_chunks; ++c)
+  {
+    const Size end = chunk_begin(n, c + 1, num_chunks);
+
+    Size count = 0;
+    for (Size i = chunk_begin(n, c, num_chunks); i < end; ++i)
+    {
+      count += is_head(keys, i, binary_pred);
+    }
+
+    offsets[c + 1] = count;
+  }
+
+  offsets[0] = 0;
+  for (Size c = 0; c < num_chunks; ++c)
+  {
+    offsets[c + 1] += offsets[c];
+  }
+}
+} // namespace key_segments_detail
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -1,6 +1,10 @@
-// SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2008-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+/*! \file merge.h
+ *  \brief OpenMP implementation of merge and merge_by_key.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -13,5 +17,254 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits merge
-#include <thrust/system/cpp/detail/merge.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/merge.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/merge_path.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/common_type.h>
+#include <cuda/std/__utility/pair.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace merge_detail
+{
+// Inputs with fewer elements than this, in total, are merged by a single thread
+inline constexpr size_t parallel_merge_threshold = 1 << 14;
+
+// Number of chunks the output of a merge of n elements is cut into, one per thread
+template <typename Size>
+Size num_merge_chunks(Size n)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  return ::cuda::std::min<Size>(
+    omp_get_max_threads(), ::cuda::ceil_div(n, static_cast<Size>(parallel_merge_threshold)));
+#else
+  return 1;
+#endif
+}
+
+// Returns the first output position of chunk c when n outputs are cut into num_chunks chunks
+template <typename Size>
+Size chunk_begin(Size n, Size c, Size num_chunks)
+{
+  return static_cast<Size>((static_cast<unsigned long long>(n) * c) / num_chunks);
+}
+
+// Writes the outputs at positions [diag_begin, diag_end) of the stable merge of [first1, first1 + n1) and
+// [first2, first2 + n2) to result + diag_begin
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename Size,
+          typename StrictWeakOrdering>
+void merge_diagonals(
+  RandomAccessIterator1 first1,
+  Size n1,
+  RandomAccessIterator2 first2,
+  Size n2,
+  Size diag_begin,
+  Size diag_end,
+  RandomAccessIterator3 result,
+  StrictWeakOrdering comp)
+{
+  const Size i_begin = merge_path_detail::merge_path(first1, n1, first2, n2, diag_begin, comp);
+  const Size i_end   = merge_path_detail::merge_path(first1, n1, first2, n2, diag_end, comp);
+
+  thrust::merge(thrust::seq,
+                first1 + i_begin,
+                first1 + i_end,
+                first2 + (diag_begin - i_begin),
+                first2 + (diag_end - i_end),
+                result + diag_begin,
+                comp);
+}
+
+// Same as merge_diagonals, but carries along the values associated with the keys
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename RandomAccessIterator5,
+          typename RandomAccessIterator6,
+          typename Size,
+          typename StrictWeakOrdering>
+void merge_by_key_diagonals(
+  RandomAccessIterator1 keys_first1,
+  Size n1,
+  RandomAccessIterator2 keys_first2,
+  Size n2,
+  RandomAccessIterator3 values_first1,
+  RandomAccessIterator4 values_first2,
+  Size diag_begin,
+  Size diag_end,
+  RandomAccessIterator5 keys_result,
+  RandomAccessIterator6 values_result,
+  StrictWeakOrdering comp)
+{
+  const Size i_begin = merge_path_detail::merge_path(keys_first1, n1, keys_first2, n2, diag_begin, comp);
+  const Size i_end   = merge_path_detail::merge_path(keys_first1, n1, keys_first2, n2, diag_end, comp);
+
+  thrust::merge_by_key(
+    thrust::seq,
+    keys_first1 + i_begin,
+    keys_first1 + i_end,
+    keys_first2 + (diag_begin - i_begin),
+    keys_first2 + (diag_end - i_end),
+    values_first1 + i_begin,
+    values_first2 + (diag_begin - i_begin),
+    keys_result + diag_begin,
+    values_result + diag_begin,
+    comp);
+}
+} // end namespace merge_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator
+merge(execution_policy<DerivedPolicy>&,
+      InputIterator1 first1,
+      InputIterator1 last1,
+      InputIterator2 first2,
+      InputIterator2 last2,
+      OutputIterator result,
+      StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  if constexpr (merge_path_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    using Size = ::cuda::std::common_type_t<thrust::detail::it_difference_t<InputIterator1>,
+                                            thrust::detail::it_difference_t<InputIterator2>>;
+
+    const Size n1         = ::cuda::std::distance(first1, last1);
+    const Size n2         = ::cuda::std::distance(first2, last2);
+    const Size n          = n1 + n2;
+    const Size num_chunks = merge_detail::num_merge_chunks(n);
+
+    if (num_chunks > 1)
+    {
+      THRUST_PRAGMA_OMP(parallel for)
+      for (Size c = 0; c < num_chunks; ++c)
+      {
+        merge_detail::merge_diagonals(
+          first1,
+          n1,
+          first2,
+          n2,
+          merge_detail::chunk_begin(n, c, num_chunks),
+          merge_detail::chunk_begin(n, c + 1, num_chunks),
+          result,
+          comp);
+      }
+
+      return result + n;
+    }
+  }
+
+  return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+} // end merge()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_key(
+  execution_policy<DerivedPolicy>&,
+  InputIterator1 keys_first1,
+  InputIterator1 keys_last1,
+  InputIterator2 keys_first2,
+  InputIterator2 keys_last2,
+  InputIterator3 values_first1,
+  InputIterator4 values_first2,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  if constexpr (merge_path_detail::is_random_access_v<InputIterator1,
+                                                 InputIterator2,
+                                                 InputIterator3,
+                                                 InputIterator4,
+                                                 OutputIterator1,
+                                                 OutputIterator2>)
+  {
+    using Size = ::cuda::std::common_type_t<thrust::detail::it_difference_t<InputIterator1>,
+                                            thrust::detail::it_difference_t<InputIterator2>>;
+
+    const Size n1         = ::cuda::std::distance(keys_first1, keys_last1);
+    const Size n2         = ::cuda::std::distance(keys_first2, keys_last2);
+    const Size n          = n1 + n2;
+    const Size num_chunks = merge_detail::num_merge_chunks(n);
+
+    if (num_chunks > 1)
+    {
+      THRUST_PRAGMA_OMP(parallel for)
+      for (Size c = 0; c < num_chunks; ++c)
+      {
+        merge_detail::merge_by_key_diagonals(
+          keys_first1,
+          n1,
+          keys_first2,
+          n2,
+          values_first1,
+          values_first2,
+          merge_detail::chunk_begin(n, c, num_chunks),
+          merge_detail::chunk_begin(n, c + 1, num_chunks),
+          keys_result,
+          values_result,
+          comp);
+      }
+
+      return ::cuda::std::make_pair(keys_result + n, values_result + n);
+    }
+  }
+
+  return thrust::merge_by_key(
+    thrust::seq,
+    keys_first1,
+    keys_last1,
+    keys_first2,
+    keys_last2,
+    values_first1,
+    values_first2,
+    keys_result,
+    values_result,
+    comp);
+} // end merge_by_key()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file merge_path.h
+ *  \brief Merge path partitioning of two sorted ranges for the OpenMP backend.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/binary_search.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/iterator/iterator_traits.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace merge_path_detail
+{
+// Partitioning along the merge path needs random access to all inputs and outputs
+template <typename... Iterators>
+inline constexpr bool is_random_access_v =
+  (::cuda::std::is_convertible_v<typename iterator_traversal<Iterators>::type, random_access_traversal_tag> && ...);
+
+// Returns the number of elements of [a, a + n1) among the first diag elements of the stable merge of
+// [a, a + n1) and [b, b + n2), i.e. the point where the merge path crosses diagonal diag. Equivalent keys
+// are taken from a before b.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+Size merge_path(RandomAccessIterator1 a, Size n1, RandomAccessIterator2 b, Size n2, Size diag, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size begin = ::cuda::std::max<Size>(0, diag - n2);
+  Size end   = ::cuda::std::min<Size>(diag, n1);
+
+  while (begin < end)
+  {
+    const Size mid = begin + (end - begin) / 2;
+
+    if (!wrapped_comp(b[diag - 1 - mid], a[mid]))
+    {
+      begin = mid + 1;
+    }
+    else
+    {
+      end = mid;
+    }
+  }
+
+  return begin;
+}
+
+// Like merge_path, but moves the split point back to the beginning of the run of keys equivalent to the next key
+// in merge order, so that equivalent keys of both ranges never straddle two partitions. This is what set
+// operations need to match up duplicates across the inputs. Split points stay monotonic in diag.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+::cuda::std::pair<Size, Size> balanced_path(
+  RandomAccessIterator1 a, Size n1, RandomAccessIterator2 b, Size n2, Size diag, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size i = merge_path(a, n1, b, n2, diag, comp);
+  Size j = diag - i;
+
+  if (i < n1 && (j == n2 || !wrapped_comp(b[j], a[i])))
+  {
+    RandomAccessIterator1 key = a + i;
+    i = thrust::lower_bound(thrust::seq, a, a + i, thrust::raw_reference_cast(*key), comp) - a;
+    j = thrust::lower_bound(thrust::seq, b, b + j, thrust::raw_reference_cast(*key), comp) - b;
+  }
+  else if (j < n2)
+  {
+    RandomAccessIterator2 key = b + j;
+    i = thrust::lower_bound(thrust::seq, a, a + i, thrust::raw_reference_cast(*key), comp) - a;
+    j = thrust::lower_bound(thrust::seq, b, b + j, thrust::raw_reference_cast(*key), comp) - b;
+  }
+
+  return ::cuda::std::make_pair(i, j);
+}
+} // namespace merge_path_detail
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2008-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
 /*! \file reduce.h
@@ -17,8 +17,14 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/partition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/merge_path.h>
+#include <thrust/system/omp/detail/stream_compaction.h>
+
+#include <cuda/std/__iterator/distance.h>
 
 #include <cuda/std/__utility/pair.h>
 
@@ -46,39 +52,58 @@ ForwardIterator stable_partition(
 } // end stable_partition()
 
 template <typename DerivedPolicy,
-          typename InputIterator,
+          typename InputIterator1,
+          typename InputIterator2,
           typename OutputIterator1,
           typename OutputIterator2,
           typename Predicate>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   execution_policy<DerivedPolicy>& exec,
-  InputIterator first,
-  InputIterator last,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
   OutputIterator1 out_true,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  if constexpr (merge_path_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2>)
+  {
+    const auto num_true = stream_compaction_detail::stable_partition_copy_n(
+      exec, first, ::cuda::std::distance(first, last), stencil, out_true, out_false, pred);
+
+    return ::cuda::std::make_pair(out_true + num_true, out_false + (::cuda::std::distance(first, last) - num_true));
+  }
+  else
+  {
+    // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
+    return thrust::system::detail::generic::stable_partition_copy(
+      exec, first, last, stencil, out_true, out_false, pred);
+  }
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
-          typename InputIterator1,
-          typename InputIterator2,
+          typename InputIterator,
           typename OutputIterator1,
           typename OutputIterator2,
           typename Predicate>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> stable_partition_copy(
   execution_policy<DerivedPolicy>& exec,
-  InputIterator1 first,
-  InputIterator1 last,
-  InputIterator2 stencil,
+  InputIterator first,
+  InputIterator last,
   OutputIterator1 out_true,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  return omp::detail::stable_partition_copy(exec, first, last, first, out_true, out_false, pred);
 } // end stable_partition_copy()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
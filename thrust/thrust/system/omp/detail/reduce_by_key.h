@@ -1,8 +1,8 @@
-// SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2008-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
 /*! \file reduce.h
- *  \brief OpenMP implementation of reduce algorithms.
+ *  \brief OpenMP implementation of reduce_by_key.
  */
 
 #pragma once
@@ -17,8 +17,20 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/function.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/reduce.h>
 #include <thrust/system/detail/generic/reduce_by_key.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/key_segments.h>
+#include <thrust/system/omp/detail/merge_path.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
@@ -40,6 +52,112 @@ template <typename DerivedPolicy,
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  if constexpr (merge_path_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2>)
+  {
+    using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+    // Use the input iterator's value type per https://wg21.link/P0571, like sequential::reduce_by_key
+    using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+    const Size n          = ::cuda::std::distance(keys_first, keys_last);
+    const Size num_chunks = key_segments_detail::num_chunks(n);
+
+    if (num_chunks > 1)
+    {
+      thrust::detail::wrapped_function<BinaryFunction, ValueType> wrapped_op{binary_op};
+
+      thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, num_chunks + 1);
+      thrust::detail::temporary_array<ValueType, DerivedPolicy> carries(exec, num_chunks);
+
+      key_segments_detail::scan_heads(keys_first, n, num_chunks, binary_pred, offsets.begin());
+
+      // a chunk has a carry if its first key continues a segment of the previous chunk
+      auto has_carry = [=](Size c) {
+        return c < num_chunks
+            && !key_segments_detail::is_head(
+                 keys_first, key_segments_detail::chunk_begin(n, c, num_chunks), binary_pred);
+      };
+
+      // reduce the values of every chunk up to its first segment head
+      THRUST_PRAGMA_OMP(parallel for)
+      for (Size c = 1; c < num_chunks; ++c)
+      {
+        if (has_carry(c))
+        {
+          const Size begin = key_segments_detail::chunk_begin(n, c, num_chunks);
+          const Size end   = key_segments_detail::chunk_begin(n, c + 1, num_chunks);
+          const Size head  = key_segments_detail::first_head(keys_first, begin, end, binary_pred);
+
+          ValueType carry = values_first[begin];
+          for (Size i = begin + 1; i < head; ++i)
+          {
+            carry = wrapped_op(carry, values_first[i]);
+          }
+
+          carries[c] = carry;
+        }
+      }
+
+      // chunks without a segment head belong to a segment that continues into the next chunk, so fold the carries
+      // back to front into the carry of the first chunk of every such run of chunks
+      for (Size c = num_chunks - 2; c > 0; --c)
+      {
+        if (has_carry(c) && offsets[c] == offsets[c + 1] && has_carry(c + 1))
+        {
+          carries[c] = wrapped_op(carries[c], carries[c + 1]);
+        }
+      }
+
+      // every chunk reduces the segments starting in it and appends the carry of the next chunk to its last segment
+      THRUST_PRAGMA_OMP(parallel for)
+      for (Size c = 0; c < num_chunks; ++c)
+      {
+        if (offsets[c] != offsets[c + 1])
+        {
+          const Size begin = key_segments_detail::chunk_begin(n, c, num_chunks);
+          const Size end   = key_segments_detail::chunk_begin(n, c + 1, num_chunks);
+          const Size head  = key_segments_detail::first_head(keys_first, begin, end, binary_pred);
+          const Size last  = key_segments_detail::last_head(keys_first, head, end, binary_pred);
+
+          thrust::reduce_by_key(
+            thrust::seq,
+            keys_first + head,
+            keys_first + last,
+            values_first + head,
+            keys_output + offsets[c],
+            values_output + offsets[c],
+            binary_pred,
+            binary_op);
+
+          ValueType sum = values_first[last];
+          for (Size i = last + 1; i < end; ++i)
+          {
+            sum = wrapped_op(sum, values_first[i]);
+          }
+
+          if (has_carry(c + 1))
+          {
+            sum = wrapped_op(sum, carries[c + 1]);
+          }
+
+          keys_output[offsets[c + 1] - 1]   = keys_first[last];
+          values_output[offsets[c + 1] - 1] = sum;
+        }
+      }
+
+      return ::cuda::std::make_pair(keys_output + offsets[num_chunks], values_output + offsets[num_chunks]);
+    }
+  }
+
   // omp prefers generic::reduce_by_key to cpp::reduce_by_key
   return thrust::system::detail::generic::reduce_by_key(
     exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
@@ -1,6 +1,10 @@
-// SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2008-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+/*! \file scatter.h
+ *  \brief OpenMP implementation of scatter and scatter_if.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -13,5 +17,78 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits this algorithm
-#include <thrust/system/cpp/detail/scatter.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/scatter.h>
+#include <thrust/system/detail/internal/blocked_scatter.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+#include <cuda/std/__functional/identity.h>
+#include <cuda/std/__iterator/distance.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename RandomAccessIterator,
+          typename Predicate>
+void scatter_if(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 map,
+  InputIterator3 stencil,
+  RandomAccessIterator output,
+  Predicate pred)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  if constexpr (thrust::system::detail::internal::
+                  use_blocked_scatter<InputIterator1, InputIterator2, InputIterator3, RandomAccessIterator>)
+  {
+    using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+    const Size n          = ::cuda::std::distance(first, last);
+    const Size num_blocks = omp_get_max_threads();
+
+    if (static_cast<size_t>(n) >= thrust::system::detail::internal::blocked_scatter_threshold && num_blocks > 1)
+    {
+      thrust::system::detail::internal::blocked_scatter_if(exec, first, n, map, stencil, output, pred, num_blocks);
+      return;
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  // small scatters run on omp::for_each through generic::scatter_if
+  thrust::system::detail::generic::scatter_if(exec, first, last, map, stencil, output, pred);
+} // end scatter_if()
+
+template <typename DerivedPolicy, typename InputIterator1, typename InputIterator2, typename RandomAccessIterator>
+void scatter(execution_policy<DerivedPolicy>& exec,
+             InputIterator1 first,
+             InputIterator1 last,
+             InputIterator2 map,
+             RandomAccessIterator output)
+{
+  omp::detail::scatter_if(
+    exec, first, last, map, thrust::make_constant_iterator(true), output, ::cuda::std::identity{});
+} // end scatter()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -1,6 +1,10 @@
-// SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2008-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+/*! \file set_operations.h
+ *  \brief OpenMP implementation of set_difference, set_intersection, set_symmetric_difference and set_union.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -13,5 +17,261 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits set_operations
-#include <thrust/system/cpp/detail/set_operations.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/merge_path.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/common_type.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace set_operations_detail
+{
+// Inputs with fewer elements than this, in total, are processed by a single thread
+inline constexpr size_t parallel_set_operation_threshold = 1 << 14;
+
+struct serial_set_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_intersection
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_symmetric_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_union
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+// Splits both inputs into one partition per thread along the merge path, snapped to boundaries between runs of
+// equivalent keys, counts the output of every partition, scans the counts and finally lets every thread write its
+// partition's output at the scanned offset.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation set_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  if constexpr (merge_path_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    using Size = ::cuda::std::common_type_t<thrust::detail::it_difference_t<InputIterator1>,
+                                            thrust::detail::it_difference_t<InputIterator2>>;
+
+    const Size n1 = ::cuda::std::distance(first1, last1);
+    const Size n2 = ::cuda::std::distance(first2, last2);
+    const Size n  = n1 + n2;
+
+    const Size num_partitions = ::cuda::std::min<Size>(
+      omp_get_max_threads(), ::cuda::ceil_div(n, static_cast<Size>(parallel_set_operation_threshold)));
+
+    if (num_partitions > 1)
+    {
+      thrust::detail::temporary_array<Size, DerivedPolicy> splits1(exec, num_partitions + 1);
+      thrust::detail::temporary_array<Size, DerivedPolicy> splits2(exec, num_partitions + 1);
+      thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, num_partitions + 1);
+
+      splits1[0]              = 0;
+      splits2[0]              = 0;
+      splits1[num_partitions] = n1;
+      splits2[num_partitions] = n2;
+
+      THRUST_PRAGMA_OMP(parallel for)
+      for (Size p = 1; p < num_partitions; ++p)
+      {
+        const Size diag  = static_cast<Size>((static_cast<unsigned long long>(n) * p) / num_partitions);
+        const auto split = merge_path_detail::balanced_path(first1, n1, first2, n2, diag, comp);
+        splits1[p]       = split.first;
+        splits2[p]       = split.second;
+      }
+
+      // count the output of every partition
+      THRUST_PRAGMA_OMP(parallel for)
+      for (Size p = 0; p < num_partitions; ++p)
+      {
+        thrust::discard_iterator<> counter = thrust::make_discard_iterator();
+        offsets[p + 1] = set_op(first1 + splits1[p],
+                                first1 + splits1[p + 1],
+                                first2 + splits2[p],
+                                first2 + splits2[p + 1],
+                                counter,
+                                comp)
+                       - counter;
+      }
+
+      offsets[0] = 0;
+      for (Size p = 0; p < num_partitions; ++p)
+      {
+        offsets[p + 1] += offsets[p];
+      }
+
+      THRUST_PRAGMA_OMP(parallel for)
+      for (Size p = 0; p < num_partitions; ++p)
+      {
+        set_op(first1 + splits1[p],
+               first1 + splits1[p + 1],
+               first2 + splits2[p],
+               first2 + splits2[p + 1],
+               result + offsets[p],
+               comp);
+      }
+
+      return result + offsets[num_partitions];
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  return set_op(first1, last1, first2, last2, result, comp);
+}
+} // end namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_difference{});
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_intersection{});
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_symmetric_difference{});
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  return set_operations_detail::set_operation(
+    exec, first1, last1, first2, last2, result, comp, set_operations_detail::serial_set_union{});
+} // end set_union()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
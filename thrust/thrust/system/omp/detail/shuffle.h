@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file shuffle.h
+ *  \brief OpenMP implementation of shuffle_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/blocked_shuffle.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/cstdint>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<RandomIterator, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  if constexpr (thrust::system::detail::internal::use_blocked_shuffle<RandomIterator, OutputIterator>)
+  {
+    const auto m          = static_cast<std::uint64_t>(last - first);
+    const auto num_blocks = static_cast<std::uint64_t>(omp_get_max_threads());
+
+    if (m >= thrust::system::detail::internal::blocked_shuffle_threshold && num_blocks > 1)
+    {
+      thrust::system::detail::internal::blocked_shuffle_copy(
+        exec, first, m, result, ::cuda::std::forward<URBG>(g), num_blocks);
+      return;
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  // small shuffles compact the bijection with a scan through generic::shuffle_copy
+  thrust::system::detail::generic::shuffle_copy(exec, first, last, result, ::cuda::std::forward<URBG>(g));
+} // end shuffle_copy()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
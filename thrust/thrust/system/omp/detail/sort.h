@@ -20,59 +20,126 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/copy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
-#include <thrust/merge.h>
 #include <thrust/sort.h>
-#include <thrust/system/detail/generic/select_system.h>
-#include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/omp/detail/merge.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/__algorithm/min.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
 namespace sort_detail
 {
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+// Primitive keys sorted with a default comparator are radix sorted in parallel from this many elements on
+inline constexpr size_t parallel_radix_sort_threshold = 1 << 16;
+
+template <typename KeyType, typename StrictWeakOrdering>
+inline constexpr bool use_radix_sort =
+  thrust::system::detail::sequential::sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering>;
+
+template <typename KeyType, typename StrictWeakOrdering>
+inline constexpr bool descending =
+  thrust::system::detail::sequential::sort_detail::needs_reverse<KeyType, StrictWeakOrdering>;
+
+// Runs f(b) for every block b of a parallel_radix_sort on its own thread
+struct for_each_block
 {
-  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  template <typename IndexType, typename Function>
+  void operator()(IndexType num_blocks, Function f) const
+  {
+    THRUST_PRAGMA_OMP(parallel for schedule(static, 1))
+    for (IndexType b = 0; b < num_blocks; ++b)
+    {
+      f(b);
+    }
+  }
+};
+
+// Merges the sorted runs delimited by bounds[0], ..., bounds[num_runs] pairwise. The output of the whole level is cut
+// into num_chunks equally sized chunks, one per thread, so every thread stays busy even when only a single pair of
+// runs is left. Each chunk is cut along the merge paths of the pairs it intersects; merge_diagonals(begin, middle,
+// end, diag_begin, diag_end) has to produce the outputs [diag_begin, diag_end) of merging the runs
+// [begin, middle) and [middle, end).
+template <typename IndexType, typename BoundsIterator, typename MergeDiagonals>
+void merge_adjacent_runs(BoundsIterator bounds, IndexType num_runs, IndexType num_chunks, MergeDiagonals merge_diagonals)
+{
+  const IndexType n = bounds[num_runs];
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType c = 0; c < num_chunks; ++c)
+  {
+    IndexType lo       = merge_detail::chunk_begin(n, c, num_chunks);
+    const IndexType hi = merge_detail::chunk_begin(n, c + 1, num_chunks);
+
+    for (IndexType r = 0; r < num_runs && lo < hi; r += 2)
+    {
+      const IndexType begin  = bounds[r];
+      const IndexType middle = bounds[::cuda::std::min<IndexType>(r + 1, num_runs)];
+      const IndexType end    = bounds[::cuda::std::min<IndexType>(r + 2, num_runs)];
+
+      if (end <= lo)
+      {
+        continue;
+      }
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+      const IndexType chunk_end = ::cuda::std::min<IndexType>(hi, end);
+      merge_diagonals(begin, middle, end, lo - begin, chunk_end - begin);
+      lo = chunk_end;
+    }
+  }
 }
 
-template <typename DerivedPolicy,
-          typename RandomAccessIterator1,
-          typename RandomAccessIterator2,
-          typename StrictWeakOrdering>
-void inplace_merge_by_key(
-  execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+// Sorts every one of num_threads tiles with sort_tile, then merges the sorted tiles level by level with
+// merge_level(bounds, num_runs, to_buffer), which merges from the input to the buffer if to_buffer is true and from
+// the buffer back to the input otherwise. Returns whether the sorted sequence ended up in the buffer.
+template <typename DerivedPolicy, typename IndexType, typename SortTile, typename MergeLevel>
+bool sort_and_merge_tiles(
+  execution_policy<DerivedPolicy>& exec, IndexType n, IndexType num_threads, SortTile sort_tile, MergeLevel merge_level)
 {
-  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
-  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
+  thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, num_threads);
+
+  IndexType num_runs = decomp.size();
+
+  thrust::detail::temporary_array<IndexType, DerivedPolicy> bounds(exec, num_runs + 1);
+
+  for (IndexType i = 0; i < num_runs; ++i)
+  {
+    bounds[i] = decomp[i].begin();
+  }
+  bounds[num_runs] = n;
+
+  // every thread sorts its own tile
+  THRUST_PRAGMA_OMP(parallel for)
+  for (IndexType i = 0; i < num_runs; ++i)
+  {
+    sort_tile(decomp[i].begin(), decomp[i].end());
+  }
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
+  bool in_buffer = false;
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+  while (num_runs > 1)
+  {
+    merge_level(bounds.begin(), num_runs, !in_buffer);
+    in_buffer = !in_buffer;
 
-  thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
+    // every other bound delimits a run of the next level
+    num_runs = (num_runs + 1) / 2;
+    for (IndexType i = 1; i < num_runs; ++i)
+    {
+      bounds[i] = bounds[2 * i];
+    }
+    bounds[num_runs] = n;
+  }
+
+  return in_buffer;
 }
 } // namespace sort_detail
 
@@ -91,61 +158,60 @@ void stable_sort(
 
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using IndexType  = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
-  if (first == last)
-  {
-    return;
-  }
+  const IndexType n = last - first;
 
-  THRUST_PRAGMA_OMP(parallel)
+  if constexpr (sort_detail::use_radix_sort<value_type, StrictWeakOrdering>)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+    const IndexType num_blocks = omp_get_max_threads();
 
-    // process id
-    IndexType p_i = omp_get_thread_num();
-
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
+    if (static_cast<size_t>(n) >= sort_detail::parallel_radix_sort_threshold && num_blocks > 1)
     {
-      thrust::stable_sort(thrust::seq, first + decomp[p_i].begin(), first + decomp[p_i].end(), comp);
+      constexpr bool descending = sort_detail::descending<value_type, StrictWeakOrdering>;
+      thrust::system::detail::internal::parallel_radix_sort<descending>(
+        exec, first, n, num_blocks, sort_detail::for_each_block{});
+      return;
     }
+  }
 
-    THRUST_PRAGMA_OMP(barrier)
-
-    // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-    ;
-
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+  const IndexType num_threads = merge_detail::num_merge_chunks(n);
 
-    while (nseg > 1)
-    {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
-
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
+  if (num_threads <= 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
 
-        b = c;
-        c += h;
-      }
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer(exec, first, last);
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+  auto sort_tile = [=](IndexType begin, IndexType end) {
+    thrust::stable_sort(thrust::seq, first + begin, first + end, comp);
+  };
 
-      THRUST_PRAGMA_OMP(barrier)
+  auto merge_level = [&](auto bounds, IndexType num_runs, bool to_buffer) {
+    auto merge = [&](auto src, auto dst) {
+      sort_detail::merge_adjacent_runs(
+        bounds, num_runs, num_threads, [=](IndexType begin, IndexType middle, IndexType end, IndexType lo, IndexType hi) {
+          merge_detail::merge_diagonals(
+            src + begin, middle - begin, src + middle, end - middle, lo, hi, dst + begin, comp);
+        });
+    };
 
-      // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-      ;
+    if (to_buffer)
+    {
+      merge(first, buffer.begin());
+    }
+    else
+    {
+      merge(buffer.begin(), first);
     }
+  };
+
+  if (sort_detail::sort_and_merge_tiles(exec, n, num_threads, sort_tile, merge_level))
+  {
+    thrust::copy(exec, buffer.begin(), buffer.end(), first);
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
@@ -172,72 +238,73 @@ void stable_sort_by_key(
 
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using IndexType   = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
 
-  if (keys_first == keys_last)
-  {
-    return;
-  }
+  const IndexType n = keys_last - keys_first;
 
-  THRUST_PRAGMA_OMP(parallel)
+  if constexpr (sort_detail::use_radix_sort<value_type1, StrictWeakOrdering>)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
-      keys_last - keys_first, 1, omp_get_num_threads());
-
-    // process id
-    IndexType p_i = omp_get_thread_num();
+    const IndexType num_blocks = omp_get_max_threads();
 
-    // every thread sorts its own tile
-    if (p_i < decomp.size())
+    if (static_cast<size_t>(n) >= sort_detail::parallel_radix_sort_threshold && num_blocks > 1)
     {
-      thrust::stable_sort_by_key(
-        thrust::seq,
-        keys_first + decomp[p_i].begin(),
-        keys_first + decomp[p_i].end(),
-        values_first + decomp[p_i].begin(),
-        comp);
+      constexpr bool descending = sort_detail::descending<value_type1, StrictWeakOrdering>;
+      thrust::system::detail::internal::parallel_radix_sort_by_key<descending>(
+        exec, keys_first, values_first, n, num_blocks, sort_detail::for_each_block{});
+      return;
     }
+  }
 
-    THRUST_PRAGMA_OMP(barrier)
-
-    // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-    ;
-
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
+  const IndexType num_threads = merge_detail::num_merge_chunks(n);
 
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+  if (num_threads <= 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
 
-    while (nseg > 1)
+  thrust::detail::temporary_array<value_type1, DerivedPolicy> keys_buffer(exec, keys_first, keys_last);
+  thrust::detail::temporary_array<value_type2, DerivedPolicy> values_buffer(exec, values_first, values_first + n);
+
+  auto sort_tile = [=](IndexType begin, IndexType end) {
+    thrust::stable_sort_by_key(thrust::seq, keys_first + begin, keys_first + end, values_first + begin, comp);
+  };
+
+  auto merge_level = [&](auto bounds, IndexType num_runs, bool to_buffer) {
+    auto merge = [&](auto keys_src, auto values_src, auto keys_dst, auto values_dst) {
+      sort_detail::merge_adjacent_runs(
+        bounds, num_runs, num_threads, [=](IndexType begin, IndexType middle, IndexType end, IndexType lo, IndexType hi) {
+          merge_detail::merge_by_key_diagonals(
+            keys_src + begin,
+            middle - begin,
+            keys_src + middle,
+            end - middle,
+            values_src + begin,
+            values_src + middle,
+            lo,
+            hi,
+            keys_dst + begin,
+            values_dst + begin,
+            comp);
+        });
+    };
+
+    if (to_buffer)
     {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
-
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
-      }
-
-      nseg = (nseg + 1) / 2;
-      h *= 2;
-
-      THRUST_PRAGMA_OMP(barrier)
-
-      // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
-      ;
+      merge(keys_first, values_first, keys_buffer.begin(), values_buffer.begin());
+    }
+    else
+    {
+      merge(keys_buffer.begin(), values_buffer.begin(), keys_first, values_first);
     }
+  };
+
+  if (sort_detail::sort_and_merge_tiles(exec, n, num_threads, sort_tile, merge_level))
+  {
+    thrust::copy(exec, keys_buffer.begin(), keys_buffer.end(), keys_first);
+    thrust::copy(exec, values_buffer.begin(), values_buffer.end(), values_first);
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
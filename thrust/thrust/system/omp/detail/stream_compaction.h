@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file stream_compaction.h
+ *  \brief Single-pass stable partitioning of a range into two outputs for the OpenMP backend.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/atomic>
+
+#include <thread>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace stream_compaction_detail
+{
+// Inputs with fewer elements than this are compacted by a single thread
+inline constexpr size_t parallel_compaction_threshold = 1 << 14;
+
+// Number of elements a thread takes at once; the predicates of a tile are kept on its stack
+inline constexpr int tile_size = 2048;
+
+// States of a tile: nothing is known yet, the number of selected elements of the tile is known, or the number of
+// selected elements up to and including the tile is known
+inline constexpr int tile_invalid   = 0;
+inline constexpr int tile_aggregate = 1;
+inline constexpr int tile_prefix    = 2;
+
+// Writes the elements first[i] of [first, first + n) with pred(stencil[i]) to selected and the others to rejected,
+// both in input order, and returns the number of selected elements.
+//
+// The input is cut into tiles the threads claim in order. A thread evaluates the predicates of its tile, publishes how
+// many elements it selects, and then looks back over the preceding tiles until it finds one whose prefix is known,
+// summing up the counts on the way. The tile is then written while it is still in cache, so the input is only read
+// from memory once.
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename Size,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename Predicate>
+Size stable_partition_copy_n(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first,
+  Size n,
+  RandomAccessIterator2 stencil,
+  RandomAccessIterator3 selected,
+  RandomAccessIterator4 rejected,
+  Predicate pred)
+{
+  if (n == 0)
+  {
+    return 0;
+  }
+
+  const Size num_tiles = ::cuda::ceil_div(n, static_cast<Size>(tile_size));
+
+  thrust::detail::temporary_array<Size, DerivedPolicy> aggregates_storage(exec, num_tiles);
+  thrust::detail::temporary_array<Size, DerivedPolicy> prefixes_storage(exec, num_tiles);
+  thrust::detail::temporary_array<int, DerivedPolicy> status_storage(exec, num_tiles);
+
+  Size* aggregates = thrust::raw_pointer_cast(aggregates_storage.data());
+  Size* prefixes   = thrust::raw_pointer_cast(prefixes_storage.data());
+  int* status      = thrust::raw_pointer_cast(status_storage.data());
+  Size next_tile   = 0;
+
+  thrust::detail::wrapped_function<Predicate, bool> wrapped_pred{pred};
+
+  THRUST_PRAGMA_OMP(parallel if (n >= static_cast<Size>(parallel_compaction_threshold)))
+  {
+    THRUST_PRAGMA_OMP(for)
+    for (Size t = 0; t < num_tiles; ++t)
+    {
+      status[t] = tile_invalid;
+    }
+
+    bool flags[tile_size];
+
+    for (Size t = ::cuda::std::atomic_ref<Size>(next_tile).fetch_add(1, ::cuda::std::memory_order_relaxed);
+         t < num_tiles;
+         t = ::cuda::std::atomic_ref<Size>(next_tile).fetch_add(1, ::cuda::std::memory_order_relaxed))
+    {
+      const Size begin = t * tile_size;
+      const Size end   = ::cuda::std::min<Size>(begin + tile_size, n);
+
+      Size count = 0;
+      for (Size i = begin; i < end; ++i)
+      {
+        flags[i - begin] = wrapped_pred(stencil[i]);
+        count += flags[i - begin];
+      }
+
+      // the tiles before t are claimed by threads that are running, so the look back terminates
+      Size prefix = 0;
+      if (t != 0)
+      {
+        aggregates[t] = count;
+        ::cuda::std::atomic_ref<int>(status[t]).store(tile_aggregate, ::cuda::std::memory_order_release);
+
+        for (Size p = t - 1;; --p)
+        {
+          int state;
+          while ((state = ::cuda::std::atomic_ref<int>(status[p]).load(::cuda::std::memory_order_acquire))
+                 == tile_invalid)
+          {
+            std::this_thread::yield();
+          }
+
+          if (state == tile_prefix)
+          {
+            prefix += prefixes[p];
+            break;
+          }
+          prefix += aggregates[p];
+        }
+      }
+
+      prefixes[t] = prefix + count;
+      ::cuda::std::atomic_ref<int>(status[t]).store(tile_prefix, ::cuda::std::memory_order_release);
+
+      Size num_selected = prefix;
+      Size num_rejected = begin - prefix;
+      for (Size i = begin; i < end; ++i)
+      {
+        if (flags[i - begin])
+        {
+          selected[num_selected++] = first[i];
+        }
+        else
+        {
+          rejected[num_rejected++] = first[i];
+        }
+      }
+    }
+  }
+
+  return prefixes[num_tiles - 1];
+}
+} // namespace stream_compaction_detail
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
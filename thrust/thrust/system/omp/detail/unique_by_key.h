@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2008-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
@@ -13,9 +13,18 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/detail/generic/unique_by_key.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/key_segments.h>
+#include <thrust/system/omp/detail/merge_path.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/unique.h>
 
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__utility/pair.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -29,7 +38,7 @@ template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIte
   ForwardIterator2 values_first,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key to cpp::unique_by_key
+  // omp prefers generic::unique_by_key to cpp::unique_by_key, which runs the parallel unique_by_key_copy below
   return thrust::system::detail::generic::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred);
 } // end unique_by_key()
 
@@ -48,6 +57,50 @@ template <typename DerivedPolicy,
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(
+    thrust::detail::depend_on_instantiation<InputIterator1, (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+    "OpenMP compiler support is not enabled");
+
+  if constexpr (merge_path_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2>)
+  {
+    using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+    const Size n          = ::cuda::std::distance(keys_first, keys_last);
+    const Size num_chunks = key_segments_detail::num_chunks(n);
+
+    if (num_chunks > 1)
+    {
+      thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, num_chunks + 1);
+
+      key_segments_detail::scan_heads(keys_first, n, num_chunks, binary_pred, offsets.begin());
+
+      // every chunk copies the segment heads it contains, skipping the tail of a segment begun by the previous chunk
+      THRUST_PRAGMA_OMP(parallel for)
+      for (Size c = 0; c < num_chunks; ++c)
+      {
+        const Size begin = key_segments_detail::chunk_begin(n, c, num_chunks);
+        const Size end   = key_segments_detail::chunk_begin(n, c + 1, num_chunks);
+        const Size head  = key_segments_detail::first_head(keys_first, begin, end, binary_pred);
+
+        thrust::unique_by_key_copy(
+          thrust::seq,
+          keys_first + head,
+          keys_first + end,
+          values_first + head,
+          keys_output + offsets[c],
+          values_output + offsets[c],
+          binary_pred);
+      }
+
+      return ::cuda::std::make_pair(keys_output + offsets[num_chunks], values_output + offsets[num_chunks]);
+    }
+  }
+
   // omp prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
   return thrust::system::detail::generic::unique_by_key_copy(
     exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
@@ -15,13 +15,13 @@
 
 #include <thrust/detail/function.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__iterator/advance.h>
 #include <cuda/std/__iterator/distance.h>
 
 #include <tbb/blocked_range.h>
-#include <tbb/parallel_scan.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -95,9 +95,18 @@ struct body
 }; // end body
 } // namespace copy_if_detail
 
-template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Predicate>
-OutputIterator
-copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil, OutputIterator result, Predicate pred)
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Predicate>
+OutputIterator copy_if(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator result,
+  Predicate pred)
 {
   using Size = thrust::detail::it_difference_t<InputIterator1>;
   using Body = typename copy_if_detail::body<InputIterator1, InputIterator2, OutputIterator, Predicate, Size>;
@@ -106,8 +115,12 @@ copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil,
 
   if (n != 0)
   {
+    using ValueType = thrust::detail::it_value_t<InputIterator1>;
+
     Body body(first, stencil, result, pred);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), body);
+    const execution_parameters params = tbb::detail::parameters(exec);
+    tbb::detail::parallel_scan(
+      params, ::tbb::blocked_range<Size>(0, n, tbb::detail::grain_size<ValueType>(params, n)), body);
     ::cuda::std::advance(result, body.sum);
   }
 
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file execution_parameters.h
+ *  \brief Applies the grain size, partitioner and arena of a TBB execution policy to the parallel loops.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+
+#include <cstddef>
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_scan.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+// Without a grain size from the policy, a task gets at least this many bytes of elements, so that scheduling it
+// costs little compared to its work ...
+inline constexpr std::size_t min_task_bytes = 16 * 1024;
+
+// ... unless that leaves fewer than this many tasks per thread to balance the load
+inline constexpr std::size_t min_tasks_per_thread = 8;
+
+template <typename DerivedPolicy>
+execution_parameters parameters(execution_policy<DerivedPolicy>& exec)
+{
+  return get_parameters(thrust::detail::derived_cast(exec));
+}
+
+// The number of threads that work on the algorithm
+inline int max_concurrency(const execution_parameters& params)
+{
+  return params.arena ? params.arena->max_concurrency() : ::tbb::this_task_arena::max_concurrency();
+}
+
+// Runs f in the arena of the policy
+template <typename Function>
+void execute(const execution_parameters& params, Function f)
+{
+  if (params.arena)
+  {
+    params.arena->execute(f);
+  }
+  else
+  {
+    f();
+  }
+}
+
+// The smallest number of elements of type T a task of a loop over n elements works on. A grain size from the policy
+// is used as given; one of at least n, which runs the loop in a single task, is only clamped to fit into Size.
+template <typename T, typename Size>
+Size grain_size(const execution_parameters& params, Size n)
+{
+  const auto size = static_cast<std::size_t>(n);
+
+  std::size_t grain = params.grain_size;
+  if (grain == 0)
+  {
+    const auto threads = static_cast<std::size_t>(::cuda::std::max(1, max_concurrency(params)));
+    grain              = ::cuda::std::min(min_task_bytes / sizeof(T), size / (min_tasks_per_thread * threads));
+  }
+  grain = ::cuda::std::min(grain, size);
+
+  return static_cast<Size>(::cuda::std::max<std::size_t>(grain, 1));
+}
+
+template <typename Range, typename Body>
+void parallel_for(const execution_parameters& params, const Range& range, const Body& body)
+{
+  tbb::detail::execute(params, [&] {
+    switch (params.partitioner)
+    {
+      case partitioner_kind::simple:
+        ::tbb::parallel_for(range, body, ::tbb::simple_partitioner());
+        break;
+      case partitioner_kind::static_:
+        ::tbb::parallel_for(range, body, ::tbb::static_partitioner());
+        break;
+      case partitioner_kind::affinity:
+        if (params.affinity)
+        {
+          ::tbb::parallel_for(range, body, *params.affinity);
+        }
+        else
+        {
+          ::tbb::affinity_partitioner affinity;
+          ::tbb::parallel_for(range, body, affinity);
+        }
+        break;
+      default:
+        ::tbb::parallel_for(range, body, ::tbb::auto_partitioner());
+        break;
+    }
+  });
+}
+
+template <typename Range, typename Body>
+void parallel_reduce(const execution_parameters& params, const Range& range, Body& body)
+{
+  tbb::detail::execute(params, [&] {
+    switch (params.partitioner)
+    {
+      case partitioner_kind::simple:
+        ::tbb::parallel_reduce(range, body, ::tbb::simple_partitioner());
+        break;
+      case partitioner_kind::static_:
+        ::tbb::parallel_reduce(range, body, ::tbb::static_partitioner());
+        break;
+      case partitioner_kind::affinity:
+        if (params.affinity)
+        {
+          ::tbb::parallel_reduce(range, body, *params.affinity);
+        }
+        else
+        {
+          ::tbb::affinity_partitioner affinity;
+          ::tbb::parallel_reduce(range, body, affinity);
+        }
+        break;
+      default:
+        ::tbb::parallel_reduce(range, body, ::tbb::auto_partitioner());
+        break;
+    }
+  });
+}
+
+// parallel_scan only takes the simple and the auto partitioner, the others fall back to the auto partitioner
+template <typename Range, typename Body>
+void parallel_scan(const execution_parameters& params, const Range& range, Body& body)
+{
+  tbb::detail::execute(params, [&] {
+    if (params.partitioner == partitioner_kind::simple)
+    {
+      ::tbb::parallel_scan(range, body, ::tbb::simple_partitioner());
+    }
+    else
+    {
+      ::tbb::parallel_scan(range, body, ::tbb::auto_partitioner());
+    }
+  });
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
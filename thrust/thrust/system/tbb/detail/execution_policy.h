@@ -16,11 +16,42 @@
 #include <thrust/system/cpp/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cstddef>
+
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb
 {
+//! \p thrust::tbb::partitioner_kind selects the TBB partitioner that splits the ranges of the parallel loops of an
+//! algorithm into tasks.
+enum class partitioner_kind
+{
+  //! \p tbb::auto_partitioner, which splits ranges adaptively down to the grain size
+  automatic,
+  //! \p tbb::simple_partitioner, which splits ranges until they are no larger than the grain size
+  simple,
+  //! \p tbb::static_partitioner, which distributes ranges evenly over the worker threads
+  static_,
+  //! \p tbb::affinity_partitioner, which replays the distribution of a previous loop to reuse the caches
+  affinity
+};
+
 namespace detail
 {
+//! The tunables an algorithm of the TBB system runs with
+struct execution_parameters
+{
+  // the smallest number of elements per task, zero selects a size from the number and the size of the elements
+  std::size_t grain_size       = 0;
+  partitioner_kind partitioner = partitioner_kind::automatic;
+  // the state of partitioner_kind::affinity, which is only reused across calls when it is owned by the caller
+  ::tbb::affinity_partitioner* affinity = nullptr;
+  // the arena to run in, the arena of the calling thread if null
+  ::tbb::task_arena* arena = nullptr;
+};
+
 // note: the tag and execution policy need to be defined in the same namespace as the algorithms for ADL to find them
 struct tag;
 
@@ -48,10 +79,94 @@ struct execution_policy : cpp::execution_policy<Derived>
   }
 };
 
+template <typename Derived>
+struct execute_with_parameters_base : execution_policy<Derived>
+{
+private:
+  execution_parameters parameters;
+
+public:
+  //! Runs the algorithm in the given arena, which limits its concurrency to the threads of the arena
+  Derived on(::tbb::task_arena& arena) const
+  {
+    Derived result          = thrust::detail::derived_cast(*this);
+    result.parameters.arena = &arena;
+    return result;
+  }
+
+  //! Sets the smallest number of elements a task of the parallel loops works on. It is used as given, and does not
+  //! change the length up to which sort runs serially
+  Derived with_grain_size(std::size_t grain_size) const
+  {
+    Derived result               = thrust::detail::derived_cast(*this);
+    result.parameters.grain_size = grain_size;
+    return result;
+  }
+
+  //! Selects the partitioner of the parallel loops
+  Derived with_partitioner(partitioner_kind partitioner) const
+  {
+    Derived result                = thrust::detail::derived_cast(*this);
+    result.parameters.partitioner = partitioner;
+    result.parameters.affinity    = nullptr;
+    return result;
+  }
+
+  //! Uses an affinity partitioner whose state is kept across the calls that share it
+  Derived with_partitioner(::tbb::affinity_partitioner& affinity) const
+  {
+    Derived result                = thrust::detail::derived_cast(*this);
+    result.parameters.partitioner = partitioner_kind::affinity;
+    result.parameters.affinity    = &affinity;
+    return result;
+  }
+
+private:
+  friend execution_parameters get_parameters(const execute_with_parameters_base& exec)
+  {
+    return exec.parameters;
+  }
+};
+
+struct execute_with_parameters : execute_with_parameters_base<execute_with_parameters>
+{};
+
+// Fallback implementation of the customization point, policies without parameters use the heuristics
+template <typename Derived>
+execution_parameters get_parameters(const execution_policy<Derived>&)
+{
+  return {};
+}
+
 struct par_t
     : execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<execution_policy>
-{};
+    , thrust::detail::allocator_aware_execution_policy<execute_with_parameters_base>
+{
+  //! Runs the algorithm in the given arena, which limits its concurrency to the threads of the arena
+  execute_with_parameters on(::tbb::task_arena& arena) const
+  {
+    return execute_with_parameters{}.on(arena);
+  }
+
+  //! Sets the smallest number of elements a task of the parallel loops works on. It is used as given, and does not
+  //! change the length up to which sort runs serially
+  execute_with_parameters with_grain_size(std::size_t grain_size) const
+  {
+    return execute_with_parameters{}.with_grain_size(grain_size);
+  }
+
+  //! Selects the partitioner of the parallel loops
+  execute_with_parameters with_partitioner(partitioner_kind partitioner) const
+  {
+    return execute_with_parameters{}.with_partitioner(partitioner);
+  }
+
+  //! Uses an affinity partitioner whose state is kept across the calls that share it
+  execute_with_parameters with_partitioner(::tbb::affinity_partitioner& affinity) const
+  {
+    return execute_with_parameters{}.with_partitioner(affinity);
+  }
+};
 } // namespace detail
 
 //! \addtogroup execution_policies
@@ -98,6 +213,15 @@ using detail::execution_policy;
 //!
 //! // 0 1 2 is printed to standard output in some unspecified order
 //! \endcode
+//!
+//! The parallel loops of the algorithms pick their grain size from the number and the size of the elements, and use
+//! \p tbb::auto_partitioner in the arena of the calling thread. \p par.on(arena), \p par.with_grain_size(n) and
+//! \p par.with_partitioner(kind) override these defaults, and can be chained and combined with an allocator:
+//!
+//! \code
+//! tbb::task_arena arena(4);
+//! thrust::sort(thrust::tbb::par(alloc).on(arena).with_grain_size(4096), vec.begin(), vec.end());
+//! \endcode
 inline constexpr detail::par_t par;
 
 //! \}
@@ -108,6 +232,7 @@ namespace tbb
 {
 using system::tbb::execution_policy;
 using system::tbb::par;
+using system::tbb::partitioner_kind;
 using system::tbb::tag;
 } // namespace tbb
 THRUST_NAMESPACE_END
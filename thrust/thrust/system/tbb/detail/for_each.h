@@ -16,12 +16,12 @@
 #include <thrust/detail/seq.h>
 #include <thrust/detail/static_assert.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__iterator/distance.h>
 
 #include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -54,9 +54,16 @@ body<RandomAccessIterator, Size, UnaryFunction> make_body(RandomAccessIterator f
 } // namespace for_each_detail
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n), for_each_detail::make_body<Size>(first, f));
+  using ValueType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const execution_parameters params = tbb::detail::parameters(exec);
+  tbb::detail::parallel_for(
+    params,
+    ::tbb::blocked_range<Size>(0, n, tbb::detail::grain_size<ValueType>(params, n)),
+    for_each_detail::make_body<Size>(first, f));
 
   // return the end of the range
   return first + n;
@@ -17,15 +17,23 @@
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
-#include <tbb/parallel_for.h>
+#include <cuda/std/__algorithm/max.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
 {
 namespace merge_detail
 {
+// A range of two elements may not split into two smaller ones, so it is never divided
+template <typename InputIterator, typename Size>
+size_t grain_size(const execution_parameters& params, Size n)
+{
+  return ::cuda::std::max<size_t>(tbb::detail::grain_size<thrust::detail::it_value_t<InputIterator>>(params, n), 2);
+}
+
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
 struct range
 {
@@ -235,7 +243,7 @@ template <typename DerivedPolicy,
           typename OutputIterator,
           typename StrictWeakOrdering>
 OutputIterator
-merge(execution_policy<DerivedPolicy>&,
+merge(execution_policy<DerivedPolicy>& exec,
       InputIterator1 first1,
       InputIterator1 last1,
       InputIterator2 first2,
@@ -245,12 +253,16 @@ merge(execution_policy<DerivedPolicy>&,
 {
   using Range = typename merge_detail::range<InputIterator1, InputIterator2, OutputIterator, StrictWeakOrdering>;
   using Body  = merge_detail::body;
-  Range range(first1, last1, first2, last2, result, comp);
+
+  const auto n = ::cuda::std::distance(first1, last1) + ::cuda::std::distance(first2, last2);
+  const execution_parameters params = tbb::detail::parameters(exec);
+
+  Range range(first1, last1, first2, last2, result, comp, merge_detail::grain_size<InputIterator1>(params, n));
   Body body;
 
-  ::tbb::parallel_for(range, body);
+  tbb::detail::parallel_for(params, range, body);
 
-  ::cuda::std::advance(result, ::cuda::std::distance(first1, last1) + ::cuda::std::distance(first2, last2));
+  ::cuda::std::advance(result, n);
 
   return result;
 } // end merge()
@@ -264,7 +276,7 @@ template <typename DerivedPolicy,
           typename OutputIterator2,
           typename StrictWeakOrdering>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_key(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator1 keys_first1,
   InputIterator1 keys_last1,
   InputIterator2 keys_first2,
@@ -285,16 +297,26 @@ template <typename DerivedPolicy,
     StrictWeakOrdering>;
   using Body = merge_by_key_detail::body;
 
+  const auto n = ::cuda::std::distance(keys_first1, keys_last1) + ::cuda::std::distance(keys_first2, keys_last2);
+  const execution_parameters params = tbb::detail::parameters(exec);
+
   Range range(
-    keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
+    keys_first1,
+    keys_last1,
+    keys_first2,
+    keys_last2,
+    values_first3,
+    values_first4,
+    keys_result,
+    values_result,
+    comp,
+    merge_detail::grain_size<InputIterator1>(params, n));
   Body body;
 
-  ::tbb::parallel_for(range, body);
+  tbb::detail::parallel_for(params, range, body);
 
-  ::cuda::std::advance(keys_result,
-                       ::cuda::std::distance(keys_first1, keys_last1) + ::cuda::std::distance(keys_first2, keys_last2));
-  ::cuda::std::advance(values_result,
-                       ::cuda::std::distance(keys_first1, keys_last1) + ::cuda::std::distance(keys_first2, keys_last2));
+  ::cuda::std::advance(keys_result, n);
+  ::cuda::std::advance(values_result, n);
 
   return ::cuda::std::make_pair(keys_result, values_result);
 }
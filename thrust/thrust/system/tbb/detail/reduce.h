@@ -20,12 +20,12 @@
 #include <thrust/detail/static_assert.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__iterator/distance.h>
 
 #include <tbb/blocked_range.h>
-#include <tbb/parallel_reduce.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -99,7 +99,11 @@ struct body
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
 OutputType reduce(
-  execution_policy<DerivedPolicy>&, InputIterator begin, InputIterator end, OutputType init, BinaryFunction binary_op)
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator begin,
+  InputIterator end,
+  OutputType init,
+  BinaryFunction binary_op)
 {
   using Size = thrust::detail::it_difference_t<InputIterator>;
 
@@ -113,7 +117,9 @@ OutputType reduce(
   {
     using Body = typename reduce_detail::body<InputIterator, OutputType, BinaryFunction>;
     Body reduce_body(begin, init, binary_op);
-    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), reduce_body);
+    const execution_parameters params = tbb::detail::parameters(exec);
+    tbb::detail::parallel_reduce(
+      params, ::tbb::blocked_range<Size>(0, n, tbb::detail::grain_size<OutputType>(params, n)), reduce_body);
     return binary_op(init, reduce_body.sum);
   }
 }
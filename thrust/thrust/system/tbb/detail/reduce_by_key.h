@@ -16,6 +16,7 @@
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/scan.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/reduce_intervals.h>
 
@@ -26,10 +27,7 @@
 #include <cuda/std/__utility/pair.h>
 #include <cuda/std/cassert>
 
-#include <thread>
-
 #include <tbb/blocked_range.h>
-#include <tbb/parallel_for.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -290,24 +288,29 @@ template <typename DerivedPolicy,
     return ::cuda::std::make_pair(keys_result, values_result);
   }
 
-  // XXX this value is a tuning opportunity
-  const difference_type parallelism_threshold = 10000;
+  using value_type = thrust::detail::it_value_t<Iterator2>;
+
+  execution_parameters params = tbb::detail::parameters(exec);
 
-  if (n < parallelism_threshold)
+  // count the number of processors
+  const difference_type p = ::cuda::std::max(1, tbb::detail::max_concurrency(params));
+
+  // generate O(P) intervals of sequential work, which are no smaller than a grain of the values unless the policy
+  // asks for a grain size
+  const difference_type max_intervals = static_cast<difference_type>(min_tasks_per_thread) * p;
+  const difference_type interval_size =
+    params.grain_size != 0
+      ? static_cast<difference_type>(params.grain_size)
+      : ::cuda::std::max<difference_type>(min_task_bytes / sizeof(value_type),
+                                          reduce_by_key_detail::divide_ri(n, max_intervals));
+
+  if (n < 2 * interval_size)
   {
-    // don't bother parallelizing for small n
+    // don't bother parallelizing a single interval
     return thrust::reduce_by_key(
       thrust::seq, keys_first, keys_last, values_first, keys_result, values_result, binary_pred, binary_op);
   }
 
-  // count the number of processors
-  const unsigned int p = ::cuda::std::max<unsigned int>(1u, std::thread::hardware_concurrency());
-
-  // generate O(P) intervals of sequential work
-  // XXX oversubscribing is a tuning opportunity
-  const unsigned int subscription_rate = 1;
-  difference_type interval_size        = ::cuda::std::min<difference_type>(
-    parallelism_threshold, ::cuda::std::max<difference_type>(n, n / (subscription_rate * p)));
   difference_type num_intervals = reduce_by_key_detail::divide_ri(n, interval_size);
 
   // decompose the input into intervals of size N / num_intervals
@@ -339,7 +342,9 @@ template <typename DerivedPolicy,
   thrust::detail::temporary_array<carry_type, DerivedPolicy> carries(0, exec, num_intervals - 1);
 
   // force grainsize == 1 with simple_partioner()
-  ::tbb::parallel_for(
+  params.partitioner = partitioner_kind::simple;
+  tbb::detail::parallel_for(
+    params,
     ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
     reduce_by_key_detail::make_serial_reduce_by_key_body(
       keys_first,
@@ -352,8 +357,7 @@ template <typename DerivedPolicy,
       interval_size,
       num_intervals,
       binary_pred,
-      binary_op),
-    ::tbb::simple_partitioner());
+      binary_op));
 
   difference_type size_of_result = interval_output_offsets[num_intervals];
 
@@ -16,13 +16,14 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
 #include <thrust/system/cpp/memory.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__type_traits/decay.h>
 #include <cuda/std/cassert>
 
-#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -85,7 +86,7 @@ template <typename DerivedPolicy,
           typename RandomAccessIterator2,
           typename BinaryFunction>
 void reduce_intervals(
-  thrust::tbb::execution_policy<DerivedPolicy>&,
+  thrust::tbb::execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator1 first,
   RandomAccessIterator1 last,
   Size interval_size,
@@ -96,9 +97,13 @@ void reduce_intervals(
 
   Size num_intervals = reduce_intervals_detail::divide_ri(n, interval_size);
 
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
-                      reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op),
-                      ::tbb::simple_partitioner());
+  // every interval is a task of its own
+  execution_parameters params = tbb::detail::parameters(exec);
+  params.partitioner          = partitioner_kind::simple;
+
+  tbb::detail::parallel_for(params,
+                            ::tbb::blocked_range<Size>(0, num_intervals, 1),
+                            reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op));
 }
 
 template <typename DerivedPolicy, typename RandomAccessIterator1, typename Size, typename RandomAccessIterator2>
@@ -19,14 +19,13 @@
 #include <thrust/detail/function.h>
 #include <thrust/detail/type_traits.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
 #include <cuda/std/__functional/invoke.h>
-#include <cuda/std/__iterator/advance.h>
 #include <cuda/std/__iterator/distance.h>
 
 #include <tbb/blocked_range.h>
-#include <tbb/parallel_scan.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
@@ -218,9 +217,13 @@ struct exclusive_body
 };
 } // namespace scan_detail
 
-template <typename InputIterator, typename OutputIterator, typename BinaryFunction>
-OutputIterator
-inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator result, BinaryFunction binary_op)
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -234,17 +237,26 @@ inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator resu
   {
     using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, false>;
     Body scan_body(first, result, binary_op, *first);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    const execution_parameters params = tbb::detail::parameters(exec);
+    tbb::detail::parallel_scan(
+      params, ::tbb::blocked_range<Size>(0, n, tbb::detail::grain_size<ValueType>(params, n)), scan_body);
   }
 
-  ::cuda::std::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
-template <typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
 OutputIterator inclusive_scan(
-  tag, InputIterator first, InputIterator last, OutputIterator result, InitialValueType init, BinaryFunction binary_op)
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -259,17 +271,26 @@ OutputIterator inclusive_scan(
   {
     using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, true>;
     Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    const execution_parameters params = tbb::detail::parameters(exec);
+    tbb::detail::parallel_scan(
+      params, ::tbb::blocked_range<Size>(0, n, tbb::detail::grain_size<ValueType>(params, n)), scan_body);
   }
 
-  ::cuda::std::advance(result, n);
-
-  return result;
+  return result + n;
 }
 
-template <typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
 OutputIterator exclusive_scan(
-  tag, InputIterator first, InputIterator last, OutputIterator result, InitialValueType init, BinaryFunction binary_op)
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
@@ -283,12 +304,12 @@ OutputIterator exclusive_scan(
   {
     using Body = typename scan_detail::exclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
     Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
+    const execution_parameters params = tbb::detail::parameters(exec);
+    tbb::detail::parallel_scan(
+      params, ::tbb::blocked_range<Size>(0, n, tbb::detail::grain_size<ValueType>(params, n)), scan_body);
   }
 
-  ::cuda::std::advance(result, n);
-
-  return result;
+  return result + n;
 }
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
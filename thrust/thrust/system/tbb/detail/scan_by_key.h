@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+/*! \file scan_by_key.h
+ *  \brief TBB implementations of scan_by_key functions.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -12,9 +16,342 @@
 #elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
 #  pragma system_header
 #endif // no system header
-
-// Ensure TBB scan is available before using generic scan_by_key
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/scan.h>
+#include <thrust/transform.h>
+#include <thrust/type_traits/is_contiguous_iterator.h>
+#include <thrust/type_traits/unwrap_contiguous_iterator.h>
+
+#include <cuda/std/__functional/not_fn.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#include <tbb/blocked_range.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace scan_by_key_detail
+{
+// Whether element i is the head of a segment, from a comparison with the key before it
+template <typename InputIterator, typename BinaryPredicate>
+struct key_head_flags
+{
+  InputIterator keys;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+
+  template <typename Size>
+  bool operator()(Size i)
+  {
+    return i == 0 || !binary_pred(keys[i - 1], keys[i]);
+  }
+};
+
+// Head flags computed beforehand, for when the output overwrites the keys
+template <typename Iterator>
+struct stored_head_flags
+{
+  Iterator flags;
+
+  template <typename Size>
+  bool operator()(Size i)
+  {
+    return flags[i] != 0;
+  }
+};
+
+// A segmented scan as a parallel_scan body. Besides the running sum, every body tracks whether it has seen any
+// element yet and whether the elements it has seen contain the head of a segment. A sum that contains a head does not
+// depend on anything to its left, so joining it with a left neighbor keeps it as is, which carries the segment
+// boundaries across the reduce and join phases.
+//
+// For the exclusive scan, the running sum of a segment starts with init, and every element receives the sum before
+// it.
+template <typename HeadFlags,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryFunction,
+          typename ValueType,
+          bool Exclusive>
+struct body
+{
+  HeadFlags is_head;
+  InputIterator values;
+  OutputIterator output;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+  ValueType init;
+  ValueType sum;
+  bool has_sum;
+  bool has_head;
+
+  body(HeadFlags is_head, InputIterator values, OutputIterator output, BinaryFunction binary_op, ValueType init)
+      : is_head(is_head)
+      , values(values)
+      , output(output)
+      , binary_op{binary_op}
+      , init(init)
+      , sum(init)
+      , has_sum(false)
+      , has_head(false)
+  {}
+
+  body(body& b, ::tbb::split)
+      : is_head(b.is_head)
+      , values(b.values)
+      , output(b.output)
+      , binary_op{b.binary_op}
+      , init(b.init)
+      , sum(b.init)
+      , has_sum(false)
+      , has_head(false)
+  {}
+
+  // the running sum of a segment that starts at element i
+  template <typename Size>
+  ValueType start_segment(Size i)
+  {
+    if constexpr (Exclusive)
+    {
+      return binary_op(init, values[i]);
+    }
+    else
+    {
+      return values[i];
+    }
+  }
+
+  template <typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::pre_scan_tag)
+  {
+    // reduce the range to the sum of its last segment, which is all that can reach the elements to its right
+    Size i              = r.begin();
+    bool local_head     = is_head(i);
+    ValueType local_sum = local_head ? start_segment(i) : ValueType(values[i]);
+
+    for (++i; i != r.end(); ++i)
+    {
+      if (is_head(i))
+      {
+        local_head = true;
+        local_sum  = start_segment(i);
+      }
+      else
+      {
+        local_sum = binary_op(local_sum, values[i]);
+      }
+    }
+
+    if (has_sum && !local_head)
+    {
+      sum = binary_op(sum, local_sum);
+    }
+    else
+    {
+      sum = local_sum;
+    }
+    has_sum  = true;
+    has_head = has_head || local_head;
+  }
+
+  // writes the result of element i and returns the running sum after it
+  template <typename Size>
+  ValueType scan_element(Size i, bool head, const ValueType& prev)
+  {
+    if constexpr (Exclusive)
+    {
+      // read the value before the output is written, which may be the same element
+      ValueType value  = values[i];
+      ValueType result = head ? init : prev;
+      output[i]        = result;
+      return binary_op(result, value);
+    }
+    else
+    {
+      ValueType result = head ? ValueType(values[i]) : binary_op(prev, values[i]);
+      output[i]        = result;
+      return result;
+    }
+  }
+
+  template <typename Size>
+  void operator()(const ::tbb::blocked_range<Size>& r, ::tbb::final_scan_tag)
+  {
+    // the running sum is kept in locals, as the output may alias the members as far as the compiler can tell
+    Size i = r.begin();
+    // a body without a sum only ever scans the range that starts at the first element
+    bool local_head     = !has_sum || is_head(i);
+    ValueType local_sum = scan_element(i, local_head, sum);
+
+    for (++i; i != r.end(); ++i)
+    {
+      const bool head = is_head(i);
+      local_head      = local_head || head;
+      local_sum       = scan_element(i, head, local_sum);
+    }
+
+    sum      = local_sum;
+    has_sum  = true;
+    has_head = has_head || local_head;
+  }
+
+  void reverse_join(body& b)
+  {
+    if (!has_sum)
+    {
+      sum      = b.sum;
+      has_sum  = b.has_sum;
+      has_head = b.has_head;
+      return;
+    }
+
+    // a sum that contains the head of a segment does not depend on the elements to its left
+    if (b.has_sum && !has_head)
+    {
+      sum = binary_op(b.sum, sum);
+    }
+    has_head = has_head || b.has_head;
+  }
+
+  void assign(body& b)
+  {
+    sum      = b.sum;
+    has_sum  = b.has_sum;
+    has_head = b.has_head;
+  }
+};
+
+// Whether writing the output may overwrite keys that are still to be compared
+template <typename InputIterator, typename OutputIterator, typename Size>
+bool output_overlaps_keys(InputIterator keys, OutputIterator output, Size n)
+{
+  if constexpr (thrust::is_contiguous_iterator_v<InputIterator> && thrust::is_contiguous_iterator_v<OutputIterator>)
+  {
+    const auto keys_begin   = reinterpret_cast<const char*>(thrust::unwrap_contiguous_iterator(keys));
+    const auto keys_end     = reinterpret_cast<const char*>(thrust::unwrap_contiguous_iterator(keys + n));
+    const auto output_begin = reinterpret_cast<const char*>(thrust::unwrap_contiguous_iterator(output));
+    const auto output_end   = reinterpret_cast<const char*>(thrust::unwrap_contiguous_iterator(output + n));
+    return output_begin < keys_end && keys_begin < output_end;
+  }
+  else if constexpr (::cuda::std::is_same_v<InputIterator, OutputIterator>)
+  {
+    return keys == output;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+template <bool Exclusive,
+          typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename ValueType,
+          typename BinaryPredicate,
+          typename AssociativeOperator>
+void scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  thrust::detail::it_difference_t<InputIterator1> n,
+  InputIterator2 first2,
+  OutputIterator result,
+  ValueType init,
+  BinaryPredicate binary_pred,
+  AssociativeOperator binary_op)
+{
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  const execution_parameters params = tbb::detail::parameters(exec);
+  const ::tbb::blocked_range<Size> range(0, n, tbb::detail::grain_size<ValueType>(params, n));
+
+  if (output_overlaps_keys(first1, result, n))
+  {
+    // the keys are compared across the boundaries of the ranges that are scanned in parallel, so flag the heads of
+    // the segments before they are overwritten
+    using HeadFlagType = ::cuda::std::uint8_t;
+    thrust::detail::temporary_array<HeadFlagType, DerivedPolicy> flags(exec, n);
+    flags[0] = 1;
+    thrust::transform(
+      exec, first1, first1 + (n - 1), first1 + 1, flags.begin() + 1, ::cuda::std::not_fn(binary_pred));
+
+    using HeadFlags = stored_head_flags<typename thrust::detail::temporary_array<HeadFlagType, DerivedPolicy>::iterator>;
+    using Body      = body<HeadFlags, InputIterator2, OutputIterator, AssociativeOperator, ValueType, Exclusive>;
+    Body scan_body(HeadFlags{flags.begin()}, first2, result, binary_op, init);
+    tbb::detail::parallel_scan(params, range, scan_body);
+  }
+  else
+  {
+    using HeadFlags = key_head_flags<InputIterator1, BinaryPredicate>;
+    using Body      = body<HeadFlags, InputIterator2, OutputIterator, AssociativeOperator, ValueType, Exclusive>;
+    Body scan_body(HeadFlags{first1, {binary_pred}}, first2, result, binary_op, init);
+    tbb::detail::parallel_scan(params, range, scan_body);
+  }
+}
+} // namespace scan_by_key_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename AssociativeOperator>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  AssociativeOperator binary_op)
+{
+  // Use the value type of the values, like the generic implementation
+  using ValueType = thrust::detail::it_value_t<InputIterator2>;
+
+  const auto n = last1 - first1;
+  if (n != 0)
+  {
+    // the inclusive scan has no initial value, the first value is only a placeholder
+    scan_by_key_detail::scan_by_key<false>(
+      exec, first1, n, first2, result, static_cast<ValueType>(*first2), binary_pred, binary_op);
+  }
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename AssociativeOperator>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  AssociativeOperator binary_op)
+{
+  const auto n = last1 - first1;
+  if (n != 0)
+  {
+    // Use the initial value type, like the generic implementation
+    scan_by_key_detail::scan_by_key<true>(exec, first1, n, first2, result, init, binary_pred, binary_op);
+  }
+
+  return result + n;
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
 
-// use generic parallel implementation
+// the overloads with default predicates and operators are generic
 #include <thrust/system/detail/generic/scan_by_key.h>
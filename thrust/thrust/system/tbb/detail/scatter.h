@@ -1,6 +1,10 @@
-// SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2008-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
+/*! \file scatter.h
+ *  \brief TBB implementation of scatter and scatter_if.
+ */
+
 #pragma once
 
 #include <thrust/detail/config.h>
@@ -13,5 +17,62 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits this algorithm
-#include <thrust/system/cpp/detail/scatter.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/scatter.h>
+#include <thrust/system/detail/internal/blocked_scatter.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__functional/identity.h>
+#include <cuda/std/__iterator/distance.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename RandomAccessIterator,
+          typename Predicate>
+void scatter_if(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 map,
+  InputIterator3 stencil,
+  RandomAccessIterator output,
+  Predicate pred)
+{
+  if constexpr (thrust::system::detail::internal::
+                  use_blocked_scatter<InputIterator1, InputIterator2, InputIterator3, RandomAccessIterator>)
+  {
+    using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+    const Size n          = ::cuda::std::distance(first, last);
+    const Size num_blocks = tbb::detail::max_concurrency(tbb::detail::parameters(exec));
+
+    if (static_cast<size_t>(n) >= thrust::system::detail::internal::blocked_scatter_threshold && num_blocks > 1)
+    {
+      thrust::system::detail::internal::blocked_scatter_if(exec, first, n, map, stencil, output, pred, num_blocks);
+      return;
+    }
+  }
+
+  // small scatters run on tbb::for_each through generic::scatter_if
+  thrust::system::detail::generic::scatter_if(exec, first, last, map, stencil, output, pred);
+} // end scatter_if()
+
+template <typename DerivedPolicy, typename InputIterator1, typename InputIterator2, typename RandomAccessIterator>
+void scatter(execution_policy<DerivedPolicy>& exec,
+             InputIterator1 first,
+             InputIterator1 last,
+             InputIterator2 map,
+             RandomAccessIterator output)
+{
+  tbb::detail::scatter_if(
+    exec, first, last, map, thrust::make_constant_iterator(true), output, ::cuda::std::identity{});
+} // end scatter()
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
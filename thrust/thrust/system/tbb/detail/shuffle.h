@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file shuffle.h
+ *  \brief TBB implementation of shuffle_copy.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/detail/generic/shuffle.h>
+#include <thrust/system/detail/internal/blocked_shuffle.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/__utility/forward.h>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+template <typename DerivedPolicy, typename RandomIterator, typename OutputIterator, typename URBG>
+void shuffle_copy(
+  execution_policy<DerivedPolicy>& exec, RandomIterator first, RandomIterator last, OutputIterator result, URBG&& g)
+{
+  if constexpr (thrust::system::detail::internal::use_blocked_shuffle<RandomIterator, OutputIterator>)
+  {
+    const auto m          = static_cast<std::uint64_t>(last - first);
+    const auto num_blocks = static_cast<std::uint64_t>(tbb::detail::max_concurrency(tbb::detail::parameters(exec)));
+
+    if (m >= thrust::system::detail::internal::blocked_shuffle_threshold && num_blocks > 1)
+    {
+      thrust::system::detail::internal::blocked_shuffle_copy(
+        exec, first, m, result, ::cuda::std::forward<URBG>(g), num_blocks);
+      return;
+    }
+  }
+
+  // small shuffles compact the bijection with a scan through generic::shuffle_copy
+  thrust::system::detail::generic::shuffle_copy(exec, first, last, result, ::cuda::std::forward<URBG>(g));
+} // end shuffle_copy()
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -1,4 +1,4 @@
-// SPDX-FileCopyrightText: Copyright (c) 2008-2013, NVIDIA Corporation. All rights reserved.
+// SPDX-FileCopyrightText: Copyright (c) 2008-2026, NVIDIA Corporation. All rights reserved.
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
@@ -18,19 +18,89 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/tbb/detail/execution_parameters.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cuda/std/__algorithm/max.h>
 #include <cuda/std/__iterator/distance.h>
 
+#include <tbb/blocked_range.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb::detail
 {
+namespace radix_sort_detail
+{
+// Primitive keys sorted with a default comparator are radix sorted in parallel from this many elements on
+inline constexpr size_t threshold = 1 << 16;
+
+template <typename KeyType, typename StrictWeakOrdering>
+inline constexpr bool use_radix_sort =
+  thrust::system::detail::sequential::sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering>;
+
+template <typename KeyType, typename StrictWeakOrdering>
+inline constexpr bool descending =
+  thrust::system::detail::sequential::sort_detail::needs_reverse<KeyType, StrictWeakOrdering>;
+
+// Runs f(b) for every block b of a parallel_radix_sort as its own task
+struct for_each_block
+{
+  execution_parameters params;
+
+  template <typename Size, typename Function>
+  void operator()(Size num_blocks, Function f) const
+  {
+    // force grainsize == 1 with simple_partitioner()
+    execution_parameters block_params = params;
+    block_params.partitioner          = partitioner_kind::simple;
+
+    tbb::detail::parallel_for(
+      block_params,
+      ::tbb::blocked_range<Size>(0, num_blocks, 1),
+      [=](const ::tbb::blocked_range<Size>& r) {
+        for (Size b = r.begin(); b < r.end(); ++b)
+        {
+          f(b);
+        }
+      });
+  }
+};
+
+// Calls sort(num_blocks, for_each_block) to radix sort n elements with one block per worker thread. Returns false
+// without calling sort if the input is too small or there is only a single worker.
+template <typename DerivedPolicy, typename Size, typename Sort>
+bool radix_sort(execution_policy<DerivedPolicy>& exec, Size n, Sort sort)
+{
+  const execution_parameters params = tbb::detail::parameters(exec);
+  const Size num_blocks             = tbb::detail::max_concurrency(params);
+
+  if (static_cast<size_t>(n) < threshold || num_blocks <= 1)
+  {
+    return false;
+  }
+
+  sort(num_blocks, for_each_block{params});
+
+  return true;
+}
+} // end namespace radix_sort_detail
+
 namespace sort_detail
 {
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
+// A merge sort sorts subsequences of at most this many bytes of elements serially
+inline constexpr size_t serial_bytes = 512 * 1024;
+
+// The length from which a merge sort of elements of the types Ts splits its input into two parallel tasks. It does
+// not depend on the grain size of the policy, which sizes the tasks of the parallel loops, such as the merges. A single
+// element is never split.
+template <typename... Ts>
+constexpr size_t threshold()
+{
+  return ::cuda::std::max<size_t>(serial_bytes / (sizeof(Ts) + ...), 2);
+}
 
 template <typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 void merge_sort(execution_policy<DerivedPolicy>& exec,
@@ -82,7 +152,7 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 
   difference_type n = ::cuda::std::distance(first1, last1);
 
-  if (n < threshold)
+  if (static_cast<size_t>(n) < threshold<thrust::detail::it_value_t<Iterator1>>())
   {
     thrust::stable_sort(thrust::seq, first1, last1, comp);
 
@@ -118,9 +188,6 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 
 namespace sort_by_key_detail
 {
-// TODO tune this based on data type and comp
-const static int threshold = 128 * 1024;
-
 template <typename DerivedPolicy,
           typename Iterator1,
           typename Iterator2,
@@ -205,7 +272,8 @@ void merge_sort_by_key(
   Iterator2 last2 = first2 + n;
   Iterator3 last3 = first3 + n;
 
-  if (n < threshold)
+  if (static_cast<size_t>(n)
+      < sort_detail::threshold<thrust::detail::it_value_t<Iterator1>, thrust::detail::it_value_t<Iterator2>>())
   {
     thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
 
@@ -243,9 +311,26 @@ void stable_sort(
 {
   using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
+  if constexpr (radix_sort_detail::use_radix_sort<key_type, StrictWeakOrdering>)
+  {
+    constexpr bool descending = radix_sort_detail::descending<key_type, StrictWeakOrdering>;
+
+    const auto n = ::cuda::std::distance(first, last);
+
+    if (radix_sort_detail::radix_sort(exec, n, [&](decltype(n) num_blocks, auto for_each_block) {
+          thrust::system::detail::internal::parallel_radix_sort<descending>(exec, first, n, num_blocks, for_each_block);
+        }))
+    {
+      return;
+    }
+  }
+
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
-  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  // the tasks of the merge sort run in the arena of the policy
+  tbb::detail::execute(tbb::detail::parameters(exec), [&] {
+    sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  });
 }
 
 template <typename DerivedPolicy,
@@ -262,12 +347,30 @@ void stable_sort_by_key(
   using key_type = thrust::detail::it_value_t<RandomAccessIterator1>;
   using val_type = thrust::detail::it_value_t<RandomAccessIterator2>;
 
+  if constexpr (radix_sort_detail::use_radix_sort<key_type, StrictWeakOrdering>)
+  {
+    constexpr bool descending = radix_sort_detail::descending<key_type, StrictWeakOrdering>;
+
+    const auto n = ::cuda::std::distance(first1, last1);
+
+    if (radix_sort_detail::radix_sort(exec, n, [&](decltype(n) num_blocks, auto for_each_block) {
+          thrust::system::detail::internal::parallel_radix_sort_by_key<descending>(
+            exec, first1, first2, n, num_blocks, for_each_block);
+        }))
+    {
+      return;
+    }
+  }
+
   RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
 
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
   thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
 
-  sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+  // the tasks of the merge sort run in the arena of the policy
+  tbb::detail::execute(tbb::detail::parameters(exec), [&] {
+    sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+  });
 }
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
@@ -13,5 +13,8 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits transform_scan
-#include <thrust/system/cpp/detail/transform_scan.h>
+// Ensure TBB scan is available before using generic transform_scan
+#include <thrust/system/tbb/detail/scan.h>
+
+// use generic parallel implementation, which runs the TBB scan over a transform_iterator
+#include <thrust/system/detail/generic/transform_scan.h>